@@ -0,0 +1,41 @@
+/*
+ * Converts the binary data files written by the bbob observer with the option "format: binary" to the
+ * text files that the bbob observer writes by default, so that they can be used by the post-processing.
+ *
+ * Usage: bbob_binary_to_text FILE.bin [FILE.bin ...]
+ *
+ * Each file FILE.bin is converted to FILE (for example, bbobexp_f1_DIM2_i1.dat.bin is converted to
+ * bbobexp_f1_DIM2_i1.dat). Existing text files are overwritten.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "coco.h"
+
+int main(int argc, char *argv[]) {
+
+  const char *extension = ".bin";
+  char *text_file_name;
+  size_t length;
+  int i;
+
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s FILE.bin [FILE.bin ...]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  for (i = 1; i < argc; i++) {
+    length = strlen(argv[i]);
+    if ((length <= strlen(extension)) || (strcmp(argv[i] + length - strlen(extension), extension) != 0)) {
+      fprintf(stderr, "Skipping %s (the file name does not end with %s)\n", argv[i], extension);
+      continue;
+    }
+    text_file_name = coco_strdupf("%s", argv[i]);
+    text_file_name[length - strlen(extension)] = '\0';
+    coco_bbob_binary_to_text(argv[i], text_file_name);
+    coco_free_memory(text_file_name);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,26 @@
+/*
+ * Merges the result folders of runs of the bbob or bbob-biobj observers on the batches of a suite (see the
+ * suite option "batch: K/N") into a single result folder, which can be post-processed as if the experiment
+ * had been run at once.
+ *
+ * Usage: merge_result_folders TARGET FOLDER [FOLDER ...]
+ *
+ * The folder TARGET must not exist. The ".info" files with the same name are merged and all other files
+ * are copied.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "coco.h"
+
+int main(int argc, char *argv[]) {
+
+  if (argc < 3) {
+    fprintf(stderr, "Usage: %s TARGET FOLDER [FOLDER ...]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  coco_merge_result_folders(argv[1], (size_t) (argc - 2), (const char **) &argv[2]);
+
+  return EXIT_SUCCESS;
+}
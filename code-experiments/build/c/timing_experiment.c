@@ -0,0 +1,76 @@
+/*
+ * The timing experiment of the BBOB methodology: measures the time per function evaluation of random
+ * search on the Rosenbrock function (f8) of the bbob suite in all dimensions, with and without the bbob
+ * observer. Replace my_random_search with your optimizer to time it.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "coco.h"
+
+/*
+ * The budget of each run is dimension * BUDGET evaluations
+ */
+static const size_t BUDGET = 1000;
+
+/*
+ * The minimal time in seconds spent in each dimension (with and without the observer)
+ */
+static const double MIN_SECONDS = 30;
+
+/**
+ * A random search algorithm that can be used for single- as well as multi-objective optimization.
+ */
+void my_random_search(coco_problem_t *problem) {
+
+  coco_random_state_t *rng = coco_random_new(0xdeadbeef);
+  const double *lbounds = coco_problem_get_smallest_values_of_interest(problem);
+  const double *ubounds = coco_problem_get_largest_values_of_interest(problem);
+  size_t dimension = coco_problem_get_dimension(problem);
+  size_t number_of_objectives = coco_problem_get_number_of_objectives(problem);
+  double *x = coco_allocate_vector(dimension);
+  double *y = coco_allocate_vector(number_of_objectives);
+  double range;
+  size_t i, j;
+
+  size_t max_budget = dimension * BUDGET;
+
+  for (i = 0; i < max_budget; ++i) {
+
+    /* Construct x as a random point between the lower and upper bounds */
+    for (j = 0; j < dimension; ++j) {
+      range = ubounds[j] - lbounds[j];
+      x[j] = lbounds[j] + coco_random_uniform(rng) * range;
+    }
+
+    coco_evaluate_function(problem, x, y);
+
+  }
+
+  coco_random_free(rng);
+  coco_free_memory(x);
+  coco_free_memory(y);
+}
+
+/*
+ * The main method runs the timing experiment and writes its results to the file timing_experiment.txt in
+ * the folder timing_experiment_bbob.
+ */
+int main(void) {
+
+  coco_suite_t *suite;
+
+  printf("Running the timing experiment... (it takes time, be patient)\n");
+  fflush(stdout);
+
+  coco_set_log_level("info");
+
+  suite = coco_suite("bbob", "", "dimensions: 2,3,5,10,20,40 function_idx: 8");
+  coco_timing_experiment(suite, my_random_search, MIN_SECONDS);
+  coco_suite_free(suite);
+
+  printf("Done!\n");
+
+  fflush(stdout);
+  return 0;
+}
@@ -28,12 +28,32 @@ public class Benchmark {
 			if (problemPointer == 0)
 				return null;
 			
-			return new Problem(problemPointer);
+			return new Problem(problemPointer, observer.getPointer() != 0);
 		} catch (Exception e) {
 			throw new Exception("Fetching of next problem failed.\n" + e.toString());
 		}
 	}
 	
+	/**
+	 * Runs the timing experiment on the suite: for each dimension of the suite, the optimizer is run
+	 * repeatedly on the first instance of each function of the suite until at least minSeconds have
+	 * passed, first without and then with the default observer of the suite. The seconds per function
+	 * evaluation are written to the file timing_experiment.txt in the folder timing_experiment_SUITENAME.
+	 * The problems passed to the optimizer are freed when the optimizer returns.
+	 * @param suite
+	 * @param optimizer
+	 * @param minSeconds
+	 * @throws Exception
+	 */
+	public static void timingExperiment(Suite suite, Optimizer optimizer, double minSeconds) throws Exception {
+
+		try {
+			CocoJNI.cocoTimingExperiment(suite.getPointer(), optimizer, minSeconds);
+		} catch (Exception e) {
+			throw new Exception("Timing experiment failed.\n" + e.toString());
+		}
+	}
+
 	/**
 	 * Finalizes the observer and suite. This method needs to be explicitly called in order to log 
 	 * the last results.
@@ -85,6 +85,268 @@ JNIEXPORT void JNICALL Java_CocoJNI_cocoFinalizeObserver
   return;
 }
 
+/*
+ * Class:     CocoJNI
+ * Method:    cocoObserverMemoryGetNumberOfResults
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_CocoJNI_cocoObserverMemoryGetNumberOfResults
+(JNIEnv *jenv, jclass interface_cls, jlong jobserver_pointer) {
+
+  coco_observer_t *observer = NULL;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoObserverMemoryGetNumberOfResults\n");
+  }
+
+  observer = (coco_observer_t *) jobserver_pointer;
+  return (jint) coco_observer_memory_get_number_of_results(observer);
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoObserverMemoryGetProblemId
+ * Signature: (JI)Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_CocoJNI_cocoObserverMemoryGetProblemId
+(JNIEnv *jenv, jclass interface_cls, jlong jobserver_pointer, jint jresult_index) {
+
+  coco_observer_t *observer = NULL;
+  const char *result;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoObserverMemoryGetProblemId\n");
+  }
+
+  observer = (coco_observer_t *) jobserver_pointer;
+  result = coco_observer_memory_get_problem_id(observer, (size_t) jresult_index);
+
+  /* Prepare the return value */
+  return (*jenv)->NewStringUTF(jenv, result);
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoObserverMemoryGetEvaluations
+ * Signature: (JI)J
+ */
+JNIEXPORT jlong JNICALL Java_CocoJNI_cocoObserverMemoryGetEvaluations
+(JNIEnv *jenv, jclass interface_cls, jlong jobserver_pointer, jint jresult_index) {
+
+  coco_observer_t *observer = NULL;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoObserverMemoryGetEvaluations\n");
+  }
+
+  observer = (coco_observer_t *) jobserver_pointer;
+  return (jlong) coco_observer_memory_get_evaluations(observer, (size_t) jresult_index);
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoObserverMemoryGetBestValue
+ * Signature: (JI)D
+ */
+JNIEXPORT jdouble JNICALL Java_CocoJNI_cocoObserverMemoryGetBestValue
+(JNIEnv *jenv, jclass interface_cls, jlong jobserver_pointer, jint jresult_index) {
+
+  coco_observer_t *observer = NULL;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoObserverMemoryGetBestValue\n");
+  }
+
+  observer = (coco_observer_t *) jobserver_pointer;
+  return (jdouble) coco_observer_memory_get_best_value(observer, (size_t) jresult_index);
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoObserverMemoryGetBestSolution
+ * Signature: (JI)[D
+ */
+JNIEXPORT jdoubleArray JNICALL Java_CocoJNI_cocoObserverMemoryGetBestSolution
+(JNIEnv *jenv, jclass interface_cls, jlong jobserver_pointer, jint jresult_index) {
+
+  coco_observer_t *observer = NULL;
+  const double *result;
+  size_t number_of_variables;
+  jdoubleArray jresult;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoObserverMemoryGetBestSolution\n");
+  }
+
+  observer = (coco_observer_t *) jobserver_pointer;
+  result = coco_observer_memory_get_best_solution(observer, (size_t) jresult_index, &number_of_variables);
+
+  /* Prepare the return value */
+  jresult = (*jenv)->NewDoubleArray(jenv, (jsize) number_of_variables);
+  if (number_of_variables > 0)
+    (*jenv)->SetDoubleArrayRegion(jenv, jresult, 0, (jsize) number_of_variables, result);
+  return jresult;
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoObserverMemoryGetTargets
+ * Signature: (JI)[D
+ */
+JNIEXPORT jdoubleArray JNICALL Java_CocoJNI_cocoObserverMemoryGetTargets
+(JNIEnv *jenv, jclass interface_cls, jlong jobserver_pointer, jint jresult_index) {
+
+  coco_observer_t *observer = NULL;
+  const double *result;
+  size_t number_of_targets;
+  jdoubleArray jresult;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoObserverMemoryGetTargets\n");
+  }
+
+  observer = (coco_observer_t *) jobserver_pointer;
+  result = coco_observer_memory_get_targets(observer, (size_t) jresult_index, &number_of_targets);
+
+  /* Prepare the return value */
+  jresult = (*jenv)->NewDoubleArray(jenv, (jsize) number_of_targets);
+  if (number_of_targets > 0)
+    (*jenv)->SetDoubleArrayRegion(jenv, jresult, 0, (jsize) number_of_targets, result);
+  return jresult;
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoObserverMemoryGetTargetHits
+ * Signature: (JI)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_CocoJNI_cocoObserverMemoryGetTargetHits
+(JNIEnv *jenv, jclass interface_cls, jlong jobserver_pointer, jint jresult_index) {
+
+  coco_observer_t *observer = NULL;
+  const size_t *result;
+  size_t number_of_targets, i;
+  jlong *values;
+  jlongArray jresult;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoObserverMemoryGetTargetHits\n");
+  }
+
+  observer = (coco_observer_t *) jobserver_pointer;
+  result = coco_observer_memory_get_target_hits(observer, (size_t) jresult_index, &number_of_targets);
+
+  /* Prepare the return value */
+  jresult = (*jenv)->NewLongArray(jenv, (jsize) number_of_targets);
+  if (number_of_targets > 0) {
+    values = (jlong *) coco_allocate_memory(number_of_targets * sizeof(jlong));
+    for (i = 0; i < number_of_targets; i++)
+      values[i] = (jlong) result[i];
+    (*jenv)->SetLongArrayRegion(jenv, jresult, 0, (jsize) number_of_targets, values);
+    coco_free_memory(values);
+  }
+  return jresult;
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoObserverMemoryGetTrajectoryEvaluations
+ * Signature: (JI)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_CocoJNI_cocoObserverMemoryGetTrajectoryEvaluations
+(JNIEnv *jenv, jclass interface_cls, jlong jobserver_pointer, jint jresult_index) {
+
+  coco_observer_t *observer = NULL;
+  const size_t *evaluations;
+  size_t length, i;
+  jlong *values;
+  jlongArray jresult;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoObserverMemoryGetTrajectoryEvaluations\n");
+  }
+
+  observer = (coco_observer_t *) jobserver_pointer;
+  length = coco_observer_memory_get_trajectory(observer, (size_t) jresult_index, &evaluations, NULL);
+
+  /* Prepare the return value */
+  jresult = (*jenv)->NewLongArray(jenv, (jsize) length);
+  if (length > 0) {
+    values = (jlong *) coco_allocate_memory(length * sizeof(jlong));
+    for (i = 0; i < length; i++)
+      values[i] = (jlong) evaluations[i];
+    (*jenv)->SetLongArrayRegion(jenv, jresult, 0, (jsize) length, values);
+    coco_free_memory(values);
+  }
+  return jresult;
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoObserverMemoryGetTrajectoryValues
+ * Signature: (JI)[D
+ */
+JNIEXPORT jdoubleArray JNICALL Java_CocoJNI_cocoObserverMemoryGetTrajectoryValues
+(JNIEnv *jenv, jclass interface_cls, jlong jobserver_pointer, jint jresult_index) {
+
+  coco_observer_t *observer = NULL;
+  const double *values;
+  size_t length;
+  jdoubleArray jresult;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoObserverMemoryGetTrajectoryValues\n");
+  }
+
+  observer = (coco_observer_t *) jobserver_pointer;
+  length = coco_observer_memory_get_trajectory(observer, (size_t) jresult_index, NULL, &values);
+
+  /* Prepare the return value */
+  jresult = (*jenv)->NewDoubleArray(jenv, (jsize) length);
+  if (length > 0)
+    (*jenv)->SetDoubleArrayRegion(jenv, jresult, 0, (jsize) length, values);
+  return jresult;
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoObserverMemoryClear
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_CocoJNI_cocoObserverMemoryClear
+(JNIEnv *jenv, jclass interface_cls, jlong jobserver_pointer) {
+
+  coco_observer_t *observer = NULL;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoObserverMemoryClear\n");
+  }
+
+  observer = (coco_observer_t *) jobserver_pointer;
+  coco_observer_memory_clear(observer);
+  return;
+}
+
 /*
  * Class:     CocoJNI
  * Method:    cocoGetSuite
@@ -134,6 +396,253 @@ JNIEXPORT void JNICALL Java_CocoJNI_cocoFinalizeSuite
   return;
 }
 
+/**
+ * Returns the number of problems of the suite that have not been filtered out by the suite options.
+ */
+static jsize suite_count_problems(coco_suite_t *suite) {
+
+  size_t index;
+  jsize count = 0;
+
+  for (index = 0; index < coco_suite_get_number_of_problems(suite); index++) {
+    if (coco_suite_get_problem_metadata(suite, index, NULL, NULL, NULL, NULL))
+      count++;
+  }
+  return count;
+}
+
+/**
+ * Returns the ids (if names is 0) or names (if names is 1) of all problems of the suite as an array of
+ * Java strings without constructing the problems.
+ */
+static jobjectArray suite_get_problem_strings(JNIEnv *jenv, coco_suite_t *suite, const int names) {
+
+  const char *problem_id, *problem_name;
+  size_t index;
+  jsize i = 0;
+  jclass string_cls;
+  jobjectArray jresult;
+  jstring jstring_value;
+
+  string_cls = (*jenv)->FindClass(jenv, "java/lang/String");
+  jresult = (*jenv)->NewObjectArray(jenv, suite_count_problems(suite), string_cls, NULL);
+  if (jresult == NULL)
+    return NULL;
+  for (index = 0; index < coco_suite_get_number_of_problems(suite); index++) {
+    if (!coco_suite_get_problem_metadata(suite, index, &problem_id, &problem_name, NULL, NULL))
+      continue;
+    jstring_value = (*jenv)->NewStringUTF(jenv, names ? problem_name : problem_id);
+    (*jenv)->SetObjectArrayElement(jenv, jresult, i++, jstring_value);
+    (*jenv)->DeleteLocalRef(jenv, jstring_value);
+  }
+  return jresult;
+}
+
+/**
+ * Returns the dimensions (if objectives is 0) or numbers of objectives (if objectives is 1) of all problems
+ * of the suite as an array of Java ints without constructing the problems.
+ */
+static jintArray suite_get_problem_sizes(JNIEnv *jenv, coco_suite_t *suite, const int objectives) {
+
+  size_t index, dimension, number_of_objectives;
+  jsize number_of_problems, i = 0;
+  jint *values;
+  jintArray jresult;
+
+  number_of_problems = suite_count_problems(suite);
+  jresult = (*jenv)->NewIntArray(jenv, number_of_problems);
+  if ((jresult == NULL) || (number_of_problems == 0))
+    return jresult;
+  values = (jint *) coco_allocate_memory((size_t) number_of_problems * sizeof(jint));
+  for (index = 0; index < coco_suite_get_number_of_problems(suite); index++) {
+    if (coco_suite_get_problem_metadata(suite, index, NULL, NULL, &dimension, &number_of_objectives))
+      values[i++] = (jint) (objectives ? number_of_objectives : dimension);
+  }
+  (*jenv)->SetIntArrayRegion(jenv, jresult, 0, number_of_problems, values);
+  coco_free_memory(values);
+  return jresult;
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoSuiteGetProblemIndices
+ * Signature: (J)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_CocoJNI_cocoSuiteGetProblemIndices
+(JNIEnv *jenv, jclass interface_cls, jlong jsuite_pointer) {
+
+  coco_suite_t *suite = NULL;
+  size_t index;
+  jsize number_of_problems, i = 0;
+  jlong *values;
+  jlongArray jresult;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoSuiteGetProblemIndices\n");
+  }
+
+  suite = (coco_suite_t *) jsuite_pointer;
+  number_of_problems = suite_count_problems(suite);
+
+  /* Prepare the return value */
+  jresult = (*jenv)->NewLongArray(jenv, number_of_problems);
+  if (number_of_problems > 0) {
+    values = (jlong *) coco_allocate_memory((size_t) number_of_problems * sizeof(jlong));
+    for (index = 0; index < coco_suite_get_number_of_problems(suite); index++) {
+      if (coco_suite_get_problem_metadata(suite, index, NULL, NULL, NULL, NULL))
+        values[i++] = (jlong) index;
+    }
+    (*jenv)->SetLongArrayRegion(jenv, jresult, 0, number_of_problems, values);
+    coco_free_memory(values);
+  }
+  return jresult;
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoSuiteGetProblemIds
+ * Signature: (J)[Ljava/lang/String;
+ */
+JNIEXPORT jobjectArray JNICALL Java_CocoJNI_cocoSuiteGetProblemIds
+(JNIEnv *jenv, jclass interface_cls, jlong jsuite_pointer) {
+
+  coco_suite_t *suite = NULL;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoSuiteGetProblemIds\n");
+  }
+
+  suite = (coco_suite_t *) jsuite_pointer;
+  return suite_get_problem_strings(jenv, suite, 0);
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoSuiteGetProblemNames
+ * Signature: (J)[Ljava/lang/String;
+ */
+JNIEXPORT jobjectArray JNICALL Java_CocoJNI_cocoSuiteGetProblemNames
+(JNIEnv *jenv, jclass interface_cls, jlong jsuite_pointer) {
+
+  coco_suite_t *suite = NULL;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoSuiteGetProblemNames\n");
+  }
+
+  suite = (coco_suite_t *) jsuite_pointer;
+  return suite_get_problem_strings(jenv, suite, 1);
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoSuiteGetProblemDimensions
+ * Signature: (J)[I
+ */
+JNIEXPORT jintArray JNICALL Java_CocoJNI_cocoSuiteGetProblemDimensions
+(JNIEnv *jenv, jclass interface_cls, jlong jsuite_pointer) {
+
+  coco_suite_t *suite = NULL;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoSuiteGetProblemDimensions\n");
+  }
+
+  suite = (coco_suite_t *) jsuite_pointer;
+  return suite_get_problem_sizes(jenv, suite, 0);
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoSuiteGetProblemNumbersOfObjectives
+ * Signature: (J)[I
+ */
+JNIEXPORT jintArray JNICALL Java_CocoJNI_cocoSuiteGetProblemNumbersOfObjectives
+(JNIEnv *jenv, jclass interface_cls, jlong jsuite_pointer) {
+
+  coco_suite_t *suite = NULL;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoSuiteGetProblemNumbersOfObjectives\n");
+  }
+
+  suite = (coco_suite_t *) jsuite_pointer;
+  return suite_get_problem_sizes(jenv, suite, 1);
+}
+
+/* The state of the running timing experiment used by timing_experiment_optimizer() */
+static JNIEnv *timing_experiment_jenv = NULL;
+static jobject timing_experiment_joptimizer = NULL;
+static jclass timing_experiment_problem_cls = NULL;
+static jmethodID timing_experiment_problem_constructor = NULL;
+static jmethodID timing_experiment_optimize = NULL;
+
+/**
+ * Calls the method optimize of the Java optimizer with a new Java Problem wrapping the problem (the problem
+ * is freed by the timing experiment when this function returns). Does nothing after an exception occurred.
+ */
+static void timing_experiment_optimizer(coco_problem_t *problem) {
+
+  JNIEnv *jenv = timing_experiment_jenv;
+  jobject jproblem;
+
+  if ((*jenv)->ExceptionCheck(jenv))
+    return;
+  jproblem = (*jenv)->NewObject(jenv, timing_experiment_problem_cls, timing_experiment_problem_constructor,
+      (jlong) problem);
+  if (jproblem == NULL)
+    return;
+  (*jenv)->CallVoidMethod(jenv, timing_experiment_joptimizer, timing_experiment_optimize, jproblem);
+  (*jenv)->DeleteLocalRef(jenv, jproblem);
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoTimingExperiment
+ * Signature: (JLOptimizer;D)V
+ */
+JNIEXPORT void JNICALL Java_CocoJNI_cocoTimingExperiment
+(JNIEnv *jenv, jclass interface_cls, jlong jsuite_pointer, jobject joptimizer, jdouble jmin_seconds) {
+
+  coco_suite_t *suite = NULL;
+  jclass optimizer_cls;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoTimingExperiment\n");
+  }
+
+  timing_experiment_problem_cls = (*jenv)->FindClass(jenv, "Problem");
+  if (timing_experiment_problem_cls == NULL)
+    return;
+  timing_experiment_problem_constructor = (*jenv)->GetMethodID(jenv, timing_experiment_problem_cls, "<init>",
+      "(J)V");
+  optimizer_cls = (*jenv)->GetObjectClass(jenv, joptimizer);
+  timing_experiment_optimize = (*jenv)->GetMethodID(jenv, optimizer_cls, "optimize", "(LProblem;)V");
+  if ((timing_experiment_problem_constructor == NULL) || (timing_experiment_optimize == NULL))
+    return;
+
+  timing_experiment_jenv = jenv;
+  timing_experiment_joptimizer = joptimizer;
+  suite = (coco_suite_t *) jsuite_pointer;
+  coco_timing_experiment(suite, timing_experiment_optimizer, jmin_seconds);
+
+  timing_experiment_jenv = NULL;
+  timing_experiment_joptimizer = NULL;
+  return;
+}
+
 /*
  * Class:     CocoJNI
  * Method:    cocoGetNextProblem
@@ -199,6 +708,116 @@ JNIEXPORT jdoubleArray JNICALL Java_CocoJNI_cocoEvaluateFunction
   (*jenv)->ReleaseDoubleArrayElements(jenv, jx, x, JNI_ABORT);
   return jy;
 }
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoEvaluateBatch
+ * Signature: (JLjava/nio/DoubleBuffer;ILjava/nio/DoubleBuffer;)V
+ *
+ * Evaluates the number_of_solutions points stored one after another in the direct buffer jx and writes
+ * the results one after another into the direct buffer jy. The buffers are accessed in place, so that
+ * nothing is copied or allocated.
+ */
+JNIEXPORT void JNICALL Java_CocoJNI_cocoEvaluateBatch
+(JNIEnv *jenv, jclass interface_cls, jlong jproblem_pointer, jobject jx, jint jnumber_of_solutions,
+    jobject jy) {
+
+  coco_problem_t *problem = NULL;
+  double *x = NULL;
+  double *y = NULL;
+  size_t number_of_solutions;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoEvaluateBatch\n");
+  }
+
+  problem = (coco_problem_t *) jproblem_pointer;
+  number_of_solutions = (size_t) jnumber_of_solutions;
+
+  x = (double *) (*jenv)->GetDirectBufferAddress(jenv, jx);
+  y = (double *) (*jenv)->GetDirectBufferAddress(jenv, jy);
+  if ((x == NULL) || (y == NULL) || (jnumber_of_solutions < 0)
+      || ((size_t) (*jenv)->GetDirectBufferCapacity(jenv, jx)
+          < number_of_solutions * coco_problem_get_dimension(problem))
+      || ((size_t) (*jenv)->GetDirectBufferCapacity(jenv, jy)
+          < number_of_solutions * coco_problem_get_number_of_objectives(problem))) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/IllegalArgumentException");
+    (*jenv)->ThrowNew(jenv, Exception, "cocoEvaluateBatch(): the buffers are not direct or too small\n");
+    return;
+  }
+
+  coco_evaluate_population(problem, x, number_of_solutions, y);
+}
+
+/*
+ * Class:     CocoJNI
+ * Method:    cocoEvaluateBatchArray
+ * Signature: (J[DI[DLjava/nio/DoubleBuffer;)V
+ *
+ * Evaluates the number_of_solutions points stored one after another in the array jx and writes the
+ * results one after another into the array jy.
+ *
+ * If jbuffer is NULL (for problems without observer), the arrays are pinned (not copied) by
+ * GetPrimitiveArrayCritical, which delays garbage collections until the evaluation is done. Otherwise the
+ * evaluation may write the output of the observer, which must not happen in a critical region, so that
+ * the points are copied into the direct buffer jbuffer of the problem, which is evaluated in place, and the
+ * results are copied out of it.
+ */
+JNIEXPORT void JNICALL Java_CocoJNI_cocoEvaluateBatchArray
+(JNIEnv *jenv, jclass interface_cls, jlong jproblem_pointer, jdoubleArray jx, jint jnumber_of_solutions,
+    jdoubleArray jy, jobject jbuffer) {
+
+  coco_problem_t *problem = NULL;
+  double *x = NULL;
+  double *y = NULL;
+  size_t number_of_solutions, x_size, y_size;
+
+  /* This test is both to prevent warning because interface_cls was not used and to check for exceptions */
+  if (interface_cls == NULL) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/Exception");
+    (*jenv)->ThrowNew(jenv, Exception, "Exception in cocoEvaluateBatchArray\n");
+  }
+
+  problem = (coco_problem_t *) jproblem_pointer;
+  number_of_solutions = (size_t) jnumber_of_solutions;
+  x_size = number_of_solutions * coco_problem_get_dimension(problem);
+  y_size = number_of_solutions * coco_problem_get_number_of_objectives(problem);
+
+  if ((jnumber_of_solutions < 0)
+      || ((size_t) (*jenv)->GetArrayLength(jenv, jx) < x_size)
+      || ((size_t) (*jenv)->GetArrayLength(jenv, jy) < y_size)) {
+    jclass Exception = (*jenv)->FindClass(jenv, "java/lang/IllegalArgumentException");
+    (*jenv)->ThrowNew(jenv, Exception, "cocoEvaluateBatchArray(): the arrays are too small\n");
+    return;
+  }
+
+  if (jbuffer != NULL) {
+    x = (double *) (*jenv)->GetDirectBufferAddress(jenv, jbuffer);
+    if ((x == NULL) || ((size_t) (*jenv)->GetDirectBufferCapacity(jenv, jbuffer) < x_size + y_size)) {
+      jclass Exception = (*jenv)->FindClass(jenv, "java/lang/IllegalArgumentException");
+      (*jenv)->ThrowNew(jenv, Exception, "cocoEvaluateBatchArray(): the buffer is not direct or too small\n");
+      return;
+    }
+    y = x + x_size;
+    (*jenv)->GetDoubleArrayRegion(jenv, jx, 0, (jsize) x_size, x);
+    coco_evaluate_population(problem, x, number_of_solutions, y);
+    (*jenv)->SetDoubleArrayRegion(jenv, jy, 0, (jsize) y_size, y);
+    return;
+  }
+
+  /* No other JNI functions may be called between getting and releasing the critical arrays */
+  x = (double *) (*jenv)->GetPrimitiveArrayCritical(jenv, jx, NULL);
+  y = (double *) (*jenv)->GetPrimitiveArrayCritical(jenv, jy, NULL);
+  if ((x != NULL) && (y != NULL))
+    coco_evaluate_population(problem, x, number_of_solutions, y);
+  if (y != NULL)
+    (*jenv)->ReleasePrimitiveArrayCritical(jenv, jy, y, 0);
+  if (x != NULL)
+    (*jenv)->ReleasePrimitiveArrayCritical(jenv, jx, x, JNI_ABORT);
+}
+
 /*
  * Class:     CocoJNI
  * Method:    cocoEvaluateConstraint
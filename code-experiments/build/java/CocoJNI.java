@@ -1,3 +1,5 @@
+import java.nio.DoubleBuffer;
+
 /**
  * This class contains the declaration of all the CocoJNI functions. 
  */
@@ -14,16 +16,34 @@ public class CocoJNI {
 	// Observer
 	public static native long cocoGetObserver(String observerName, String observerOptions);
 	public static native void cocoFinalizeObserver(long ObserverPointer);
+	public static native int cocoObserverMemoryGetNumberOfResults(long observerPointer);
+	public static native String cocoObserverMemoryGetProblemId(long observerPointer, int resultIndex);
+	public static native long cocoObserverMemoryGetEvaluations(long observerPointer, int resultIndex);
+	public static native double cocoObserverMemoryGetBestValue(long observerPointer, int resultIndex);
+	public static native double[] cocoObserverMemoryGetBestSolution(long observerPointer, int resultIndex);
+	public static native double[] cocoObserverMemoryGetTargets(long observerPointer, int resultIndex);
+	public static native long[] cocoObserverMemoryGetTargetHits(long observerPointer, int resultIndex);
+	public static native long[] cocoObserverMemoryGetTrajectoryEvaluations(long observerPointer, int resultIndex);
+	public static native double[] cocoObserverMemoryGetTrajectoryValues(long observerPointer, int resultIndex);
+	public static native void cocoObserverMemoryClear(long observerPointer);
 
 	// Suite
 	public static native long cocoGetSuite(String suiteName, String suiteInstance, String suiteOptions);
 	public static native void cocoFinalizeSuite(long SuitePointer);
+	public static native void cocoTimingExperiment(long suitePointer, Optimizer optimizer, double minSeconds);
+	public static native long[] cocoSuiteGetProblemIndices(long suitePointer);
+	public static native String[] cocoSuiteGetProblemIds(long suitePointer);
+	public static native String[] cocoSuiteGetProblemNames(long suitePointer);
+	public static native int[] cocoSuiteGetProblemDimensions(long suitePointer);
+	public static native int[] cocoSuiteGetProblemNumbersOfObjectives(long suitePointer);
 
 	// Problem
 	public static native long cocoGetNextProblem(long suitePointer, long ObserverPointer);
 
 	// Functions
 	public static native double[] cocoEvaluateFunction(long problemPointer, double[] x);
+	public static native void cocoEvaluateBatch(long problemPointer, DoubleBuffer x, int numberOfSolutions, DoubleBuffer y);
+	public static native void cocoEvaluateBatchArray(long problemPointer, double[] x, int numberOfSolutions, double[] y, DoubleBuffer buffer);
 	public static native double[] cocoEvaluateConstraint(long problemPointer, double[] x);
 
 	// Getters
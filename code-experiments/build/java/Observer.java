@@ -36,6 +36,51 @@ public class Observer {
 	public long getPointer() {
 		return this.pointer;
 	}
+
+	/* Results of the memory observer (or of the memory observer within the multi observer) */
+	public int getNumberOfMemoryResults() {
+		return CocoJNI.cocoObserverMemoryGetNumberOfResults(this.pointer);
+	}
+
+	public String getMemoryProblemId(int resultIndex) {
+		return CocoJNI.cocoObserverMemoryGetProblemId(this.pointer, resultIndex);
+	}
+
+	public long getMemoryEvaluations(int resultIndex) {
+		return CocoJNI.cocoObserverMemoryGetEvaluations(this.pointer, resultIndex);
+	}
+
+	public double getMemoryBestValue(int resultIndex) {
+		return CocoJNI.cocoObserverMemoryGetBestValue(this.pointer, resultIndex);
+	}
+
+	public double[] getMemoryBestSolution(int resultIndex) {
+		return CocoJNI.cocoObserverMemoryGetBestSolution(this.pointer, resultIndex);
+	}
+
+	public double[] getMemoryTargets(int resultIndex) {
+		return CocoJNI.cocoObserverMemoryGetTargets(this.pointer, resultIndex);
+	}
+
+	/**
+	 * Returns the evaluations in which the targets were first hit (0 if a target was not hit).
+	 * @param resultIndex
+	 */
+	public long[] getMemoryTargetHits(int resultIndex) {
+		return CocoJNI.cocoObserverMemoryGetTargetHits(this.pointer, resultIndex);
+	}
+
+	public long[] getMemoryTrajectoryEvaluations(int resultIndex) {
+		return CocoJNI.cocoObserverMemoryGetTrajectoryEvaluations(this.pointer, resultIndex);
+	}
+
+	public double[] getMemoryTrajectoryValues(int resultIndex) {
+		return CocoJNI.cocoObserverMemoryGetTrajectoryValues(this.pointer, resultIndex);
+	}
+
+	public void clearMemoryResults() {
+		CocoJNI.cocoObserverMemoryClear(this.pointer);
+	}
 	
 	public String getName() {
 		return this.name;
@@ -0,0 +1,12 @@
+/**
+ * An optimization algorithm that can be run on a problem, for example in the timing experiment (see
+ * Benchmark.timingExperiment).
+ */
+public interface Optimizer {
+
+	/**
+	 * Optimizes the given problem.
+	 * @param problem
+	 */
+	public void optimize(Problem problem);
+}
@@ -1,3 +1,7 @@
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+
 /**
  * The problem contains some basic properties of the coco_problem_t structure that can be accessed
  * through its getter functions.
@@ -18,12 +22,25 @@ public class Problem {
 	
 	private long index;
 
+	private boolean observed;
+	private DoubleBuffer batch_buffer; // The native buffer of evaluateBatch(double[], int, double[])
+
 	/**
-	 * Constructs the problem from the pointer.
+	 * Constructs the problem from the pointer, assuming that the problem is observed.
 	 * @param pointer pointer to the coco_problem_t object
 	 * @throws Exception
 	 */
 	public Problem(long pointer) throws Exception {
+		this(pointer, true);
+	}
+
+	/**
+	 * Constructs the problem from the pointer.
+	 * @param pointer pointer to the coco_problem_t object
+	 * @param observed whether the problem is observed
+	 * @throws Exception
+	 */
+	public Problem(long pointer, boolean observed) throws Exception {
 
 		super();
 		try {		
@@ -40,6 +57,8 @@ public class Problem {
 			this.index = CocoJNI.cocoProblemGetIndex(pointer);
 			
 			this.pointer = pointer;
+			this.observed = observed;
+			this.batch_buffer = null;
 		} catch (Exception e) {
 			throw new Exception("Problem constructor failed.\n" + e.toString());
 		}
@@ -54,6 +73,43 @@ public class Problem {
 		return CocoJNI.cocoEvaluateFunction(this.pointer, x);
 	}
 
+	/**
+	 * Evaluates the function in numberOfSolutions points stored one after another in x and writes the
+	 * results one after another into y without any allocation. Both buffers must be direct and in the
+	 * native byte order, e.g., ByteBuffer.allocateDirect(8 * n).order(ByteOrder.nativeOrder()).asDoubleBuffer(),
+	 * and are read and written from their beginning, independently of their positions.
+	 * @param x the points (at least numberOfSolutions * dimension values)
+	 * @param numberOfSolutions
+	 * @param y the results (at least numberOfSolutions * numberOfObjectives values)
+	 */
+	public void evaluateBatch(DoubleBuffer x, int numberOfSolutions, DoubleBuffer y) {
+		if (!x.isDirect() || !y.isDirect() || (x.order() != ByteOrder.nativeOrder())
+				|| (y.order() != ByteOrder.nativeOrder()))
+			throw new IllegalArgumentException("evaluateBatch() requires direct buffers in the native byte order");
+		CocoJNI.cocoEvaluateBatch(this.pointer, x, numberOfSolutions, y);
+	}
+
+	/**
+	 * Evaluates the function in numberOfSolutions points stored one after another in x and writes the
+	 * results one after another into y. Without observer, the arrays are accessed in place, i.e., without
+	 * copies and allocations, but the garbage collector may be paused while the points are evaluated.
+	 * Otherwise the observer may write its output during the evaluation, so that the points and results
+	 * are copied through a native buffer of the problem, which is only reallocated for larger batches.
+	 * @param x the points (at least numberOfSolutions * dimension values)
+	 * @param numberOfSolutions
+	 * @param y the results (at least numberOfSolutions * numberOfObjectives values)
+	 */
+	public void evaluateBatch(double[] x, int numberOfSolutions, double[] y) {
+		if (!this.observed) {
+			CocoJNI.cocoEvaluateBatchArray(this.pointer, x, numberOfSolutions, y, null);
+			return;
+		}
+		int size = numberOfSolutions * (this.dimension + this.number_of_objectives);
+		if ((this.batch_buffer == null) || (this.batch_buffer.capacity() < size))
+			this.batch_buffer = ByteBuffer.allocateDirect(8 * size).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+		CocoJNI.cocoEvaluateBatchArray(this.pointer, x, numberOfSolutions, y, this.batch_buffer);
+	}
+
 	/**
 	 * Evaluates the constraint in point x and returns the result as an array of doubles. 
 	 * @param x
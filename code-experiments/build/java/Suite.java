@@ -3,6 +3,13 @@ public class Suite {
 	private long pointer; // Pointer to the coco_suite_t object
 	private String name;
 
+	// Metadata of the problems of the suite (collected without constructing the problems)
+	private long[] problemIndices;
+	private String[] problemIds;
+	private String[] problemNames;
+	private int[] dimensions;
+	private int[] numbersOfObjectives;
+
 	/**
 	 * Constructs the suite from the given suiteName, suiteInstance and suiteOptions.
 	 * TODO: Copy explanation of options from the C code
@@ -17,6 +24,11 @@ public class Suite {
 		try {
 			this.pointer = CocoJNI.cocoGetSuite(suiteName, suiteInstance, suiteOptions);
 			this.name = suiteName;
+			this.problemIndices = CocoJNI.cocoSuiteGetProblemIndices(this.pointer);
+			this.problemIds = CocoJNI.cocoSuiteGetProblemIds(this.pointer);
+			this.problemNames = CocoJNI.cocoSuiteGetProblemNames(this.pointer);
+			this.dimensions = CocoJNI.cocoSuiteGetProblemDimensions(this.pointer);
+			this.numbersOfObjectives = CocoJNI.cocoSuiteGetProblemNumbersOfObjectives(this.pointer);
 		} catch (Exception e) {
 			throw new Exception("Suite constructor failed.\n" + e.toString());
 		}
@@ -42,6 +54,38 @@ public class Suite {
 		return this.name;
 	}
 
+	/**
+	 * Returns the number of problems in the suite (without the ones filtered out by the suite options).
+	 */
+	public int getNumberOfProblems() {
+		return this.problemIndices.length;
+	}
+
+	/**
+	 * Returns the indices of the problems in the suite in the order in which they are returned by
+	 * Benchmark.getNextProblem (the i-th entries of the arrays returned by the following getters belong to
+	 * the same problem).
+	 */
+	public long[] getProblemIndices() {
+		return this.problemIndices;
+	}
+
+	public String[] getProblemIds() {
+		return this.problemIds;
+	}
+
+	public String[] getProblemNames() {
+		return this.problemNames;
+	}
+
+	public int[] getDimensions() {
+		return this.dimensions;
+	}
+
+	public int[] getNumbersOfObjectives() {
+		return this.numbersOfObjectives;
+	}
+
 	/* toString method */
 	@Override
 	public String toString() {
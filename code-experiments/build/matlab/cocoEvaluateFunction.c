@@ -8,7 +8,13 @@
 
 #include "mex.h"
 
-/* The gateway function */
+/* The gateway function
+ *
+ * Evaluates the problem in x, which is either a single point (a vector of dim values) or a dim x n matrix
+ * whose n columns are the points. The result is a 1 x m row vector for a single point and an m x n matrix
+ * whose columns are the m objective values of the points otherwise. The columns of a MATLAB matrix are
+ * stored one after another, so that all points are evaluated by one call of coco_evaluate_population(...).
+ */
 void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[])
 {
     size_t *ref;
@@ -16,6 +22,7 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[])
     coco_problem_t *problem = NULL;
     /* const char *class_name = NULL; */
     int nb_objectives;
+    size_t dimension, nb_rows, nb_points;
     double *x;
     double *y;
 
@@ -30,12 +37,24 @@ void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[])
     if(!mxIsDouble(prhs[1])) {
         mexErrMsgIdAndTxt("cocoEvaluateFunction:notDoubleArray","Input x must be an array of doubles.");
     }
-    /* get the x vector */
+    /* get the x vector or matrix */
     x = mxGetPr(prhs[1]);
-    /* prepare the return value */
+    dimension = coco_problem_get_dimension(problem);
+    nb_rows = (size_t)mxGetM(prhs[1]);
+    nb_points = (size_t)mxGetN(prhs[1]);
     nb_objectives = coco_problem_get_number_of_objectives(problem);
-    plhs[0] = mxCreateDoubleMatrix(1, (size_t)nb_objectives, mxREAL);
-    y = mxGetPr(plhs[0]);
-    /* call coco_evaluate_function(...) */
-    coco_evaluate_function(problem, x, y);
+    if ((size_t)mxGetNumberOfElements(prhs[1]) == dimension) {
+        /* a single point: prepare the return value and call coco_evaluate_function(...) */
+        plhs[0] = mxCreateDoubleMatrix(1, (size_t)nb_objectives, mxREAL);
+        y = mxGetPr(plhs[0]);
+        coco_evaluate_function(problem, x, y);
+    } else if ((mxGetNumberOfDimensions(prhs[1]) == 2) && (nb_rows == dimension)) {
+        /* the columns of a matrix: prepare the return value and call coco_evaluate_population(...) */
+        plhs[0] = mxCreateDoubleMatrix((size_t)nb_objectives, nb_points, mxREAL);
+        y = mxGetPr(plhs[0]);
+        coco_evaluate_population(problem, x, nb_points, y);
+    } else {
+        mexErrMsgIdAndTxt("cocoEvaluateFunction:dimension",
+                "Input x must be a vector of dim values or a dim x n matrix.");
+    }
 }
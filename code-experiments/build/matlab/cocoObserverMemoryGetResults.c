@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <stdlib.h>
+
+#include "coco.h"
+#include "coco.c"
+
+#include "mex.h"
+
+/* Returns a row vector with the n given values */
+static mxArray *double_row(const double *values, size_t n)
+{
+    mxArray *res = mxCreateDoubleMatrix(1, (mwSize)n, mxREAL);
+    double *v = mxGetPr(res);
+    size_t i;
+    for (i = 0; i < n; i++){
+        v[i] = values[i];
+    }
+    return res;
+}
+
+/* Returns a row vector with the n given evaluation numbers */
+static mxArray *evaluations_row(const size_t *values, size_t n)
+{
+    mxArray *res = mxCreateDoubleMatrix(1, (mwSize)n, mxREAL);
+    double *v = mxGetPr(res);
+    size_t i;
+    for (i = 0; i < n; i++){
+        v[i] = (double)values[i];
+    }
+    return res;
+}
+
+/* The gateway function */
+void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[])
+{
+    size_t *ref;
+    coco_observer_t *observer = NULL;
+    const char *field_names[] = {"id", "evaluations", "best_value", "best_solution", "targets",
+                                 "target_hits", "trajectory_evaluations", "trajectory_values"};
+    size_t number_of_results, i, n;
+    const double *values;
+    const size_t *evaluations;
+
+    /* check for proper number of arguments */
+    if(nrhs!=1) {
+        mexErrMsgIdAndTxt("cocoObserverMemoryGetResults:nrhs","One input required.");
+    }
+    /* get the observer */
+    ref = (size_t *)mxGetData(prhs[0]);
+    observer = (coco_observer_t *)(*ref);
+
+    /* prepare the return value: a struct array with one element for each observed problem */
+    number_of_results = coco_observer_memory_get_number_of_results(observer);
+    plhs[0] = mxCreateStructMatrix(1, (mwSize)number_of_results, 8, field_names);
+    for (i = 0; i < number_of_results; i++){
+        mxSetField(plhs[0], (mwIndex)i, "id", mxCreateString(coco_observer_memory_get_problem_id(observer, i)));
+        mxSetField(plhs[0], (mwIndex)i, "evaluations",
+                mxCreateDoubleScalar((double)coco_observer_memory_get_evaluations(observer, i)));
+        mxSetField(plhs[0], (mwIndex)i, "best_value",
+                mxCreateDoubleScalar(coco_observer_memory_get_best_value(observer, i)));
+        values = coco_observer_memory_get_best_solution(observer, i, &n);
+        mxSetField(plhs[0], (mwIndex)i, "best_solution", double_row(values, n));
+        values = coco_observer_memory_get_targets(observer, i, &n);
+        mxSetField(plhs[0], (mwIndex)i, "targets", double_row(values, n));
+        evaluations = coco_observer_memory_get_target_hits(observer, i, &n);
+        mxSetField(plhs[0], (mwIndex)i, "target_hits", evaluations_row(evaluations, n));
+        n = coco_observer_memory_get_trajectory(observer, i, &evaluations, &values);
+        mxSetField(plhs[0], (mwIndex)i, "trajectory_evaluations", evaluations_row(evaluations, n));
+        mxSetField(plhs[0], (mwIndex)i, "trajectory_values", double_row(values, n));
+    }
+}
@@ -0,0 +1,51 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <stdlib.h>
+
+#include "coco.h"
+#include "coco.c"
+
+#include "mex.h"
+
+/* The gateway function */
+void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[])
+{
+    size_t *ref;
+    coco_suite_t *suite = NULL;
+    const char *field_names[] = {"index", "id", "name", "dimension", "number_of_objectives"};
+    const char *problem_id, *problem_name;
+    size_t number_of_problems, number_of_entries, problem_index, dimension, number_of_objectives;
+
+    /* check for proper number of arguments */
+    if(nrhs!=1) {
+        mexErrMsgIdAndTxt("cocoSuiteGetProblemMetadata:nrhs","One input required.");
+    }
+    /* get the suite */
+    ref = (size_t *)mxGetData(prhs[0]);
+    suite = (coco_suite_t *)(*ref);
+
+    /* count the problems that are not filtered out (without constructing them) */
+    number_of_problems = coco_suite_get_number_of_problems(suite);
+    number_of_entries = 0;
+    for (problem_index = 0; problem_index < number_of_problems; problem_index++){
+        if (coco_suite_get_problem_metadata(suite, problem_index, NULL, NULL, NULL, NULL))
+            number_of_entries++;
+    }
+
+    /* prepare the return value: a struct array with one element for each problem of the suite */
+    plhs[0] = mxCreateStructMatrix(1, (mwSize)number_of_entries, 5, field_names);
+    number_of_entries = 0;
+    for (problem_index = 0; problem_index < number_of_problems; problem_index++){
+        if (!coco_suite_get_problem_metadata(suite, problem_index, &problem_id, &problem_name, &dimension,
+                &number_of_objectives))
+            continue;
+        mxSetField(plhs[0], (mwIndex)number_of_entries, "index", mxCreateDoubleScalar((double)problem_index));
+        mxSetField(plhs[0], (mwIndex)number_of_entries, "id", mxCreateString(problem_id));
+        mxSetField(plhs[0], (mwIndex)number_of_entries, "name", mxCreateString(problem_name));
+        mxSetField(plhs[0], (mwIndex)number_of_entries, "dimension", mxCreateDoubleScalar((double)dimension));
+        mxSetField(plhs[0], (mwIndex)number_of_entries, "number_of_objectives",
+                mxCreateDoubleScalar((double)number_of_objectives));
+        number_of_entries++;
+    }
+}
@@ -0,0 +1,61 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <stdlib.h>
+
+#include "coco.h"
+#include "coco.c"
+
+#include "mex.h"
+
+/* The optimizer of the running timing experiment and the first error it raised */
+static mxArray *timing_optimizer = NULL;
+static mxArray *timing_exception = NULL;
+
+/* Calls the MATLAB optimizer on the problem (freed by the timing experiment when the optimizer returns) */
+static void timing_experiment_optimizer(coco_problem_t *problem)
+{
+    mxArray *args[2];
+    size_t *ref;
+
+    if (timing_exception != NULL) {
+        return;
+    }
+    args[0] = timing_optimizer;
+    args[1] = mxCreateNumericMatrix(1, 1, mxINT64_CLASS, mxREAL);
+    ref = (size_t *)mxGetData(args[1]);
+    *ref = (size_t)problem;
+    timing_exception = mexCallMATLABWithTrap(0, NULL, 2, args, "feval");
+    mxDestroyArray(args[1]);
+}
+
+/* The gateway function */
+void mexFunction(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[])
+{
+    size_t *ref;
+    coco_suite_t *suite = NULL;
+    double min_seconds;
+    mxArray *exception;
+
+    /* check for proper number of arguments */
+    if(nrhs!=3) {
+        mexErrMsgIdAndTxt("cocoTimingExperiment:nrhs","Three inputs required.");
+    }
+    /* get the suite */
+    ref = (size_t *)mxGetData(prhs[0]);
+    suite = (coco_suite_t *)(*ref);
+    /* get the optimizer (a function handle or name) and the minimal time */
+    timing_optimizer = (mxArray *)prhs[1];
+    min_seconds = mxGetScalar(prhs[2]);
+
+    timing_exception = NULL;
+    coco_timing_experiment(suite, timing_experiment_optimizer, min_seconds);
+    timing_optimizer = NULL;
+
+    /* raise the error of the optimizer again */
+    if (timing_exception != NULL) {
+        exception = timing_exception;
+        timing_exception = NULL;
+        mexCallMATLAB(0, NULL, 1, &exception, "rethrow");
+    }
+}
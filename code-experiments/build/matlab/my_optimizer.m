@@ -1,9 +1,13 @@
 function my_optimizer (f, lower_bounds, upper_bounds, budget)
     n = length(lower_bounds);
     delta = upper_bounds - lower_bounds;
-    for i= 1:budget
-        x = lower_bounds + normrnd(zeros(1, n), 1) .* delta;
-        y = cocoEvaluateFunction(f, x);
+    % the points are the columns of n x chunk_size matrices, each of which
+    % cocoEvaluateFunction evaluates in a single call; the chunks keep the
+    % memory bounded for large budgets
+    chunk_size = 1000;
+    for i = 1:chunk_size:budget
+        m = min(chunk_size, budget - i + 1);
+        X = repmat(lower_bounds(:), 1, m) + normrnd(zeros(n, m), 1) .* repmat(delta(:), 1, m);
+        Y = cocoEvaluateFunction(f, X);
     end
 end
-
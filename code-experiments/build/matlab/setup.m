@@ -7,6 +7,7 @@
 %mkoctfile --mex -Dchar16_t=uint16_t cocoProblemFree.c
 %mkoctfile --mex -Dchar16_t=uint16_t cocoObserver.c
 %mkoctfile --mex -Dchar16_t=uint16_t cocoObserverFree.c
+%mkoctfile --mex -Dchar16_t=uint16_t cocoObserverMemoryGetResults.c
 %mkoctfile --mex -Dchar16_t=uint16_t cocoProblemGetDimension.c
 %mkoctfile --mex -Dchar16_t=uint16_t cocoProblemGetEvaluations.c
 %mkoctfile --mex -Dchar16_t=uint16_t cocoProblemGetId.c
@@ -17,6 +18,8 @@
 %mkoctfile --mex -Dchar16_t=uint16_t cocoProblemIsValid.c
 %mkoctfile --mex -Dchar16_t=uint16_t cocoSuiteGetProblem.c
 %mkoctfile --mex -Dchar16_t=uint16_t cocoSuiteGetNextProblemIndex.c
+%mkoctfile --mex -Dchar16_t=uint16_t cocoSuiteGetProblemMetadata.c
+%mkoctfile --mex -Dchar16_t=uint16_t cocoTimingExperiment.c
 
 
 
@@ -28,9 +31,11 @@ more off; % turn off page-wise output
 tocompilecoco = {'cocoSuite.c', ...
                  'cocoSuiteFree.c', ...
                  'cocoSuiteGetNextProblem.c', ...
+                 'cocoSuiteGetProblemMetadata.c', ...
                  'cocoEvaluateFunction.c', ...
                  'cocoObserver.c', ...
                  'cocoObserverFree.c', ...
+                 'cocoObserverMemoryGetResults.c', ...
                  'cocoProblemGetDimension.c', ...
                  'cocoProblemGetEvaluations.c', ...
                  'cocoProblemGetId.c', ...
@@ -38,7 +43,8 @@ tocompilecoco = {'cocoSuite.c', ...
                  'cocoProblemGetName.c', ...
                  'cocoProblemGetNumberOfObjectives.c', ...
                  'cocoProblemGetSmallestValuesOfInterest.c', ...
-                 'cocoProblemIsValid.c'};
+                 'cocoProblemIsValid.c', ...
+                 'cocoTimingExperiment.c'};
 
 for i = 1:length(tocompilecoco)
     printf('compiling %s...', tocompilecoco{i});
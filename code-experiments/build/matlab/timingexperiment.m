@@ -0,0 +1,20 @@
+% This script runs the timing experiment of the BBOB methodology: it measures
+% the time per function evaluation of random search on the Rosenbrock function
+% (f8) of the 'bbob' suite with and without the observer. The results are
+% written to timing_experiment_bbob/timing_experiment.txt.
+
+more on; % to get immediate output in Octave
+
+BUDGET = 1000; % algorithm runs for BUDGET*dimension funevals
+MIN_SECONDS = 30; % minimal time spent in each dimension
+
+disp('Running the timing experiment... (it takes time, be patient)');
+
+suite = cocoSuite('bbob', '', 'dimensions: 2,3,5,10,20,40 function_idx: 8');
+optimizer = @(problem) my_optimizer(problem, ...
+    cocoProblemGetSmallestValuesOfInterest(problem), ...
+    cocoProblemGetLargestValuesOfInterest(problem), ...
+    BUDGET*cocoProblemGetDimension(problem));
+cocoTimingExperiment(suite, optimizer, MIN_SECONDS);
+cocoSuiteFree(suite);
+disp('Done!');
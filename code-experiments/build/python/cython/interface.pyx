@@ -1,9 +1,14 @@
 # -*- mode: cython -*-
-#cython: c_string_type=str, c_string_encoding=ascii
+#cython: c_string_type=str, c_string_encoding=ascii, language_level=2
 from __future__ import absolute_import, division, print_function, unicode_literals
+import os
 import sys
 import numpy as np
 cimport numpy as np
+from libc.stdlib cimport malloc, free as _free_memory
+from libc.string cimport memcpy
+from cpython.pythread cimport (PyThread_type_lock, PyThread_allocate_lock,
+    PyThread_free_lock, PyThread_acquire_lock, PyThread_release_lock, WAIT_LOCK)
 
 from cocoex.exceptions import InvalidProblemException, NoSuchProblemException, NoSuchSuiteException
 
@@ -30,12 +35,28 @@ cdef extern from "coco.h":
     coco_problem_t *coco_problem_add_observer(coco_problem_t *problem, 
                                               coco_observer_t *observer)    
 
+    size_t coco_observer_memory_get_number_of_results(coco_observer_t *observer)
+    const char *coco_observer_memory_get_problem_id(coco_observer_t *observer, size_t result_index)
+    size_t coco_observer_memory_get_evaluations(coco_observer_t *observer, size_t result_index)
+    double coco_observer_memory_get_best_value(coco_observer_t *observer, size_t result_index)
+    const double *coco_observer_memory_get_best_solution(coco_observer_t *observer, size_t result_index,
+                                                         size_t *number_of_variables)
+    const double *coco_observer_memory_get_targets(coco_observer_t *observer, size_t result_index,
+                                                   size_t *number_of_targets)
+    const size_t *coco_observer_memory_get_target_hits(coco_observer_t *observer, size_t result_index,
+                                                       size_t *number_of_targets)
+    size_t coco_observer_memory_get_trajectory(coco_observer_t *observer, size_t result_index,
+                                               const size_t **evaluations, const double **values)
+    void coco_observer_memory_clear(coco_observer_t *observer)
+
     coco_suite_t *coco_suite(const char *suite_name, const char *suite_instance, 
                              const char *suite_options)
     void coco_suite_free(coco_suite_t *suite)
     void coco_problem_free(coco_problem_t *problem)
 
-    void coco_evaluate_function(coco_problem_t *problem, double *x, double *y)
+    void coco_evaluate_function(coco_problem_t *problem, double *x, double *y) nogil
+    void coco_evaluate_population(coco_problem_t *problem, const double *x,
+                                  size_t number_of_solutions, double *y) nogil
     void coco_evaluate_constraint(coco_problem_t *problem, const double *x, double *y)
     void coco_recommend_solutions(coco_problem_t *problem, 
                                   const double *x,
@@ -43,6 +64,14 @@ cdef extern from "coco.h":
                                   
     coco_problem_t* coco_suite_get_next_problem(coco_suite_t*, coco_observer_t*)
     coco_problem_t* coco_suite_get_problem(coco_suite_t *, size_t)
+    size_t coco_suite_get_number_of_problems(coco_suite_t *suite)
+    int coco_suite_get_problem_metadata(coco_suite_t *suite, size_t problem_index,
+                                        const char **problem_id, const char **problem_name,
+                                        size_t *dimension, size_t *number_of_objectives)
+    void coco_timing_experiment(coco_suite_t *suite, void (*optimizer)(coco_problem_t *),
+                                double min_seconds)
+    void coco_merge_result_folders(const char *target_folder, size_t number_of_folders,
+                                   const char **folders)
 
     size_t coco_problem_get_suite_dep_index(coco_problem_t* )
     size_t coco_problem_get_dimension(coco_problem_t *problem)
@@ -175,11 +204,14 @@ cdef class Suite:
         self._initialize()
         assert self.initialized
     cdef _initialize(self):
-        """sweeps through `suite` to collect indices and id's to operate by
-        direct access in the remainder"""
+        """collects the indices, id's, names, dimensions and numbers of
+        objectives of all problems of `suite` (without constructing the
+        problems) to operate by direct access in the remainder"""
         cdef np.npy_intp shape[1]  # probably completely useless
         cdef coco_suite_t* suite
-        cdef coco_problem_t* p
+        cdef const char* problem_id
+        cdef const char* problem_name
+        cdef size_t index, dimension, number_of_objectives
         if self.initialized:
             self.reset()
         self._ids = []
@@ -206,17 +238,18 @@ also report back a missing name to https://github.com/numbbo/coco/issues
             raise NoSuchSuiteException("No suite with name '%s' found" % self._name)
         if suite == NULL:
             raise NoSuchSuiteException("No suite with name '%s' found" % self._name)
-        while True:
-            p = coco_suite_get_next_problem(suite, NULL)
-            if not p:
-                break
-            self._indices.append(coco_problem_get_suite_dep_index(p))
-            self._ids.append(coco_problem_get_id(p))
-            self._names.append(coco_problem_get_name(p))
-            self._dimensions.append(coco_problem_get_dimension(p))
-            self._number_of_objectives.append(coco_problem_get_number_of_objectives(p))
-        coco_suite_free(suite)
-        self.suite = coco_suite(self._name, self._instance, self._options)
+        for index in range(coco_suite_get_number_of_problems(suite)):
+            if not coco_suite_get_problem_metadata(suite, index, &problem_id, &problem_name,
+                                                   &dimension, &number_of_objectives):
+                continue  # filtered out by the suite options
+            self._indices.append(index)
+            self._ids.append(problem_id)
+            self._names.append(problem_name)
+            self._dimensions.append(dimension)
+            self._number_of_objectives.append(number_of_objectives)
+        if self.suite:
+            coco_suite_free(self.suite)
+        self.suite = suite
         self.initialized = True
         return self
     def reset(self):
@@ -305,6 +338,43 @@ also report back a missing name to https://github.com/numbbo/coco/issues
         if self.suite:
             coco_suite_free(self.suite)
 
+    def timing_experiment(self, optimizer, min_seconds=30):
+        """`timing_experiment(optimizer, min_seconds=30)` measures the seconds
+        per function evaluation of `optimizer` with and without an observer.
+
+        For each dimension of the suite, `optimizer(problem)` is called
+        repeatedly on the first instance of each function of the suite until
+        at least `min_seconds` have passed, first on the plain problems and
+        then on the problems observed by the default observer of the suite.
+        The results are written to the file ``timing_experiment.txt`` in the
+        folder ``timing_experiment_<suite name>``. The classic BBOB timing
+        experiment uses the Rosenbrock function::
+
+        >>> import cocoex as ex
+        >>> suite = ex.Suite("bbob", "", "dimensions: 2,3,5,10,20,40 function_idx: 8")
+        >>> def random_search(f):
+        ...     for i in range(1000 * f.dimension):
+        ...         f(np.random.uniform(f.lower_bounds, f.upper_bounds))
+        >>> suite.timing_experiment(random_search, 30)  # doctest: +SKIP
+
+        Details: the problem passed to `optimizer` is freed when `optimizer`
+        returns. When `optimizer` raises an exception, the remaining problems
+        are skipped and the exception is raised again at the end.
+        """
+        global _timing_optimizer, _timing_suite_name, _timing_exception
+        if not self.initialized:
+            raise ValueError("Suite has been finalized/free'ed")
+        _timing_optimizer = optimizer
+        _timing_suite_name = self._name
+        _timing_exception = None
+        try:
+            coco_timing_experiment(self.suite, _timing_experiment_optimizer, min_seconds)
+        finally:
+            _timing_optimizer = None
+        if _timing_exception is not None:
+            exception, _timing_exception = _timing_exception, None
+            raise exception
+
     def find_problem_ids(self, *id_snippets, get_problem=False, verbose=False):
         """`find_problem_ids(*id_snippets, verbose=False)`
         returns all problem IDs that contain each of the `id_snippets`.
@@ -517,6 +587,56 @@ cdef class Observer:
     def state(self):
         return self._state
 
+    def memory_results(self):
+        """return the results recorded by a "memory" observer (or by the
+        "memory" observer within a "multi" observer) as a `list` of `dict`,
+        one for each observed problem.
+
+        The keys are ``'id'``, ``'evaluations'``, ``'best_value'`` (f - f_opt
+        or the hypervolume indicator difference), ``'best_solution'``,
+        ``'targets'``, ``'target_hits'`` (the evaluation in which each target
+        was first hit or 0), ``'trajectory_evaluations'`` and
+        ``'trajectory_values'`` (the improvements of the best value, recorded
+        with option ``trajectory: N``).
+
+        >>> import cocoex as co
+        >>> suite = co.Suite("bbob", "", "dimensions: 2 function_idx: 1")
+        >>> observer = co.Observer("memory", "trajectory: 10")
+        >>> f = suite.next_problem(observer)
+        >>> y = [f([0.1 * i, 0]) for i in range(10)]
+        >>> result = observer.memory_results()[0]
+        >>> assert result['evaluations'] == 10
+        >>> assert len(result['targets']) == len(result['target_hits']) == 51
+
+        """
+        cdef size_t i, j, n
+        cdef const double *values
+        cdef const size_t *evaluations
+        if self._observer == NULL:
+            raise ValueError("the observer is not active")
+        results = []
+        for i in range(coco_observer_memory_get_number_of_results(self._observer)):
+            result = {'id': coco_observer_memory_get_problem_id(self._observer, i),
+                      'evaluations': coco_observer_memory_get_evaluations(self._observer, i),
+                      'best_value': coco_observer_memory_get_best_value(self._observer, i)}
+            values = coco_observer_memory_get_best_solution(self._observer, i, &n)
+            result['best_solution'] = np.array([values[j] for j in range(n)], dtype=np.double)
+            values = coco_observer_memory_get_targets(self._observer, i, &n)
+            result['targets'] = np.array([values[j] for j in range(n)], dtype=np.double)
+            evaluations = coco_observer_memory_get_target_hits(self._observer, i, &n)
+            result['target_hits'] = np.array([evaluations[j] for j in range(n)], dtype=np.int64)
+            n = coco_observer_memory_get_trajectory(self._observer, i, &evaluations, &values)
+            result['trajectory_evaluations'] = np.array([evaluations[j] for j in range(n)], dtype=np.int64)
+            result['trajectory_values'] = np.array([values[j] for j in range(n)], dtype=np.double)
+            results.append(result)
+        return results
+
+    def clear_memory_results(self):
+        """remove all results of a "memory" observer, see `memory_results`"""
+        if self._observer == NULL:
+            raise ValueError("the observer is not active")
+        coco_observer_memory_clear(self._observer)
+
     def free(self):
         self.__dealloc__()
         self._observer = NULL
@@ -542,11 +662,6 @@ cdef class Problem:
     """
     cdef coco_problem_t* problem
     cdef np.ndarray y  # argument for coco_evaluate
-    # cdef public const double[:] test_bounds
-    # cdef public np.ndarray lower_bounds
-    # cdef public np.ndarray upper_bounds
-    cdef public np.ndarray _lower_bounds
-    cdef public np.ndarray _upper_bounds
     cdef size_t _number_of_variables
     cdef size_t _number_of_objectives
     cdef size_t _number_of_constraints
@@ -555,8 +670,14 @@ cdef class Problem:
     cdef _problem_index  # for the record, this is not public but used in index property
     cdef _do_free
     cdef initialized
+    cdef PyThread_type_lock _lock  # serializes the evaluations without the GIL
+    cdef public np.ndarray _lower_bounds
+    cdef public np.ndarray _upper_bounds
     def __cinit__(self):
         cdef np.npy_intp shape[1]
+        self._lock = PyThread_allocate_lock()
+        if self._lock is NULL:
+            raise MemoryError()
         self.initialized = False  # all done in _initialize
     cdef _initialize(self, coco_problem_t* problem, free=True):
         cdef np.npy_intp shape[1]
@@ -576,16 +697,12 @@ cdef class Problem:
         self._number_of_objectives = coco_problem_get_number_of_objectives(self.problem)
         self._number_of_constraints = coco_problem_get_number_of_constraints(self.problem)
         self.y = np.zeros(self._number_of_objectives)
-        ## FIXME: Inefficient because we copy the bounds instead of
-        ## sharing the data.
-        self._lower_bounds = -np.inf * np.ones(self._number_of_variables)
-        self._upper_bounds = np.inf * np.ones(self._number_of_variables)
-        # self.test_bounds = coco_problem_get_smallest_values_of_interest(self.problem)  # fails
-        for i in range(self._number_of_variables):
-            if coco_problem_get_smallest_values_of_interest(self.problem) is not NULL:
-                self._lower_bounds[i] = coco_problem_get_smallest_values_of_interest(self.problem)[i]
-            if coco_problem_get_largest_values_of_interest(self.problem) is not NULL:
-                self._upper_bounds[i] = coco_problem_get_largest_values_of_interest(self.problem)[i]
+        # the bounds are copied, such that they remain valid after the C
+        # problem has been freed
+        self._lower_bounds = self._copy_bounds(
+            coco_problem_get_smallest_values_of_interest(self.problem), -np.inf)
+        self._upper_bounds = self._copy_bounds(
+            coco_problem_get_largest_values_of_interest(self.problem), np.inf)
         self.initialized = True
         return self
     def constraint(self, x):
@@ -664,9 +781,30 @@ cdef class Problem:
     def number_of_constraints(self):
         "number of constraints"
         return self._number_of_constraints
+    cdef _copy_bounds(self, const double *bounds, double default):
+        """return a copy of the C `bounds` or an array filled with `default`
+        if `bounds` is NULL"""
+        cdef np.ndarray result
+        if bounds is NULL:
+            return default * np.ones(self._number_of_variables)
+        result = np.empty(self._number_of_variables, dtype=np.double)
+        memcpy(np.PyArray_DATA(result), bounds,
+               self._number_of_variables * sizeof(double))
+        return result
     @property
     def lower_bounds(self):
-        """depending on the test bed, these are not necessarily strict bounds
+        """depending on the test bed, these are not necessarily strict bounds.
+
+        The bounds remain available after the problem has been freed:
+
+        >>> import cocoex as co
+        >>> suite = co.Suite("bbob", "", "dimensions: 2")
+        >>> f = suite.next_problem()
+        >>> f.free()
+        >>> assert list(f.lower_bounds) == [-5, -5]
+        >>> assert list(f.upper_bounds) == [5, 5]
+        >>> suite.free()
+
         """
         return self._lower_bounds
     @property
@@ -705,25 +843,99 @@ cdef class Problem:
         # the possibility to set _do_free = False
         if self._do_free and self.problem != NULL:  # this is not guaranteed to work, see above link
             coco_problem_free(self.problem)
+        if self._lock is not NULL:
+            PyThread_free_lock(self._lock)
 
     # def __call__(self, np.ndarray[double, ndim=1, mode="c"] x):
     def __call__(self, x):
-        """return objective function value of input `x`"""
+        """return objective function value of input `x`.
+
+        If `x` is a 2-D array of shape ``(n, number_of_variables)`` with
+        ``n > 1``, its rows are evaluated one after another in a single call
+        into the C library and an array of shape ``(n,)`` or, for a
+        multiobjective problem, ``(n, number_of_objectives)`` is returned.
+        An array of shape ``(1, number_of_variables)`` is evaluated like a
+        single solution.
+
+        The GIL is released during the evaluation, such that Python threads
+        can evaluate different problems concurrently. Concurrent calls of
+        the same problem are evaluated one after another.
+
+        A 1-D, C-contiguous `numpy.ndarray` of `float64` of the right length
+        is evaluated directly, without any conversion.
+
+        >>> import numpy as np
+        >>> import cocoex as co
+        >>> suite = co.Suite("bbob", "", "dimensions: 2")
+        >>> f = suite.next_problem()
+        >>> X = np.array([[1., 2.], [0., 0.], [-1., 3.]])
+        >>> y = f(X)
+        >>> assert y.shape == (3,)
+        >>> assert all(y[i] == f(X[i]) for i in range(3))
+        >>> assert f(X[:1]) == y[0]
+        >>> suite.free()
+
+        """
         cdef np.ndarray[double, ndim=1, mode="c"] _x
+        cdef np.ndarray[double, ndim=2, mode="c"] _X
+        cdef np.ndarray _a
+        cdef np.ndarray _Y
+        cdef coco_problem_t *problem
+        cdef double *xdata
+        cdef double *ydata
+        cdef size_t number_of_solutions
         assert self.initialized
+        if self.problem is NULL:
+            raise InvalidProblemException()
+        problem = self.problem
+        if type(x) is np.ndarray:
+            _a = <np.ndarray>x
+            if (np.PyArray_NDIM(_a) == 1 and np.PyArray_TYPE(_a) == np.NPY_DOUBLE
+                    and np.PyArray_ISCARRAY_RO(_a)
+                    and <size_t>np.PyArray_DIM(_a, 0) == self._number_of_variables):
+                return self._evaluate(problem, <double *>np.PyArray_DATA(_a))
         x = np.array(x, copy=False, dtype=np.double, order='C')
+        if (np.ndim(x) == 2 and np.shape(x)[0] > 1
+                and np.shape(x)[1] == self._number_of_variables):
+            _X = x  # this is the final type conversion
+            number_of_solutions = _X.shape[0]
+            if self._number_of_objectives == 1:
+                _Y = np.empty(number_of_solutions, dtype=np.double)
+            else:
+                _Y = np.empty((number_of_solutions, self._number_of_objectives),
+                              dtype=np.double)
+            xdata = <double *>np.PyArray_DATA(_X)
+            ydata = <double *>np.PyArray_DATA(_Y)
+            with nogil:
+                PyThread_acquire_lock(self._lock, WAIT_LOCK)
+                coco_evaluate_population(problem, xdata, number_of_solutions, ydata)
+                PyThread_release_lock(self._lock)
+            return _Y
         if np.size(x) != self.number_of_variables:
             raise ValueError(
                 "Dimension, `np.size(x)==%d`, of input `x` does " % np.size(x) +
                 "not match the problem dimension `number_of_variables==%d`." 
                              % self.number_of_variables)
-        _x = x  # this is the final type conversion
-        if self.problem is NULL:
-            raise InvalidProblemException()
-        coco_evaluate_function(self.problem,
-                               <double *>np.PyArray_DATA(_x),
-                               <double *>np.PyArray_DATA(self.y))
-        return self.y[0] if self._number_of_objectives == 1 else self.y
+        _x = x.reshape(-1)  # this is the final type conversion
+        return self._evaluate(problem, <double *>np.PyArray_DATA(_x))
+
+    cdef _evaluate(self, coco_problem_t *problem, double *x):
+        """evaluate `problem` in the point `x` without holding the GIL and
+        return the value (single-objective) or `self.y` (multiobjective)"""
+        cdef double value
+        cdef double *ydata
+        if self._number_of_objectives == 1:
+            with nogil:
+                PyThread_acquire_lock(self._lock, WAIT_LOCK)
+                coco_evaluate_function(problem, x, &value)
+                PyThread_release_lock(self._lock)
+            return value
+        ydata = <double *>np.PyArray_DATA(self.y)
+        with nogil:
+            PyThread_acquire_lock(self._lock, WAIT_LOCK)
+            coco_evaluate_function(problem, x, ydata)
+            PyThread_release_lock(self._lock)
+        return self.y
 
     @property
     def id(self): 
@@ -780,9 +992,58 @@ cdef class Problem:
         except:
             pass
 
+# the optimizer, suite name and raised exception of the running timing experiment
+cdef object _timing_optimizer = None
+cdef object _timing_suite_name = None
+cdef object _timing_exception = None
+
+cdef void _timing_experiment_optimizer(coco_problem_t *problem) noexcept:
+    """calls the Python optimizer of `Suite.timing_experiment` on `problem`,
+    which is freed by the C code when this function returns"""
+    cdef Problem p
+    global _timing_exception
+    if _timing_exception is not None:
+        return
+    p = Problem_init(problem, False, _timing_suite_name)
+    try:
+        _timing_optimizer(p)
+    except BaseException as e:
+        _timing_exception = e
+    p.problem = NULL
+
 def set_log_level(level):
     """`level` values (increasing verbosity): 'error', 'warning', 'info', 'debug'.
     """
     cdef bytes _level = _bstring(level)
     return coco_set_log_level(_level)
 
+def merge_result_folders(target_folder, folders):
+    """merge the output `folders` of the "bbob" or "bbob-biobj" observer of
+    runs on disjoint batches of a suite into the new folder `target_folder`.
+
+    All problems with the same function and dimension must have been run
+    in the same folder, as is the case for the "batch" suite option and for
+    `cocoex.runner.run_parallel`. The ".info" files with the same name are
+    merged, the entries sorted by dimension and function as a single run
+    over the suite would have written them, and all other files are copied.
+    A file other than an ".info" file that exists in more than one folder
+    makes the C code exit with an error.
+    """
+    cdef bytes _target_folder = _bstring(target_folder)
+    cdef list _folders = [_bstring(folder) for folder in folders]
+    cdef const char **c_folders
+    cdef size_t i
+    if os.path.exists(target_folder):
+        raise ValueError("the target folder %s exists already" % target_folder)
+    for folder in folders:
+        if not os.path.isdir(folder):
+            raise ValueError("the folder %s does not exist" % folder)
+    c_folders = <const char **>malloc(max(len(_folders), 1) * sizeof(char *))
+    if c_folders is NULL:
+        raise MemoryError()
+    try:
+        for i in range(len(_folders)):
+            c_folders[i] = <bytes>_folders[i]
+        coco_merge_result_folders(_target_folder, len(_folders), c_folders)
+    finally:
+        _free_memory(c_folders)
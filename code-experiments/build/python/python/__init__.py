@@ -13,14 +13,15 @@ Help on class Suite...
 [...
 
 A more complete example use case can be found in the `example_experiment.py`
-file. """
+file. Experiments can be run on several processes with `runner.run_parallel`,
+see `cocoex.runner`. """
 from __future__ import absolute_import, division, print_function, unicode_literals
 from . import utilities
 try:
-    from ._interface import Suite, Observer, known_suite_names, set_log_level
+    from ._interface import Suite, Observer, known_suite_names, set_log_level, merge_result_folders
 except Exception as _e:
     # print("numbbo/code-experiments/build/python/python/__init__.py: could not import '_interface', trying 'interface'", _e)
-    from .interface import Suite, Observer, known_suite_names, set_log_level
+    from .interface import Suite, Observer, known_suite_names, set_log_level, merge_result_folders
 del absolute_import, division, print_function, unicode_literals
 
 # from .utilities import about_equal
@@ -0,0 +1,187 @@
+"""Parallel execution of an experiment on several processes.
+
+`run_parallel` runs a solver on all problems of a benchmark suite with
+several worker processes and merges their output into a single result
+folder, which can be post-processed as if the experiment had been run in
+a single process::
+
+    >>> import cocoex
+    >>> from cocoex.runner import run_parallel
+    >>> def random_search(fun, lbounds, ubounds, budget):
+    ...     import numpy as np
+    ...     fun(lbounds + (ubounds - lbounds) * np.random.rand(budget, len(lbounds)))
+    >>> folder = run_parallel(random_search, "bbob", "", "dimensions: 2,3 function_idx: 1-3",
+    ...                       observer_options="result_folder: doctest_runner algorithm_name: RS",
+    ...                       number_of_processes=2, verbose=False)  # doctest: +SKIP
+
+The solver must be picklable, i.e., a function defined at the top level of
+a module, because it is sent to the worker processes.
+
+The problems with the same function and dimension (which differ only in
+the instance) are always run by the same worker one after another, because
+the "bbob" and "bbob-biobj" observers write their data to common files.
+These units are handed out to the workers on demand, the largest
+dimensions first, such that the workers finish at about the same time.
+Each worker writes to its own subfolder, which `cocoex.merge_result_folders`
+combines at the end.
+"""
+from __future__ import absolute_import, division, print_function
+import os
+import re
+import sys
+import shutil
+import multiprocessing
+try:
+    import queue
+except ImportError:
+    import Queue as queue  # Python 2
+from . import Suite, Observer, merge_result_folders
+
+_result_folder_option = re.compile(r'result_folder\s*:\s*("[^"]*"|\S+)')
+_poll_interval = 1.0  # seconds between the checks whether the workers are alive
+
+
+def _unique_path(path):
+    """return `path` or, if it exists, the first non-existing path of
+    `path-001`, `path-002`,... like the observers of the C code do"""
+    if not os.path.exists(path):
+        return path
+    for number in range(1, 1000):
+        candidate = "%s-%03d" % (path, number)
+        if not os.path.exists(candidate):
+            return candidate
+    raise ValueError("could not find a unique name for the folder %s" % path)
+
+
+def _units(suite):
+    """return the lists of indices of the problems of `suite` that differ only
+    in the instance, the most expensive ones first.
+
+    The expected runtime of a unit is taken as the number of its problems
+    times the dimension squared (the budget and the cost of an evaluation
+    grow both about linearly with the dimension).
+    """
+    units = {}
+    order = []
+    for index, problem_id in enumerate(suite.ids):
+        key = re.sub(r'_i[0-9]+', '', problem_id)
+        if key not in units:
+            match = re.search(r'_d([0-9]+)', problem_id)
+            units[key] = []
+            order.append((key, int(match.group(1)) if match else 1))
+        units[key].append(index)
+    order.sort(key=lambda key_dimension: -key_dimension[1] ** 2 * len(units[key_dimension[0]]))
+    return [units[key] for key, _ in order]
+
+
+def _worker(worker_index, suite_arguments, observer_name, observer_options,
+            solver, budget_multiplier, tasks, results):
+    """run `solver` on the units of problems taken from the `tasks` queue
+    until `None` is taken and report each finished problem id to `results`"""
+    suite = Suite(*suite_arguments)
+    observer = Observer(observer_name, observer_options)
+    try:
+        for unit in iter(tasks.get, None):
+            for index in unit:
+                problem = suite.get_problem(index, observer)
+                solver(problem, problem.lower_bounds, problem.upper_bounds,
+                       budget_multiplier * problem.dimension)
+                results.put((worker_index, problem.id))
+                problem.free()  # closes the files of the observer
+    finally:
+        observer.free()
+        suite.free()
+        results.put((worker_index, None))
+
+
+def run_parallel(solver, suite_name, suite_instance="", suite_options="",
+                 observer_name=None, observer_options="", budget_multiplier=2,
+                 number_of_processes=None, keep_worker_folders=False, verbose=True):
+    """run `solver` on all problems of the given suite with
+    `number_of_processes` worker processes and return the result folder.
+
+    `solver` is called as ``solver(problem, lower_bounds, upper_bounds,
+    budget)`` with ``budget = budget_multiplier * problem.dimension``.
+
+    The observer (by default the one named like the suite) is created with
+    `observer_options` in each worker, whose output goes to the subfolder
+    ``worker-NNN`` of a temporary folder. Afterwards, the output of the
+    workers is merged into the result folder given in `observer_options`
+    (by default ``results``), which gets a suffix ``-001``, ``-002``,... if
+    it exists already. The temporary folder is removed unless
+    `keep_worker_folders` is set.
+
+    A worker that dies, e.g. because it has been killed, stops the run with
+    a `RuntimeError` naming the folder of its output.
+    """
+    if observer_name is None:
+        observer_name = suite_name
+    if number_of_processes is None:
+        number_of_processes = multiprocessing.cpu_count()
+    match = _result_folder_option.search(observer_options)
+    result_folder = match.group(1).strip('"') if match else "results"
+    observer_options = _result_folder_option.sub("", observer_options)
+    work_folder = _unique_path(result_folder + "-workers")
+    os.makedirs(work_folder)
+    worker_folders = [os.path.join(work_folder, "worker-%03d" % i)
+                      for i in range(number_of_processes)]
+
+    suite = Suite(suite_name, suite_instance, suite_options)
+    units = _units(suite)
+    number_of_problems = len(suite)
+    suite.free()
+
+    tasks, results = multiprocessing.Queue(), multiprocessing.Queue()
+    for unit in units:
+        tasks.put(unit)
+    for _ in range(number_of_processes):
+        tasks.put(None)
+    workers = [multiprocessing.Process(
+        target=_worker,
+        args=(i, (suite_name, suite_instance, suite_options), observer_name,
+              observer_options + ' result_folder: "%s"' % worker_folders[i],
+              solver, budget_multiplier, tasks, results))
+        for i in range(number_of_processes)]
+    for worker in workers:
+        worker.start()
+    finished_problems, finished_workers, dead_workers = 0, set(), set()
+    while len(finished_workers) < number_of_processes:
+        try:
+            worker_index, problem_id = results.get(timeout=_poll_interval)
+        except queue.Empty:
+            # a worker that has been found dead twice without reporting its
+            # end has been killed (the reports of a finished worker are in
+            # the queue before its process exits)
+            for i, worker in enumerate(workers):
+                if i in finished_workers or worker.is_alive():
+                    continue
+                if i in dead_workers:
+                    for other in workers:
+                        other.terminate()
+                    raise RuntimeError("worker %d died with exit code %s, see its output in %s"
+                                       % (i, worker.exitcode, worker_folders[i]))
+                dead_workers.add(i)
+            continue
+        if problem_id is None:
+            finished_workers.add(worker_index)
+            continue
+        finished_problems += 1
+        if verbose:
+            print("\r%d of %d problems done (%s by worker %d)" %
+                  (finished_problems, number_of_problems, problem_id, worker_index), end="")
+            sys.stdout.flush()
+    for worker in workers:
+        worker.join()
+    if verbose:
+        print()
+    if finished_problems < number_of_problems:
+        raise RuntimeError("only %d of %d problems were run, see the output of the workers in %s"
+                           % (finished_problems, number_of_problems, work_folder))
+
+    result_folder = _unique_path(result_folder)
+    merge_result_folders(result_folder,
+                         [folder for folder in worker_folders if os.path.isdir(folder)])
+    if not keep_worker_folders:
+        shutil.rmtree(work_folder)
+    return result_folder
+
@@ -0,0 +1,324 @@
+/*
+ * A client of the COCO evaluation server in C (see coco_client.h).
+ */
+#define _POSIX_C_SOURCE 200112L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "coco_client.h"
+
+/**
+ * The connection to the server.
+ */
+struct coco_client {
+  int socket;
+  unsigned char *shared_memory;
+  size_t number_of_slots;
+  size_t slot_size;
+  size_t number_of_problems;
+  size_t number_of_pending_evaluations;  /* submitted, but not waited for yet */
+  char error[COCO_CLIENT_MAX_ID_LENGTH];
+};
+
+/**
+ * Sets the error message of the client and returns 0.
+ */
+static int coco_client_fail(coco_client_t *client, const char *message) {
+  strncpy(client->error, message, sizeof(client->error) - 1);
+  client->error[sizeof(client->error) - 1] = '\0';
+  return 0;
+}
+
+/**
+ * Reads length bytes from the socket. Returns 1 on success and 0 otherwise.
+ */
+static int coco_client_read(const int socket, void *buffer, size_t length) {
+  char *position = (char *) buffer;
+  ssize_t result;
+
+  while (length > 0) {
+    result = read(socket, position, length);
+    if ((result < 0) && (errno == EINTR))
+      continue;
+    if (result <= 0)
+      return 0;
+    position += result;
+    length -= (size_t) result;
+  }
+  return 1;
+}
+
+/**
+ * Writes length bytes to the socket. Returns 1 on success and 0 otherwise.
+ */
+static int coco_client_write(const int socket, const void *buffer, size_t length) {
+  const char *position = (const char *) buffer;
+  ssize_t result;
+
+  while (length > 0) {
+    result = write(socket, position, length);
+    if ((result < 0) && (errno == EINTR))
+      continue;
+    if (result <= 0)
+      return 0;
+    position += result;
+    length -= (size_t) result;
+  }
+  return 1;
+}
+
+/**
+ * Sends a request of the given type with the given first three values.
+ */
+static int coco_client_send(coco_client_t *client, const uint32_t type, const uint32_t value0,
+    const uint32_t value1, const uint32_t value2) {
+
+  coco_server_message_t request;
+
+  request.type = type;
+  request.payload_length = 0;
+  memset(request.values, 0, sizeof(request.values));
+  request.values[0] = value0;
+  request.values[1] = value1;
+  request.values[2] = value2;
+  if (!coco_client_write(client->socket, &request, sizeof(request)))
+    return coco_client_fail(client, "the connection to the server has been lost");
+  return 1;
+}
+
+/**
+ * Receives a reply into reply and its payload into payload (of the given size, ignored if NULL). A payload
+ * that does not fit into it is skipped. Returns 0 if the connection has been lost or the status of the reply
+ * is COCO_SERVER_ERROR.
+ */
+static int coco_client_receive(coco_client_t *client, coco_server_message_t *reply, void *payload,
+    const size_t payload_size) {
+
+  char buffer[COCO_CLIENT_MAX_ID_LENGTH];
+  size_t remaining, length;
+
+  if (!coco_client_read(client->socket, reply, sizeof(*reply))
+      || (reply->payload_length > COCO_SERVER_MAX_PAYLOAD))
+    return coco_client_fail(client, "the connection to the server has been lost");
+
+  remaining = reply->payload_length;
+  if ((reply->type == COCO_SERVER_OK) && (payload != NULL) && (remaining <= payload_size)) {
+    if (!coco_client_read(client->socket, payload, remaining))
+      return coco_client_fail(client, "the connection to the server has been lost");
+    remaining = 0;
+  }
+  /* The error message is read into the error of the client, anything else is skipped */
+  while (remaining > 0) {
+    length = (remaining < sizeof(buffer)) ? remaining : sizeof(buffer);
+    if (!coco_client_read(client->socket, buffer, length))
+      return coco_client_fail(client, "the connection to the server has been lost");
+    if ((reply->type == COCO_SERVER_ERROR) && (remaining == reply->payload_length)) {
+      buffer[length - 1] = '\0';
+      coco_client_fail(client, buffer);
+    }
+    remaining -= length;
+  }
+  if (reply->type != COCO_SERVER_OK)
+    return (reply->payload_length > 0) ? 0 : coco_client_fail(client, "the request has failed");
+  return 1;
+}
+
+/**
+ * Sends a request and receives its reply, which requires that no evaluations are pending.
+ */
+static int coco_client_request(coco_client_t *client, const uint32_t type, const uint32_t value0,
+    const uint32_t value1, coco_server_message_t *reply, void *payload, const size_t payload_size) {
+
+  if (client->number_of_pending_evaluations > 0)
+    return coco_client_fail(client, "the submitted evaluations need to be waited for first");
+  return coco_client_send(client, type, value0, value1, 0)
+      && coco_client_receive(client, reply, payload, payload_size);
+}
+
+coco_client_t *coco_client_connect(const char *socket_path, const size_t number_of_slots,
+    const size_t slot_size) {
+
+  coco_client_t *client;
+  struct sockaddr_un address;
+  coco_server_message_t reply;
+  char shared_memory_name[COCO_CLIENT_MAX_ID_LENGTH];
+  int file_descriptor;
+  void *memory;
+
+  if (strlen(socket_path) >= sizeof(address.sun_path)) {
+    fprintf(stderr, "coco_client_connect(): the socket path %s is too long\n", socket_path);
+    return NULL;
+  }
+  client = (coco_client_t *) malloc(sizeof(*client));
+  if (client == NULL)
+    return NULL;
+  client->shared_memory = NULL;
+  client->number_of_slots = number_of_slots;
+  client->slot_size = slot_size - slot_size % sizeof(double);
+  client->number_of_problems = 0;
+  client->number_of_pending_evaluations = 0;
+  client->error[0] = '\0';
+
+  client->socket = socket(AF_UNIX, SOCK_STREAM, 0);
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strcpy(address.sun_path, socket_path);
+  if ((client->socket < 0) || (connect(client->socket, (struct sockaddr *) &address, sizeof(address)) != 0)) {
+    fprintf(stderr, "coco_client_connect(): failed to connect to %s\n", socket_path);
+    coco_client_close(client);
+    return NULL;
+  }
+
+  if (!coco_client_request(client, COCO_SERVER_HELLO, (uint32_t) number_of_slots, (uint32_t) slot_size, &reply,
+      shared_memory_name, sizeof(shared_memory_name)) || (reply.values[0] != COCO_SERVER_PROTOCOL_VERSION)) {
+    fprintf(stderr, "coco_client_connect(): failed to set up the connection: %s\n",
+        (client->error[0] != '\0') ? client->error : "unsupported protocol version");
+    coco_client_close(client);
+    return NULL;
+  }
+  client->number_of_problems = reply.values[1];
+
+  memory = MAP_FAILED;
+  file_descriptor = shm_open(shared_memory_name, O_RDWR, 0);
+  if (file_descriptor >= 0) {
+    memory = mmap(NULL, client->number_of_slots * client->slot_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+        file_descriptor, 0);
+    close(file_descriptor);
+  }
+  if (memory == MAP_FAILED) {
+    fprintf(stderr, "coco_client_connect(): failed to map the shared memory %s\n", shared_memory_name);
+    coco_client_close(client);
+    return NULL;
+  }
+  client->shared_memory = (unsigned char *) memory;
+  return client;
+}
+
+void coco_client_close(coco_client_t *client) {
+
+  if (client == NULL)
+    return;
+  if (client->shared_memory != NULL)
+    munmap(client->shared_memory, client->number_of_slots * client->slot_size);
+  if (client->socket >= 0)
+    close(client->socket);
+  free(client);
+}
+
+const char *coco_client_get_error(const coco_client_t *client) {
+  return client->error;
+}
+
+size_t coco_client_get_number_of_problems(const coco_client_t *client) {
+  return client->number_of_problems;
+}
+
+int coco_client_get_problem(coco_client_t *client, const size_t problem_index, coco_client_problem_t *problem) {
+
+  coco_server_message_t reply;
+
+  problem->id[0] = '\0';
+  if (!coco_client_request(client, COCO_SERVER_GET_PROBLEM, (uint32_t) problem_index, 0, &reply, problem->id,
+      sizeof(problem->id)))
+    return 0;
+  problem->handle = reply.values[0];
+  problem->problem_index = reply.values[1];
+  problem->dimension = reply.values[2];
+  problem->number_of_objectives = reply.values[3];
+  problem->number_of_constraints = reply.values[4];
+  return 1;
+}
+
+int coco_client_get_next_problem(coco_client_t *client, coco_client_problem_t *problem) {
+  return coco_client_get_problem(client, COCO_SERVER_NEXT_PROBLEM, problem);
+}
+
+int coco_client_get_bounds(coco_client_t *client, const coco_client_problem_t *problem, double *lower_bounds,
+    double *upper_bounds) {
+
+  coco_server_message_t reply;
+  const size_t size = problem->dimension * sizeof(double);
+  double *bounds;
+  int result;
+
+  bounds = (double *) malloc(2 * size);
+  if (bounds == NULL)
+    return coco_client_fail(client, "coco_client_get_bounds(): out of memory");
+  result = coco_client_request(client, COCO_SERVER_GET_BOUNDS, problem->handle, 0, &reply, bounds, 2 * size)
+      && ((reply.payload_length == 2 * size) || coco_client_fail(client, "unexpected size of the bounds"));
+  if (result) {
+    memcpy(lower_bounds, bounds, size);
+    memcpy(upper_bounds, bounds + problem->dimension, size);
+  }
+  free(bounds);
+  return result;
+}
+
+double *coco_client_get_slot(const coco_client_t *client, const size_t slot) {
+  return (double *) (client->shared_memory + slot * client->slot_size);
+}
+
+size_t coco_client_get_slot_size(const coco_client_t *client) {
+  return client->slot_size;
+}
+
+int coco_client_submit(coco_client_t *client, const coco_client_problem_t *problem, const size_t slot,
+    const size_t number_of_points) {
+
+  if (!coco_client_send(client, COCO_SERVER_EVALUATE, problem->handle, (uint32_t) slot,
+      (uint32_t) number_of_points))
+    return 0;
+  client->number_of_pending_evaluations++;
+  return 1;
+}
+
+int coco_client_wait(coco_client_t *client, size_t *number_of_evaluations) {
+
+  coco_server_message_t reply;
+
+  if (client->number_of_pending_evaluations == 0)
+    return coco_client_fail(client, "no evaluation has been submitted");
+  client->number_of_pending_evaluations--;
+  if (!coco_client_receive(client, &reply, NULL, 0))
+    return 0;
+  if (number_of_evaluations != NULL)
+    *number_of_evaluations = reply.values[0];
+  return 1;
+}
+
+int coco_client_evaluate(coco_client_t *client, const coco_client_problem_t *problem, const double *x,
+    const size_t number_of_points, double *y) {
+
+  double *slot = coco_client_get_slot(client, 0);
+  const size_t x_size = number_of_points * problem->dimension;
+  const size_t y_size = number_of_points * problem->number_of_objectives;
+
+  if (client->number_of_pending_evaluations > 0)
+    return coco_client_fail(client, "the submitted evaluations need to be waited for first");
+  if ((x_size + y_size) * sizeof(double) > client->slot_size)
+    return coco_client_fail(client, "coco_client_evaluate(): the points do not fit into a slot");
+  memcpy(slot, x, x_size * sizeof(double));
+  if (!coco_client_submit(client, problem, 0, number_of_points) || !coco_client_wait(client, NULL))
+    return 0;
+  memcpy(y, slot + x_size, y_size * sizeof(double));
+  return 1;
+}
+
+int coco_client_free_problem(coco_client_t *client, const coco_client_problem_t *problem) {
+  coco_server_message_t reply;
+  return coco_client_request(client, COCO_SERVER_FREE_PROBLEM, problem->handle, 0, &reply, NULL, 0);
+}
+
+int coco_client_shutdown(coco_client_t *client) {
+  coco_server_message_t reply;
+  return coco_client_request(client, COCO_SERVER_SHUTDOWN, 0, 0, &reply, NULL, 0);
+}
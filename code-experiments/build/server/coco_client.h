@@ -0,0 +1,143 @@
+/*
+ * A client of the COCO evaluation server (see coco_server.c) in C, which can also serve as a reference for
+ * clients in other languages (see coco_server_protocol.h for the protocol).
+ *
+ * The client does not depend on COCO itself. All functions that communicate with the server return 1 on
+ * success and 0 on failure, in which case coco_client_get_error() returns the reason.
+ *
+ * The points can either be evaluated with coco_client_evaluate(), which copies them into and their values
+ * out of the shared memory, or written directly into a slot (see coco_client_get_slot()) and evaluated with
+ * coco_client_submit() and coco_client_wait(). The latter avoids any copying and allows the client to have
+ * several batches of points in flight, one per slot, e.g., to generate the next batch while the server
+ * evaluates the current one:
+ *
+ *   coco_client_t *client = coco_client_connect("/tmp/coco.socket", 2, 1 << 20);
+ *   coco_client_problem_t problem;
+ *   double *x;
+ *
+ *   while (coco_client_get_next_problem(client, &problem) && (problem.handle != COCO_SERVER_NO_PROBLEM)) {
+ *     x = coco_client_get_slot(client, 0);
+ *     ... write n points into x ...
+ *     coco_client_submit(client, &problem, 0, n);
+ *     coco_client_wait(client, NULL);
+ *     ... the values are in x + n * problem.dimension ...
+ *     coco_client_free_problem(client, &problem);
+ *   }
+ *   coco_client_close(client);
+ */
+#ifndef __COCO_CLIENT__
+#define __COCO_CLIENT__
+
+#include <stddef.h>
+
+#include "coco_server_protocol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The maximal length of a problem id including the null character */
+#define COCO_CLIENT_MAX_ID_LENGTH 256
+
+/**
+ * The connection to the server.
+ */
+typedef struct coco_client coco_client_t;
+
+/**
+ * A problem handed out by the server.
+ */
+typedef struct {
+  uint32_t handle;                 /* COCO_SERVER_NO_PROBLEM if the suite has no further problems */
+  size_t problem_index;
+  size_t dimension;
+  size_t number_of_objectives;
+  size_t number_of_constraints;
+  char id[COCO_CLIENT_MAX_ID_LENGTH];
+} coco_client_problem_t;
+
+/**
+ * Connects to the server listening on the given socket and sets up the shared memory with the given number
+ * of slots of the given size in bytes. Returns NULL on failure (with a message on stderr).
+ */
+coco_client_t *coco_client_connect(const char *socket_path, const size_t number_of_slots,
+    const size_t slot_size);
+
+/**
+ * Closes the connection, which frees the problems that are still open.
+ */
+void coco_client_close(coco_client_t *client);
+
+/**
+ * Returns the message of the last failure.
+ */
+const char *coco_client_get_error(const coco_client_t *client);
+
+/**
+ * Returns the number of problems of the suite of the server (including the ones filtered out by the suite
+ * options).
+ */
+size_t coco_client_get_number_of_problems(const coco_client_t *client);
+
+/**
+ * Gets the problem with the given index.
+ */
+int coco_client_get_problem(coco_client_t *client, const size_t problem_index, coco_client_problem_t *problem);
+
+/**
+ * Gets the next problem of the suite that has not been handed out to any client yet. Its handle is
+ * COCO_SERVER_NO_PROBLEM if there is none.
+ */
+int coco_client_get_next_problem(coco_client_t *client, coco_client_problem_t *problem);
+
+/**
+ * Copies the bounds of the region of interest of the problem into lower_bounds and upper_bounds (of size
+ * dimension each).
+ */
+int coco_client_get_bounds(coco_client_t *client, const coco_client_problem_t *problem, double *lower_bounds,
+    double *upper_bounds);
+
+/**
+ * Returns the beginning of the given slot of the shared memory.
+ */
+double *coco_client_get_slot(const coco_client_t *client, const size_t slot);
+
+/**
+ * Returns the size of the slots in bytes.
+ */
+size_t coco_client_get_slot_size(const coco_client_t *client);
+
+/**
+ * Requests the evaluation of the number_of_points points at the beginning of the given slot without waiting
+ * for the result. The slot must not be touched until the corresponding coco_client_wait() has returned.
+ */
+int coco_client_submit(coco_client_t *client, const coco_client_problem_t *problem, const size_t slot,
+    const size_t number_of_points);
+
+/**
+ * Waits for the oldest submitted evaluation to finish and sets number_of_evaluations (if not NULL) to the
+ * number of evaluations of its problem.
+ */
+int coco_client_wait(coco_client_t *client, size_t *number_of_evaluations);
+
+/**
+ * Evaluates the number_of_points points stored one after another in x and saves their values one after
+ * another in y using the first slot.
+ */
+int coco_client_evaluate(coco_client_t *client, const coco_client_problem_t *problem, const double *x,
+    const size_t number_of_points, double *y);
+
+/**
+ * Frees the problem (and finishes its output on the server).
+ */
+int coco_client_free_problem(coco_client_t *client, const coco_client_problem_t *problem);
+
+/**
+ * Stops the server.
+ */
+int coco_client_shutdown(coco_client_t *client);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,500 @@
+/*
+ * An evaluation server for optimizers that cannot call COCO directly, for example because COCO has no
+ * binding for their language or because they run in separate processes.
+ *
+ * The server owns a suite and an observer and serves the requests of any number of clients over a Unix
+ * domain socket, one request at a time. The points and their values are exchanged through shared memory
+ * without copying. See coco_server_protocol.h for the protocol and coco_client.h for a client in C.
+ *
+ * Usage: coco_server SOCKET_PATH SUITE_NAME ["SUITE_INSTANCE" ["SUITE_OPTIONS" [OBSERVER_NAME
+ * ["OBSERVER_OPTIONS"]]]]
+ *
+ * For example, coco_server /tmp/coco.socket bbob "" "dimensions: 2,3,5" bbob "result_folder: RS_on_bbob"
+ * serves the bbob suite in the given dimensions and observes the evaluations with the bbob observer. The
+ * server runs until it receives SIGINT or SIGTERM or a client sends COCO_SERVER_SHUTDOWN.
+ */
+#define _POSIX_C_SOURCE 200112L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "coco.h"
+#include "coco_server_protocol.h"
+
+/* The maximal number of simultaneous connections */
+#define COCO_SERVER_MAX_CONNECTIONS 128
+
+/* The maximal number of open problems of a connection */
+#define COCO_SERVER_MAX_PROBLEMS 64
+
+/**
+ * The state of a connection to a client.
+ */
+typedef struct {
+  int socket;
+  char shared_memory_name[64];   /* empty once the name has been removed */
+  unsigned char *shared_memory;  /* NULL before the request COCO_SERVER_HELLO */
+  size_t shared_memory_size;
+  size_t number_of_slots;
+  size_t slot_size;
+  coco_problem_t *problems[COCO_SERVER_MAX_PROBLEMS];
+} coco_server_connection_t;
+
+/**
+ * The state of the server.
+ */
+typedef struct {
+  coco_suite_t *suite;
+  coco_observer_t *observer;
+  size_t next_problem_index;
+  size_t number_of_observed_problems;
+  size_t number_of_segments;  /* used to name the shared-memory segments */
+  int is_shutdown_requested;
+  coco_server_connection_t *connections[COCO_SERVER_MAX_CONNECTIONS];
+  size_t number_of_connections;
+} coco_server_t;
+
+/* Set by the handler of SIGINT and SIGTERM */
+static volatile sig_atomic_t coco_server_is_signaled = 0;
+
+static void coco_server_handle_signal(int signal_number) {
+  (void) signal_number;
+  coco_server_is_signaled = 1;
+}
+
+/**
+ * Reads length bytes from the socket. Returns 1 on success and 0 if the connection has been closed or failed.
+ */
+static int coco_server_read(const int socket, void *buffer, size_t length) {
+  char *position = (char *) buffer;
+  ssize_t result;
+
+  while (length > 0) {
+    result = read(socket, position, length);
+    if ((result < 0) && (errno == EINTR))
+      continue;
+    if (result <= 0)
+      return 0;
+    position += result;
+    length -= (size_t) result;
+  }
+  return 1;
+}
+
+/**
+ * Writes length bytes to the socket. Returns 1 on success and 0 if the connection has been closed or failed.
+ */
+static int coco_server_write(const int socket, const void *buffer, size_t length) {
+  const char *position = (const char *) buffer;
+  ssize_t result;
+
+  while (length > 0) {
+    result = write(socket, position, length);
+    if ((result < 0) && (errno == EINTR))
+      continue;
+    if (result <= 0)
+      return 0;
+    position += result;
+    length -= (size_t) result;
+  }
+  return 1;
+}
+
+/**
+ * Sends a reply with the given status, values (six of them or NULL for zeros) and payload. Returns 1 on
+ * success and 0 otherwise.
+ */
+static int coco_server_reply(const coco_server_connection_t *connection, const uint32_t status,
+    const uint32_t *values, const void *payload, const size_t payload_length) {
+
+  coco_server_message_t reply;
+  size_t i;
+
+  reply.type = status;
+  reply.payload_length = (uint32_t) payload_length;
+  for (i = 0; i < 6; i++)
+    reply.values[i] = (values != NULL) ? values[i] : 0;
+  return coco_server_write(connection->socket, &reply, sizeof(reply))
+      && ((payload_length == 0) || coco_server_write(connection->socket, payload, payload_length));
+}
+
+/**
+ * Sends a reply with the status COCO_SERVER_ERROR and the given message (including the null character).
+ */
+static int coco_server_reply_error(const coco_server_connection_t *connection, const char *message) {
+  return coco_server_reply(connection, COCO_SERVER_ERROR, NULL, message, strlen(message) + 1);
+}
+
+/**
+ * Returns the problem of the connection with the given handle or NULL if there is no such problem.
+ */
+static coco_problem_t *coco_server_get_problem(const coco_server_connection_t *connection, const uint32_t handle) {
+  return (handle < COCO_SERVER_MAX_PROBLEMS) ? connection->problems[handle] : NULL;
+}
+
+/**
+ * Handles COCO_SERVER_HELLO(number_of_slots, slot_size) by creating and mapping the shared-memory segment of
+ * the connection.
+ */
+static int coco_server_hello(coco_server_t *server, coco_server_connection_t *connection,
+    const coco_server_message_t *request) {
+
+  uint32_t values[6] = { COCO_SERVER_PROTOCOL_VERSION, 0, 0, 0, 0, 0 };
+  int file_descriptor;
+  void *memory;
+
+  if (connection->shared_memory != NULL)
+    return coco_server_reply_error(connection, "COCO_SERVER_HELLO: the connection has been set up already");
+  if ((request->values[0] == 0) || (request->values[1] < sizeof(double))
+      || ((size_t) request->values[0] > ((size_t) -1) / (size_t) request->values[1]))
+    return coco_server_reply_error(connection, "COCO_SERVER_HELLO: invalid number of slots or slot size");
+
+  connection->number_of_slots = request->values[0];
+  connection->slot_size = request->values[1] - request->values[1] % sizeof(double);
+  connection->shared_memory_size = connection->number_of_slots * connection->slot_size;
+  sprintf(connection->shared_memory_name, "/coco-server-%lu-%lu", (unsigned long) getpid(),
+      (unsigned long) server->number_of_segments++);
+  file_descriptor = shm_open(connection->shared_memory_name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+  if (file_descriptor < 0) {
+    connection->shared_memory_name[0] = '\0';
+    return coco_server_reply_error(connection, "COCO_SERVER_HELLO: shm_open() failed");
+  }
+  memory = MAP_FAILED;
+  if (ftruncate(file_descriptor, (off_t) connection->shared_memory_size) == 0)
+    memory = mmap(NULL, connection->shared_memory_size, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0);
+  close(file_descriptor);
+  if (memory == MAP_FAILED) {
+    shm_unlink(connection->shared_memory_name);
+    connection->shared_memory_name[0] = '\0';
+    return coco_server_reply_error(connection, "COCO_SERVER_HELLO: failed to allocate the shared memory");
+  }
+  connection->shared_memory = (unsigned char *) memory;
+
+  values[1] = (uint32_t) coco_suite_get_number_of_problems(server->suite);
+  return coco_server_reply(connection, COCO_SERVER_OK, values, connection->shared_memory_name,
+      strlen(connection->shared_memory_name) + 1);
+}
+
+/**
+ * Handles COCO_SERVER_GET_PROBLEM(problem_index).
+ */
+static int coco_server_get_problem_request(coco_server_t *server, coco_server_connection_t *connection,
+    const coco_server_message_t *request) {
+
+  const size_t number_of_problems = coco_suite_get_number_of_problems(server->suite);
+  uint32_t values[6] = { COCO_SERVER_NO_PROBLEM, 0, 0, 0, 0, 0 };
+  size_t problem_index, dimension, number_of_objectives;
+  uint32_t handle;
+  const char *problem_id;
+  coco_problem_t *problem;
+
+  for (handle = 0; (handle < COCO_SERVER_MAX_PROBLEMS) && (connection->problems[handle] != NULL); handle++)
+    ;
+  if (handle == COCO_SERVER_MAX_PROBLEMS)
+    return coco_server_reply_error(connection, "COCO_SERVER_GET_PROBLEM: too many open problems");
+  if ((server->observer != NULL) && (server->number_of_observed_problems > 0))
+    return coco_server_reply_error(connection, "COCO_SERVER_GET_PROBLEM: the open problem needs to be freed "
+        "first, since only one problem can be observed at a time");
+
+  if (request->values[0] == COCO_SERVER_NEXT_PROBLEM) {
+    while ((server->next_problem_index < number_of_problems)
+        && !coco_suite_get_problem_metadata(server->suite, server->next_problem_index, NULL, NULL, NULL, NULL))
+      server->next_problem_index++;
+    if (server->next_problem_index == number_of_problems)
+      return coco_server_reply(connection, COCO_SERVER_OK, values, NULL, 0);
+    problem_index = server->next_problem_index++;
+  } else {
+    problem_index = request->values[0];
+    if (!coco_suite_get_problem_metadata(server->suite, problem_index, NULL, NULL, NULL, NULL))
+      return coco_server_reply_error(connection, "COCO_SERVER_GET_PROBLEM: the problem is not in the suite");
+  }
+
+  coco_suite_get_problem_metadata(server->suite, problem_index, &problem_id, NULL, &dimension,
+      &number_of_objectives);
+  problem = coco_suite_get_problem(server->suite, problem_index);
+  if (server->observer != NULL) {
+    problem = coco_problem_add_observer(problem, server->observer);
+    server->number_of_observed_problems++;
+  }
+  connection->problems[handle] = problem;
+
+  values[0] = handle;
+  values[1] = (uint32_t) problem_index;
+  values[2] = (uint32_t) dimension;
+  values[3] = (uint32_t) number_of_objectives;
+  values[4] = (uint32_t) coco_problem_get_number_of_constraints(problem);
+  problem_id = coco_problem_get_id(problem);
+  return coco_server_reply(connection, COCO_SERVER_OK, values, problem_id, strlen(problem_id) + 1);
+}
+
+/**
+ * Handles COCO_SERVER_GET_BOUNDS(handle).
+ */
+static int coco_server_get_bounds(const coco_server_connection_t *connection,
+    const coco_server_message_t *request) {
+
+  coco_problem_t *problem = coco_server_get_problem(connection, request->values[0]);
+  size_t dimension;
+  double *bounds;
+  int result;
+
+  if (problem == NULL)
+    return coco_server_reply_error(connection, "COCO_SERVER_GET_BOUNDS: invalid handle");
+  dimension = coco_problem_get_dimension(problem);
+  bounds = coco_allocate_vector(2 * dimension);
+  memcpy(bounds, coco_problem_get_smallest_values_of_interest(problem), dimension * sizeof(double));
+  memcpy(bounds + dimension, coco_problem_get_largest_values_of_interest(problem), dimension * sizeof(double));
+  result = coco_server_reply(connection, COCO_SERVER_OK, NULL, bounds, 2 * dimension * sizeof(double));
+  coco_free_memory(bounds);
+  return result;
+}
+
+/**
+ * Handles COCO_SERVER_EVALUATE(handle, slot, number_of_points), reading the points from and writing their
+ * values into the given slot of the shared memory.
+ */
+static int coco_server_evaluate(const coco_server_connection_t *connection,
+    const coco_server_message_t *request) {
+
+  coco_problem_t *problem = coco_server_get_problem(connection, request->values[0]);
+  const size_t slot = request->values[1], number_of_points = request->values[2];
+  uint32_t values[6] = { 0, 0, 0, 0, 0, 0 };
+  size_t dimension, number_of_objectives;
+  double *x;
+
+  if (problem == NULL)
+    return coco_server_reply_error(connection, "COCO_SERVER_EVALUATE: invalid handle");
+  if ((connection->shared_memory == NULL) || (slot >= connection->number_of_slots))
+    return coco_server_reply_error(connection, "COCO_SERVER_EVALUATE: invalid slot");
+  dimension = coco_problem_get_dimension(problem);
+  number_of_objectives = coco_problem_get_number_of_objectives(problem);
+  if ((number_of_points == 0) || (number_of_points * (dimension + number_of_objectives) * sizeof(double)
+      > connection->slot_size))
+    return coco_server_reply_error(connection, "COCO_SERVER_EVALUATE: the points do not fit into the slot");
+
+  x = (double *) (connection->shared_memory + slot * connection->slot_size);
+  coco_evaluate_population(problem, x, number_of_points, x + number_of_points * dimension);
+  values[0] = (uint32_t) coco_problem_get_evaluations(problem);
+  return coco_server_reply(connection, COCO_SERVER_OK, values, NULL, 0);
+}
+
+/**
+ * Frees the problem of the connection with the given handle.
+ */
+static void coco_server_free_problem(coco_server_t *server, coco_server_connection_t *connection,
+    const uint32_t handle) {
+
+  coco_problem_free(connection->problems[handle]);
+  connection->problems[handle] = NULL;
+  if (server->observer != NULL)
+    server->number_of_observed_problems--;
+}
+
+/**
+ * Reads a request of the connection and answers it. Returns 0 if the connection needs to be closed and 1
+ * otherwise.
+ */
+static int coco_server_handle_request(coco_server_t *server, coco_server_connection_t *connection) {
+
+  coco_server_message_t request;
+  char *payload;
+  int result;
+
+  if (!coco_server_read(connection->socket, &request, sizeof(request))
+      || (request.payload_length > COCO_SERVER_MAX_PAYLOAD))
+    return 0;
+  /* None of the requests has a payload, so it is skipped */
+  if (request.payload_length > 0) {
+    payload = (char *) coco_allocate_memory(request.payload_length);
+    result = coco_server_read(connection->socket, payload, request.payload_length);
+    coco_free_memory(payload);
+    if (!result)
+      return 0;
+  }
+
+  /* The client has mapped the shared memory if it sends a further request */
+  if ((connection->shared_memory != NULL) && (connection->shared_memory_name[0] != '\0')) {
+    shm_unlink(connection->shared_memory_name);
+    connection->shared_memory_name[0] = '\0';
+  }
+
+  switch (request.type) {
+  case COCO_SERVER_HELLO:
+    return coco_server_hello(server, connection, &request);
+  case COCO_SERVER_GET_PROBLEM:
+    return coco_server_get_problem_request(server, connection, &request);
+  case COCO_SERVER_GET_BOUNDS:
+    return coco_server_get_bounds(connection, &request);
+  case COCO_SERVER_EVALUATE:
+    return coco_server_evaluate(connection, &request);
+  case COCO_SERVER_FREE_PROBLEM:
+    if (coco_server_get_problem(connection, request.values[0]) == NULL)
+      return coco_server_reply_error(connection, "COCO_SERVER_FREE_PROBLEM: invalid handle");
+    coco_server_free_problem(server, connection, request.values[0]);
+    return coco_server_reply(connection, COCO_SERVER_OK, NULL, NULL, 0);
+  case COCO_SERVER_SHUTDOWN:
+    server->is_shutdown_requested = 1;
+    return coco_server_reply(connection, COCO_SERVER_OK, NULL, NULL, 0);
+  default:
+    return coco_server_reply_error(connection, "unknown request");
+  }
+}
+
+/**
+ * Closes the connection with the given index and frees its problems and its shared memory.
+ */
+static void coco_server_close_connection(coco_server_t *server, const size_t index) {
+
+  coco_server_connection_t *connection = server->connections[index];
+  uint32_t handle;
+
+  for (handle = 0; handle < COCO_SERVER_MAX_PROBLEMS; handle++) {
+    if (connection->problems[handle] != NULL)
+      coco_server_free_problem(server, connection, handle);
+  }
+  if (connection->shared_memory != NULL) {
+    munmap(connection->shared_memory, connection->shared_memory_size);
+    if (connection->shared_memory_name[0] != '\0')
+      shm_unlink(connection->shared_memory_name);
+  }
+  close(connection->socket);
+  coco_free_memory(connection);
+
+  server->connections[index] = server->connections[--server->number_of_connections];
+}
+
+/**
+ * Accepts a new connection on the listening socket.
+ */
+static void coco_server_accept(coco_server_t *server, const int listening_socket) {
+
+  coco_server_connection_t *connection;
+  int client_socket;
+  size_t i;
+
+  client_socket = accept(listening_socket, NULL, NULL);
+  if (client_socket < 0)
+    return;
+  if (server->number_of_connections == COCO_SERVER_MAX_CONNECTIONS) {
+    coco_warning("coco_server: refused a connection, since %d clients are connected",
+        COCO_SERVER_MAX_CONNECTIONS);
+    close(client_socket);
+    return;
+  }
+  connection = (coco_server_connection_t *) coco_allocate_memory(sizeof(*connection));
+  connection->socket = client_socket;
+  connection->shared_memory_name[0] = '\0';
+  connection->shared_memory = NULL;
+  connection->shared_memory_size = 0;
+  connection->number_of_slots = 0;
+  connection->slot_size = 0;
+  for (i = 0; i < COCO_SERVER_MAX_PROBLEMS; i++)
+    connection->problems[i] = NULL;
+  server->connections[server->number_of_connections++] = connection;
+}
+
+/**
+ * Serves the requests on the listening socket until a shutdown is requested or signaled.
+ */
+static void coco_server_run(coco_server_t *server, const int listening_socket) {
+
+  struct pollfd descriptors[COCO_SERVER_MAX_CONNECTIONS + 1];
+  size_t number_of_connections, i;
+
+  while (!server->is_shutdown_requested && !coco_server_is_signaled) {
+    number_of_connections = server->number_of_connections;
+    descriptors[0].fd = listening_socket;
+    descriptors[0].events = POLLIN;
+    for (i = 0; i < number_of_connections; i++) {
+      descriptors[i + 1].fd = server->connections[i]->socket;
+      descriptors[i + 1].events = POLLIN;
+    }
+    if (poll(descriptors, (nfds_t) (number_of_connections + 1), -1) < 0) {
+      if (errno == EINTR)
+        continue;
+      coco_error("coco_server: poll() failed");
+    }
+
+    /* Going backwards keeps the indices of the remaining connections when one is closed */
+    for (i = number_of_connections; i > 0; i--) {
+      if ((descriptors[i].revents & (POLLIN | POLLHUP | POLLERR))
+          && !coco_server_handle_request(server, server->connections[i - 1]))
+        coco_server_close_connection(server, i - 1);
+      if (server->is_shutdown_requested)
+        break;
+    }
+    if (descriptors[0].revents & POLLIN)
+      coco_server_accept(server, listening_socket);
+  }
+}
+
+int main(int argc, char *argv[]) {
+
+  coco_server_t server;
+  struct sockaddr_un address;
+  struct sigaction action;
+  int listening_socket;
+
+  if ((argc < 3) || (argc > 7)) {
+    fprintf(stderr, "Usage: %s SOCKET_PATH SUITE_NAME [\"SUITE_INSTANCE\" [\"SUITE_OPTIONS\" [OBSERVER_NAME "
+        "[\"OBSERVER_OPTIONS\"]]]]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+  if (strlen(argv[1]) >= sizeof(address.sun_path)) {
+    fprintf(stderr, "The socket path %s is too long\n", argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  server.suite = coco_suite(argv[2], (argc > 3) ? argv[3] : "", (argc > 4) ? argv[4] : "");
+  server.observer = NULL;
+  if ((argc > 5) && (strcmp(argv[5], "") != 0) && (strcmp(argv[5], "no_observer") != 0))
+    server.observer = coco_observer(argv[5], (argc > 6) ? argv[6] : "");
+  server.next_problem_index = 0;
+  server.number_of_observed_problems = 0;
+  server.number_of_segments = 0;
+  server.is_shutdown_requested = 0;
+  server.number_of_connections = 0;
+
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = coco_server_handle_signal;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGINT, &action, NULL);
+  sigaction(SIGTERM, &action, NULL);
+  /* A client that disappears must not stop the server */
+  action.sa_handler = SIG_IGN;
+  sigaction(SIGPIPE, &action, NULL);
+
+  listening_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listening_socket < 0)
+    coco_error("coco_server: socket() failed");
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  strcpy(address.sun_path, argv[1]);
+  unlink(argv[1]);
+  if ((bind(listening_socket, (struct sockaddr *) &address, sizeof(address)) != 0)
+      || (listen(listening_socket, 16) != 0))
+    coco_error("coco_server: failed to listen on %s", argv[1]);
+  coco_info("coco_server: serving suite %s on %s", argv[2], argv[1]);
+
+  coco_server_run(&server, listening_socket);
+
+  while (server.number_of_connections > 0)
+    coco_server_close_connection(&server, server.number_of_connections - 1);
+  close(listening_socket);
+  unlink(argv[1]);
+  if (server.observer != NULL)
+    coco_observer_free(server.observer);
+  coco_suite_free(server.suite);
+  coco_info("coco_server: stopped");
+  return EXIT_SUCCESS;
+}
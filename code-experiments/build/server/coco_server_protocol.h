@@ -0,0 +1,88 @@
+/*
+ * The protocol between the COCO evaluation server (coco_server.c) and its clients (see coco_client.h for the
+ * reference client in C).
+ *
+ * The server listens on a Unix domain socket (of type SOCK_STREAM). Server and clients run on the same
+ * machine, so that all numbers are sent in the native byte order. Each request and each reply consists of
+ * a message header followed by payload_length bytes of payload:
+ *
+ *   uint32_t type;            the request type or, in replies, the status (COCO_SERVER_OK or COCO_SERVER_ERROR)
+ *   uint32_t payload_length;  the number of bytes following the header
+ *   uint32_t values[6];       the arguments of the request or the results of the reply
+ *
+ * The reply to a failed request has the status COCO_SERVER_ERROR and the error message as payload. The
+ * requests are answered in the order in which they are sent, so that a client can send several requests
+ * before it reads their replies.
+ *
+ * The points and their values travel through a shared-memory segment (created by the server with
+ * shm_open()), which is divided into number_of_slots slots of slot_size bytes each. The points to be
+ * evaluated are stored as doubles at the beginning of a slot, one point after the other, and the server
+ * writes their values, one vector of objective values after the other, directly behind them. Neither of
+ * them is copied on the way.
+ *
+ * The requests and their arguments (values) and results (values and payload) are:
+ *
+ * - COCO_SERVER_HELLO(number_of_slots, slot_size): creates the shared-memory segment of the connection
+ *   and returns (COCO_SERVER_PROTOCOL_VERSION, number_of_problems) and the name of the segment (a
+ *   null-terminated string) as payload. The client then maps the segment (with shm_open() and mmap()). The
+ *   server removes the name of the segment on the next request, so that it is freed once both have
+ *   unmapped it. This has to be the first request of a connection.
+ *
+ * - COCO_SERVER_GET_PROBLEM(problem_index): constructs the problem with the given index (see
+ *   coco_suite_get_problem()) or, for the index COCO_SERVER_NEXT_PROBLEM, the next problem of the suite that
+ *   has not been handed out to any client yet, and wraps it with the observer of the server. Returns
+ *   (handle, problem_index, dimension, number_of_objectives, number_of_constraints) and the id of the
+ *   problem (a null-terminated string) as payload, or the status COCO_SERVER_OK with the handle
+ *   COCO_SERVER_NO_PROBLEM if all problems have been handed out. With an observer, only one problem can be
+ *   open at a time (on the whole server), because the observers keep data of the current problem.
+ *
+ * - COCO_SERVER_GET_BOUNDS(handle): returns the lower bounds followed by the upper bounds of the region of
+ *   interest (2 * dimension doubles) as payload.
+ *
+ * - COCO_SERVER_EVALUATE(handle, slot, number_of_points): evaluates the points in the given slot and writes
+ *   their values behind them (see above). Returns (number_of_evaluations) of the problem.
+ *
+ * - COCO_SERVER_FREE_PROBLEM(handle): frees the problem (and finishes its output).
+ *
+ * - COCO_SERVER_SHUTDOWN(): stops the server after the reply.
+ *
+ * A connection is closed by closing the socket, which frees its remaining problems.
+ */
+#ifndef __COCO_SERVER_PROTOCOL__
+#define __COCO_SERVER_PROTOCOL__
+
+#include <stdint.h>
+
+#define COCO_SERVER_PROTOCOL_VERSION 1
+
+/* The request types */
+#define COCO_SERVER_HELLO 1
+#define COCO_SERVER_GET_PROBLEM 2
+#define COCO_SERVER_GET_BOUNDS 3
+#define COCO_SERVER_EVALUATE 4
+#define COCO_SERVER_FREE_PROBLEM 5
+#define COCO_SERVER_SHUTDOWN 6
+
+/* The statuses of the replies */
+#define COCO_SERVER_OK 0
+#define COCO_SERVER_ERROR 1
+
+/* The problem index that requests the next problem of the suite */
+#define COCO_SERVER_NEXT_PROBLEM 0xFFFFFFFFUL
+
+/* The handle that signals that there is no next problem */
+#define COCO_SERVER_NO_PROBLEM 0xFFFFFFFFUL
+
+/* The maximal length of the payload of a message */
+#define COCO_SERVER_MAX_PAYLOAD 1048576
+
+/**
+ * The header of a message.
+ */
+typedef struct {
+  uint32_t type;
+  uint32_t payload_length;
+  uint32_t values[6];
+} coco_server_message_t;
+
+#endif
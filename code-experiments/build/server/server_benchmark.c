@@ -0,0 +1,186 @@
+/*
+ * Compares the throughput of evaluations through the COCO evaluation server with the throughput of
+ * evaluations in the same process.
+ *
+ * The benchmark starts ./coco_server on the bbob suite (without observer) and measures, for the functions
+ * f1 (sphere, the cheapest one) and f10 (ellipsoid) in dimensions 2, 10 and 40 and for batches of 1, 10, 100
+ * and 1000 points, the time per evaluation
+ * - in process: with coco_evaluate_population(),
+ * - blocking: writing the points into a slot of the shared memory and waiting for each batch, and
+ * - pipelined: keeping BENCHMARK_NUMBER_OF_SLOTS batches in flight, one per slot.
+ *
+ * The overhead of the server is a constant per batch (a round trip over the socket), so that the
+ * throughput through the server approaches the one in process as the batches grow.
+ *
+ * Usage: server_benchmark [MIN_SECONDS], where MIN_SECONDS is the minimal time spent in each measurement
+ * (default: 0.2).
+ */
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "coco.h"
+#include "coco_client.h"
+
+#define BENCHMARK_NUMBER_OF_SLOTS 4
+#define BENCHMARK_MAX_BATCH_SIZE 1000
+#define BENCHMARK_MAX_DIMENSION 40
+
+/**
+ * Returns the time of the monotonic clock in seconds.
+ */
+static double benchmark_get_time(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double) now.tv_sec + 1e-9 * (double) now.tv_nsec;
+}
+
+/**
+ * Fills the first number_of_points points of x with uniformly distributed points in [-5, 5]^dimension.
+ */
+static void benchmark_sample_points(coco_random_state_t *random_generator, double *x,
+    const size_t number_of_points, const size_t dimension) {
+  size_t i;
+  for (i = 0; i < number_of_points * dimension; i++)
+    x[i] = 10.0 * coco_random_uniform(random_generator) - 5.0;
+}
+
+/**
+ * Starts the server on the given socket and connects to it.
+ */
+static coco_client_t *benchmark_start_server(const char *socket_path, pid_t *server_pid) {
+
+  coco_client_t *client = NULL;
+  struct timespec delay;
+  int attempt;
+
+  *server_pid = fork();
+  if (*server_pid == 0) {
+    execl("./coco_server", "./coco_server", socket_path, "bbob", "instances: 1",
+        "function_idx: 1,10 dimensions: 2,10,40", (char *) NULL);
+    perror("server_benchmark: failed to start ./coco_server");
+    _exit(EXIT_FAILURE);
+  }
+  if (*server_pid < 0)
+    coco_error("server_benchmark: fork() failed");
+
+  /* The server needs a moment until it listens */
+  delay.tv_sec = 0;
+  delay.tv_nsec = 10000000;
+  for (attempt = 0; (attempt < 500) && (client == NULL); attempt++) {
+    nanosleep(&delay, NULL);
+    if (access(socket_path, F_OK) == 0)
+      client = coco_client_connect(socket_path, BENCHMARK_NUMBER_OF_SLOTS,
+          BENCHMARK_MAX_BATCH_SIZE * (BENCHMARK_MAX_DIMENSION + 1) * sizeof(double));
+  }
+  if (client == NULL)
+    coco_error("server_benchmark: failed to connect to the server");
+  return client;
+}
+
+int main(int argc, char *argv[]) {
+
+  const size_t batch_sizes[] = { 1, 10, 100, 1000 };
+  const size_t number_of_batch_sizes = sizeof(batch_sizes) / sizeof(batch_sizes[0]);
+  const double min_seconds = (argc > 1) ? atof(argv[1]) : 0.2;
+  char socket_path[64];
+  pid_t server_pid;
+  int status;
+  coco_client_t *client;
+  coco_client_problem_t client_problem;
+  coco_suite_t *suite;
+  coco_problem_t *problem;
+  coco_random_state_t *random_generator;
+  double *x, *y, *slot, start, seconds, in_process, blocking, pipelined;
+  size_t dimension, batch_size, calls, i, k;
+
+  coco_set_log_level("warning");
+  sprintf(socket_path, "/tmp/coco_server_benchmark.%lu.socket", (unsigned long) getpid());
+  client = benchmark_start_server(socket_path, &server_pid);
+  suite = coco_suite("bbob", "instances: 1", "function_idx: 1,10 dimensions: 2,10,40");
+  random_generator = coco_random_new(12345);
+  x = coco_allocate_vector(BENCHMARK_MAX_BATCH_SIZE * BENCHMARK_MAX_DIMENSION);
+  y = coco_allocate_vector(BENCHMARK_MAX_BATCH_SIZE);
+
+  printf("%-28s %6s %14s %14s %14s %10s\n", "problem", "batch", "in process", "blocking", "pipelined",
+      "ratio");
+  printf("%-28s %6s %14s %14s %14s %10s\n", "", "", "[ns/eval]", "[ns/eval]", "[ns/eval]", "");
+
+  while ((problem = coco_suite_get_next_problem(suite, NULL)) != NULL) {
+    if (!coco_client_get_next_problem(client, &client_problem)
+        || (client_problem.handle == COCO_SERVER_NO_PROBLEM)
+        || (strcmp(client_problem.id, coco_problem_get_id(problem)) != 0))
+      coco_error("server_benchmark: the server does not serve %s", coco_problem_get_id(problem));
+    dimension = coco_problem_get_dimension(problem);
+
+    for (k = 0; k < number_of_batch_sizes; k++) {
+      batch_size = batch_sizes[k];
+      benchmark_sample_points(random_generator, x, batch_size, dimension);
+      for (i = 0; i < BENCHMARK_NUMBER_OF_SLOTS; i++)
+        memcpy(coco_client_get_slot(client, i), x, batch_size * dimension * sizeof(double));
+
+      /* In process */
+      calls = 0;
+      start = benchmark_get_time();
+      do {
+        coco_evaluate_population(problem, x, batch_size, y);
+        calls++;
+      } while ((seconds = benchmark_get_time() - start) < min_seconds);
+      in_process = 1e9 * seconds / (double) (calls * batch_size);
+
+      /* Through the server, waiting for each batch */
+      slot = coco_client_get_slot(client, 0);
+      calls = 0;
+      start = benchmark_get_time();
+      do {
+        if (!coco_client_submit(client, &client_problem, 0, batch_size) || !coco_client_wait(client, NULL))
+          coco_error("server_benchmark: %s", coco_client_get_error(client));
+        calls++;
+      } while ((seconds = benchmark_get_time() - start) < min_seconds);
+      blocking = 1e9 * seconds / (double) (calls * batch_size);
+      if (slot[batch_size * dimension] != y[0])
+        coco_error("server_benchmark: the server returned a different value for %s", client_problem.id);
+
+      /* Through the server, with one batch in flight per slot */
+      for (i = 0; i < BENCHMARK_NUMBER_OF_SLOTS; i++) {
+        if (!coco_client_submit(client, &client_problem, i, batch_size))
+          coco_error("server_benchmark: %s", coco_client_get_error(client));
+      }
+      calls = 0;
+      start = benchmark_get_time();
+      do {
+        if (!coco_client_wait(client, NULL)
+            || !coco_client_submit(client, &client_problem, calls % BENCHMARK_NUMBER_OF_SLOTS, batch_size))
+          coco_error("server_benchmark: %s", coco_client_get_error(client));
+        calls++;
+      } while ((seconds = benchmark_get_time() - start) < min_seconds);
+      pipelined = 1e9 * seconds / (double) (calls * batch_size);
+      for (i = 0; i < BENCHMARK_NUMBER_OF_SLOTS; i++) {
+        if (!coco_client_wait(client, NULL))
+          coco_error("server_benchmark: %s", coco_client_get_error(client));
+      }
+
+      printf("%-28s %6lu %14.1f %14.1f %14.1f %10.2f\n", client_problem.id, (unsigned long) batch_size,
+          in_process, blocking, pipelined, pipelined / in_process);
+      fflush(stdout);
+    }
+    if (!coco_client_free_problem(client, &client_problem))
+      coco_error("server_benchmark: %s", coco_client_get_error(client));
+  }
+  printf("ratio: time per evaluation pipelined through the server relative to in process\n");
+
+  coco_client_shutdown(client);
+  coco_client_close(client);
+  waitpid(server_pid, &status, 0);
+  coco_free_memory(x);
+  coco_free_memory(y);
+  coco_random_free(random_generator);
+  coco_suite_free(suite);
+  return EXIT_SUCCESS;
+}
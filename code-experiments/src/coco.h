@@ -97,6 +97,59 @@ struct coco_random_state;
  * See coco_random_state for more information on its fields. */
 typedef struct coco_random_state coco_random_state_t;
 
+/** @brief The categories of the time measured with the observer option "timing: 1". */
+typedef enum {
+  COCO_TIMING_CONSTRUCTION,  /**< @brief constructing the problem and adding the observer to it */
+  COCO_TIMING_EVALUATION,    /**< @brief evaluating the problem without the loggers of the observer */
+  COCO_TIMING_LOGGING,       /**< @brief logging the evaluations in the loggers of the observer */
+  COCO_TIMING_OPTIMIZER,     /**< @brief the optimizer between the evaluations */
+  COCO_TIMING_NUMBER_OF_CATEGORIES
+} coco_timing_category_e;
+
+/** @brief The number of bins of the evaluation latency histogram. */
+#define COCO_TIMING_NUMBER_OF_BINS 40
+
+/**
+ * @brief The timing of an observed problem.
+ *
+ * All times are in seconds. Bin i of the latency histogram counts the evaluations that took between 2^i
+ * and 2^(i+1) nanoseconds (the first bin also counts the shorter and the last bin the longer evaluations).
+ */
+typedef struct {
+  double seconds[COCO_TIMING_NUMBER_OF_CATEGORIES]; /**< @brief the wall-clock time of each category */
+  double wall_seconds;            /**< @brief the wall-clock time since the construction started */
+  double cpu_seconds;             /**< @brief the CPU time of the process since the observer was added */
+  size_t number_of_evaluations;   /**< @brief the number of timed evaluations */
+  size_t latency_histogram[COCO_TIMING_NUMBER_OF_BINS]; /**< @brief the evaluation latency histogram */
+} coco_timing_t;
+
+/** @brief The subsystems to which the memory tracked with COCO_MEMORY_TRACKING is attributed. */
+typedef enum {
+  COCO_MEMORY_OTHER,          /**< @brief allocations outside of COCO, e.g. by the optimizer */
+  COCO_MEMORY_SUITE,          /**< @brief the suites */
+  COCO_MEMORY_PROBLEM,        /**< @brief the problems (without their transformations) */
+  COCO_MEMORY_TRANSFORMATION, /**< @brief the transformations of the problems */
+  COCO_MEMORY_LOGGER,         /**< @brief the observers and loggers */
+  COCO_MEMORY_ARCHIVE,        /**< @brief the archives of the solutions kept by the loggers */
+  COCO_MEMORY_NUMBER_OF_SUBSYSTEMS
+} coco_memory_subsystem_e;
+
+/**
+ * @brief The statistics of the memory tracked with COCO_MEMORY_TRACKING.
+ *
+ * The sizes are those requested from coco_allocate_memory() (without the overhead of the tracking).
+ */
+typedef struct {
+  size_t live_bytes[COCO_MEMORY_NUMBER_OF_SUBSYSTEMS];  /**< @brief the currently allocated bytes */
+  size_t peak_bytes[COCO_MEMORY_NUMBER_OF_SUBSYSTEMS];  /**< @brief the maximal allocated bytes */
+  size_t live_blocks[COCO_MEMORY_NUMBER_OF_SUBSYSTEMS]; /**< @brief the currently allocated blocks */
+  size_t allocations[COCO_MEMORY_NUMBER_OF_SUBSYSTEMS]; /**< @brief the number of allocations */
+  size_t total_live_bytes;   /**< @brief the currently allocated bytes of all subsystems */
+  size_t total_peak_bytes;   /**< @brief the maximal allocated bytes of all subsystems */
+  size_t total_live_blocks;  /**< @brief the currently allocated blocks of all subsystems */
+  size_t total_allocations;  /**< @brief the number of allocations of all subsystems */
+} coco_memory_stats_t;
+
 /***********************************************************************************************************/
 
 /**
@@ -114,6 +167,12 @@ void coco_run_benchmark(const char *suite_name,
                         const char *observer_options,
                         coco_optimizer_t optimizer);
 
+/**
+ * @brief Runs the timing experiment on the suite, i.e. measures the seconds per function evaluation of the
+ * optimizer with and without an observer in each dimension.
+ */
+void coco_timing_experiment(coco_suite_t *suite, coco_optimizer_t optimizer, const double min_seconds);
+
 /**
  * @brief Constructs a COCO suite.
  */
@@ -139,6 +198,17 @@ coco_problem_t *coco_suite_get_problem(coco_suite_t *suite, size_t problem_index
  */
 size_t coco_suite_get_number_of_problems(coco_suite_t *suite);
 
+/**
+ * @brief Returns 1 and sets the id, name, dimension and number of objectives of the problem of the suite
+ * defined by problem_index without constructing the problem or 0 if the problem is not part of the suite.
+ */
+int coco_suite_get_problem_metadata(coco_suite_t *suite,
+                                    const size_t problem_index,
+                                    const char **problem_id,
+                                    const char **problem_name,
+                                    size_t *dimension,
+                                    size_t *number_of_objectives);
+
 /**
  * @brief Returns the function number in the suite in position function_idx (counting from 0).
  */
@@ -259,6 +329,75 @@ coco_problem_t *coco_problem_add_observer(coco_problem_t *problem, coco_observer
 
 /***********************************************************************************************************/
 
+/**
+ * @name Methods regarding the results of the memory observer
+ *
+ * The results are numbered in the order in which the problems were observed. The observer can also be a
+ * multi observer that contains a memory observer.
+ */
+/**@{*/
+/**
+ * @brief Returns the number of problems with results in the memory observer.
+ */
+size_t coco_observer_memory_get_number_of_results(const coco_observer_t *observer);
+
+/**
+ * @brief Returns the ID of the problem of the result with the given index.
+ */
+const char *coco_observer_memory_get_problem_id(const coco_observer_t *observer, const size_t result_index);
+
+/**
+ * @brief Returns the number of evaluations of the problem of the result with the given index.
+ */
+size_t coco_observer_memory_get_evaluations(const coco_observer_t *observer, const size_t result_index);
+
+/**
+ * @brief Returns the best value (f - f_opt or the indicator difference) of the result with the given index.
+ */
+double coco_observer_memory_get_best_value(const coco_observer_t *observer, const size_t result_index);
+
+/**
+ * @brief Returns the solution with the best value of the result with the given index and stores its
+ * dimension in number_of_variables.
+ */
+const double *coco_observer_memory_get_best_solution(const coco_observer_t *observer,
+                                                     const size_t result_index,
+                                                     size_t *number_of_variables);
+
+/**
+ * @brief Returns the targets of the result with the given index (from the largest to the smallest one)
+ * and stores their number in number_of_targets.
+ */
+const double *coco_observer_memory_get_targets(const coco_observer_t *observer,
+                                               const size_t result_index,
+                                               size_t *number_of_targets);
+
+/**
+ * @brief Returns the evaluations in which the targets of the result with the given index were first hit
+ * (0 for targets that were not hit) and stores their number in number_of_targets.
+ */
+const size_t *coco_observer_memory_get_target_hits(const coco_observer_t *observer,
+                                                   const size_t result_index,
+                                                   size_t *number_of_targets);
+
+/**
+ * @brief Stores the trajectory of the best value of the result with the given index in evaluations and
+ * values and returns its length.
+ */
+size_t coco_observer_memory_get_trajectory(const coco_observer_t *observer,
+                                           const size_t result_index,
+                                           const size_t **evaluations,
+                                           const double **values);
+
+/**
+ * @brief Removes all results from the memory observer (no problem may be observed at that time). If the
+ * observer writes a summary, the results are added to it first.
+ */
+void coco_observer_memory_clear(coco_observer_t *observer);
+/**@}*/
+
+/***********************************************************************************************************/
+
 /**
  * @name Methods regarding COCO problem
  */
@@ -268,6 +407,15 @@ coco_problem_t *coco_problem_add_observer(coco_problem_t *problem, coco_observer
  */
 void coco_evaluate_function(coco_problem_t *problem, const double *x, double *y);
 
+/**
+ * @brief Evaluates the problem function in number_of_solutions points stored one after another in x and
+ * saves the results one after another in y.
+ */
+void coco_evaluate_population(coco_problem_t *problem,
+                              const double *x,
+                              const size_t number_of_solutions,
+                              double *y);
+
 /**
  * @brief Evaluates the problem constraints in point x and save the result in y.
  */
@@ -344,6 +492,12 @@ size_t coco_problem_get_suite_dep_index(coco_problem_t *problem);
  * @brief Returns an initial solution, i.e. a feasible variable setting, to the problem.
  */
 void coco_problem_get_initial_solution(const coco_problem_t *problem, double *initial_solution);
+
+/**
+ * @brief Returns the timing of the problem observed by an observer with the option "timing: 1" (updated
+ * to the current time) or NULL if the problem is not timed.
+ */
+const coco_timing_t *coco_problem_get_timing(coco_problem_t *problem);
 /**@}*/
 
 /***********************************************************************************************************/
@@ -395,6 +549,12 @@ double *coco_allocate_vector(const size_t size);
  * @brief Frees the allocated memory.
  */
 void coco_free_memory(void *data);
+
+/**
+ * @brief Returns the statistics of the memory allocated by coco_allocate_memory() or NULL if COCO was
+ * compiled without COCO_MEMORY_TRACKING.
+ */
+const coco_memory_stats_t *coco_memory_stats(void);
 /**@}*/
 
 /***********************************************************************************************************/
@@ -444,6 +604,18 @@ int coco_remove_directory(const char *path);
  * @brief Formatted string duplication.
  */
 char *coco_strdupf(const char *str, ...);
+
+/**
+ * @brief Converts a binary data file of the bbob observer (option "format: binary") to the text format.
+ */
+void coco_bbob_binary_to_text(const char *binary_file_name, const char *text_file_name);
+
+/**
+ * @brief Merges the output folders of the bbob or bbob-biobj observers of runs on disjoint batches of a
+ * suite (see the "batch" suite option) into the new target folder.
+ */
+void coco_merge_result_folders(const char *target_folder, const size_t number_of_folders,
+    const char **folders);
 /**@}*/
 
 /***********************************************************************************************************/
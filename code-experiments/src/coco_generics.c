@@ -1,8 +1,11 @@
+#include "coco_platform.h"
+
 #include <assert.h>
 #include <stddef.h>
 
 #include "coco.h"
 #include "coco_internal.h"
+#include "coco_probes.h"
 
 /**
  * Evaluates the problem function, increases the number of evaluations and updates the best observed value
@@ -19,8 +22,10 @@ void coco_evaluate_function(coco_problem_t *problem, const double *x, double *y)
   /* implements a safer version of self->evaluate(self, x, y) */
   assert(problem != NULL);
   assert(problem->evaluate_function != NULL);
+  COCO_PROBE4(evaluate_entry, problem, problem->problem_id, problem->number_of_variables, x);
   problem->evaluate_function(problem, x, y);
   problem->evaluations++; /* each derived class has its own counter, only the most outer will be visible */
+  COCO_PROBE4(evaluate_exit, problem, problem->problem_id, problem->evaluations, y);
 #if 1
   /* A little bit of bookkeeping */
   if (y[0] < problem->best_observed_fvalue[0]) {
@@ -30,6 +35,46 @@ void coco_evaluate_function(coco_problem_t *problem, const double *x, double *y)
 #endif
 }
 
+/**
+ * Evaluates the problem function in a block of number_of_solutions points, increases the number of
+ * evaluations accordingly and updates the best observed value and the best observed evaluation number.
+ * The result is the same as calling coco_evaluate_function for each point in turn, but problems (and
+ * observers) that implement evaluate_population can process the whole block at once.
+ *
+ * @note Both x and y must point to correctly sized allocated memory regions.
+ *
+ * @param problem The given COCO problem.
+ * @param x The decision vectors stored one after another (number_of_solutions * dimension values).
+ * @param number_of_solutions The number of decision vectors in x.
+ * @param y The objective vectors that are the result of the evaluation stored one after another
+ * (number_of_solutions * number_of_objectives values).
+ */
+void coco_evaluate_population(coco_problem_t *problem,
+                              const double *x,
+                              const size_t number_of_solutions,
+                              double *y) {
+  size_t i;
+  assert(problem != NULL);
+
+  COCO_PROBE4(evaluate_population_entry, problem, problem->problem_id, number_of_solutions, x);
+  if (problem->evaluate_population == NULL) {
+    for (i = 0; i < number_of_solutions; i++) {
+      coco_evaluate_function(problem, &x[i * problem->number_of_variables],
+          &y[i * problem->number_of_objectives]);
+    }
+  } else {
+    problem->evaluate_population(problem, x, number_of_solutions, y);
+    for (i = 0; i < number_of_solutions; i++) {
+      problem->evaluations++;
+      if (y[i * problem->number_of_objectives] < problem->best_observed_fvalue[0]) {
+        problem->best_observed_fvalue[0] = y[i * problem->number_of_objectives];
+        problem->best_observed_evaluation[0] = problem->evaluations;
+      }
+    }
+  }
+  COCO_PROBE4(evaluate_population_exit, problem, problem->problem_id, problem->evaluations, y);
+}
+
 size_t coco_problem_get_evaluations(coco_problem_t *problem) {
   assert(problem != NULL);
   return problem->evaluations;
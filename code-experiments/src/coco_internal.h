@@ -10,6 +10,10 @@
 
 typedef void (*coco_initial_solution_function_t)(const coco_problem_t *self, double *y);
 typedef void (*coco_evaluate_function_t)(coco_problem_t *self, const double *x, double *y);
+typedef void (*coco_evaluate_population_function_t)(coco_problem_t *self,
+                                                    const double *x,
+                                                    const size_t number_of_solutions,
+                                                    double *y);
 typedef void (*coco_recommendation_function_t)(coco_problem_t *self,
                                                const double *x,
                                                size_t number_of_solutions);
@@ -46,6 +50,9 @@ typedef void (*coco_free_function_t)(coco_problem_t *self);
  *
  * problem_type - Type of the problem. May be NULL to indicate that no type is known.
  *
+ * evaluate_population - Optional method evaluating a whole block of solutions at once. May be NULL,
+ *   in which case coco_evaluate_population() falls back to evaluating the solutions one by one.
+ *
  * suite_dep_index - Index of the problem in the current/parent benchmark suite
  *
  * suite_dep_function - Problem function in the current/parent benchmark suite
@@ -58,6 +65,7 @@ typedef void (*coco_free_function_t)(coco_problem_t *self);
 struct coco_problem {
   coco_initial_solution_function_t initial_solution;
   coco_evaluate_function_t evaluate_function;
+  coco_evaluate_population_function_t evaluate_population;
   coco_evaluate_function_t evaluate_constraint;
   coco_recommendation_function_t recommend_solutions;
   coco_free_function_t free_problem; /* AKA free_self */
@@ -98,6 +106,20 @@ struct coco_problem {
 
 typedef void (*coco_observer_data_free_function_t)(void *data);
 typedef coco_problem_t *(*coco_logger_initialize_function_t)(coco_observer_t *self, coco_problem_t *problem);
+typedef void *(*coco_logger_allocate_function_t)(coco_observer_t *self, coco_problem_t *problem);
+typedef void (*coco_logger_log_function_t)(void *logger,
+                                           const size_t number_of_evaluations,
+                                           const double *x,
+                                           const double *y);
+typedef void (*coco_logger_free_function_t)(void *logger);
+
+/* The asynchronous writer of a logger, see logger_async.c */
+typedef struct logger_async logger_async_t;
+
+/* The policies for flushing the output files of the loggers, see logger_flush.c */
+typedef enum {
+  COCO_FLUSH_DEFAULT, COCO_FLUSH_EVERY, COCO_FLUSH_INTERVAL, COCO_FLUSH_ON_TARGET, COCO_FLUSH_ON_CLOSE
+} coco_flush_mode_e;
 
 /**
  * Description of a COCO observer (instance)
@@ -112,6 +134,21 @@ typedef coco_problem_t *(*coco_logger_initialize_function_t)(coco_observer_t *se
  *
  * data - Void pointer that can be used to store data specific to any observer
  *
+ * async_logging, async_buffer_size - Whether the loggers write their output in a background thread and the
+ *   number of evaluations that can wait to be logged before the evaluations block
+ *
+ * async_writers - List of the asynchronous writers of the loggers that are still open
+ *
+ * logger_allocate_function, logger_log_function, logger_free_function - Allocate the data of a logger of
+ *   this observer for the given problem, log the evaluation with the given number into it without evaluating
+ *   the problem again, and finish the output and free the contents of the data (the multi observer uses them
+ *   to dispatch one evaluation to several loggers within a single layer)
+ *
+ * flush_mode, flush_interval - When the loggers flush their output files (COCO_FLUSH_DEFAULT leaves the
+ *   choice to the logger) and the time between two flushes in milliseconds for COCO_FLUSH_INTERVAL
+ *
+ * timing - Whether the observed problems are wrapped into the timing layers, see coco_timing.c
+ *
  */
 struct coco_observer {
 
@@ -121,14 +158,29 @@ struct coco_observer {
   char *algorithm_info;
   int precision_x;
   int precision_f;
+  int async_logging;
+  size_t async_buffer_size;
+  logger_async_t *async_writers;
+  coco_flush_mode_e flush_mode;
+  double flush_interval;
+  int timing;
   void *data;
 
   coco_observer_data_free_function_t data_free_function;
   coco_logger_initialize_function_t logger_initialize_function;
+  coco_logger_allocate_function_t logger_allocate_function;
+  coco_logger_log_function_t logger_log_function;
+  coco_logger_free_function_t logger_free_function;
 };
 
 typedef void (*coco_suite_data_free_function_t)(void *data);
 
+/* The work queue shared by cooperating processes, see coco_work_queue.c */
+typedef struct coco_work_queue coco_work_queue_t;
+
+/* The construction of the next problem of a suite on a helper thread, see coco_prefetch.c */
+typedef struct coco_prefetch coco_prefetch_t;
+
 struct coco_suite {
 
   char *suite_name;
@@ -146,8 +198,24 @@ struct coco_suite {
   long current_instance_idx;
   char *default_instances;
 
+  /* Whether the problems of a function in a dimension (at index function_idx + dimension_idx *
+   * number_of_functions) belong to the batch chosen with the "batch" suite option (NULL if the suite is not
+   * split into batches) */
+  unsigned char *batch_units;
+
+  /* The work queue from which the functions in dimensions are claimed with the "work_queue" suite option
+   * (NULL if the suite is iterated in the usual order) */
+  coco_work_queue_t *work_queue;
+
+  /* The construction of the following problem on a helper thread with the "prefetch" suite option (NULL if
+   * the problems are constructed when they are asked for) */
+  coco_prefetch_t *prefetch;
+
   coco_problem_t *current_problem;
 
+  char *metadata_problem_id;
+  char *metadata_problem_name;
+
   void *data;
   coco_suite_data_free_function_t data_free_function;
 
@@ -0,0 +1,275 @@
+#include "coco_platform.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "coco.h"
+
+/**
+ * Optional tracking of the memory allocated by coco_allocate_memory().
+ *
+ * The tracking is compiled only if COCO is compiled with COCO_MEMORY_TRACKING defined (see
+ * coco_platform.h). Each block then gets a header that links it into a list of the outstanding blocks and
+ * records its size, sequence number and subsystem, i.e., the subsystem that was current when the block was
+ * allocated. The current subsystem is set with coco_memory_set_subsystem() at the entry points of the
+ * suites, problems, transformations, loggers and archives and restored when they return. Allocations done
+ * elsewhere, e.g. by the optimizer, are attributed to COCO_MEMORY_OTHER. Each thread has its own current
+ * subsystem, so that the writer threads of asynchronous logging and the prefetching threads attribute their
+ * allocations independently of the thread evaluating the problems. The statistics of the live and peak
+ * bytes per subsystem are returned by coco_memory_stats() and the outstanding blocks are reported at the
+ * exit of the program.
+ *
+ * Without COCO_MEMORY_TRACKING, coco_memory_set_subsystem() does nothing and coco_memory_stats() returns
+ * NULL.
+ */
+
+#if defined(HAVE_MEMORY_TRACKING)
+
+#if defined(HAVE_ASYNC_LOGGING) || defined(HAVE_PREFETCH)
+
+/* The key of the subsystem to which the allocations of a thread are currently attributed (a thread
+ * that has not set it yet has the value NULL, i.e., COCO_MEMORY_OTHER). */
+static pthread_key_t coco_memory_subsystem_key;
+static pthread_once_t coco_memory_subsystem_key_once = PTHREAD_ONCE_INIT;
+
+static void coco_memory_create_subsystem_key(void) {
+  pthread_key_create(&coco_memory_subsystem_key, NULL);
+}
+
+/**
+ * Returns the subsystem to which the allocations of the calling thread are currently attributed.
+ */
+static coco_memory_subsystem_e coco_memory_get_subsystem(void) {
+  pthread_once(&coco_memory_subsystem_key_once, coco_memory_create_subsystem_key);
+  return (coco_memory_subsystem_e) (size_t) pthread_getspecific(coco_memory_subsystem_key);
+}
+
+/**
+ * Sets the subsystem to which the following allocations of the calling thread are attributed.
+ */
+static void coco_memory_put_subsystem(const coco_memory_subsystem_e subsystem) {
+  pthread_once(&coco_memory_subsystem_key_once, coco_memory_create_subsystem_key);
+  pthread_setspecific(coco_memory_subsystem_key, (void *) (size_t) subsystem);
+}
+
+#else
+
+/* The subsystem to which the allocations are currently attributed. */
+static coco_memory_subsystem_e coco_memory_subsystem = COCO_MEMORY_OTHER;
+
+static coco_memory_subsystem_e coco_memory_get_subsystem(void) {
+  return coco_memory_subsystem;
+}
+
+static void coco_memory_put_subsystem(const coco_memory_subsystem_e subsystem) {
+  coco_memory_subsystem = subsystem;
+}
+
+#endif
+
+/**
+ * Sets the subsystem to which the following allocations of the calling thread are attributed and
+ * returns the previous one, which should be restored when the subsystem is left.
+ */
+static coco_memory_subsystem_e coco_memory_set_subsystem(const coco_memory_subsystem_e subsystem) {
+  coco_memory_subsystem_e previous_subsystem = coco_memory_get_subsystem();
+  coco_memory_put_subsystem(subsystem);
+  return previous_subsystem;
+}
+
+/**
+ * Returns the name of the subsystem.
+ */
+static const char *coco_memory_get_subsystem_name(const coco_memory_subsystem_e subsystem) {
+  static const char *names[COCO_MEMORY_NUMBER_OF_SUBSYSTEMS] = { "other", "suite", "problem",
+      "transformation", "logger", "archive" };
+  return names[subsystem];
+}
+
+/* The value in the header of the tracked blocks used to detect foreign and corrupted blocks. */
+#define COCO_MEMORY_MAGIC 0xc0c0a11cUL
+
+/* The maximal number of outstanding blocks listed at the exit of the program. */
+#define COCO_MEMORY_MAX_REPORTED_BLOCKS 20
+
+/**
+ * The header of a tracked block.
+ *
+ * The union with the alignment members makes sure that the memory following the header is aligned for any
+ * type.
+ */
+typedef union coco_memory_header {
+  struct {
+    union coco_memory_header *previous; /* the previously allocated outstanding block */
+    union coco_memory_header *next;     /* the next allocated outstanding block */
+    size_t size;                        /* the size requested by the caller */
+    size_t sequence_number;             /* the number of the allocation */
+    coco_memory_subsystem_e subsystem;  /* the subsystem of the allocation */
+    unsigned long magic;                /* COCO_MEMORY_MAGIC while the block is allocated */
+  } block;
+  long double alignment_long_double;
+  void *alignment_pointer;
+} coco_memory_header_t;
+
+/* The statistics of the tracked memory. */
+static coco_memory_stats_t coco_memory_statistics;
+
+/* The oldest and the newest outstanding blocks. */
+static coco_memory_header_t *coco_memory_first = NULL, *coco_memory_last = NULL;
+
+/* Whether the report at the exit of the program has been registered. */
+static int coco_memory_report_registered = 0;
+
+#if defined(HAVE_ASYNC_LOGGING) || defined(HAVE_PREFETCH)
+/* Guards the statistics and the list, since the writer threads of the loggers and the prefetching
+ * threads of the suites allocate memory. */
+static pthread_mutex_t coco_memory_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define coco_memory_lock() pthread_mutex_lock(&coco_memory_mutex)
+#define coco_memory_unlock() pthread_mutex_unlock(&coco_memory_mutex)
+#else
+#define coco_memory_lock() ((void) 0)
+#define coco_memory_unlock() ((void) 0)
+#endif
+
+/**
+ * Reports the peak bytes of the subsystems and the blocks that are still allocated at the exit of
+ * the program (the oldest ones first).
+ */
+static void coco_memory_report(void) {
+  const coco_memory_stats_t *stats = &coco_memory_statistics;
+  coco_memory_header_t *header;
+  size_t i;
+
+  coco_info("Memory: peak of %lu bytes (%lu allocations)", (unsigned long) stats->total_peak_bytes,
+      (unsigned long) stats->total_allocations);
+  for (i = 0; i < COCO_MEMORY_NUMBER_OF_SUBSYSTEMS; i++) {
+    if (stats->allocations[i] == 0)
+      continue;
+    coco_info("Memory: peak of %lu bytes (%lu allocations) in subsystem %s",
+        (unsigned long) stats->peak_bytes[i], (unsigned long) stats->allocations[i],
+        coco_memory_get_subsystem_name((coco_memory_subsystem_e) i));
+  }
+
+  if (stats->total_live_blocks == 0)
+    return;
+  coco_warning("Memory: %lu bytes in %lu blocks still allocated at exit",
+      (unsigned long) stats->total_live_bytes, (unsigned long) stats->total_live_blocks);
+  for (i = 0, header = coco_memory_first; header != NULL; i++, header = header->block.next) {
+    if (i == COCO_MEMORY_MAX_REPORTED_BLOCKS) {
+      coco_warning("Memory: ... and %lu more blocks", (unsigned long) (stats->total_live_blocks - i));
+      break;
+    }
+    coco_warning("Memory: block %lu of %lu bytes at %p allocated in subsystem %s",
+        (unsigned long) header->block.sequence_number, (unsigned long) header->block.size,
+        (void *) (header + 1), coco_memory_get_subsystem_name(header->block.subsystem));
+  }
+}
+
+/**
+ * Allocates a tracked block of the given size (or returns NULL if malloc fails).
+ */
+static void *coco_memory_allocate_tracked(const size_t size) {
+  coco_memory_stats_t *stats = &coco_memory_statistics;
+  coco_memory_header_t *header;
+  coco_memory_subsystem_e subsystem = coco_memory_get_subsystem();
+
+  if (size > (size_t) -1 - sizeof(*header))
+    return NULL;
+  header = (coco_memory_header_t *) malloc(sizeof(*header) + size);
+  if (header == NULL)
+    return NULL;
+  header->block.size = size;
+  header->block.subsystem = subsystem;
+  header->block.magic = COCO_MEMORY_MAGIC;
+  header->block.next = NULL;
+
+  coco_memory_lock();
+  if (!coco_memory_report_registered) {
+    atexit(coco_memory_report);
+    coco_memory_report_registered = 1;
+  }
+  header->block.sequence_number = ++stats->total_allocations;
+  header->block.previous = coco_memory_last;
+  if (coco_memory_last != NULL)
+    coco_memory_last->block.next = header;
+  else
+    coco_memory_first = header;
+  coco_memory_last = header;
+
+  stats->allocations[subsystem]++;
+  stats->live_blocks[subsystem]++;
+  stats->live_bytes[subsystem] += size;
+  if (stats->live_bytes[subsystem] > stats->peak_bytes[subsystem])
+    stats->peak_bytes[subsystem] = stats->live_bytes[subsystem];
+  stats->total_live_blocks++;
+  stats->total_live_bytes += size;
+  if (stats->total_live_bytes > stats->total_peak_bytes)
+    stats->total_peak_bytes = stats->total_live_bytes;
+  coco_memory_unlock();
+
+  return header + 1;
+}
+
+/**
+ * Frees a tracked block (triggers a coco_error if the block was not allocated by
+ * coco_memory_allocate_tracked() or has already been freed).
+ */
+static void coco_memory_free_tracked(void *data) {
+  coco_memory_stats_t *stats = &coco_memory_statistics;
+  coco_memory_header_t *header;
+
+  if (data == NULL)
+    return;
+  header = (coco_memory_header_t *) data - 1;
+  if (header->block.magic != COCO_MEMORY_MAGIC) {
+    coco_error("coco_free_memory(): %p was not allocated by coco_allocate_memory() or was freed twice",
+        data);
+    return; /* never reached */
+  }
+  header->block.magic = 0;
+
+  coco_memory_lock();
+  if (header->block.previous != NULL)
+    header->block.previous->block.next = header->block.next;
+  else
+    coco_memory_first = header->block.next;
+  if (header->block.next != NULL)
+    header->block.next->block.previous = header->block.previous;
+  else
+    coco_memory_last = header->block.previous;
+
+  stats->live_blocks[header->block.subsystem]--;
+  stats->live_bytes[header->block.subsystem] -= header->block.size;
+  stats->total_live_blocks--;
+  stats->total_live_bytes -= header->block.size;
+  coco_memory_unlock();
+
+  free(header);
+}
+
+/**
+ * The statistics are updated by each allocation and deallocation; a block is attributed to the subsystem
+ * that was current when it was allocated.
+ */
+const coco_memory_stats_t *coco_memory_stats(void) {
+  return &coco_memory_statistics;
+}
+
+#else
+
+/**
+ * Does nothing and returns COCO_MEMORY_OTHER, since COCO was compiled without COCO_MEMORY_TRACKING.
+ */
+static coco_memory_subsystem_e coco_memory_set_subsystem(const coco_memory_subsystem_e subsystem) {
+  (void) subsystem; /* unused */
+  return COCO_MEMORY_OTHER;
+}
+
+/**
+ * Returns NULL, since COCO was compiled without COCO_MEMORY_TRACKING.
+ */
+const coco_memory_stats_t *coco_memory_stats(void) {
+  return NULL;
+}
+
+#endif
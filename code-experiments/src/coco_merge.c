@@ -0,0 +1,479 @@
+#include "coco_platform.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "coco.h"
+#include "coco_internal.h"
+#include "coco_utilities.c"
+#include "coco_timing.c"
+
+/**
+ * Merging of the output folders of runs on disjoint parts of a suite (see coco_merge_result_folders()).
+ *
+ * The bbob and bbob-biobj observers write the data of the problems with the same function and dimension to
+ * common data files and add an entry for each function and dimension to the ".info" files in the top level
+ * of the output folder. If the suite is split with the "batch" suite option (or otherwise) such that the
+ * problems with the same function and dimension are run together, the data files of the runs are disjoint
+ * and only the ".info" files need to be merged. Their entries are sorted by dimension and function, i.e., in
+ * the order in which a single run over the suite would have written them. The same holds for the lines of
+ * the timing summary files written with the observer option "timing: 1" (see coco_timing.c).
+ */
+
+/**
+ * An entry of an ".info" file, i.e., the lines about a function in a dimension.
+ */
+typedef struct {
+  size_t dimension;
+  size_t function;
+  size_t order;  /* The number of the entry in the order of reading (to make the sorting stable) */
+  char *lines;   /* The lines of the entry without the final newline */
+} coco_merge_info_entry_t;
+
+/**
+ * An ".info" file (or a timing summary file) that is merged from the files with the same name in the
+ * folders.
+ */
+typedef struct {
+  char *name;
+  char *header;  /* The lines before the first entry (NULL if there are none) */
+  int has_final_newline; /* Whether the last line ends with a newline */
+  coco_merge_info_entry_t *entries;
+  size_t number_of_entries;
+  size_t max_number_of_entries;
+} coco_merge_info_file_t;
+
+/**
+ * The ".info" files found so far.
+ */
+typedef struct {
+  coco_merge_info_file_t *info_files;
+  size_t number_of_info_files;
+  size_t max_number_of_info_files;
+} coco_merge_t;
+
+/**
+ * Makes room in the array of elements of the given size for at least one more element and returns the
+ * (possibly reallocated) array.
+ */
+static void *coco_merge_ensure_capacity(void *array, const size_t element_size, const size_t number_of_elements,
+    size_t *max_number_of_elements) {
+
+  void *new_array;
+
+  if (number_of_elements < *max_number_of_elements)
+    return array;
+  *max_number_of_elements = 2 * *max_number_of_elements + 8;
+  new_array = coco_allocate_memory(*max_number_of_elements * element_size);
+  if (array != NULL) {
+    memcpy(new_array, array, number_of_elements * element_size);
+    coco_free_memory(array);
+  }
+  return new_array;
+}
+
+/**
+ * Compares two strings given by pointers (for qsort()).
+ */
+static int coco_merge_compare_names(const void *a, const void *b) {
+  return strcmp(*(char *const *) a, *(char *const *) b);
+}
+
+/**
+ * Compares two entries of an ".info" file by dimension, function and order (for qsort()).
+ */
+static int coco_merge_compare_info_entries(const void *a, const void *b) {
+  const coco_merge_info_entry_t *entry_a = (const coco_merge_info_entry_t *) a;
+  const coco_merge_info_entry_t *entry_b = (const coco_merge_info_entry_t *) b;
+
+  if (entry_a->dimension != entry_b->dimension)
+    return (entry_a->dimension < entry_b->dimension) ? -1 : 1;
+  if (entry_a->function != entry_b->function)
+    return (entry_a->function < entry_b->function) ? -1 : 1;
+  if (entry_a->order != entry_b->order)
+    return (entry_a->order < entry_b->order) ? -1 : 1;
+  return 0;
+}
+
+/**
+ * Returns the names of the files and directories in the given directory (without "." and "..") sorted
+ * alphabetically. The names and the array need to be freed by the caller.
+ */
+static char **coco_merge_list_directory(const char *path, size_t *number_of_names) {
+
+  char **names = NULL;
+  size_t max_number_of_names = 0;
+#if _MSC_VER
+  WIN32_FIND_DATA find_data_file;
+  HANDLE find_handle;
+  char *pattern;
+
+  *number_of_names = 0;
+  pattern = coco_strdupf("%s\\*.*", path);
+  find_handle = FindFirstFile(pattern, &find_data_file);
+  coco_free_memory(pattern);
+  if (find_handle == INVALID_HANDLE_VALUE) {
+    coco_error("coco_merge_result_folders(): failed to read directory '%s'", path);
+    return NULL; /* Never reached */
+  }
+  do {
+    if (strcmp(find_data_file.cFileName, ".") != 0 && strcmp(find_data_file.cFileName, "..") != 0) {
+      names = (char **) coco_merge_ensure_capacity(names, sizeof(char *), *number_of_names,
+          &max_number_of_names);
+      names[(*number_of_names)++] = coco_strdup(find_data_file.cFileName);
+    }
+  } while (FindNextFile(find_handle, &find_data_file));
+  FindClose(find_handle);
+#else
+  DIR *directory;
+  struct dirent *entry;
+
+  *number_of_names = 0;
+  directory = opendir(path);
+  if (directory == NULL) {
+    coco_error("coco_merge_result_folders(): failed to read directory '%s'", path);
+    return NULL; /* Never reached */
+  }
+  while ((entry = readdir(directory)) != NULL) {
+    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+      names = (char **) coco_merge_ensure_capacity(names, sizeof(char *), *number_of_names,
+          &max_number_of_names);
+      names[(*number_of_names)++] = coco_strdup(entry->d_name);
+    }
+  }
+  closedir(directory);
+#endif
+
+  if (*number_of_names > 1)
+    qsort(names, *number_of_names, sizeof(char *), coco_merge_compare_names);
+  return names;
+}
+
+/**
+ * Copies the source file to the destination file, which must not exist yet.
+ */
+static void coco_merge_copy_file(const char *source, const char *destination) {
+
+  FILE *source_file, *destination_file;
+  char buffer[4096];
+  size_t length;
+
+  if (coco_file_exists(destination)) {
+    coco_error("coco_merge_result_folders(): '%s' exists in more than one of the folders (the data of a "
+        "function in a dimension must come from a single run)", destination);
+    return; /* Never reached */
+  }
+  source_file = fopen(source, "rb");
+  if (source_file == NULL) {
+    coco_error("coco_merge_result_folders(): failed to open file '%s'", source);
+    return; /* Never reached */
+  }
+  destination_file = fopen(destination, "wb");
+  if (destination_file == NULL) {
+    fclose(source_file);
+    coco_error("coco_merge_result_folders(): failed to open file '%s'", destination);
+    return; /* Never reached */
+  }
+  while ((length = fread(buffer, 1, sizeof(buffer), source_file)) > 0) {
+    if (fwrite(buffer, 1, length, destination_file) != length) {
+      fclose(source_file);
+      fclose(destination_file);
+      coco_error("coco_merge_result_folders(): failed to write file '%s'", destination);
+      return; /* Never reached */
+    }
+  }
+  fclose(source_file);
+  fclose(destination_file);
+}
+
+/**
+ * Returns the content of the file as a null-terminated string that needs to be freed by the caller.
+ */
+static char *coco_merge_read_file(const char *path) {
+
+  FILE *file;
+  char *content;
+  size_t length = 0, max_length = 0, read_length;
+
+  file = fopen(path, "rb");
+  if (file == NULL) {
+    coco_error("coco_merge_result_folders(): failed to open file '%s'", path);
+    return NULL; /* Never reached */
+  }
+  max_length = 4096;
+  content = (char *) coco_allocate_memory(max_length);
+  while ((read_length = fread(content + length, 1, max_length - length - 1, file)) > 0) {
+    length += read_length;
+    if (length + 1 == max_length)
+      content = (char *) coco_merge_ensure_capacity(content, 1, max_length, &max_length);
+  }
+  content[length] = '\0';
+  fclose(file);
+  return content;
+}
+
+/**
+ * Appends the line to the lines (separated by a newline) and returns the new lines.
+ */
+static char *coco_merge_append_line(char *lines, const char *line) {
+  char *new_lines;
+
+  if (lines == NULL)
+    return coco_strdup(line);
+  new_lines = (char *) coco_allocate_memory(strlen(lines) + strlen(line) + 2);
+  sprintf(new_lines, "%s\n%s", lines, line);
+  coco_free_memory(lines);
+  return new_lines;
+}
+
+/**
+ * Returns the merged file with the given name, which is added to merge (and is_new_file set) if it is not
+ * found.
+ */
+static coco_merge_info_file_t *coco_merge_get_info_file(coco_merge_t *merge, const char *name,
+    int *is_new_file) {
+
+  coco_merge_info_file_t *info_file;
+  size_t i;
+
+  *is_new_file = 0;
+  for (i = 0; i < merge->number_of_info_files; i++) {
+    if (strcmp(merge->info_files[i].name, name) == 0)
+      return &merge->info_files[i];
+  }
+  merge->info_files = (coco_merge_info_file_t *) coco_merge_ensure_capacity(merge->info_files,
+      sizeof(coco_merge_info_file_t), merge->number_of_info_files, &merge->max_number_of_info_files);
+  info_file = &merge->info_files[merge->number_of_info_files++];
+  info_file->name = coco_strdup(name);
+  info_file->header = NULL;
+  info_file->has_final_newline = 0;
+  info_file->entries = NULL;
+  info_file->number_of_entries = 0;
+  info_file->max_number_of_entries = 0;
+  *is_new_file = 1;
+  return info_file;
+}
+
+/**
+ * Adds an entry with the given line for the function in the dimension to the merged file and returns it.
+ */
+static coco_merge_info_entry_t *coco_merge_add_info_entry(coco_merge_info_file_t *info_file,
+    const unsigned long function, const unsigned long dimension, const char *line) {
+
+  coco_merge_info_entry_t *entry;
+
+  info_file->entries = (coco_merge_info_entry_t *) coco_merge_ensure_capacity(info_file->entries,
+      sizeof(coco_merge_info_entry_t), info_file->number_of_entries, &info_file->max_number_of_entries);
+  entry = &info_file->entries[info_file->number_of_entries];
+  entry->dimension = (size_t) dimension;
+  entry->function = (size_t) function;
+  entry->order = info_file->number_of_entries++;
+  entry->lines = coco_strdup(line);
+  return entry;
+}
+
+/**
+ * Adds the entries of the ".info" file at the given path to the merged ".info" file with the given name.
+ *
+ * The bbob observer writes an entry of three lines (starting with "funcId = ") for each dimension and no
+ * header, the bbob-biobj observer a header of two lines and an entry of one line (starting with
+ * "function = ") for each function and dimension. Empty lines are skipped.
+ */
+static void coco_merge_read_info_file(coco_merge_t *merge, const char *path, const char *name) {
+
+  coco_merge_info_file_t *info_file;
+  coco_merge_info_entry_t *entry;
+  char *content, *line, *next_line;
+  unsigned long function, dimension;
+  int is_bbob_format = -1, is_new_file;
+  size_t length;
+
+  info_file = coco_merge_get_info_file(merge, name, &is_new_file);
+  content = coco_merge_read_file(path);
+  entry = NULL;
+  for (line = content; line != NULL; line = next_line) {
+    next_line = strchr(line, '\n');
+    if (next_line != NULL)
+      *(next_line++) = '\0';
+    length = strlen(line);
+    if ((length > 0) && (line[length - 1] == '\r'))
+      line[--length] = '\0';
+    if (strspn(line, " \t") == length)
+      continue;
+    if (is_bbob_format < 0)
+      is_bbob_format = (strncmp(line, "funcId", 6) == 0);
+
+    if ((sscanf(line, "funcId = %lu, DIM = %lu", &function, &dimension) == 2)
+        || (sscanf(line, "function = %lu, dim = %lu", &function, &dimension) == 2)) {
+      entry = coco_merge_add_info_entry(info_file, function, dimension, line);
+    } else if ((entry != NULL) && is_bbob_format) {
+      entry->lines = coco_merge_append_line(entry->lines, line);
+    } else if (entry == NULL) {
+      /* The header is taken from the first file with the given name */
+      if (is_new_file)
+        info_file->header = coco_merge_append_line(info_file->header, line);
+    } else {
+      coco_free_memory(content);
+      coco_error("coco_merge_result_folders(): unexpected line in '%s': %s", path, line);
+      return; /* Never reached */
+    }
+  }
+  coco_free_memory(content);
+}
+
+/**
+ * Adds the lines of the timing summary file at the given path to the merged timing summary with the given
+ * name. The lines that start with "%" form the header, while each other line holds the timing of a problem
+ * with the problem id (e.g., "bbob_f001_i01_d02") in front, which gives its function and dimension.
+ */
+static void coco_merge_read_timing_file(coco_merge_t *merge, const char *path, const char *name) {
+
+  coco_merge_info_file_t *info_file;
+  char *content, *line, *next_line, *id_end;
+  unsigned long function, instance, dimension;
+  int is_new_file;
+  size_t length;
+
+  info_file = coco_merge_get_info_file(merge, name, &is_new_file);
+  info_file->has_final_newline = 1;
+
+  content = coco_merge_read_file(path);
+  for (line = content; line != NULL; line = next_line) {
+    next_line = strchr(line, '\n');
+    if (next_line != NULL)
+      *(next_line++) = '\0';
+    length = strlen(line);
+    if ((length > 0) && (line[length - 1] == '\r'))
+      line[--length] = '\0';
+    if (strspn(line, " \t") == length)
+      continue;
+
+    if (line[0] == '%') {
+      /* The header is taken from the first file with the given name */
+      if (is_new_file)
+        info_file->header = coco_merge_append_line(info_file->header, line);
+      continue;
+    }
+    /* The suite name in front of the function, instance and dimension can contain any character */
+    id_end = line + strcspn(line, " ");
+    while ((id_end > line) && (*id_end != '_' || (id_end[1] != 'f')))
+      id_end--;
+    if (sscanf(id_end, "_f%lu_i%lu_d%lu", &function, &instance, &dimension) != 3) {
+      coco_free_memory(content);
+      coco_error("coco_merge_result_folders(): unexpected line in '%s': %s", path, line);
+      return; /* Never reached */
+    }
+    coco_merge_add_info_entry(info_file, function, dimension, line);
+  }
+  coco_free_memory(content);
+}
+
+/**
+ * Writes the merged ".info" file (or timing summary file) into the target folder and frees its contents.
+ */
+static void coco_merge_write_info_file(coco_merge_info_file_t *info_file, const char *target_folder) {
+
+  FILE *file;
+  char *path;
+  int is_first_line = 1;
+  size_t i;
+
+  path = coco_strdupf("%s%s%s", target_folder, coco_path_separator, info_file->name);
+  file = fopen(path, "w");
+  if (file == NULL) {
+    coco_error("coco_merge_result_folders(): failed to open file '%s'", path);
+    return; /* Never reached */
+  }
+  coco_free_memory(path);
+
+  if (info_file->header != NULL) {
+    fputs(info_file->header, file);
+    is_first_line = 0;
+    coco_free_memory(info_file->header);
+  }
+  if (info_file->number_of_entries > 1)
+    qsort(info_file->entries, info_file->number_of_entries, sizeof(coco_merge_info_entry_t),
+        coco_merge_compare_info_entries);
+  for (i = 0; i < info_file->number_of_entries; i++) {
+    fprintf(file, is_first_line ? "%s" : "\n%s", info_file->entries[i].lines);
+    is_first_line = 0;
+    coco_free_memory(info_file->entries[i].lines);
+  }
+  if (info_file->has_final_newline && !is_first_line)
+    fputs("\n", file);
+  fclose(file);
+
+  if (info_file->entries != NULL)
+    coco_free_memory(info_file->entries);
+  coco_free_memory(info_file->name);
+}
+
+/**
+ * Copies the contents of the source folder into the target folder, except for the ".info" files and the
+ * timing summary file at the top level (is_top_level = 1), whose entries are collected in merge.
+ */
+static void coco_merge_folder(coco_merge_t *merge, const char *source_folder, const char *target_folder,
+    const int is_top_level) {
+
+  char **names, *source, *target;
+  size_t number_of_names, length, i;
+
+  names = coco_merge_list_directory(source_folder, &number_of_names);
+  for (i = 0; i < number_of_names; i++) {
+    source = coco_strdupf("%s%s%s", source_folder, coco_path_separator, names[i]);
+    target = coco_strdupf("%s%s%s", target_folder, coco_path_separator, names[i]);
+    length = strlen(names[i]);
+    if (coco_path_exists(source)) {
+      coco_create_path(target);
+      coco_merge_folder(merge, source, target, 0);
+    } else if (is_top_level && (length > 5) && (strcmp(names[i] + length - 5, ".info") == 0)) {
+      coco_merge_read_info_file(merge, source, names[i]);
+    } else if (is_top_level && (strcmp(names[i], COCO_TIMING_FILE_NAME) == 0)) {
+      coco_merge_read_timing_file(merge, source, names[i]);
+    } else {
+      coco_merge_copy_file(source, target);
+    }
+    coco_free_memory(source);
+    coco_free_memory(target);
+    coco_free_memory(names[i]);
+  }
+  if (names != NULL)
+    coco_free_memory(names);
+}
+
+/**
+ * The folders must contain the output of the bbob or bbob-biobj observers of runs on disjoint sets of
+ * problems in which all problems with the same function and dimension are run together (as is the case
+ * for the batches of the "batch" suite option). The ".info" files with the same name and the timing summary
+ * files are merged, with the entries sorted by dimension and function, and all other files are copied. A file other than an ".info"
+ * file that exists in more than one of the folders triggers a coco_error, as does an existing target folder.
+ */
+void coco_merge_result_folders(const char *target_folder, const size_t number_of_folders,
+    const char **folders) {
+
+  coco_merge_t merge;
+  size_t i;
+
+  if (coco_path_exists(target_folder) || coco_file_exists(target_folder)) {
+    coco_error("coco_merge_result_folders(): target folder '%s' exists already", target_folder);
+    return; /* Never reached */
+  }
+  for (i = 0; i < number_of_folders; i++) {
+    if (!coco_path_exists(folders[i])) {
+      coco_error("coco_merge_result_folders(): folder '%s' does not exist", folders[i]);
+      return; /* Never reached */
+    }
+  }
+
+  merge.info_files = NULL;
+  merge.number_of_info_files = 0;
+  merge.max_number_of_info_files = 0;
+  coco_create_path(target_folder);
+  for (i = 0; i < number_of_folders; i++)
+    coco_merge_folder(&merge, folders[i], target_folder, 1);
+  for (i = 0; i < merge.number_of_info_files; i++)
+    coco_merge_write_info_file(&merge.info_files[i], target_folder);
+  if (merge.info_files != NULL)
+    coco_free_memory(merge.info_files);
+}
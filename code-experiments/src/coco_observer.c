@@ -1,41 +1,16 @@
 #include "coco.h"
 #include "coco_internal.h"
 
-/**
- * A set of numbers from which the evaluations that should always be logged are computed. For example, if
- * logger_biobj_always_log[3] = {1, 2, 5}, the logger will always output evaluations
- * 1, dim*1, dim*2, dim*5, 10*dim*1, 10*dim*2, 10*dim*5, 100*dim*1, 100*dim*2, 100*dim*5, ...
- */
-static const size_t coco_observer_always_log[3] = {1, 2, 5};
-
-/**
- * Returns true if the number_of_evaluations corresponds to a number that should always be logged and false
- * otherwise (computed from coco_observer_always_log). For example, if coco_observer_always_log = {1, 2, 5},
- * return true for 1, dim*1, dim*2, dim*5, 10*dim*1, 10*dim*2, 10*dim*5, 100*dim*1, 100*dim*2, 100*dim*5, ...
- */
-static int coco_observer_evaluation_to_log(size_t number_of_evaluations, size_t dimension) {
-
-  size_t i;
-  double j = 0, factor = 10;
-  size_t count = sizeof(coco_observer_always_log) / sizeof(size_t);
-
-  if (number_of_evaluations == 1)
-    return 1;
-
-  while ((size_t) pow(factor, j) * dimension <= number_of_evaluations) {
-    for (i = 0; i < count; i++) {
-      if (number_of_evaluations == (size_t) pow(factor, j) * dimension * coco_observer_always_log[i])
-        return 1;
-    }
-    j++;
-  }
-
-  return 0;
-}
-
+#include "coco_timing.c"
+#include "logger_triggers.c"
+#include "logger_async.c"
+#include "logger_flush.c"
 #include "logger_bbob.c"
 #include "logger_biobj.c"
 #include "logger_toy.c"
+#include "logger_multi.c"
+#include "logger_memory.c"
+#include "coco_merge.c"
 
 /**
  * Allocates memory for a coco_observer_t instance.
@@ -57,7 +32,16 @@ static coco_observer_t *coco_observer_allocate(const char *output_folder,
   observer->data = NULL;
   observer->data_free_function = NULL;
   observer->logger_initialize_function = NULL;
+  observer->logger_allocate_function = NULL;
+  observer->logger_log_function = NULL;
+  observer->logger_free_function = NULL;
   observer->is_active = 1;
+  observer->async_logging = 0;
+  observer->async_buffer_size = 4096;
+  observer->async_writers = NULL;
+  observer->flush_mode = COCO_FLUSH_DEFAULT;
+  observer->flush_interval = 1000;
+  observer->timing = 0;
   return observer;
 }
 
@@ -65,6 +49,7 @@ void coco_observer_free(coco_observer_t *observer) {
 
   if (observer != NULL) {
     observer->is_active = 0;
+    logger_async_drain_all(observer);
     if (observer->output_folder != NULL)
       coco_free_memory(observer->output_folder);
     if (observer->algorithm_name != NULL)
@@ -87,18 +72,25 @@ void coco_observer_free(coco_observer_t *observer) {
 }
 
 /**
- * Currently, three observers are supported:
+ * Currently, five observers are supported:
  * - "bbob" is the observer for single-objective (both noisy and noiseless) problems with known optima, which
  * creates *.info, *.dat, *.tdat and *.rdat files and logs the distance to the optimum.
  * - "bbob-biobj" is the observer for bi-objective problems, which creates *.info and *.dat files for the
  * given indicators, as well as an archive folder with *.dat files containing nondominated solutions.
  * - "toy" is a simple observer that logs when a target has been hit.
+ * - "multi" logs with several of the above observers at once (given by its option "observers"), while the
+ * problem is evaluated only once.
+ * - "memory" records the target hits, the best solution and optionally the trajectory of the best value
+ * in memory without creating any files. The results can be retrieved with coco_observer_memory_get_*.
+ * With the option "summary: 1", it also aggregates them into the ERT and ECDF for each function and
+ * dimension and writes these into a compact summary file when it is freed.
  *
  * @param observer_name A string containing the name of the observer. Currently supported observer names are
- * "bbob", "bbob-biobj", "toy". "no_observer", "" or NULL return NULL.
+ * "bbob", "bbob-biobj", "toy", "multi", "memory". "no_observer", "" or NULL return NULL.
  * @param observer_options A string of pairs "key: value" used to pass the options to the observer. Some
  * observer options are general, while others are specific to some observers. Here we list only the general
- * options, see observer_bbob, observer_biobj and observer_toy for options of the specific observers.
+ * options, see observer_bbob, observer_biobj, observer_toy, observer_multi and observer_memory for options
+ * of the specific observers.
  * - "result_folder: NAME" determines the output folder. If the folder with the given name already exists,
  * first NAME_001 will be tried, then NAME_002 and so on. The default value is "results".
  * - "algorithm_name: NAME", where NAME is a short name of the algorithm that will be used in plots (no
@@ -109,13 +101,31 @@ void coco_observer_free(coco_observer_t *observer) {
  * of digits to be printed after the decimal point. The default value is 8.
  * - precision_f: VALUE defines the precision used when outputting f values and corresponds to the number of
  * digits to be printed after the decimal point. The default value is 15.
+ * - "async_logging: 1" makes the loggers write their output in a background thread, so that the evaluations
+ * do not wait for the file output. It is available only if COCO was compiled with COCO_ASYNC_LOGGING defined
+ * (and linked with -pthread), otherwise the output is written synchronously. The default value is 0.
+ * - "async_buffer_size: VALUE" defines the number of evaluated solutions that can wait to be logged in
+ * the asynchronous mode. When there are as many, the evaluations wait for the background thread. The
+ * default value is 4096.
+ * - "flush: POLICY" determines when the loggers flush their output files, which is a trade-off between the
+ * number of system calls and the amount of data lost if the run crashes. The POLICY "every" flushes after
+ * each evaluation that has produced output, "interval_ms:N" at most every N milliseconds, "on_target" after
+ * each evaluation that has hit a target and "on_close" only when the files are closed. Except for "every",
+ * the files are written through large stream buffers. The default is "every" for text output and "on_close"
+ * for the binary format of the bbob observer.
+ * - "timing: 1" measures the wall-clock time spent in the construction, evaluation and logging of each
+ * observed problem and in the optimizer between the evaluations, together with a histogram of the
+ * evaluation latencies. The timing can be retrieved with coco_problem_get_timing() and is appended to the
+ * file timing.txt in the output folder when the problem is freed. The default value is 0.
  * @return The constructed observer object or NULL if observer_name equals NULL, "" or "no_observer".
  */
 coco_observer_t *coco_observer(const char *observer_name, const char *observer_options) {
 
   coco_observer_t *observer;
   char *result_folder, *algorithm_name, *algorithm_info;
+  char string_value[COCO_PATH_MAX];
   int precision_x, precision_f;
+  coco_memory_subsystem_e previous_subsystem;
 
   if (0 == strcmp(observer_name, "no_observer")) {
     return NULL;
@@ -124,6 +134,7 @@ coco_observer_t *coco_observer(const char *observer_name, const char *observer_o
     return NULL;
   }
 
+  previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_LOGGER);
   result_folder = (char *) coco_allocate_memory(COCO_PATH_MAX);
   algorithm_name = (char *) coco_allocate_memory(COCO_PATH_MAX);
   algorithm_info = (char *) coco_allocate_memory(5 * COCO_PATH_MAX);
@@ -132,8 +143,11 @@ coco_observer_t *coco_observer(const char *observer_name, const char *observer_o
   if (coco_options_read_string(observer_options, "result_folder", result_folder) == 0) {
     strcpy(result_folder, "results");
   }
-  coco_create_unique_path(&result_folder);
-  coco_info("Results will be output to folder %s", result_folder);
+  /* The memory observer outputs at most a summary file, for which it creates the folder itself */
+  if (0 != strcmp(observer_name, "memory")) {
+    coco_create_unique_path(&result_folder);
+    coco_info("Results will be output to folder %s", result_folder);
+  }
 
   if (coco_options_read_string(observer_options, "algorithm_name", algorithm_name) == 0) {
     strcpy(algorithm_name, "ALG");
@@ -157,6 +171,24 @@ coco_observer_t *coco_observer(const char *observer_name, const char *observer_o
 
   observer = coco_observer_allocate(result_folder, algorithm_name, algorithm_info, precision_x, precision_f);
 
+  if (coco_options_read_int(observer_options, "async_logging", &observer->async_logging) == 0)
+    observer->async_logging = 0;
+#if !defined(HAVE_ASYNC_LOGGING)
+  if (observer->async_logging) {
+    coco_warning("coco_observer(): asynchronous logging is not available (COCO was not compiled with COCO_ASYNC_LOGGING); logging synchronously");
+    observer->async_logging = 0;
+  }
+#endif
+  if ((coco_options_read_size_t(observer_options, "async_buffer_size", &observer->async_buffer_size) == 0)
+      || (observer->async_buffer_size < 1))
+    observer->async_buffer_size = 4096;
+
+  if (coco_options_read_string(observer_options, "flush", string_value) > 0)
+    logger_flush_read_option(observer, string_value);
+
+  if (coco_options_read_int(observer_options, "timing", &observer->timing) == 0)
+    observer->timing = 0;
+
   coco_free_memory(result_folder);
   coco_free_memory(algorithm_name);
   coco_free_memory(algorithm_info);
@@ -168,11 +200,17 @@ coco_observer_t *coco_observer(const char *observer_name, const char *observer_o
     observer_bbob(observer, observer_options);
   } else if (0 == strcmp(observer_name, "bbob-biobj")) {
     observer_biobj(observer, observer_options);
+  } else if (0 == strcmp(observer_name, "multi")) {
+    observer_multi(observer, observer_options);
+  } else if (0 == strcmp(observer_name, "memory")) {
+    observer_memory(observer, observer_options);
   } else {
     coco_warning("Unknown observer!");
+    coco_memory_set_subsystem(previous_subsystem);
     return NULL;
   }
 
+  coco_memory_set_subsystem(previous_subsystem);
   return observer;
 }
 
@@ -187,11 +225,20 @@ coco_observer_t *coco_observer(const char *observer_name, const char *observer_o
  */
 coco_problem_t *coco_problem_add_observer(coco_problem_t *problem, coco_observer_t *observer) {
 
+  coco_problem_t *observed_problem;
+  coco_memory_subsystem_e previous_subsystem;
+
   if ((observer == NULL) || (observer->is_active == 0)) {
     coco_warning("The problem will not be observed. %s", observer == NULL ? "(observer == NULL)" : "(observer not active)");
     return problem;
   }
 
-  return observer->logger_initialize_function(observer, problem);
+  previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_LOGGER);
+  if (observer->timing)
+    observed_problem = coco_timing_add_observer(problem, observer);
+  else
+    observed_problem = observer->logger_initialize_function(observer, problem);
+  coco_memory_set_subsystem(previous_subsystem);
+  return observed_problem;
 }
 
@@ -11,6 +11,14 @@
 #ifndef __COCO_PLATFORM__ 
 #define __COCO_PLATFORM__
 
+/* The Linux system headers declare POSIX functions and constants (such as clock_gettime() and
+ * CLOCK_MONOTONIC) for strictly conforming C89 compilers only if POSIX is asked for. This needs to be done
+ * before the first system header is included, which is why coco_generics.c (the first file of the
+ * amalgamation) includes this file first. */
+#if defined(__gnu_linux__) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
 /* Definitions of COCO_PATH_MAX, coco_path_separator, HAVE_GFA and HAVE_STAT heavily used by functions in
  * coco_utilities.c */
 #if defined(_WIN32) || defined(_WIN64) || defined(__MINGW64__) || defined(__CYGWIN__)
@@ -73,6 +81,48 @@ int mkdir(const char *pathname, mode_t mode);
 #define S_IRWXU 0700
 #endif
 
+/* Definitions needed for measuring the wall-clock time (see coco_get_time_ms() and
+ * coco_get_monotonic_time() in coco_utilities.c). Platforms that do not declare the monotonic clock of
+ * clock_gettime() fall back to gettimeofday(), which has a resolution of one microsecond */
+#if defined(HAVE_STAT)
+#include <sys/time.h>
+#include <time.h>
+#define HAVE_GETTIMEOFDAY 1
+#if defined(CLOCK_MONOTONIC)
+#define HAVE_CLOCK_GETTIME 1
+#endif
+#endif
+
+/* Definitions needed for the asynchronous logging (see logger_async.c), which is compiled only if
+ * COCO_ASYNC_LOGGING is defined and POSIX threads and the GCC atomic builtins are available (the program
+ * then needs to be linked with -pthread) */
+#if defined(COCO_ASYNC_LOGGING) && defined(HAVE_STAT) && (defined(__GNUC__) || defined(__clang__))
+#include <pthread.h>
+#define HAVE_ASYNC_LOGGING 1
+#endif
+
+/* Definitions needed for the prefetching of problems (see coco_prefetch.c), which is compiled only if
+ * COCO_PREFETCH is defined and POSIX threads are available (the program then needs to be linked with
+ * -pthread) */
+#if defined(COCO_PREFETCH) && defined(HAVE_STAT)
+#include <pthread.h>
+#define HAVE_PREFETCH 1
+#endif
+
+/* Definitions needed for the static tracepoints (see coco_probes.h), which are compiled only if
+ * COCO_USDT_PROBES is defined on Linux with GCC or clang (the SystemTap header sys/sdt.h, for example
+ * from the package systemtap-sdt-dev, then needs to be installed) */
+#if defined(COCO_USDT_PROBES) && defined(__gnu_linux__) && (defined(__GNUC__) || defined(__clang__))
+#include <sys/sdt.h>
+#define HAVE_USDT_PROBES 1
+#endif
+
+/* Definition needed for the tracking of the allocated memory (see coco_memory.c), which is compiled only if
+ * COCO_MEMORY_TRACKING is defined */
+#if defined(COCO_MEMORY_TRACKING)
+#define HAVE_MEMORY_TRACKING 1
+#endif
+
 /* To silence the Visual Studio compiler (C4996 warnings in the python build). */
 #ifdef _MSC_VER
 #pragma warning(disable:4996)
@@ -0,0 +1,198 @@
+#include "coco_platform.h"
+
+#include <assert.h>
+
+#include "coco.h"
+#include "coco_internal.h"
+
+/**
+ * Construction of the next problem of a suite on a helper thread (see the "prefetch" suite option).
+ *
+ * Once coco_suite_get_next_problem() has returned a problem, it starts a helper thread that constructs the
+ * following problem of the iteration (without observer) while the optimizer works on the current one. The
+ * next call to coco_suite_get_next_problem() then waits for the helper thread, if it is still running, and
+ * only wraps the prefetched problem with the observer. A prefetched problem that is not the one asked for
+ * (which cannot happen in the usual iteration) is freed and the problem is constructed anew.
+ *
+ * At most one problem is constructed at a time, since the construction of some functions uses global
+ * state (for example the Gallagher functions). Therefore all other functions of the suite that construct
+ * problems or use the data of the suite wait for a running helper thread first (see coco_prefetch_wait()),
+ * and the constructions of the problems of all suites are serialized by a global mutex (see
+ * coco_prefetch_lock_construction()), since other suites may construct problems on the main thread while
+ * the helper thread is running.
+ * With memory tracking, the helper thread has its own current subsystem (see coco_memory.c), so that it
+ * does not change the attribution of the allocations of the optimizer.
+ *
+ * Prefetching is available only if COCO is compiled with COCO_PREFETCH (see coco_platform.h), otherwise
+ * coco_prefetch_allocate() returns NULL and the problems are constructed when they are asked for.
+ */
+
+static coco_problem_t *coco_suite_get_problem_from_indices(coco_suite_t *suite,
+                                                           size_t function_idx,
+                                                           size_t dimension_idx,
+                                                           size_t instance_idx);
+
+#if defined(HAVE_PREFETCH)
+
+/**
+ * The state of the prefetching of a suite.
+ */
+struct coco_prefetch {
+  coco_suite_t *suite;
+  size_t function_idx;      /* The indices of the prefetched problem */
+  size_t dimension_idx;
+  size_t instance_idx;
+  coco_problem_t *problem;  /* The prefetched problem (NULL if none has been constructed) */
+  int is_running;           /* Whether the helper thread has been started and not joined yet */
+  pthread_t thread;
+};
+
+/**
+ * Serializes the construction of problems (of all suites) on the main and the helper threads.
+ */
+static pthread_mutex_t coco_prefetch_construction_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Waits until no other thread constructs a problem, which needs to be followed by
+ * coco_prefetch_unlock_construction() once the problem has been constructed.
+ */
+static void coco_prefetch_lock_construction(void) {
+  pthread_mutex_lock(&coco_prefetch_construction_mutex);
+}
+
+/**
+ * Lets other threads construct problems again.
+ */
+static void coco_prefetch_unlock_construction(void) {
+  pthread_mutex_unlock(&coco_prefetch_construction_mutex);
+}
+
+/**
+ * Allocates the prefetching of the given suite.
+ */
+static coco_prefetch_t *coco_prefetch_allocate(coco_suite_t *suite) {
+
+  coco_prefetch_t *prefetch;
+
+  prefetch = (coco_prefetch_t *) coco_allocate_memory(sizeof(*prefetch));
+  prefetch->suite = suite;
+  prefetch->function_idx = 0;
+  prefetch->dimension_idx = 0;
+  prefetch->instance_idx = 0;
+  prefetch->problem = NULL;
+  prefetch->is_running = 0;
+  return prefetch;
+}
+
+/**
+ * The helper thread, which constructs the problem.
+ */
+static void *coco_prefetch_run(void *argument) {
+
+  coco_prefetch_t *prefetch = (coco_prefetch_t *) argument;
+
+  prefetch->problem = coco_suite_get_problem_from_indices(prefetch->suite, prefetch->function_idx,
+      prefetch->dimension_idx, prefetch->instance_idx);
+  return NULL;
+}
+
+/**
+ * Waits for the helper thread, if it is running.
+ */
+static void coco_prefetch_wait(coco_prefetch_t *prefetch) {
+
+  if ((prefetch == NULL) || !prefetch->is_running)
+    return;
+  pthread_join(prefetch->thread, NULL);
+  prefetch->is_running = 0;
+}
+
+/**
+ * Starts the construction of the problem with the given indices on the helper thread. If the thread cannot
+ * be started, nothing is prefetched.
+ */
+static void coco_prefetch_start(coco_prefetch_t *prefetch, const size_t function_idx, const size_t dimension_idx,
+    const size_t instance_idx) {
+
+  assert(!prefetch->is_running);
+  assert(prefetch->problem == NULL);
+  prefetch->function_idx = function_idx;
+  prefetch->dimension_idx = dimension_idx;
+  prefetch->instance_idx = instance_idx;
+  prefetch->is_running = (pthread_create(&prefetch->thread, NULL, coco_prefetch_run, prefetch) == 0);
+}
+
+/**
+ * Returns the prefetched problem if it has the given indices (its ownership passes to the caller) and NULL
+ * otherwise.
+ */
+static coco_problem_t *coco_prefetch_take(coco_prefetch_t *prefetch, const size_t function_idx,
+    const size_t dimension_idx, const size_t instance_idx) {
+
+  coco_problem_t *problem;
+
+  if (prefetch == NULL)
+    return NULL;
+  coco_prefetch_wait(prefetch);
+  problem = prefetch->problem;
+  prefetch->problem = NULL;
+  if ((problem != NULL) && ((prefetch->function_idx != function_idx)
+      || (prefetch->dimension_idx != dimension_idx) || (prefetch->instance_idx != instance_idx))) {
+    coco_problem_free(problem);
+    problem = NULL;
+  }
+  return problem;
+}
+
+/**
+ * Frees the prefetching, including a prefetched problem.
+ */
+static void coco_prefetch_free(coco_prefetch_t *prefetch) {
+
+  if (prefetch == NULL)
+    return;
+  coco_prefetch_wait(prefetch);
+  if (prefetch->problem != NULL)
+    coco_problem_free(prefetch->problem);
+  coco_free_memory(prefetch);
+}
+
+#else
+
+static void coco_prefetch_lock_construction(void) {
+}
+
+static void coco_prefetch_unlock_construction(void) {
+}
+
+static coco_prefetch_t *coco_prefetch_allocate(coco_suite_t *suite) {
+  (void) suite; /* unused */
+  return NULL;
+}
+
+static void coco_prefetch_wait(coco_prefetch_t *prefetch) {
+  (void) prefetch; /* unused */
+}
+
+static void coco_prefetch_start(coco_prefetch_t *prefetch, const size_t function_idx, const size_t dimension_idx,
+    const size_t instance_idx) {
+  (void) prefetch; /* unused */
+  (void) function_idx; /* unused */
+  (void) dimension_idx; /* unused */
+  (void) instance_idx; /* unused */
+}
+
+static coco_problem_t *coco_prefetch_take(coco_prefetch_t *prefetch, const size_t function_idx,
+    const size_t dimension_idx, const size_t instance_idx) {
+  (void) prefetch; /* unused */
+  (void) function_idx; /* unused */
+  (void) dimension_idx; /* unused */
+  (void) instance_idx; /* unused */
+  return NULL;
+}
+
+static void coco_prefetch_free(coco_prefetch_t *prefetch) {
+  (void) prefetch; /* unused */
+}
+
+#endif
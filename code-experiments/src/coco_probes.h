@@ -0,0 +1,75 @@
+/**
+ * Static tracepoints (USDT probes) of the COCO framework
+ *
+ * The probes are compiled only if COCO is compiled with COCO_USDT_PROBES defined on Linux with the SystemTap
+ * header sys/sdt.h available (see coco_platform.h). Otherwise, they are no-ops that do not even evaluate
+ * their arguments. An enabled probe costs a single nop instruction until a tracer (perf, bpftrace,
+ * SystemTap) attaches to it.
+ *
+ * All probes belong to the provider coco and have the following arguments (strings are passed as pointers
+ * to null-terminated strings, doubles as pointers to the values):
+ *
+ * - evaluate_entry(coco_problem_t *problem, const char *problem_id, size_t number_of_variables,
+ *   const double *x) and
+ *   evaluate_exit(coco_problem_t *problem, const char *problem_id, size_t evaluations, const double *y)
+ *   fire in coco_evaluate_function, i.e., for each layer of a transformed problem (the innermost layer is
+ *   the function itself, the outermost the one seen by the optimizer). Pairs with the same problem pointer
+ *   on the same thread give the latency of that layer. The evaluations are those of the given layer,
+ *   including the one just performed.
+ *
+ * - evaluate_population_entry(coco_problem_t *problem, const char *problem_id, size_t number_of_solutions,
+ *   const double *x) and
+ *   evaluate_population_exit(coco_problem_t *problem, const char *problem_id, size_t evaluations,
+ *   const double *y) fire in coco_evaluate_population in the same way.
+ *
+ * - problem_construct_entry(const char *suite_name, size_t function, size_t dimension, size_t instance) and
+ *   problem_construct_exit(const char *suite_name, coco_problem_t *problem, const char *problem_id)
+ *   fire around the construction of a problem of a suite (without its observer).
+ *
+ * - logger_target_hit(const char *logger_name, const char *problem_id, size_t evaluation,
+ *   const double *value, const double *target) fires when the bbob logger hits an f-value target (value is
+ *   the f-value and target the first of the hit targets, which are relative to the optimal value) or when
+ *   the bbob-biobj logger hits a target of the hypervolume indicator (value is the difference of the
+ *   indicator to its reference value and target the last of the hit targets).
+ *
+ * - logger_file_open(const char *logger_name, const char *path, FILE *file) fires after the bbob or
+ *   bbob-biobj logger has opened one of its output files (file is NULL if the file could not be opened).
+ *
+ * - logger_file_write(const char *logger_name, FILE *file, size_t evaluation) fires after the bbob or
+ *   bbob-biobj logger has written a line (or a record or, for the nondominated solutions, a block of lines)
+ *   after the given evaluation to the file.
+ *
+ * - logger_file_flush_entry(size_t number_of_files) and logger_file_flush_exit(size_t number_of_files)
+ *   fire around the flushing of the output files of a bbob or bbob-biobj logger (see logger_flush.c), so
+ *   that the time between them shows the I/O stalls.
+ *
+ * For example, the distribution of the latencies of the evaluations of the outermost layers of the
+ * problems of a running experiment in nanoseconds (i.e., as seen by the optimizer) can be shown with the
+ * following script. Since evaluate_entry and evaluate_exit fire for every layer, it counts the nesting depth
+ * per thread and measures only from the first entry to the matching exit:
+ *
+ * bpftrace -p PID -e 'usdt:./example_experiment:coco:evaluate_entry {
+ *   if (@depth[tid] == 0) { @start[tid] = nsecs; } @depth[tid]++; }
+ *   usdt:./example_experiment:coco:evaluate_exit /@depth[tid] > 0/ { @depth[tid]--;
+ *   if (@depth[tid] == 0) { @latency[str(arg1)] = hist(nsecs - @start[tid]); } }'
+ *
+ * and the probes can be listed with "perf list sdt_coco:*" after "perf buildid-cache --add EXECUTABLE".
+ */
+#ifndef __COCO_PROBES__
+#define __COCO_PROBES__
+
+#include "coco_platform.h"
+
+#if defined(HAVE_USDT_PROBES)
+#define COCO_PROBE1(name, a1) DTRACE_PROBE1(coco, name, a1)
+#define COCO_PROBE3(name, a1, a2, a3) DTRACE_PROBE3(coco, name, a1, a2, a3)
+#define COCO_PROBE4(name, a1, a2, a3, a4) DTRACE_PROBE4(coco, name, a1, a2, a3, a4)
+#define COCO_PROBE5(name, a1, a2, a3, a4, a5) DTRACE_PROBE5(coco, name, a1, a2, a3, a4, a5)
+#else
+#define COCO_PROBE1(name, a1) ((void) 0)
+#define COCO_PROBE3(name, a1, a2, a3) ((void) 0)
+#define COCO_PROBE4(name, a1, a2, a3, a4) ((void) 0)
+#define COCO_PROBE5(name, a1, a2, a3, a4, a5) ((void) 0)
+#endif
+
+#endif
@@ -82,6 +82,7 @@ coco_problem_t *coco_problem_allocate(const size_t number_of_variables,
   /* Initialize fields to sane/safe defaults */
   problem->initial_solution = NULL;
   problem->evaluate_function = NULL;
+  problem->evaluate_population = NULL;
   problem->evaluate_constraint = NULL;
   problem->recommend_solutions = NULL;
   problem->free_problem = NULL;
@@ -121,6 +122,8 @@ coco_problem_t *coco_problem_duplicate(coco_problem_t *other) {
 
   problem->initial_solution = other->initial_solution;
   problem->evaluate_function = other->evaluate_function;
+  /* Not inherited, since a derived problem would otherwise bypass its own evaluate_function */
+  problem->evaluate_population = NULL;
   problem->evaluate_constraint = other->evaluate_constraint;
   problem->recommend_solutions = other->recommend_solutions;
   problem->free_problem = NULL;
@@ -311,10 +314,8 @@ static void transformed_free_problem(coco_problem_t *self) {
   data = self->data;
   assert(data->inner_problem != NULL);
 
-  if (data->inner_problem != NULL) {
-    coco_problem_free(data->inner_problem);
-    data->inner_problem = NULL;
-  }
+  /* The data is freed before the inner problem, because freeing it can still require the inner problem
+   * (an asynchronous logger needs to log its pending evaluations first) */
   if (data->data != NULL) {
     if (data->free_data != NULL) {
       data->free_data(data->data);
@@ -323,6 +324,10 @@ static void transformed_free_problem(coco_problem_t *self) {
     coco_free_memory(data->data);
     data->data = NULL;
   }
+  if (data->inner_problem != NULL) {
+    coco_problem_free(data->inner_problem);
+    data->inner_problem = NULL;
+  }
   /* Let the generic free problem code deal with the rest of the
    * fields. For this we clear the free_problem function pointer and
    * recall the generic function.
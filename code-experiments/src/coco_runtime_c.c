@@ -109,12 +109,20 @@ void *coco_allocate_memory(const size_t size) {
     coco_error("coco_allocate_memory() called with 0 size.");
     return NULL; /* never reached */
   }
+#if defined(HAVE_MEMORY_TRACKING)
+  data = coco_memory_allocate_tracked(size);
+#else
   data = malloc(size);
+#endif
   if (data == NULL)
     coco_error("coco_allocate_memory() failed.");
   return data;
 }
 
 void coco_free_memory(void *data) {
+#if defined(HAVE_MEMORY_TRACKING)
+  coco_memory_free_tracked(data);
+#else
   free(data);
+#endif
 }
@@ -45,7 +45,7 @@ char *coco_strdupf(const char *str, ...) {
  * va_list version of formatted string duplication coco_strdupf()
  */
 static char *coco_vstrdupf(const char *str, va_list args) {
-  static char buf[coco_vstrdupf_buflen];
+  char buf[coco_vstrdupf_buflen]; /* not static, since threads may format strings simultaneously */
   long written;
   /* apparently args can only be used once, therefore
    * len = vsnprintf(NULL, 0, str, args) to find out the
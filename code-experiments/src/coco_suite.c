@@ -2,7 +2,11 @@
 
 #include "coco.h"
 #include "coco_internal.h"
+#include "coco_probes.h"
 
+#include "coco_timing.c"
+#include "coco_work_queue.c"
+#include "coco_prefetch.c"
 #include "suite_bbob.c"
 #include "suite_biobj.c"
 #include "suite_toy.c"
@@ -48,6 +52,15 @@ static coco_suite_t *coco_suite_allocate(const char *suite_name,
   suite->current_instance_idx = -1;
   suite->current_problem = NULL;
 
+  /* To be set in coco_suite_filter_batch() and coco_suite() */
+  suite->batch_units = NULL;
+  suite->work_queue = NULL;
+  suite->prefetch = NULL;
+
+  /* To be set in coco_suite_get_problem_metadata() */
+  suite->metadata_problem_id = NULL;
+  suite->metadata_problem_name = NULL;
+
   /* To be set in coco_suite_set_instance() */
   suite->number_of_instances = 0;
   suite->instances = NULL;
@@ -115,6 +128,103 @@ static void coco_suite_filter_dimensions(coco_suite_t *suite, const size_t *dims
 
 }
 
+/**
+ * Returns the expected cost of the problems of the function in the dimension with the given unit index
+ * (function_idx + dimension_idx * number_of_functions), i.e., the square of the dimension, since both the
+ * usual budgets and the costs of the evaluations grow about linearly with the dimension.
+ */
+static double coco_suite_get_unit_cost(const coco_suite_t *suite, const size_t unit) {
+  const double dimension = (double) suite->dimensions[unit / suite->number_of_functions];
+  return dimension * dimension;
+}
+
+/**
+ * Returns the units of the remaining functions in dimensions sorted by decreasing expected cost (see
+ * coco_suite_get_unit_cost()) and sets number_of_units to their number. Each unit is identified by the
+ * problem index of its first instance divided by the number of instances (see
+ * coco_suite_encode_problem_index()). The result needs to be freed by the caller.
+ */
+static size_t *coco_suite_get_units_by_cost(coco_suite_t *suite, size_t *number_of_units) {
+
+  size_t *units, function_idx, dimension_idx, unit, i, j;
+
+  units = coco_allocate_memory(suite->number_of_functions * suite->number_of_dimensions * sizeof(size_t));
+  *number_of_units = 0;
+  for (dimension_idx = 0; dimension_idx < suite->number_of_dimensions; dimension_idx++) {
+    for (function_idx = 0; function_idx < suite->number_of_functions; function_idx++) {
+      if ((suite->functions[function_idx] != 0) && (suite->dimensions[dimension_idx] != 0)
+          && ((suite->batch_units == NULL) || suite->batch_units[function_idx + dimension_idx
+              * suite->number_of_functions]))
+        units[(*number_of_units)++] = coco_suite_encode_problem_index(suite, function_idx, dimension_idx, 0)
+            / suite->number_of_instances;
+    }
+  }
+
+  /* The insertion sort keeps units of equal cost in the suite order */
+  for (i = 1; i < *number_of_units; i++) {
+    unit = units[i];
+    for (j = i; (j > 0) && (coco_suite_get_unit_cost(suite, units[j - 1]) < coco_suite_get_unit_cost(suite,
+        unit)); j--)
+      units[j] = units[j - 1];
+    units[j] = unit;
+  }
+  return units;
+}
+
+/**
+ * Splits the (filtered) suite into number_of_batches batches and keeps only the problems of the given batch
+ * (counted from 1). The problems of a function in a dimension form a unit that is never split, because the
+ * observers write them to common files. The units are assigned in the order of decreasing expected cost
+ * (see coco_suite_get_units_by_cost()), each to the batch with the smallest total cost so far (the first one
+ * in case of ties).
+ *
+ * The assignment depends only on the remaining functions and dimensions, so that the batches of runs with
+ * equal suite_instance and suite_options (except for the batch) partition the suite.
+ */
+static void coco_suite_filter_batch(coco_suite_t *suite, const size_t batch, const size_t number_of_batches) {
+
+  size_t *units, number_of_units, lightest_batch, i, j;
+  double *loads;
+
+  units = coco_suite_get_units_by_cost(suite, &number_of_units);
+  suite->batch_units = coco_allocate_memory(suite->number_of_functions * suite->number_of_dimensions
+      * sizeof(unsigned char));
+  for (i = 0; i < suite->number_of_functions * suite->number_of_dimensions; i++)
+    suite->batch_units[i] = 0;
+
+  loads = coco_allocate_vector(number_of_batches);
+  for (i = 0; i < number_of_batches; i++)
+    loads[i] = 0;
+  for (i = 0; i < number_of_units; i++) {
+    lightest_batch = 0;
+    for (j = 1; j < number_of_batches; j++) {
+      if (loads[j] < loads[lightest_batch])
+        lightest_batch = j;
+    }
+    loads[lightest_batch] += coco_suite_get_unit_cost(suite, units[i]);
+    if (lightest_batch == batch - 1)
+      suite->batch_units[units[i]] = 1;
+  }
+  if (number_of_units < batch)
+    coco_warning("coco_suite(): batch %lu of %lu contains no problems", (unsigned long) batch,
+        (unsigned long) number_of_batches);
+
+  coco_free_memory(loads);
+  coco_free_memory(units);
+}
+
+/**
+ * Returns 1 if the problems of the function in the dimension belong to the batch of the suite (see
+ * coco_suite_filter_batch()) and 0 otherwise.
+ */
+static int coco_suite_is_in_batch(const coco_suite_t *suite, const size_t function_idx,
+    const size_t dimension_idx) {
+
+  if (suite->batch_units == NULL)
+    return 1;
+  return suite->batch_units[function_idx + dimension_idx * suite->number_of_functions];
+}
+
 /**
  * @param suite The given suite.
  * @param function_idx The index of the function in question (starting from 0).
@@ -167,6 +277,12 @@ void coco_suite_free(coco_suite_t *suite) {
 
   if (suite != NULL) {
 
+    /* The helper thread of the prefetching uses the data of the suite */
+    if (suite->prefetch) {
+      coco_prefetch_free(suite->prefetch);
+      suite->prefetch = NULL;
+    }
+
     if (suite->suite_name) {
       coco_free_memory(suite->suite_name);
       suite->suite_name = NULL;
@@ -187,12 +303,29 @@ void coco_suite_free(coco_suite_t *suite) {
       coco_free_memory(suite->default_instances);
       suite->default_instances = NULL;
     }
+    if (suite->batch_units) {
+      coco_free_memory(suite->batch_units);
+      suite->batch_units = NULL;
+    }
+    if (suite->work_queue) {
+      coco_work_queue_free(suite->work_queue);
+      suite->work_queue = NULL;
+    }
 
     if (suite->current_problem) {
       coco_problem_free(suite->current_problem);
       suite->current_problem = NULL;
     }
 
+    if (suite->metadata_problem_id) {
+      coco_free_memory(suite->metadata_problem_id);
+      suite->metadata_problem_id = NULL;
+    }
+    if (suite->metadata_problem_name) {
+      coco_free_memory(suite->metadata_problem_name);
+      suite->metadata_problem_name = NULL;
+    }
+
     if (suite->data != NULL) {
       if (suite->data_free_function != NULL) {
         suite->data_free_function(suite->data);
@@ -249,7 +382,11 @@ static coco_problem_t *coco_suite_get_problem_from_indices(coco_suite_t *suite,
                                                            size_t instance_idx) {
 
   coco_problem_t *problem;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_PROBLEM);
 
+  coco_prefetch_lock_construction();
+  COCO_PROBE4(problem_construct_entry, suite->suite_name, suite->functions[function_idx],
+      suite->dimensions[dimension_idx], suite->instances[instance_idx]);
   if (strcmp(suite->suite_name, "toy") == 0) {
     problem = suite_toy_get_problem(suite, function_idx, dimension_idx, instance_idx);
   } else if (strcmp(suite->suite_name, "bbob") == 0) {
@@ -259,9 +396,13 @@ static coco_problem_t *coco_suite_get_problem_from_indices(coco_suite_t *suite,
   } else if (strcmp(suite->suite_name, "bbob-largescale") == 0) {
     problem = suite_largescale_get_problem(suite, function_idx, dimension_idx, instance_idx);
   } else {
+    coco_prefetch_unlock_construction();
     coco_error("coco_suite_get_problem(): unknown problem suite");
     return NULL;
   }
+  COCO_PROBE3(problem_construct_exit, suite->suite_name, problem, problem->problem_id);
+  coco_prefetch_unlock_construction();
+  coco_memory_set_subsystem(previous_subsystem);
 
   return problem;
 }
@@ -278,9 +419,82 @@ coco_problem_t *coco_suite_get_problem(coco_suite_t *suite, size_t problem_index
   size_t function_idx = 0, instance_idx = 0, dimension_idx = 0;
   coco_suite_decode_problem_index(suite, problem_index, &function_idx, &dimension_idx, &instance_idx);
 
+  /* Only one problem is constructed at a time */
+  coco_prefetch_wait(suite->prefetch);
   return coco_suite_get_problem_from_indices(suite, function_idx, dimension_idx, instance_idx);
 }
 
+/**
+ * Answers the questions that the bindings ask about each problem of the suite when they enumerate it
+ * without constructing the problem, i.e., without generating its instance (rotation matrices etc.). Since
+ * the problem indices of the suite run in the order in which coco_suite_get_next_problem() iterates through
+ * the suite, the problems of a (filtered) suite can be enumerated by calling this function for all indices
+ * from 0 to coco_suite_get_number_of_problems() - 1 and skipping those for which it returns 0.
+ *
+ * @param suite The given suite.
+ * @param problem_index The index of the problem in the suite (the suite_dep_index of the problem).
+ * @param problem_id Pointer to the id of the problem, which is set by this function (can be NULL).
+ * @param problem_name Pointer to the name of the problem, which is set by this function (can be NULL).
+ * @param dimension Pointer to the dimension of the problem, which is set by this function (can be NULL).
+ * @param number_of_objectives Pointer to the number of objectives of the problem, which is set by this
+ * function (can be NULL).
+ * @return 1 if the problem with problem_index is part of the suite and 0 if it has been filtered out
+ * through suite_options or problem_index is too large (the metadata is then not set). The id and name are
+ * owned by the suite and remain valid until the next call of this function or until the suite is freed.
+ */
+int coco_suite_get_problem_metadata(coco_suite_t *suite,
+                                    const size_t problem_index,
+                                    const char **problem_id,
+                                    const char **problem_name,
+                                    size_t *dimension,
+                                    size_t *number_of_objectives) {
+
+  size_t function_idx = 0, instance_idx = 0, dimension_idx = 0;
+  size_t objectives = 0;
+
+  if (problem_index >= coco_suite_get_number_of_problems(suite))
+    return 0;
+  coco_suite_decode_problem_index(suite, problem_index, &function_idx, &dimension_idx, &instance_idx);
+  if ((suite->functions[function_idx] == 0) || (suite->dimensions[dimension_idx] == 0)
+      || (suite->instances[instance_idx] == 0) || !coco_suite_is_in_batch(suite, function_idx, dimension_idx))
+    return 0;
+
+  /* The data of the suite are not used while a problem is constructed */
+  coco_prefetch_wait(suite->prefetch);
+
+  if (suite->metadata_problem_id != NULL)
+    coco_free_memory(suite->metadata_problem_id);
+  if (suite->metadata_problem_name != NULL)
+    coco_free_memory(suite->metadata_problem_name);
+
+  if (strcmp(suite->suite_name, "toy") == 0) {
+    suite_toy_get_problem_metadata(suite, function_idx, dimension_idx, instance_idx,
+        &suite->metadata_problem_id, &suite->metadata_problem_name, &objectives);
+  } else if (strcmp(suite->suite_name, "bbob") == 0) {
+    suite_bbob_get_problem_metadata(suite, function_idx, dimension_idx, instance_idx,
+        &suite->metadata_problem_id, &suite->metadata_problem_name, &objectives);
+  } else if (strcmp(suite->suite_name, "bbob-biobj") == 0) {
+    suite_biobj_get_problem_metadata(suite, function_idx, dimension_idx, instance_idx,
+        &suite->metadata_problem_id, &suite->metadata_problem_name, &objectives);
+  } else if (strcmp(suite->suite_name, "bbob-largescale") == 0) {
+    suite_largescale_get_problem_metadata(suite, function_idx, dimension_idx, instance_idx,
+        &suite->metadata_problem_id, &suite->metadata_problem_name, &objectives);
+  } else {
+    coco_error("coco_suite_get_problem_metadata(): unknown problem suite");
+    return 0; /* Never reached */
+  }
+
+  if (problem_id != NULL)
+    *problem_id = suite->metadata_problem_id;
+  if (problem_name != NULL)
+    *problem_name = suite->metadata_problem_name;
+  if (dimension != NULL)
+    *dimension = suite->dimensions[dimension_idx];
+  if (number_of_objectives != NULL)
+    *number_of_objectives = objectives;
+  return 1;
+}
+
 /**
  * The number of problems in the suite is computed as a product of the number of instances, number of
  * functions and number of dimensions and therefore doesn't account for any filtering done through the
@@ -416,6 +630,83 @@ static int coco_suite_is_next_dimension_found(coco_suite_t *suite) {
       &suite->current_dimension_idx);
 }
 
+/**
+ * Moves the current indices of the suite to the next problem taken from its work queue, i.e., to the next
+ * instance of the claimed function in dimension or, once all of its instances have been returned, to the
+ * first instance of the most expensive function in dimension that can still be claimed. Returns 1 if such a
+ * problem is found and 0 otherwise.
+ */
+static int coco_suite_is_next_queued_problem_found(coco_suite_t *suite, const char *output_folder) {
+
+  coco_work_queue_t *queue = suite->work_queue;
+  size_t function_idx, dimension_idx, i;
+  char *name;
+  int is_claimed;
+
+  if (queue->current_item != NULL) {
+    if (coco_suite_is_next_instance_found(suite)) {
+      coco_work_queue_renew(queue, output_folder);
+      return 1;
+    }
+    coco_work_queue_finish(queue, output_folder);
+  }
+
+  for (i = 0; i < queue->number_of_units; i++) {
+    function_idx = queue->units[i] % suite->number_of_functions;
+    dimension_idx = queue->units[i] / suite->number_of_functions;
+    name = coco_strdupf("%s_f%03lu_d%02lu", suite->suite_name, (unsigned long) suite->functions[function_idx],
+        (unsigned long) suite->dimensions[dimension_idx]);
+    is_claimed = coco_work_queue_claim(queue, name, output_folder);
+    coco_free_memory(name);
+    if (is_claimed) {
+      suite->current_function_idx = (long) function_idx;
+      suite->current_dimension_idx = (long) dimension_idx;
+      suite->current_instance_idx = -1;
+      coco_suite_is_next_instance_found(suite);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/**
+ * Sets function_idx, dimension_idx and instance_idx to the indices of the problem that follows the current
+ * one in the iteration of coco_suite_get_next_problem() without changing the current indices. With the
+ * "work_queue" suite option, only the following instance of the claimed function in dimension is known.
+ * Returns 1 if such a problem is found and 0 otherwise.
+ */
+static int coco_suite_is_following_problem_found(coco_suite_t *suite,
+                                                 size_t *function_idx,
+                                                 size_t *dimension_idx,
+                                                 size_t *instance_idx) {
+
+  const long current_function_idx = suite->current_function_idx;
+  const long current_dimension_idx = suite->current_dimension_idx;
+  const long current_instance_idx = suite->current_instance_idx;
+  int is_found;
+
+  if (suite->work_queue != NULL) {
+    is_found = (suite->work_queue->current_item != NULL) && coco_suite_is_next_instance_found(suite);
+  } else {
+    do {
+      is_found = coco_suite_is_next_instance_found(suite)
+          || coco_suite_is_next_function_found(suite)
+          || coco_suite_is_next_dimension_found(suite);
+    } while (is_found && !coco_suite_is_in_batch(suite, (size_t) suite->current_function_idx,
+        (size_t) suite->current_dimension_idx));
+  }
+  if (is_found) {
+    *function_idx = (size_t) suite->current_function_idx;
+    *dimension_idx = (size_t) suite->current_dimension_idx;
+    *instance_idx = (size_t) suite->current_instance_idx;
+  }
+
+  suite->current_function_idx = current_function_idx;
+  suite->current_dimension_idx = current_dimension_idx;
+  suite->current_instance_idx = current_instance_idx;
+  return is_found;
+}
+
 /**
  * Currently, four suites are supported:
  * - "bbob" contains 24 <a href="http://coco.lri.fr/downloads/download15.03/bbobdocfunctions.pdf">
@@ -445,7 +736,24 @@ static int coco_suite_is_next_dimension_found(coco_suite_t *suite) {
  * - "function_idx: VALUES", where VALUES is a list or a range of function indexes (starting from 1) to keep
  * in the suite, and
  * - "instance_idx: VALUES", where VALUES is a list or a range of instance indexes (starting from 1) to keep
- * in the suite.
+ * in the suite, and
+ * - "batch: K/N", where 1 <= K <= N, splits the suite (after the other filters) into N batches of about
+ * the same expected cost and keeps the K-th one. All instances of a function in a dimension are in the same
+ * batch, so that the output folders of the N batches can be merged into the one of a single run with
+ * coco_merge_result_folders().
+ * - "work_queue: FOLDER" lets processes that construct the suite with the same suite_instance and
+ * suite_options take its problems from a work queue in the given shared folder (see coco_work_queue.c)
+ * instead of iterating through all of them. Each process claims the most expensive function in a dimension
+ * that is not claimed yet and runs all of its instances, until no function in a dimension is left. The
+ * output folders of the processes can then be merged with coco_merge_result_folders(). Processes that stop
+ * before finishing their function in a dimension are detected when their heartbeat is older than
+ * "lease_timeout: SECONDS" (default 3600). The heartbeat is renewed when a problem starts and, during the
+ * evaluations, whenever a quarter of the timeout has passed, so that the timeout needs to be longer than the
+ * time between two evaluations (but not the runtime on a whole problem).
+ * - "prefetch: 1" lets coco_suite_get_next_problem() construct the following problem on a helper thread
+ * while the optimizer works on the current one (see coco_prefetch.c), which is available only if COCO was
+ * compiled with COCO_PREFETCH. With the "work_queue" option, only the instances of the claimed function in
+ * dimension are prefetched.
  * @return The constructed suite object.
  */
 coco_suite_t *coco_suite(const char *suite_name, const char *suite_instance, const char *suite_options) {
@@ -458,6 +766,10 @@ coco_suite_t *coco_suite(const char *suite_name, const char *suite_instance, con
   size_t *dimensions = NULL;
   long dim_found, dim_idx_found;
   int parce_dim = 1, parce_dim_idx = 1;
+  unsigned long batch, number_of_batches;
+  size_t lease_timeout = 3600;
+  int prefetch = 0;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_SUITE);
 
   /* Initialize the suite */
   suite = coco_suite_intialize(suite_name);
@@ -523,6 +835,7 @@ coco_suite_t *coco_suite(const char *suite_name, const char *suite_instance, con
       while (*ptr != '\0') {
         if ((*ptr != ',') && !isdigit((unsigned char )*ptr)) {
           coco_warning("coco_suite(): 'dimensions' suite option ignored because of disallowed characters");
+          coco_memory_set_subsystem(previous_subsystem);
           return NULL;
         } else
           ptr++;
@@ -535,6 +848,30 @@ coco_suite_t *coco_suite(const char *suite_name, const char *suite_instance, con
       }
     }
     coco_free_memory(option_string);
+
+    /* The batch needs to be chosen after all other filters have been applied */
+    option_string = coco_allocate_memory(COCO_PATH_MAX * sizeof(char));
+    if (coco_options_read_string(suite_options, "batch", option_string) > 0) {
+      if ((sscanf(option_string, "%lu/%lu", &batch, &number_of_batches) != 2) || (batch < 1)
+          || (batch > number_of_batches))
+        coco_warning("coco_suite(): 'batch' suite option ignored because it is not of the form K/N with 1 <= K <= N");
+      else
+        coco_suite_filter_batch(suite, (size_t) batch, (size_t) number_of_batches);
+    }
+    coco_free_memory(option_string);
+
+    option_string = coco_allocate_memory(COCO_PATH_MAX * sizeof(char));
+    if (coco_options_read_string(suite_options, "work_queue", option_string) > 0) {
+      coco_options_read_size_t(suite_options, "lease_timeout", &lease_timeout);
+      suite->work_queue = coco_work_queue_open(option_string, (unsigned long) lease_timeout);
+    }
+    coco_free_memory(option_string);
+
+    if ((coco_options_read_int(suite_options, "prefetch", &prefetch) > 0) && prefetch) {
+      suite->prefetch = coco_prefetch_allocate(suite);
+      if (suite->prefetch == NULL)
+        coco_warning("coco_suite(): prefetching is not available (COCO was not compiled with COCO_PREFETCH); constructing the problems when they are asked for");
+    }
   }
 
   /* Check that there are enough dimensions, functions and instances left */
@@ -550,13 +887,18 @@ coco_suite_t *coco_suite(const char *suite_name, const char *suite_instance, con
   coco_suite_is_next_function_found(suite);
   coco_suite_is_next_dimension_found(suite);
 
+  if (suite->work_queue != NULL)
+    suite->work_queue->units = coco_suite_get_units_by_cost(suite, &suite->work_queue->number_of_units);
+
+  coco_memory_set_subsystem(previous_subsystem);
   return suite;
 }
 
 /**
- * Iterates through the suite first by instances, then by functions and finally by dimensions.
- * The instances/functions/dimensions that have been filtered out using the suite_options of the coco_suite
- * function are skipped. Outputs some information regarding the current place in the iteration. The returned
+ * Iterates through the suite first by instances, then by functions and finally by dimensions (or, with the
+ * "work_queue" suite option, through the instances of the functions in dimensions claimed from the work
+ * queue). The instances/functions/dimensions that have been filtered out using the suite_options of the
+ * coco_suite function are skipped. Outputs some information regarding the current place in the iteration. The returned
  * problem is wrapped with the observer. If the observer is NULL, the returned problem is unobserved.
  *
  * @param suite The given suite.
@@ -568,18 +910,30 @@ coco_problem_t *coco_suite_get_next_problem(coco_suite_t *suite, coco_observer_t
   size_t function_idx;
   size_t dimension_idx;
   size_t instance_idx;
+  size_t next_function_idx, next_dimension_idx, next_instance_idx;
   coco_problem_t *problem;
+  double construction_start;
+  int is_found;
 
   long previous_function_idx = suite->current_function_idx;
   long previous_dimension_idx = suite->current_dimension_idx;
   long previous_instance_idx = suite->current_instance_idx;
 
-  /* Iterate through the suite by instances, then functions and lastly dimensions in search for the next
-   * problem. Note that these functions set the values of suite fields current_instance_idx,
-   * current_function_idx and current_dimension_idx. */
-  if (!coco_suite_is_next_instance_found(suite)
-      && !coco_suite_is_next_function_found(suite)
-      && !coco_suite_is_next_dimension_found(suite)) {
+  /* Take the next problem from the work queue or iterate through the suite by instances, then functions and
+   * lastly dimensions in search for the next problem of the batch. Note that these functions set the values
+   * of suite fields current_instance_idx, current_function_idx and current_dimension_idx. */
+  if (suite->work_queue != NULL) {
+    is_found = coco_suite_is_next_queued_problem_found(suite,
+        ((observer != NULL) && observer->is_active) ? observer->output_folder : "");
+  } else {
+    do {
+      is_found = coco_suite_is_next_instance_found(suite)
+          || coco_suite_is_next_function_found(suite)
+          || coco_suite_is_next_dimension_found(suite);
+    } while (is_found && !coco_suite_is_in_batch(suite, (size_t) suite->current_function_idx,
+        (size_t) suite->current_dimension_idx));
+  }
+  if (!is_found) {
     coco_info_partial("done\n");
     return NULL;
   }
@@ -596,11 +950,24 @@ coco_problem_t *coco_suite_get_next_problem(coco_suite_t *suite, coco_observer_t
   dimension_idx = (size_t) suite->current_dimension_idx;
   instance_idx = (size_t) suite->current_instance_idx;
 
-  problem = coco_suite_get_problem_from_indices(suite, function_idx, dimension_idx, instance_idx);
-  if (observer != NULL)
+  /* With prefetching, the construction time is the time spent waiting for the helper thread */
+  construction_start = coco_get_monotonic_time();
+  problem = coco_prefetch_take(suite->prefetch, function_idx, dimension_idx, instance_idx);
+  if (problem == NULL)
+    problem = coco_suite_get_problem_from_indices(suite, function_idx, dimension_idx, instance_idx);
+  if (suite->work_queue != NULL)
+    problem = coco_work_queue_add_heartbeat(suite->work_queue, problem,
+        ((observer != NULL) && observer->is_active) ? observer->output_folder : "");
+  if (observer != NULL) {
     problem = coco_problem_add_observer(problem, observer);
+    coco_timing_set_construction_start(problem, construction_start);
+  }
   suite->current_problem = problem;
 
+  if ((suite->prefetch != NULL)
+      && coco_suite_is_following_problem_found(suite, &next_function_idx, &next_dimension_idx, &next_instance_idx))
+    coco_prefetch_start(suite->prefetch, next_function_idx, next_dimension_idx, next_instance_idx);
+
   /* Output information regarding the current place in the iteration */
   if (((long) dimension_idx != previous_dimension_idx)
       || ((dimension_idx == 0) && (previous_instance_idx < 0))) {
@@ -672,6 +1039,150 @@ void coco_run_benchmark(const char *suite_name,
 
 }
 
+/* The name of the report file of the timing experiment */
+#define COCO_TIMING_EXPERIMENT_FILE_NAME "timing_experiment.txt"
+
+/**
+ * Returns the first item of the suite that was not filtered out (items equal to 0 are filtered out).
+ */
+static size_t coco_suite_get_first_item_idx(const size_t number_of_items, const size_t *items) {
+
+  size_t i;
+
+  for (i = 0; i < number_of_items; i++) {
+    if (items[i] != 0)
+      return i;
+  }
+  coco_error("coco_suite_get_first_item_idx(): the chosen suite has no valid (positive) items");
+  return 0; /* Never reached */
+}
+
+/**
+ * Runs the optimizer repeatedly on the first instance of each function of the suite in the given dimension
+ * (observed by the observer if it is not NULL) until at least min_seconds of wall-clock time have passed.
+ * Returns the number of runs and evaluations and the consumed wall-clock and CPU time in seconds.
+ */
+static void coco_suite_run_timing(coco_suite_t *suite,
+                                  coco_optimizer_t optimizer,
+                                  coco_observer_t *observer,
+                                  const size_t dimension_idx,
+                                  const double min_seconds,
+                                  size_t *runs,
+                                  size_t *evaluations,
+                                  double *seconds,
+                                  double *cpu_seconds) {
+
+  size_t function_idx, instance_idx;
+  coco_problem_t *problem;
+  double start_time;
+  clock_t start_cpu_time;
+
+  coco_prefetch_wait(suite->prefetch);
+  instance_idx = coco_suite_get_first_item_idx(suite->number_of_instances, suite->instances);
+  *runs = 0;
+  *evaluations = 0;
+  start_time = coco_get_monotonic_time();
+  start_cpu_time = clock();
+  do {
+    for (function_idx = 0; function_idx < suite->number_of_functions; function_idx++) {
+      if (suite->functions[function_idx] == 0)
+        continue;
+      problem = coco_suite_get_problem_from_indices(suite, function_idx, dimension_idx, instance_idx);
+      if (observer != NULL)
+        problem = coco_problem_add_observer(problem, observer);
+      optimizer(problem);
+      *evaluations += coco_problem_get_evaluations(problem);
+      (*runs)++;
+      coco_problem_free(problem);
+    }
+    *seconds = coco_get_monotonic_time() - start_time;
+  } while (*seconds < min_seconds);
+  *cpu_seconds = (double) (clock() - start_cpu_time) / (double) CLOCKS_PER_SEC;
+}
+
+/**
+ * Runs the timing experiment of the BBOB methodology. For each dimension of the suite, the optimizer is
+ * run repeatedly on the first instance of each function of the suite until at least min_seconds of
+ * wall-clock time have passed, first without an observer and then with the default observer of the suite
+ * ("bbob-biobj" for the bbob-biobj suite, "toy" for the toy suite and "bbob" otherwise). The seconds per
+ * function evaluation measured in both cases are output as info and written to the file
+ * timing_experiment.txt in the output folder of the observer (timing_experiment_SUITE_NAME or, if that
+ * folder already exists, the same name with an appended number).
+ *
+ * The functions of the timing experiment are designated with the suite options of the suite, for example
+ * "function_idx: 8" selects the Rosenbrock function used in the classic timing experiment of the bbob
+ * suite.
+ *
+ * @param suite The suite.
+ * @param optimizer An optimization algorithm to be run on the problems of the suite. It should stop after
+ * a number of evaluations that is large enough for the construction of the problems to be negligible.
+ * @param min_seconds The minimal wall-clock time spent in each dimension with and without the observer.
+ */
+void coco_timing_experiment(coco_suite_t *suite, coco_optimizer_t optimizer, const double min_seconds) {
+
+  coco_observer_t *observer;
+  const char *observer_name;
+  char *observer_options, file_name[COCO_PATH_MAX] = { 0 };
+  FILE *file;
+  size_t dimension_idx, function_idx, runs[2], evaluations[2], i;
+  double seconds[2], cpu_seconds[2];
+
+  if (strcmp(suite->suite_name, "bbob-biobj") == 0)
+    observer_name = "bbob-biobj";
+  else if (strcmp(suite->suite_name, "toy") == 0)
+    observer_name = "toy";
+  else
+    observer_name = "bbob";
+  observer_options = coco_strdupf("result_folder: timing_experiment_%s algorithm_name: timing",
+      suite->suite_name);
+  observer = coco_observer(observer_name, observer_options);
+  coco_free_memory(observer_options);
+
+  memcpy(file_name, observer->output_folder, strlen(observer->output_folder) + 1);
+  coco_join_path(file_name, COCO_PATH_MAX, COCO_TIMING_EXPERIMENT_FILE_NAME, NULL);
+  file = fopen(file_name, "w");
+  if (file == NULL) {
+    coco_error("coco_timing_experiment(): failed to open file %s", file_name);
+    return; /* Never reached */
+  }
+  fprintf(file, "%% suite = %s, observer = %s, min_seconds = %g, functions =", suite->suite_name,
+      observer_name, min_seconds);
+  for (function_idx = 0; function_idx < suite->number_of_functions; function_idx++) {
+    if (suite->functions[function_idx] != 0)
+      fprintf(file, " %lu", (unsigned long) suite->functions[function_idx]);
+  }
+  fprintf(file, "\n%% Runs, evaluations and wall-clock and CPU seconds per evaluation without and with "
+      "the observer\n");
+  fprintf(file, "%% dimension runs evaluations seconds_per_evaluation cpu_seconds_per_evaluation "
+      "observed_runs observed_evaluations observed_seconds_per_evaluation "
+      "observed_cpu_seconds_per_evaluation\n");
+
+  for (dimension_idx = 0; dimension_idx < suite->number_of_dimensions; dimension_idx++) {
+    if (suite->dimensions[dimension_idx] == 0)
+      continue;
+    coco_suite_run_timing(suite, optimizer, NULL, dimension_idx, min_seconds, &runs[0], &evaluations[0],
+        &seconds[0], &cpu_seconds[0]);
+    coco_suite_run_timing(suite, optimizer, observer, dimension_idx, min_seconds, &runs[1], &evaluations[1],
+        &seconds[1], &cpu_seconds[1]);
+    fprintf(file, "%lu", (unsigned long) suite->dimensions[dimension_idx]);
+    for (i = 0; i < 2; i++) {
+      /* Avoid dividing by zero for optimizers that do not evaluate the problem */
+      if (evaluations[i] == 0)
+        evaluations[i] = 1;
+      fprintf(file, " %lu %lu %.4e %.4e", (unsigned long) runs[i], (unsigned long) evaluations[i],
+          seconds[i] / (double) evaluations[i], cpu_seconds[i] / (double) evaluations[i]);
+    }
+    fprintf(file, "\n");
+    fflush(file);
+    coco_info("coco_timing_experiment(): d=%lu, %.1e seconds per evaluation without and %.1e with the "
+        "observer", (unsigned long) suite->dimensions[dimension_idx], seconds[0] / (double) evaluations[0],
+        seconds[1] / (double) evaluations[1]);
+  }
+  fclose(file);
+  coco_info("coco_timing_experiment(): results written to %s", file_name);
+  coco_observer_free(observer);
+}
+
 /* See coco.h for more information on encoding and decoding problem index */
 
 /**
@@ -0,0 +1,244 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "coco.h"
+#include "coco_internal.h"
+
+#include "coco_utilities.c"
+#include "coco_problem.c"
+
+/**
+ * The timing instrumentation is switched on with the observer option "timing: 1". Adding such an observer
+ * to a problem then wraps the problem into two transparent timing layers:
+ * - the inner layer directly wraps the problem as constructed by the suite and measures the time spent in
+ * its evaluation,
+ * - the outer layer wraps the loggers of the observer and measures the latency of the whole evaluation.
+ * The time spent in the loggers is the difference between the two, while the time from the end of an
+ * evaluation to the start of the next one is attributed to the optimizer. When the problem is freed, its
+ * timing is appended to the file timing.txt in the output folder of the observer (next to the .info
+ * files).
+ *
+ * All times are measured with coco_get_monotonic_time(), which reads the clock four times per evaluation.
+ */
+
+/* The name of the timing summary file */
+#define COCO_TIMING_FILE_NAME "timing.txt"
+
+/**
+ * The data of the outer timing layer.
+ */
+typedef struct {
+  coco_timing_t timing;
+  char *output_folder;            /* The folder of the timing summary file */
+  double start_time;              /* The start of the construction */
+  clock_t start_cpu_time;
+  double last_evaluation_end;
+  double last_evaluation_seconds; /* The time spent in the inner layer in the last evaluation */
+} coco_timing_data_t;
+
+/**
+ * The data of the inner timing layer.
+ */
+typedef struct {
+  coco_timing_data_t *data;
+} coco_timing_inner_t;
+
+/**
+ * Evaluates the problem and measures the time of the evaluation.
+ */
+static void coco_timing_inner_evaluate(coco_problem_t *self, const double *x, double *y) {
+
+  coco_timing_data_t *data = ((coco_timing_inner_t *) coco_transformed_get_data(self))->data;
+  double start = coco_get_monotonic_time();
+
+  coco_evaluate_function(coco_transformed_get_inner_problem(self), x, y);
+  data->last_evaluation_seconds = coco_get_monotonic_time() - start;
+}
+
+/**
+ * Returns the bin of the latency histogram for an evaluation that took the given number of seconds.
+ */
+static size_t coco_timing_latency_bin(const double seconds) {
+
+  int exponent;
+
+  if (seconds < 2e-9)
+    return 0;
+  /* seconds * 1e9 = m * 2^exponent with 0.5 <= m < 1 */
+  (void) frexp(seconds * 1e9, &exponent);
+  if (exponent > COCO_TIMING_NUMBER_OF_BINS)
+    return COCO_TIMING_NUMBER_OF_BINS - 1;
+  return (size_t) (exponent - 1);
+}
+
+/**
+ * Evaluates the problem with the loggers and updates the timing of all categories except the construction.
+ */
+static void coco_timing_outer_evaluate(coco_problem_t *self, const double *x, double *y) {
+
+  coco_timing_data_t *data = (coco_timing_data_t *) coco_transformed_get_data(self);
+  coco_timing_t *timing = &data->timing;
+  double start, end;
+
+  start = coco_get_monotonic_time();
+  timing->seconds[COCO_TIMING_OPTIMIZER] += start - data->last_evaluation_end;
+  data->last_evaluation_seconds = 0;
+
+  coco_evaluate_function(coco_transformed_get_inner_problem(self), x, y);
+
+  end = coco_get_monotonic_time();
+  timing->seconds[COCO_TIMING_EVALUATION] += data->last_evaluation_seconds;
+  timing->seconds[COCO_TIMING_LOGGING] += (end - start) - data->last_evaluation_seconds;
+  timing->latency_histogram[coco_timing_latency_bin(end - start)]++;
+  timing->number_of_evaluations++;
+  data->last_evaluation_end = end;
+}
+
+/**
+ * Updates the total wall-clock and CPU times of the timing to the current time.
+ */
+static void coco_timing_update_totals(coco_timing_data_t *data) {
+  data->timing.wall_seconds = coco_get_monotonic_time() - data->start_time;
+  data->timing.cpu_seconds = (double) (clock() - data->start_cpu_time) / (double) CLOCKS_PER_SEC;
+}
+
+/**
+ * Appends the timing of the problem to the timing summary file (and writes its header if the file is new).
+ */
+static void coco_timing_write(coco_timing_data_t *data, const char *problem_id) {
+
+  FILE *file;
+  int is_new;
+  size_t i;
+  char file_name[COCO_PATH_MAX] = { 0 };
+
+  coco_create_path(data->output_folder);
+  memcpy(file_name, data->output_folder, strlen(data->output_folder) + 1);
+  coco_join_path(file_name, COCO_PATH_MAX, COCO_TIMING_FILE_NAME, NULL);
+  is_new = !coco_file_exists(file_name);
+  file = fopen(file_name, "a");
+  if (file == NULL) {
+    coco_warning("coco_timing_write(): failed to open file %s", file_name);
+    return;
+  }
+  if (is_new) {
+    fprintf(file, "%% Wall-clock times in seconds spent in the construction, evaluation, logging and optimizer, "
+        "the total wall-clock and CPU times in seconds\n");
+    fprintf(file, "%% and the latency histogram (bin i counts the evaluations that took between 2^i and 2^(i+1) "
+        "nanoseconds)\n");
+    fprintf(file, "%% problem_id evaluations construction evaluation logging optimizer wall cpu histogram\n");
+  }
+  fprintf(file, "%s %lu", problem_id, (unsigned long) data->timing.number_of_evaluations);
+  for (i = 0; i < COCO_TIMING_NUMBER_OF_CATEGORIES; i++)
+    fprintf(file, " %.6e", data->timing.seconds[i]);
+  fprintf(file, " %.6e %.6e", data->timing.wall_seconds, data->timing.cpu_seconds);
+  for (i = 0; i < COCO_TIMING_NUMBER_OF_BINS; i++)
+    fprintf(file, " %lu", (unsigned long) data->timing.latency_histogram[i]);
+  fprintf(file, "\n");
+  fclose(file);
+}
+
+/**
+ * Frees the timing data (the data of the inner layer is freed with the inner layer).
+ */
+static void coco_timing_free(void *stuff) {
+
+  coco_timing_data_t *data;
+
+  assert(stuff != NULL);
+  data = (coco_timing_data_t *) stuff;
+
+  if (data->output_folder != NULL) {
+    coco_free_memory(data->output_folder);
+    data->output_folder = NULL;
+  }
+}
+
+/**
+ * Frees the outer timing layer after adding the time since the last evaluation to the optimizer and writing
+ * the timing to the summary file.
+ */
+static void coco_timing_free_problem(coco_problem_t *self) {
+
+  coco_timing_data_t *data = (coco_timing_data_t *) coco_transformed_get_data(self);
+
+  data->timing.seconds[COCO_TIMING_OPTIMIZER] += coco_get_monotonic_time() - data->last_evaluation_end;
+  coco_timing_update_totals(data);
+  coco_timing_write(data, self->problem_id);
+
+  transformed_free_problem(self);
+}
+
+/**
+ * Adds the observer to the problem within the two timing layers.
+ */
+static coco_problem_t *coco_timing_add_observer(coco_problem_t *problem, coco_observer_t *observer) {
+
+  coco_timing_data_t *data;
+  coco_timing_inner_t *inner_data;
+  coco_problem_t *inner, *self;
+  size_t i;
+
+  data = (coco_timing_data_t *) coco_allocate_memory(sizeof(*data));
+  data->start_time = coco_get_monotonic_time();
+  data->start_cpu_time = clock();
+  for (i = 0; i < COCO_TIMING_NUMBER_OF_CATEGORIES; i++)
+    data->timing.seconds[i] = 0;
+  for (i = 0; i < COCO_TIMING_NUMBER_OF_BINS; i++)
+    data->timing.latency_histogram[i] = 0;
+  data->timing.number_of_evaluations = 0;
+  data->last_evaluation_seconds = 0;
+  data->output_folder = coco_strdup(observer->output_folder);
+
+  inner_data = (coco_timing_inner_t *) coco_allocate_memory(sizeof(*inner_data));
+  inner_data->data = data;
+  inner = coco_transformed_allocate(problem, inner_data, NULL);
+  inner->evaluate_function = coco_timing_inner_evaluate;
+
+  self = coco_transformed_allocate(observer->logger_initialize_function(observer, inner), data,
+      coco_timing_free);
+  self->evaluate_function = coco_timing_outer_evaluate;
+  self->free_problem = coco_timing_free_problem;
+
+  data->last_evaluation_end = coco_get_monotonic_time();
+  data->timing.seconds[COCO_TIMING_CONSTRUCTION] = data->last_evaluation_end - data->start_time;
+  return self;
+}
+
+/**
+ * Returns the data of the outer timing layer or NULL if the problem is not timed.
+ */
+static coco_timing_data_t *coco_timing_get_data(coco_problem_t *problem) {
+  if ((problem == NULL) || (problem->evaluate_function != coco_timing_outer_evaluate))
+    return NULL;
+  return (coco_timing_data_t *) coco_transformed_get_data(problem);
+}
+
+/**
+ * Adds the construction of the problem, which started at start_time, to the timing of the problem (does
+ * nothing if the problem is not timed).
+ */
+static void coco_timing_set_construction_start(coco_problem_t *problem, const double start_time) {
+
+  coco_timing_data_t *data = coco_timing_get_data(problem);
+
+  if (data == NULL)
+    return;
+  data->timing.seconds[COCO_TIMING_CONSTRUCTION] += data->start_time - start_time;
+  data->start_time = start_time;
+}
+
+/**
+ * @note The timing is available only while the problem exists.
+ */
+const coco_timing_t *coco_problem_get_timing(coco_problem_t *problem) {
+
+  coco_timing_data_t *data = coco_timing_get_data(problem);
+
+  if (data == NULL)
+    return NULL;
+  coco_timing_update_totals(data);
+  return &data->timing;
+}
@@ -10,6 +10,7 @@
 #include "coco.h"
 #include "coco_internal.h"
 #include "coco_string.c"
+#include "coco_memory.c"
 
 /***********************************
  * Global definitions in this file
@@ -806,3 +807,39 @@ static char *coco_remove_from_string(char *string, char *from, char *to) {
 
   return result;
 }
+
+/**
+ * Returns the wall-clock time in milliseconds since an unspecified point in time. The resolution is one
+ * second on platforms that provide neither gettimeofday nor GetTickCount.
+ */
+static double coco_get_time_ms(void) {
+#if defined(HAVE_GFA)
+  return (double) GetTickCount();
+#elif defined(HAVE_GETTIMEOFDAY)
+  struct timeval time_value;
+  gettimeofday(&time_value, NULL);
+  return 1000.0 * (double) time_value.tv_sec + (double) time_value.tv_usec / 1000.0;
+#else
+  return 1000.0 * (double) time(NULL);
+#endif
+}
+
+/**
+ * Returns the time in seconds since an unspecified point in time measured with the most precise
+ * monotonic clock available (QueryPerformanceCounter on Windows, clock_gettime(CLOCK_MONOTONIC) on POSIX
+ * systems that declare it), otherwise the wall-clock time of coco_get_time_ms().
+ */
+static double coco_get_monotonic_time(void) {
+#if defined(HAVE_GFA)
+  LARGE_INTEGER counter, frequency;
+  QueryPerformanceCounter(&counter);
+  QueryPerformanceFrequency(&frequency);
+  return (double) counter.QuadPart / (double) frequency.QuadPart;
+#elif defined(HAVE_CLOCK_GETTIME)
+  struct timespec time_value;
+  clock_gettime(CLOCK_MONOTONIC, &time_value);
+  return (double) time_value.tv_sec + 1e-9 * (double) time_value.tv_nsec;
+#else
+  return coco_get_time_ms() / 1000.0;
+#endif
+}
@@ -0,0 +1,439 @@
+#include "coco_platform.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(HAVE_STAT)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "coco.h"
+#include "coco_internal.h"
+#include "coco_utilities.c"
+#include "coco_random.c"
+#include "coco_problem.c"
+
+/**
+ * A work queue shared by cooperating processes through lease files in a common folder (see the
+ * "work_queue" suite option).
+ *
+ * The items of the queue are identified by names (for the suites, the names of the functions in dimensions,
+ * e.g., "bbob_f001_d40"). A process claims an item by creating the lease file NAME.lease in the folder of
+ * the queue exclusively (with open() and O_EXCL or with CreateFile() and CREATE_NEW on Windows), which fails
+ * if the file exists. This is atomic on local file systems and on NFS from version 3 on, so that the
+ * processes can run on different nodes that share the folder. The lease file contains the owner (a random
+ * identifier of the process), the time of its last heartbeat (in seconds since the epoch) and its output
+ * folder. The owner renews the heartbeat whenever it starts the next problem of the item and, during the
+ * evaluations, whenever a quarter of the timeout has passed (see coco_work_queue_add_heartbeat()). Once the
+ * item is finished, it creates the file NAME.done and removes the lease file.
+ *
+ * The heartbeat is written to the file NAME.lease.OWNER.new, which then replaces the lease file with an
+ * atomic rename(), but only if the lease file still names this process as the owner. The owner is checked
+ * once more afterwards, so that a lease that has been lost to another process is reported.
+ *
+ * A lease whose heartbeat is older than the timeout is taken to belong to a dead process. It is reclaimed by
+ * renaming the lease file to NAME.lease.OWNER, which only one process can do, before the item is claimed
+ * anew. If the heartbeat turns out to have been renewed in the meantime, the lease is put back with link()
+ * (MoveFile() on Windows), which fails instead of overwriting the lease of a process that has claimed the
+ * item since. The clocks of the nodes need to agree to well within the timeout. The output that the dead
+ * process wrote for the item is incomplete and needs to be removed from its output folder before the output
+ * folders are merged with coco_merge_result_folders().
+ */
+
+/* The maximal number of evaluations after which the clock is checked again for the heartbeat */
+#define COCO_WORK_QUEUE_MAX_TIME_CHECK_PERIOD 1024
+
+/**
+ * The state of a process that takes its work from a shared queue.
+ */
+struct coco_work_queue {
+  char *folder;            /* The folder of the lease files */
+  unsigned long timeout;   /* The time in seconds after which a lease without heartbeat expires */
+  char *owner;             /* The identifier of this process */
+  char *current_item;      /* The item claimed by this process (NULL if none) */
+  size_t *units;           /* The units of the suite in the order in which they are claimed */
+  size_t number_of_units;
+};
+
+/**
+ * Creates a work queue in the given folder (which is created if it does not exist).
+ */
+static coco_work_queue_t *coco_work_queue_open(const char *folder, const unsigned long timeout) {
+
+  coco_work_queue_t *queue;
+
+  queue = (coco_work_queue_t *) coco_allocate_memory(sizeof(*queue));
+  queue->folder = coco_strdup(folder);
+  queue->timeout = timeout;
+  queue->owner = NULL;
+  queue->current_item = NULL;
+  queue->units = NULL;
+  queue->number_of_units = 0;
+
+  coco_create_path(queue->folder);
+  return queue;
+}
+
+/**
+ * Sets the identifier of the process, if not done yet. It is drawn from a random number generator seeded
+ * with the current time, the processor time, a stack address and the given output folder, which is unique
+ * among the processes that share a result folder.
+ */
+static void coco_work_queue_set_owner(coco_work_queue_t *queue, const char *output_folder) {
+
+  coco_random_state_t *random_generator;
+  unsigned long seed;
+  const char *c;
+
+  if (queue->owner != NULL)
+    return;
+  seed = (unsigned long) time(NULL) ^ ((unsigned long) clock() << 16) ^ (unsigned long) (size_t) &seed;
+  for (c = output_folder; *c != '\0'; c++)
+    seed = 31 * seed + (unsigned char) *c;
+  random_generator = coco_random_new((uint32_t) (seed & 0xFFFFFFFFUL));
+  queue->owner = coco_strdupf("%08lx%08lx",
+      (unsigned long) (coco_random_uniform(random_generator) * 4294967295.0),
+      (unsigned long) (coco_random_uniform(random_generator) * 4294967295.0));
+  coco_random_free(random_generator);
+}
+
+/**
+ * Reads the lease file at the given path into owner and output_folder (both of size COCO_PATH_MAX) and
+ * heartbeat. Returns 1 on success and 0 if the file does not exist or is incomplete.
+ */
+static int coco_work_queue_read_lease(const char *path, char *owner, unsigned long *heartbeat,
+    char *output_folder) {
+
+  FILE *file;
+  char line[COCO_PATH_MAX];
+  int result = 0;
+  size_t length;
+
+  file = fopen(path, "r");
+  if (file == NULL)
+    return 0;
+  if ((fgets(owner, COCO_PATH_MAX, file) != NULL) && (fgets(line, COCO_PATH_MAX, file) != NULL)
+      && (sscanf(line, "%lu", heartbeat) == 1) && (fgets(output_folder, COCO_PATH_MAX, file) != NULL)) {
+    owner[strcspn(owner, "\r\n")] = '\0';
+    length = strcspn(output_folder, "\r\n");
+    result = (output_folder[length] != '\0'); /* The last line is complete */
+    output_folder[length] = '\0';
+  }
+  fclose(file);
+  return result;
+}
+
+/**
+ * Writes the lease of this process with the current time as heartbeat into the file at the given path,
+ * which is created exclusively (i.e., this fails if the file exists) if is_new is set and overwritten
+ * otherwise. Returns 1 on success and 0 otherwise.
+ */
+static int coco_work_queue_write_lease(const coco_work_queue_t *queue, const char *path, const int is_new,
+    const char *output_folder) {
+
+  char *lease;
+  size_t length;
+  int result = 0;
+  FILE *file;
+#if defined(HAVE_STAT)
+  int file_descriptor;
+#elif defined(HAVE_GFA)
+  HANDLE handle;
+  DWORD written;
+#endif
+
+  lease = coco_strdupf("%s\n%lu\n%s\n", queue->owner, (unsigned long) time(NULL), output_folder);
+  length = strlen(lease);
+  if (!is_new) {
+    file = fopen(path, "w");
+    if (file != NULL) {
+      result = (fwrite(lease, 1, length, file) == length);
+      result = (fclose(file) == 0) && result;
+    }
+  } else {
+#if defined(HAVE_STAT)
+    file_descriptor = open(path, O_CREAT | O_EXCL | O_WRONLY, 0644);
+    if (file_descriptor >= 0) {
+      result = (write(file_descriptor, lease, length) == (ssize_t) length);
+      result = (close(file_descriptor) == 0) && result;
+    }
+#elif defined(HAVE_GFA)
+    handle = CreateFile(path, GENERIC_WRITE, 0, NULL, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle != INVALID_HANDLE_VALUE) {
+      result = WriteFile(handle, lease, (DWORD) length, &written, NULL) && (written == (DWORD) length);
+      result = CloseHandle(handle) && result;
+    }
+#endif
+  }
+  coco_free_memory(lease);
+  return result;
+}
+
+/**
+ * Returns 1 if the heartbeat is older than the timeout of the queue and 0 otherwise.
+ */
+static int coco_work_queue_is_expired(const coco_work_queue_t *queue, const unsigned long heartbeat) {
+  const unsigned long now = (unsigned long) time(NULL);
+  return (now > heartbeat) && (now - heartbeat > queue->timeout);
+}
+
+/**
+ * Moves the file at from_path to to_path unless a file exists at to_path. Returns 1 on success and 0
+ * otherwise (the file at from_path is then left in place).
+ */
+static int coco_work_queue_move_exclusive(const char *from_path, const char *to_path) {
+#if defined(HAVE_STAT)
+  /* Unlike rename(), link() fails if to_path exists */
+  if (link(from_path, to_path) != 0)
+    return 0;
+  remove(from_path);
+  return 1;
+#elif defined(HAVE_GFA)
+  return MoveFile(from_path, to_path) != 0;
+#else
+  return 0;
+#endif
+}
+
+/**
+ * Moves the file at from_path to to_path, replacing the file at to_path atomically if it exists. Returns 1
+ * on success and 0 otherwise.
+ */
+static int coco_work_queue_move_replacing(const char *from_path, const char *to_path) {
+#if defined(HAVE_GFA)
+  /* On Windows, rename() fails if to_path exists */
+  return MoveFileEx(from_path, to_path, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+  return rename(from_path, to_path) == 0;
+#endif
+}
+
+/**
+ * Tries to claim the item with the given name, also if the lease of another process has expired. Returns 1
+ * if the item has been claimed (and is now the current item of the queue) and 0 if it is finished or leased
+ * by another process.
+ */
+static int coco_work_queue_claim(coco_work_queue_t *queue, const char *name, const char *output_folder) {
+
+  char *done_path, *lease_path, *expired_path;
+  char owner[COCO_PATH_MAX], owner_output_folder[COCO_PATH_MAX];
+  unsigned long heartbeat;
+  int result = 0;
+
+  assert(queue->current_item == NULL);
+  coco_work_queue_set_owner(queue, output_folder);
+  done_path = coco_strdupf("%s%s%s.done", queue->folder, coco_path_separator, name);
+  lease_path = coco_strdupf("%s%s%s.lease", queue->folder, coco_path_separator, name);
+  expired_path = coco_strdupf("%s.%s", lease_path, queue->owner);
+
+  if (coco_file_exists(done_path))
+    goto cleanup;
+
+  if (!coco_work_queue_write_lease(queue, lease_path, 1, output_folder)) {
+    if (!coco_work_queue_read_lease(lease_path, owner, &heartbeat, owner_output_folder)
+        || !coco_work_queue_is_expired(queue, heartbeat))
+      goto cleanup;
+    /* Only one process can rename the expired lease. If it has been renewed or replaced in the meantime,
+     * it is put back, unless another process has claimed the item since. */
+    if (rename(lease_path, expired_path) != 0)
+      goto cleanup;
+    if (!coco_work_queue_read_lease(expired_path, owner, &heartbeat, owner_output_folder)
+        || !coco_work_queue_is_expired(queue, heartbeat)) {
+      if (!coco_work_queue_move_exclusive(expired_path, lease_path))
+        remove(expired_path);
+      goto cleanup;
+    }
+    remove(expired_path);
+    coco_warning("coco_work_queue_claim(): reclaimed %s from process %s without heartbeat for %lu seconds, "
+        "its incomplete output in '%s' needs to be removed before merging", name, owner, queue->timeout,
+        owner_output_folder);
+    if (!coco_work_queue_write_lease(queue, lease_path, 1, output_folder))
+      goto cleanup;
+  }
+
+  /* The item might have been finished just before the lease was created */
+  if (coco_file_exists(done_path)) {
+    remove(lease_path);
+    goto cleanup;
+  }
+  queue->current_item = coco_strdup(name);
+  result = 1;
+
+  cleanup:
+  coco_free_memory(done_path);
+  coco_free_memory(lease_path);
+  coco_free_memory(expired_path);
+  return result;
+}
+
+/**
+ * Renews the heartbeat of the lease of the current item. The new lease is written to a file of its own,
+ * which replaces the lease file only if this process is still its owner.
+ */
+static void coco_work_queue_renew(const coco_work_queue_t *queue, const char *output_folder) {
+
+  char *lease_path, *renewal_path;
+  char owner[COCO_PATH_MAX], owner_output_folder[COCO_PATH_MAX];
+  unsigned long heartbeat;
+
+  if (queue->current_item == NULL)
+    return;
+  lease_path = coco_strdupf("%s%s%s.lease", queue->folder, coco_path_separator, queue->current_item);
+  renewal_path = coco_strdupf("%s.%s.new", lease_path, queue->owner);
+  if (!coco_work_queue_write_lease(queue, renewal_path, 0, output_folder)) {
+    coco_warning("coco_work_queue_renew(): failed to write file '%s'", renewal_path);
+  } else if (!coco_work_queue_read_lease(lease_path, owner, &heartbeat, owner_output_folder)
+      || (strcmp(owner, queue->owner) != 0)
+      || !coco_work_queue_move_replacing(renewal_path, lease_path)
+      || !coco_work_queue_read_lease(lease_path, owner, &heartbeat, owner_output_folder)
+      || (strcmp(owner, queue->owner) != 0)) {
+    /* The owner is checked again after the renewal, since another process may have reclaimed the lease
+     * between the first check and the rename */
+    coco_warning("coco_work_queue_renew(): the lease of %s has been lost to another process, the timeout of "
+        "%lu seconds is too short", queue->current_item, queue->timeout);
+  }
+  remove(renewal_path);
+  coco_free_memory(renewal_path);
+  coco_free_memory(lease_path);
+}
+
+/**
+ * The data of the heartbeat layer (see coco_work_queue_add_heartbeat()).
+ */
+typedef struct {
+  const coco_work_queue_t *queue;
+  char *output_folder;
+  size_t time_check_period;   /* The number of evaluations between two readings of the clock */
+  size_t evaluations_to_time_check;
+  double last_time_check;
+  double last_heartbeat;
+} coco_work_queue_heartbeat_t;
+
+/**
+ * Counts number_of_evaluations evaluations and renews the heartbeat if a quarter of the timeout has passed
+ * since the last one. As in the COCO_FLUSH_INTERVAL policy of the loggers, reading the clock can cost more
+ * than evaluating a cheap function, so the clock is read only about ten times per quarter of the timeout.
+ */
+static void coco_work_queue_heartbeat_update(coco_work_queue_heartbeat_t *heartbeat,
+                                             const size_t number_of_evaluations) {
+
+  const double interval = (double) heartbeat->queue->timeout / 4;
+  double time;
+
+  if (heartbeat->evaluations_to_time_check > number_of_evaluations) {
+    heartbeat->evaluations_to_time_check -= number_of_evaluations;
+    return;
+  }
+  time = coco_get_monotonic_time();
+  if (time - heartbeat->last_heartbeat >= interval) {
+    coco_work_queue_renew(heartbeat->queue, heartbeat->output_folder);
+    heartbeat->last_heartbeat = time;
+  }
+  if ((time - heartbeat->last_time_check < interval / 10)
+      && (heartbeat->time_check_period < COCO_WORK_QUEUE_MAX_TIME_CHECK_PERIOD))
+    heartbeat->time_check_period *= 2;
+  else if ((time - heartbeat->last_time_check >= interval / 10) && (heartbeat->time_check_period > 1))
+    heartbeat->time_check_period /= 2;
+  heartbeat->evaluations_to_time_check = heartbeat->time_check_period;
+  heartbeat->last_time_check = time;
+}
+
+/**
+ * Evaluates the function and renews the heartbeat if needed.
+ */
+static void coco_work_queue_heartbeat_evaluate(coco_problem_t *self, const double *x, double *y) {
+  coco_evaluate_function(coco_transformed_get_inner_problem(self), x, y);
+  coco_work_queue_heartbeat_update((coco_work_queue_heartbeat_t *) coco_transformed_get_data(self), 1);
+}
+
+/**
+ * Evaluates the function in a block of solutions and renews the heartbeat if needed.
+ */
+static void coco_work_queue_heartbeat_evaluate_population(coco_problem_t *self,
+                                                          const double *x,
+                                                          const size_t number_of_solutions,
+                                                          double *y) {
+  coco_evaluate_population(coco_transformed_get_inner_problem(self), x, number_of_solutions, y);
+  coco_work_queue_heartbeat_update((coco_work_queue_heartbeat_t *) coco_transformed_get_data(self),
+      number_of_solutions);
+}
+
+/**
+ * Frees the data of the heartbeat layer.
+ */
+static void coco_work_queue_heartbeat_free(void *stuff) {
+  coco_work_queue_heartbeat_t *heartbeat = (coco_work_queue_heartbeat_t *) stuff;
+  coco_free_memory(heartbeat->output_folder);
+}
+
+/**
+ * Wraps the given problem of the current item into a transparent layer that renews the heartbeat of the
+ * lease during the evaluations, so that the timeout only needs to be longer than the time between two
+ * evaluations (and the construction of a problem) rather than the runtime on a whole problem. The layer
+ * must not be evaluated after the current item of the queue has changed.
+ */
+static coco_problem_t *coco_work_queue_add_heartbeat(const coco_work_queue_t *queue,
+                                                     coco_problem_t *problem,
+                                                     const char *output_folder) {
+  coco_work_queue_heartbeat_t *heartbeat;
+  coco_problem_t *self;
+
+  heartbeat = (coco_work_queue_heartbeat_t *) coco_allocate_memory(sizeof(*heartbeat));
+  heartbeat->queue = queue;
+  heartbeat->output_folder = coco_strdup(output_folder);
+  heartbeat->time_check_period = 1;
+  heartbeat->evaluations_to_time_check = 1;
+  heartbeat->last_heartbeat = coco_get_monotonic_time();
+  heartbeat->last_time_check = heartbeat->last_heartbeat;
+
+  self = coco_transformed_allocate(problem, heartbeat, coco_work_queue_heartbeat_free);
+  self->evaluate_function = coco_work_queue_heartbeat_evaluate;
+  self->evaluate_population = coco_work_queue_heartbeat_evaluate_population;
+  return self;
+}
+
+/**
+ * Marks the current item as finished.
+ */
+static void coco_work_queue_finish(coco_work_queue_t *queue, const char *output_folder) {
+
+  char *done_path, *lease_path;
+  FILE *file;
+
+  if (queue->current_item == NULL)
+    return;
+  done_path = coco_strdupf("%s%s%s.done", queue->folder, coco_path_separator, queue->current_item);
+  lease_path = coco_strdupf("%s%s%s.lease", queue->folder, coco_path_separator, queue->current_item);
+  file = fopen(done_path, "w");
+  if (file == NULL) {
+    coco_error("coco_work_queue_finish(): failed to open file '%s'", done_path);
+    return; /* Never reached */
+  }
+  fprintf(file, "%s\n%lu\n%s\n", queue->owner, (unsigned long) time(NULL), output_folder);
+  fclose(file);
+  remove(lease_path);
+
+  coco_free_memory(done_path);
+  coco_free_memory(lease_path);
+  coco_free_memory(queue->current_item);
+  queue->current_item = NULL;
+}
+
+/**
+ * Frees the work queue. The lease of an unfinished current item is left to expire, since its output is
+ * incomplete.
+ */
+static void coco_work_queue_free(coco_work_queue_t *queue) {
+
+  if (queue == NULL)
+    return;
+  if (queue->current_item != NULL)
+    coco_free_memory(queue->current_item);
+  if (queue->units != NULL)
+    coco_free_memory(queue->units);
+  if (queue->owner != NULL)
+    coco_free_memory(queue->owner);
+  coco_free_memory(queue->folder);
+  coco_free_memory(queue);
+}
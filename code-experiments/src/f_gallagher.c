@@ -101,11 +101,6 @@ static void f_gallagher_free(coco_problem_t *self) {
   bbob2009_free_matrix(data->arr_scales, data->number_of_peaks);
   self->free_problem = NULL;
   coco_problem_free(self);
-
-  if (gallagher_peaks != NULL) {
-    coco_free_memory(gallagher_peaks);
-    gallagher_peaks = NULL;
-  }
 }
 
 /* Note: there is no separate f_gallagher_allocate() function! */
@@ -211,6 +206,10 @@ static coco_problem_t *f_gallagher_bbob_problem_allocate(const size_t function,
     }
   }
   coco_free_memory(arrCondition);
+  /* The peaks are needed only during the construction, so that freeing a problem does not interfere with
+   * the construction of another one (see coco_prefetch.c) */
+  coco_free_memory(gallagher_peaks);
+  gallagher_peaks = NULL;
 
   problem->data = data;
 
@@ -0,0 +1,290 @@
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "coco.h"
+#include "coco_internal.h"
+
+#include "coco_utilities.c"
+
+/**
+ * Asynchronous logging: instead of logging each evaluation by itself, a logger pushes the evaluated solution
+ * (x followed by y) and its evaluation number into a ring buffer and a background writer thread pops the
+ * solutions in the same order and passes them to the logger's log function, which does all the bookkeeping
+ * and file output.
+ *
+ * The ring buffer has a single producer (the thread evaluating the problem) and a single consumer (the
+ * writer thread), so it needs no locks: the producer only advances head and the consumer only advances tail.
+ * The mutex and the condition variable are used only for sleeping when the buffer is empty (the writer) or
+ * full (the evaluation). A full buffer therefore blocks the evaluation until the writer has logged at least
+ * one solution; solutions are never dropped.
+ *
+ * The writers need to be drained before the logger is freed, which is done by logger_async_stop(). All
+ * remaining writers are also drained when the observer is freed (the suite usually frees its last problem
+ * only after the observer).
+ *
+ * Asynchronous logging is available only if COCO is compiled with COCO_ASYNC_LOGGING (see coco_platform.h),
+ * otherwise logger_async_start() always returns NULL and the loggers log synchronously.
+ */
+
+#if defined(HAVE_ASYNC_LOGGING)
+
+#define logger_async_load(pointer) __atomic_load_n(pointer, __ATOMIC_SEQ_CST)
+#define logger_async_store(pointer, value) __atomic_store_n(pointer, value, __ATOMIC_SEQ_CST)
+
+struct logger_async {
+  coco_observer_t *observer;
+  void *logger;                              /* the data of the logger passed to log_function */
+  coco_logger_log_function_t log_function;   /* called in the writer thread for each evaluated solution */
+
+  size_t number_of_variables;
+  size_t number_of_objectives;
+
+  double *records;   /* capacity records of number_of_variables + number_of_objectives values */
+  size_t *evaluation_numbers; /* the evaluation numbers of the records */
+  size_t capacity;
+  size_t head;       /* the number of pushed records (changed only by the producer) */
+  size_t tail;       /* the number of logged records (changed only by the consumer) */
+
+  int producer_waiting;
+  int consumer_waiting;
+  int closing;
+
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t condition;
+
+  logger_async_t *next; /* the next writer of the same observer */
+};
+
+/**
+ * Wakes up the other thread if it is waiting (the flag is checked only after the counters have been updated,
+ * so that no wake-up can be lost).
+ */
+static void logger_async_notify(logger_async_t *writer, int *waiting) {
+  if (logger_async_load(waiting)) {
+    pthread_mutex_lock(&writer->mutex);
+    pthread_cond_broadcast(&writer->condition);
+    pthread_mutex_unlock(&writer->mutex);
+  }
+}
+
+/**
+ * Returns 1 if the buffer has no free slot and 0 otherwise.
+ */
+static int logger_async_is_full(logger_async_t *writer) {
+  return (logger_async_load(&writer->head) - logger_async_load(&writer->tail) == writer->capacity);
+}
+
+/**
+ * Returns 1 if the writer has logged all pushed records and 0 otherwise.
+ */
+static int logger_async_is_empty(logger_async_t *writer) {
+  return (logger_async_load(&writer->head) == logger_async_load(&writer->tail));
+}
+
+/**
+ * The writer thread logs records until the writer is closed and all records have been logged.
+ */
+static void *logger_async_run(void *stuff) {
+
+  logger_async_t *writer = (logger_async_t *) stuff;
+  const size_t record_size = writer->number_of_variables + writer->number_of_objectives;
+  double *record;
+  size_t tail;
+
+  for (;;) {
+    while (!logger_async_is_empty(writer)) {
+      tail = logger_async_load(&writer->tail);
+      record = &writer->records[(tail % writer->capacity) * record_size];
+      writer->log_function(writer->logger, writer->evaluation_numbers[tail % writer->capacity], record,
+          record + writer->number_of_variables);
+      logger_async_store(&writer->tail, tail + 1);
+      logger_async_notify(writer, &writer->producer_waiting);
+    }
+
+    pthread_mutex_lock(&writer->mutex);
+    logger_async_store(&writer->consumer_waiting, 1);
+    while (logger_async_is_empty(writer) && !logger_async_load(&writer->closing))
+      pthread_cond_wait(&writer->condition, &writer->mutex);
+    logger_async_store(&writer->consumer_waiting, 0);
+    pthread_mutex_unlock(&writer->mutex);
+
+    if (logger_async_load(&writer->closing) && logger_async_is_empty(writer))
+      break;
+  }
+  return NULL;
+}
+
+/**
+ * Starts a writer thread that will call log_function with the given logger data for each record of the
+ * problem pushed by logger_async_push(). Returns NULL if the observer does not use asynchronous logging or
+ * the thread could not be started.
+ */
+static logger_async_t *logger_async_start(coco_observer_t *observer,
+                                          const coco_problem_t *problem,
+                                          void *logger,
+                                          coco_logger_log_function_t log_function) {
+  logger_async_t *writer;
+
+  if (!observer->async_logging)
+    return NULL;
+
+  writer = (logger_async_t *) coco_allocate_memory(sizeof(*writer));
+  writer->observer = observer;
+  writer->logger = logger;
+  writer->log_function = log_function;
+  writer->number_of_variables = problem->number_of_variables;
+  writer->number_of_objectives = problem->number_of_objectives;
+  writer->capacity = observer->async_buffer_size;
+  writer->records = coco_allocate_vector(writer->capacity
+      * (writer->number_of_variables + writer->number_of_objectives));
+  writer->evaluation_numbers = (size_t *) coco_allocate_memory(writer->capacity * sizeof(size_t));
+  writer->head = 0;
+  writer->tail = 0;
+  writer->producer_waiting = 0;
+  writer->consumer_waiting = 0;
+  writer->closing = 0;
+  pthread_mutex_init(&writer->mutex, NULL);
+  pthread_cond_init(&writer->condition, NULL);
+
+  if (pthread_create(&writer->thread, NULL, logger_async_run, writer) != 0) {
+    coco_warning("logger_async_start(): failed to start the writer thread, logging synchronously");
+    pthread_cond_destroy(&writer->condition);
+    pthread_mutex_destroy(&writer->mutex);
+    coco_free_memory(writer->evaluation_numbers);
+    coco_free_memory(writer->records);
+    coco_free_memory(writer);
+    return NULL;
+  }
+
+  writer->next = observer->async_writers;
+  observer->async_writers = writer;
+  return writer;
+}
+
+/**
+ * Pushes the evaluated solution with the given evaluation number into the buffer of the writer (waits while
+ * the buffer is full).
+ */
+static void logger_async_push(logger_async_t *writer,
+                              const size_t number_of_evaluations,
+                              const double *x,
+                              const double *y) {
+
+  const size_t record_size = writer->number_of_variables + writer->number_of_objectives;
+  const size_t head = writer->head;
+  double *record;
+
+  if (logger_async_is_full(writer)) {
+    pthread_mutex_lock(&writer->mutex);
+    logger_async_store(&writer->producer_waiting, 1);
+    while (logger_async_is_full(writer))
+      pthread_cond_wait(&writer->condition, &writer->mutex);
+    logger_async_store(&writer->producer_waiting, 0);
+    pthread_mutex_unlock(&writer->mutex);
+  }
+
+  record = &writer->records[(head % writer->capacity) * record_size];
+  memcpy(record, x, writer->number_of_variables * sizeof(double));
+  memcpy(record + writer->number_of_variables, y, writer->number_of_objectives * sizeof(double));
+  writer->evaluation_numbers[head % writer->capacity] = number_of_evaluations;
+  logger_async_store(&writer->head, head + 1);
+  logger_async_notify(writer, &writer->consumer_waiting);
+}
+
+/**
+ * Waits until the writer has logged all pushed records.
+ */
+static void logger_async_drain(logger_async_t *writer) {
+
+  pthread_mutex_lock(&writer->mutex);
+  logger_async_store(&writer->producer_waiting, 1);
+  while (!logger_async_is_empty(writer))
+    pthread_cond_wait(&writer->condition, &writer->mutex);
+  logger_async_store(&writer->producer_waiting, 0);
+  pthread_mutex_unlock(&writer->mutex);
+}
+
+/**
+ * Logs all pushed records, stops the writer thread and frees the writer.
+ */
+static void logger_async_stop(logger_async_t *writer) {
+
+  logger_async_t **link;
+
+  logger_async_store(&writer->closing, 1);
+  pthread_mutex_lock(&writer->mutex);
+  pthread_cond_broadcast(&writer->condition);
+  pthread_mutex_unlock(&writer->mutex);
+  pthread_join(writer->thread, NULL);
+
+  if (writer->observer != NULL) {
+    for (link = &writer->observer->async_writers; *link != NULL; link = &(*link)->next) {
+      if (*link == writer) {
+        *link = writer->next;
+        break;
+      }
+    }
+  }
+
+  pthread_cond_destroy(&writer->condition);
+  pthread_mutex_destroy(&writer->mutex);
+  coco_free_memory(writer->evaluation_numbers);
+  coco_free_memory(writer->records);
+  coco_free_memory(writer);
+}
+
+/**
+ * Waits until all writers of the observer have logged all pushed records and detaches them from the observer
+ * (which is about to be freed, while the problems can be freed later).
+ */
+static void logger_async_drain_all(coco_observer_t *observer) {
+
+  logger_async_t *writer, *next;
+
+  for (writer = observer->async_writers; writer != NULL; writer = next) {
+    logger_async_drain(writer);
+    next = writer->next;
+    writer->observer = NULL;
+    writer->next = NULL;
+  }
+  observer->async_writers = NULL;
+}
+
+#else
+
+struct logger_async {
+  int unused;
+};
+
+static logger_async_t *logger_async_start(coco_observer_t *observer,
+                                          const coco_problem_t *problem,
+                                          void *logger,
+                                          coco_logger_log_function_t log_function) {
+  (void) observer; /* unused */
+  (void) problem; /* unused */
+  (void) logger; /* unused */
+  (void) log_function; /* unused */
+  return NULL;
+}
+
+static void logger_async_push(logger_async_t *writer,
+                              const size_t number_of_evaluations,
+                              const double *x,
+                              const double *y) {
+  (void) writer; /* unused */
+  (void) number_of_evaluations; /* unused */
+  (void) x; /* unused */
+  (void) y; /* unused */
+}
+
+static void logger_async_stop(logger_async_t *writer) {
+  (void) writer; /* unused */
+}
+
+static void logger_async_drain_all(coco_observer_t *observer) {
+  (void) observer; /* unused */
+}
+
+#endif
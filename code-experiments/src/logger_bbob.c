@@ -12,6 +12,10 @@
 #include "coco_problem.c"
 #include "coco_string.c"
 #include "observer_bbob.c"
+#include "logger_async.c"
+#include "logger_triggers.c"
+#include "logger_flush.c"
+#include "coco_probes.h"
 
 static int bbob_raisedOptValWarning;
 /*static const size_t bbob_nbpts_nbevals = 20; Wassim: tentative, are now observer options with these default values*/
@@ -38,6 +42,16 @@ static int bbob_logger_is_open = 0; /* this could become lock-list of .info file
 
 /* TODO: add possibility of adding a prefix to the index files (easy to do through observer options) */
 
+/* The size of the stream buffers of the data files in the binary format */
+#define LOGGER_BBOB_BINARY_BUFFER_SIZE 1048576
+
+/* The number of variables up to which the decision vector is written to the data files */
+#define LOGGER_BBOB_MAX_LOGGED_VARIABLES 21
+
+/* The byte of which the 8-byte field that marks a run header in the binary data files consists (evaluation
+ * numbers never reach the value with all bits set) */
+#define LOGGER_BBOB_BINARY_HEADER_MARK 0xFF
+
 typedef struct {
   coco_observer_t *observer;
   int is_initialized;
@@ -47,11 +61,12 @@ typedef struct {
   FILE *fdata_file; /* function value aligned data file */
   FILE *tdata_file; /* number of function evaluations aligned data file */
   FILE *rdata_file; /* restart info data file */
+  int binary_format; /* whether the data files are written in the binary format */
+  logger_flush_t flush; /* when the data files are flushed */
   double f_trigger; /* next upper bound on the fvalue to trigger a log in the .dat file*/
-  long t_trigger; /* next lower bound on nb fun evals to trigger a log in the .tdat file*/
   int idx_f_trigger; /* allows to track the index i in logging target = {10**(i/bbob_nbpts_fval), i \in Z} */
-  int idx_t_trigger; /* allows to track the index i in logging nbevals = {int(10**(i/bbob_nbpts_nbevals)), i \in Z} */
-  int idx_tdim_trigger; /* allows to track the index i in logging nbevals = {dim * 10**i, i \in Z} */
+  logger_f_triggers_t *f_triggers; /* precomputed targets 10**(i/bbob_nbpts_fval) */
+  logger_evaluation_triggers_t *t_triggers; /* evaluation numbers that trigger a log in the .tdat file */
   size_t number_of_evaluations;
   double best_fvalue;
   double last_fvalue;
@@ -65,6 +80,8 @@ typedef struct {
   size_t instance_id;
   size_t number_of_variables;
   double optimal_fvalue;
+  coco_problem_t *problem; /* the logged problem */
+  logger_async_t *async_writer; /* NULL if the logger logs synchronously */
 } logger_bbob_t;
 
 static const char *bbob_file_header_str = "%% function evaluation | "
@@ -91,31 +108,14 @@ static void logger_bbob_update_f_trigger(logger_bbob_t *logger, double fvalue) {
     } else { /* We only call this function when we reach the current f_trigger*/
       logger->idx_f_trigger--;
     }
-    logger->f_trigger = pow(10, logger->idx_f_trigger * 1.0 / (double) (long) observer_bbob->bbob_nbpts_fval);
+    logger->f_trigger = logger_f_triggers_get(logger->f_triggers, logger->idx_f_trigger);
     while (fvalue - logger->optimal_fvalue <= logger->f_trigger) {
       logger->idx_f_trigger--;
-      logger->f_trigger = pow(10,
-          logger->idx_f_trigger * 1.0 / (double) (long) observer_bbob->bbob_nbpts_fval);
+      logger->f_trigger = logger_f_triggers_get(logger->f_triggers, logger->idx_f_trigger);
     }
   }
 }
 
-static void logger_bbob_update_t_trigger(logger_bbob_t *logger, size_t number_of_variables) {
-  observer_bbob_t *observer_bbob;
-  observer_bbob = (observer_bbob_t *) logger->observer->data;
-  while (logger->number_of_evaluations
-      >= floor(pow(10, (double) logger->idx_t_trigger / (double) (long) observer_bbob->bbob_nbpts_nbevals)))
-    logger->idx_t_trigger++;
-
-  while (logger->number_of_evaluations
-      >= (double) (long) number_of_variables * pow(10, (double) logger->idx_tdim_trigger))
-    logger->idx_tdim_trigger++;
-
-  logger->t_trigger = (long) coco_min_double(
-      floor(pow(10, (double) logger->idx_t_trigger / (double) (long) observer_bbob->bbob_nbpts_nbevals)),
-      (double) (long) number_of_variables * pow(10, (double) logger->idx_tdim_trigger));
-}
-
 /**
  * adds a formated line to a data file
  */
@@ -131,7 +131,7 @@ static void logger_bbob_write_data(FILE *target_file,
    */
   fprintf(target_file, "%ld %+10.9e %+10.9e %+10.9e %+10.9e", number_of_evaluations, fvalue - best_value,
       best_fvalue - best_value, fvalue, best_fvalue);
-  if (number_of_variables < 22) {
+  if (number_of_variables <= LOGGER_BBOB_MAX_LOGGED_VARIABLES) {
     size_t i;
     for (i = 0; i < number_of_variables; i++) {
       fprintf(target_file, " %+5.4e", x[i]);
@@ -140,6 +140,210 @@ static void logger_bbob_write_data(FILE *target_file,
   fprintf(target_file, "\n");
 }
 
+/**
+ * The binary data files consist of runs. Each run starts with a header of three 8-byte fields:
+ * - the header mark (all bytes equal to LOGGER_BBOB_BINARY_HEADER_MARK, i.e., all bits set)
+ * - the number of variables n
+ * - the optimal f value (Fopt)
+ * and is followed by records of 3 + k 8-byte fields, where k = n if n <= LOGGER_BBOB_MAX_LOGGED_VARIABLES
+ * and k = 0 otherwise:
+ * - the number of evaluations
+ * - the measured fitness
+ * - the best measured fitness
+ * - the first k variables of the decision vector
+ * Integers are stored as unsigned 64-bit values and doubles as IEEE 754 values, both in little-endian byte
+ * order, so that the files are the same on all hosts regardless of the width of size_t. This is all that is
+ * needed to reproduce the text format, see coco_bbob_binary_to_text().
+ */
+
+/**
+ * Returns 1 if the host byte order is little-endian and 0 otherwise.
+ */
+static int logger_bbob_binary_is_little_endian(void) {
+  const unsigned long one = 1;
+  return (*(const unsigned char *) &one == 1);
+}
+
+/**
+ * Stores value as unsigned 64-bit integer into the 8 bytes starting at bytes. The upper 32 bits are shifted
+ * in two steps, since size_t may have only 32 bits.
+ */
+static void logger_bbob_binary_put_size_t(unsigned char *bytes, const size_t value) {
+  unsigned long low = (unsigned long) (value & 0xFFFFFFFFUL);
+  unsigned long high = (unsigned long) (((value >> 16) >> 16) & 0xFFFFFFFFUL);
+  size_t i;
+  for (i = 0; i < 4; i++) {
+    bytes[i] = (unsigned char) (low & 0xFF);
+    bytes[i + 4] = (unsigned char) (high & 0xFF);
+    low >>= 8;
+    high >>= 8;
+  }
+}
+
+/**
+ * Stores the header mark into the 8 bytes starting at bytes.
+ */
+static void logger_bbob_binary_put_header_mark(unsigned char *bytes) {
+  size_t i;
+  for (i = 0; i < 8; i++)
+    bytes[i] = LOGGER_BBOB_BINARY_HEADER_MARK;
+}
+
+/**
+ * Stores value into the 8 bytes starting at bytes (is_little_endian is the host byte order).
+ */
+static void logger_bbob_binary_put_double(unsigned char *bytes, const double value, const int is_little_endian) {
+  const unsigned char *value_bytes = (const unsigned char *) &value;
+  size_t i;
+  if (is_little_endian) {
+    for (i = 0; i < 8; i++)
+      bytes[i] = value_bytes[i];
+  } else {
+    for (i = 0; i < 8; i++)
+      bytes[i] = value_bytes[7 - i];
+  }
+}
+
+/**
+ * Returns 1 if the 8 bytes starting at bytes are the header mark and 0 otherwise.
+ */
+static int logger_bbob_binary_is_header_mark(const unsigned char *bytes) {
+  size_t i;
+  for (i = 0; i < 8; i++) {
+    if (bytes[i] != LOGGER_BBOB_BINARY_HEADER_MARK)
+      return 0;
+  }
+  return 1;
+}
+
+/**
+ * Returns the unsigned 64-bit integer stored in the 8 bytes starting at bytes (values that do not fit into
+ * size_t are truncated).
+ */
+static size_t logger_bbob_binary_get_size_t(const unsigned char *bytes) {
+  unsigned long low = 0, high = 0;
+  size_t i;
+  for (i = 4; i > 0; i--) {
+    low = (low << 8) | bytes[i - 1];
+    high = (high << 8) | bytes[i + 3];
+  }
+  return (((size_t) high << 16) << 16) | (size_t) low;
+}
+
+/**
+ * Returns the value stored in the 8 bytes starting at bytes (is_little_endian is the host byte order).
+ */
+static double logger_bbob_binary_get_double(const unsigned char *bytes, const int is_little_endian) {
+  double value;
+  unsigned char *value_bytes = (unsigned char *) &value;
+  size_t i;
+  if (is_little_endian) {
+    for (i = 0; i < 8; i++)
+      value_bytes[i] = bytes[i];
+  } else {
+    for (i = 0; i < 8; i++)
+      value_bytes[i] = bytes[7 - i];
+  }
+  return value;
+}
+
+/**
+ * Adds a run header to a binary data file.
+ */
+static void logger_bbob_write_binary_header(FILE *target_file, size_t number_of_variables, double best_value) {
+  unsigned char bytes[24];
+
+  logger_bbob_binary_put_header_mark(&bytes[0]);
+  logger_bbob_binary_put_size_t(&bytes[8], number_of_variables);
+  logger_bbob_binary_put_double(&bytes[16], best_value, logger_bbob_binary_is_little_endian());
+  fwrite(bytes, 1, sizeof(bytes), target_file);
+}
+
+/**
+ * Adds a record to a binary data file (the counterpart of logger_bbob_write_data).
+ */
+static void logger_bbob_write_binary_data(FILE *target_file,
+                                          size_t number_of_evaluations,
+                                          double fvalue,
+                                          double best_fvalue,
+                                          const double *x,
+                                          size_t number_of_variables) {
+  const int is_little_endian = logger_bbob_binary_is_little_endian();
+  unsigned char bytes[8 * (3 + LOGGER_BBOB_MAX_LOGGED_VARIABLES)];
+  size_t i, size = 24;
+
+  logger_bbob_binary_put_size_t(&bytes[0], number_of_evaluations);
+  logger_bbob_binary_put_double(&bytes[8], fvalue, is_little_endian);
+  logger_bbob_binary_put_double(&bytes[16], best_fvalue, is_little_endian);
+  if (number_of_variables <= LOGGER_BBOB_MAX_LOGGED_VARIABLES) {
+    for (i = 0; i < number_of_variables; i++) {
+      logger_bbob_binary_put_double(&bytes[size], x[i], is_little_endian);
+      size += 8;
+    }
+  }
+  fwrite(bytes, 1, size, target_file);
+}
+
+/**
+ * Converts the binary data file binary_file_name (written by the bbob observer with the option
+ * "format: binary") to the text file text_file_name, which is identical to the file that the bbob observer
+ * would have written with the option "format: text".
+ *
+ * If text_file_name already exists, it is overwritten.
+ */
+void coco_bbob_binary_to_text(const char *binary_file_name, const char *text_file_name) {
+
+  FILE *binary_file, *text_file;
+  unsigned char bytes[8 * (3 + LOGGER_BBOB_MAX_LOGGED_VARIABLES)];
+  double x[LOGGER_BBOB_MAX_LOGGED_VARIABLES];
+  double best_value = 0;
+  size_t number_of_variables = 0, number_of_logged_variables = 0, i;
+  int header_found = 0;
+  const int is_little_endian = logger_bbob_binary_is_little_endian();
+
+  binary_file = fopen(binary_file_name, "rb");
+  if (binary_file == NULL) {
+    coco_error("coco_bbob_binary_to_text(): failed to open file '%s'", binary_file_name);
+    return; /* Never reached */
+  }
+  text_file = fopen(text_file_name, "w");
+  if (text_file == NULL) {
+    fclose(binary_file);
+    coco_error("coco_bbob_binary_to_text(): failed to open file '%s'", text_file_name);
+    return; /* Never reached */
+  }
+
+  while (fread(bytes, 1, 24, binary_file) == 24) {
+    if (logger_bbob_binary_is_header_mark(&bytes[0])) {
+      number_of_variables = logger_bbob_binary_get_size_t(&bytes[8]);
+      best_value = logger_bbob_binary_get_double(&bytes[16], is_little_endian);
+      number_of_logged_variables = 0;
+      if (number_of_variables <= LOGGER_BBOB_MAX_LOGGED_VARIABLES)
+        number_of_logged_variables = number_of_variables;
+      fprintf(text_file, bbob_file_header_str, best_value);
+      header_found = 1;
+      continue;
+    }
+    if (!header_found
+        || (fread(&bytes[24], 8, number_of_logged_variables, binary_file) != number_of_logged_variables)) {
+      break;
+    }
+    for (i = 0; i < number_of_logged_variables; i++) {
+      x[i] = logger_bbob_binary_get_double(&bytes[24 + 8 * i], is_little_endian);
+    }
+    logger_bbob_write_data(text_file, logger_bbob_binary_get_size_t(&bytes[0]),
+        logger_bbob_binary_get_double(&bytes[8], is_little_endian),
+        logger_bbob_binary_get_double(&bytes[16], is_little_endian), best_value, x, number_of_variables);
+  }
+
+  if (!feof(binary_file)) {
+    coco_warning("coco_bbob_binary_to_text(): file '%s' is corrupted, the conversion is incomplete",
+        binary_file_name);
+  }
+  fclose(binary_file);
+  fclose(text_file);
+}
+
 /**
  * Error when trying to create the file "path"
  */
@@ -173,12 +377,66 @@ static void logger_bbob_open_dataFile(FILE **target_file,
   if (*target_file == NULL) {
     *target_file = fopen(file_path, "a+");
     errnum = errno;
+    COCO_PROBE3(logger_file_open, "bbob", file_path, *target_file);
     if (*target_file == NULL) {
       logger_bbob_error_io(*target_file, errnum);
     }
   }
 }
 
+/**
+ * Opens the binary data file (with the extension file_extension followed by ".bin").
+ */
+static void logger_bbob_open_binary_dataFile(FILE **target_file,
+                                             const char *path,
+                                             const char *dataFile_path,
+                                             const char *file_extension) {
+  char file_path[COCO_PATH_MAX] = { 0 };
+  char relative_filePath[COCO_PATH_MAX] = { 0 };
+  int errnum;
+  strncpy(relative_filePath, dataFile_path, COCO_PATH_MAX - strlen(relative_filePath) - 1);
+  strncat(relative_filePath, file_extension, COCO_PATH_MAX - strlen(relative_filePath) - 1);
+  strncat(relative_filePath, ".bin", COCO_PATH_MAX - strlen(relative_filePath) - 1);
+  coco_join_path(file_path, sizeof(file_path), path, relative_filePath, NULL);
+  if (*target_file == NULL) {
+    *target_file = fopen(file_path, "ab");
+    errnum = errno;
+    COCO_PROBE3(logger_file_open, "bbob", file_path, *target_file);
+    if (*target_file == NULL) {
+      logger_bbob_error_io(*target_file, errnum);
+    }
+  }
+}
+
+/**
+ * Adds a line to the given data file in the format used by the logger.
+ */
+static void logger_bbob_output(logger_bbob_t *logger,
+                               FILE *target_file,
+                               size_t number_of_evaluations,
+                               double fvalue,
+                               const double *x) {
+  if (logger->binary_format) {
+    logger_bbob_write_binary_data(target_file, number_of_evaluations, fvalue, logger->best_fvalue, x,
+        logger->number_of_variables);
+  } else {
+    logger_bbob_write_data(target_file, number_of_evaluations, fvalue, logger->best_fvalue,
+        logger->optimal_fvalue, x, logger->number_of_variables);
+  }
+  COCO_PROBE3(logger_file_write, "bbob", target_file, number_of_evaluations);
+}
+
+/**
+ * Adds the header of a run to the given data file in the format used by the logger.
+ */
+static void logger_bbob_output_header(logger_bbob_t *logger, FILE *target_file) {
+  if (logger->binary_format) {
+    logger_bbob_write_binary_header(target_file, logger->number_of_variables, logger->optimal_fvalue);
+  } else {
+    fprintf(target_file, bbob_file_header_str, logger->optimal_fvalue);
+  }
+}
+
 /*
 static void logger_bbob_open_dataFile(FILE **target_file,
                                       const char *path,
@@ -240,6 +498,7 @@ static void logger_bbob_openIndexFile(logger_bbob_t *logger,
         /* new instance of current funId and current dim */
       newLine = 0;
       *target_file = fopen(file_path, "a+");
+      COCO_PROBE3(logger_file_open, "bbob", file_path, *target_file);
       if (*target_file == NULL) {
         errnum = errno;
         logger_bbob_error_io(*target_file, errnum);
@@ -282,6 +541,7 @@ static void logger_bbob_openIndexFile(logger_bbob_t *logger,
         }
       }
       *target_file = fopen(file_path, "a+"); /* in any case, we append */
+      COCO_PROBE3(logger_file_open, "bbob", file_path, *target_file);
       if (*target_file == NULL) {
         errnum = errno;
         logger_bbob_error_io(*target_file, errnum);
@@ -357,43 +617,59 @@ static void logger_bbob_initialize(logger_bbob_t *logger, coco_problem_t *inner_
   strncat(dataFile_path, "_i", COCO_PATH_MAX - strlen(dataFile_path) - 1);
   strncat(dataFile_path, bbob_infoFile_firstInstance_char,
   COCO_PATH_MAX - strlen(dataFile_path) - 1);
-  logger_bbob_open_dataFile(&(logger->fdata_file), logger->observer->output_folder, dataFile_path, ".dat");
-  fprintf(logger->fdata_file, bbob_file_header_str, logger->optimal_fvalue);
-
-  logger_bbob_open_dataFile(&(logger->tdata_file), logger->observer->output_folder, dataFile_path, ".tdat");
-  fprintf(logger->tdata_file, bbob_file_header_str, logger->optimal_fvalue);
-
-  logger_bbob_open_dataFile(&(logger->rdata_file), logger->observer->output_folder, dataFile_path, ".rdat");
-  fprintf(logger->rdata_file, bbob_file_header_str, logger->optimal_fvalue);
+  if (logger->binary_format) {
+    logger_bbob_open_binary_dataFile(&(logger->fdata_file), logger->observer->output_folder, dataFile_path,
+        ".dat");
+    logger_bbob_open_binary_dataFile(&(logger->tdata_file), logger->observer->output_folder, dataFile_path,
+        ".tdat");
+    logger_bbob_open_binary_dataFile(&(logger->rdata_file), logger->observer->output_folder, dataFile_path,
+        ".rdat");
+  } else {
+    logger_bbob_open_dataFile(&(logger->fdata_file), logger->observer->output_folder, dataFile_path, ".dat");
+    logger_bbob_open_dataFile(&(logger->tdata_file), logger->observer->output_folder, dataFile_path, ".tdat");
+    logger_bbob_open_dataFile(&(logger->rdata_file), logger->observer->output_folder, dataFile_path, ".rdat");
+  }
+  logger_flush_add_file(&logger->flush, logger->fdata_file,
+      logger->binary_format ? LOGGER_BBOB_BINARY_BUFFER_SIZE : 0);
+  logger_flush_add_file(&logger->flush, logger->tdata_file,
+      logger->binary_format ? LOGGER_BBOB_BINARY_BUFFER_SIZE : 0);
+  logger_flush_add_file(&logger->flush, logger->rdata_file,
+      logger->binary_format ? LOGGER_BBOB_BINARY_BUFFER_SIZE : 0);
+  logger_bbob_output_header(logger, logger->fdata_file);
+  logger_bbob_output_header(logger, logger->tdata_file);
+  logger_bbob_output_header(logger, logger->rdata_file);
   logger->is_initialized = 1;
   coco_free_memory(tmpc_dim);
   coco_free_memory(tmpc_funId);
 }
 
 /**
- * Layer added to the transformed-problem evaluate_function by the logger
+ * Logs the evaluation of x with the result y
  */
-static void logger_bbob_evaluate(coco_problem_t *self, const double *x, double *y) {
-  logger_bbob_t *logger = coco_transformed_get_data(self);
-  coco_problem_t * inner_problem = coco_transformed_get_inner_problem(self);
+static void logger_bbob_log(void *stuff, const size_t number_of_evaluations, const double *x, const double *y) {
+  logger_bbob_t *logger = (logger_bbob_t *) stuff;
+  coco_problem_t *inner_problem = logger->problem;
+  int target_hit = 0, has_written = 0;
+  coco_memory_subsystem_e previous_subsystem;
 
   if (!logger->is_initialized) {
+    previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_LOGGER);
     logger_bbob_initialize(logger, inner_problem);
+    coco_memory_set_subsystem(previous_subsystem);
   }
   if ((coco_log_level >= COCO_DEBUG) && logger->number_of_evaluations == 0) {
     coco_debug("%4ld: ", inner_problem->suite_dep_index);
     coco_debug("on problem %s ... ", coco_problem_get_id(inner_problem));
   }
-  coco_evaluate_function(inner_problem, x, y);
   logger->last_fvalue = y[0];
   logger->written_last_eval = 0;
   if (logger->number_of_evaluations == 0 || y[0] < logger->best_fvalue) {
     size_t i;
     logger->best_fvalue = y[0];
-    for (i = 0; i < self->number_of_variables; i++)
+    for (i = 0; i < logger->number_of_variables; i++)
       logger->best_solution[i] = x[i];
   }
-  logger->number_of_evaluations++;
+  logger->number_of_evaluations = number_of_evaluations;
 
   /* Add sanity check for optimal f value */
   /* assert(y[0] >= logger->optimal_fvalue); */
@@ -405,28 +681,44 @@ static void logger_bbob_evaluate(coco_problem_t *self, const double *x, double *
   /* Add a line in the .dat file for each logging target reached. */
   if (y[0] - logger->optimal_fvalue <= logger->f_trigger) {
 
-    logger_bbob_write_data(logger->fdata_file, logger->number_of_evaluations, y[0], logger->best_fvalue,
-        logger->optimal_fvalue, x, self->number_of_variables);
+    COCO_PROBE5(logger_target_hit, "bbob", inner_problem->problem_id, logger->number_of_evaluations, &y[0],
+        &logger->f_trigger);
+    logger_bbob_output(logger, logger->fdata_file, logger->number_of_evaluations, y[0], x);
     logger_bbob_update_f_trigger(logger, y[0]);
+    target_hit = has_written = 1;
   }
 
-  /* Add a line in the .tdat file each time an fevals trigger is reached.*/
-  if (logger->number_of_evaluations >= logger->t_trigger) {
+  /* Add a line in the .tdat file each time an fevals trigger or a dimension-dependent trigger is reached
+   * (both are contained in t_triggers) */
+  if (logger_evaluation_triggers_is_hit(logger->t_triggers, logger->number_of_evaluations)) {
     logger->written_last_eval = 1;
-    logger_bbob_write_data(logger->tdata_file, logger->number_of_evaluations, y[0], logger->best_fvalue,
-        logger->optimal_fvalue, x, self->number_of_variables);
-    logger_bbob_update_t_trigger(logger, self->number_of_variables);
-  } else {
-    /* Add a line in the .tdat file each time a dimension-depended trigger is reached.*/
-    if ((coco_observer_evaluation_to_log(logger->number_of_evaluations, self->number_of_variables))) {
-      logger->written_last_eval = 1;
-      logger_bbob_write_data(logger->tdata_file, logger->number_of_evaluations, y[0], logger->best_fvalue,
-                             logger->optimal_fvalue, x, self->number_of_variables);
-    }
+    logger_bbob_output(logger, logger->tdata_file, logger->number_of_evaluations, y[0], x);
+    has_written = 1;
   }
 
-  /* Flush output so that impatient users can see progress. */
-  fflush(logger->fdata_file);
+  /* Flush output (by default after each evaluation in the text format, so that impatient users can see
+   * progress, and only when closing the files in the binary format) */
+  logger_flush_update(&logger->flush, has_written, target_hit);
+}
+
+/**
+ * Logs the evaluation of x with the result y or passes it to the writer thread.
+ */
+static void logger_bbob_record(void *stuff, const size_t number_of_evaluations, const double *x, const double *y) {
+  logger_bbob_t *logger = (logger_bbob_t *) stuff;
+
+  if (logger->async_writer != NULL)
+    logger_async_push(logger->async_writer, number_of_evaluations, x, y);
+  else
+    logger_bbob_log(logger, number_of_evaluations, x, y);
+}
+
+/**
+ * Layer added to the transformed-problem evaluate_function by the logger
+ */
+static void logger_bbob_evaluate(coco_problem_t *self, const double *x, double *y) {
+  coco_evaluate_function(coco_transformed_get_inner_problem(self), x, y);
+  logger_bbob_record(coco_transformed_get_data(self), self->evaluations + 1, x, y);
 }
 
 /**
@@ -442,6 +734,10 @@ static void logger_bbob_free(void *stuff) {
    */
   logger_bbob_t *logger = stuff;
 
+  if (logger->async_writer != NULL) {
+    logger_async_stop(logger->async_writer);
+    logger->async_writer = NULL;
+  }
   if ((coco_log_level >= COCO_DEBUG) && logger && logger->number_of_evaluations > 0) {
     coco_debug("best f=%e after %ld fevals (done observing)\n", logger->best_fvalue,
         logger->number_of_evaluations);
@@ -463,8 +759,8 @@ static void logger_bbob_free(void *stuff) {
      * "instance" of problem for each restart in the beginning
      */
     if (!logger->written_last_eval) {
-      logger_bbob_write_data(logger->tdata_file, logger->number_of_evaluations, logger->last_fvalue,
-          logger->best_fvalue, logger->optimal_fvalue, logger->best_solution, logger->number_of_variables);
+      logger_bbob_output(logger, logger->tdata_file, logger->number_of_evaluations, logger->last_fvalue,
+          logger->best_solution);
     }
     fclose(logger->tdata_file);
     logger->tdata_file = NULL;
@@ -475,19 +771,29 @@ static void logger_bbob_free(void *stuff) {
     logger->rdata_file = NULL;
   }
 
+  /* The stream buffers can be freed only after the files have been closed */
+  logger_flush_free(&logger->flush);
+
   if (logger->best_solution != NULL) {
     coco_free_memory(logger->best_solution);
     logger->best_solution = NULL;
   }
+  logger_f_triggers_free(logger->f_triggers);
+  logger->f_triggers = NULL;
+  logger_evaluation_triggers_free(logger->t_triggers);
+  logger->t_triggers = NULL;
   bbob_logger_is_open = 0;
 }
 
-static coco_problem_t *logger_bbob(coco_observer_t *observer, coco_problem_t *problem) {
+/**
+ * Allocates the data of the bbob logger for the given problem.
+ */
+static void *logger_bbob_allocate(coco_observer_t *observer, coco_problem_t *problem) {
   logger_bbob_t *logger;
-  coco_problem_t *self;
 
   logger = coco_allocate_memory(sizeof(*logger));
   logger->observer = observer;
+  logger->problem = problem;
 
   if (problem->number_of_objectives != 1) {
     coco_warning("logger_toy(): The toy logger shouldn't be used to log a problem with %d objectives",
@@ -502,6 +808,8 @@ static coco_problem_t *logger_bbob(coco_observer_t *observer, coco_problem_t *pr
   logger->fdata_file = NULL;
   logger->tdata_file = NULL;
   logger->rdata_file = NULL;
+  logger->binary_format = ((observer_bbob_t *) observer->data)->binary_format;
+  logger_flush_init(&logger->flush, observer, logger->binary_format ? COCO_FLUSH_ON_CLOSE : COCO_FLUSH_EVERY);
   logger->number_of_variables = problem->number_of_variables;
   if (problem->best_value == NULL) {
     /* coco_error("Optimal f value must be defined for each problem in order for the logger to work properly"); */
@@ -514,10 +822,10 @@ static coco_problem_t *logger_bbob(coco_observer_t *observer, coco_problem_t *pr
   bbob_raisedOptValWarning = 0;
 
   logger->idx_f_trigger = INT_MAX;
-  logger->idx_t_trigger = 0;
-  logger->idx_tdim_trigger = 0;
   logger->f_trigger = DBL_MAX;
-  logger->t_trigger = 0;
+  logger->f_triggers = logger_f_triggers(((observer_bbob_t *) observer->data)->bbob_nbpts_fval);
+  logger->t_triggers = logger_evaluation_triggers_bbob(problem->number_of_variables,
+      ((observer_bbob_t *) observer->data)->bbob_nbpts_nbevals);
   logger->number_of_evaluations = 0;
   logger->best_solution = coco_allocate_vector(problem->number_of_variables);
   /* TODO: the following inits are just to be in the safe side and
@@ -530,10 +838,16 @@ static coco_problem_t *logger_bbob(coco_observer_t *observer, coco_problem_t *pr
   logger->last_fvalue = DBL_MAX;
   logger->is_initialized = 0;
 
-  self = coco_transformed_allocate(problem, logger, logger_bbob_free);
+  logger->async_writer = logger_async_start(observer, problem, logger, logger_bbob_log);
+  bbob_logger_is_open = 1;
+  return logger;
+}
+
+static coco_problem_t *logger_bbob(coco_observer_t *observer, coco_problem_t *problem) {
+  coco_problem_t *self;
 
+  self = coco_transformed_allocate(problem, logger_bbob_allocate(observer, problem), logger_bbob_free);
   self->evaluate_function = logger_bbob_evaluate;
-  bbob_logger_is_open = 1;
   return self;
 }
 
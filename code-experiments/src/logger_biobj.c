@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 
@@ -9,6 +10,10 @@
 #include "coco_problem.c"
 #include "coco_string.c"
 #include "observer_biobj.c"
+#include "logger_async.c"
+#include "logger_triggers.c"
+#include "logger_flush.c"
+#include "coco_probes.h"
 
 #include "logger_biobj_avl_tree.c"
 #include "mo_generics.c"
@@ -49,6 +54,8 @@ typedef struct {
 typedef struct {
   /* To access options read by the general observer */
   coco_observer_t *observer;
+  /* The logged problem */
+  coco_problem_t *problem;
 
   observer_biobj_log_nondom_e log_nondom_mode;
   /* File for logging nondominated solutions (either all or final) */
@@ -64,6 +71,9 @@ typedef struct {
   size_t number_of_objectives;
   size_t suite_dep_instance;
 
+  /* The evaluations that are always logged */
+  logger_evaluation_triggers_t *evaluation_triggers;
+
   /* The tree keeping currently non-dominated solutions */
   avl_tree_t *archive_tree;
   /* The tree with pointers to nondominated solutions that haven't been logged yet */
@@ -73,6 +83,12 @@ typedef struct {
   int compute_indicators;
   logger_biobj_indicator_t *indicators[OBSERVER_BIOBJ_NUMBER_OF_INDICATORS];
 
+  /* The writer thread for asynchronous logging (NULL if the logger logs synchronously) */
+  logger_async_t *async_writer;
+
+  /* When the nondominated solutions and the indicator values are flushed */
+  logger_flush_t flush;
+
 } logger_biobj_t;
 
 /* Data contained in the node's item in the AVL tree */
@@ -98,13 +114,16 @@ static logger_biobj_avl_item_t* logger_biobj_node_create(const double *x,
                                                          const size_t num_obj) {
 
   size_t i;
+  logger_biobj_avl_item_t *item;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_ARCHIVE);
 
   /* Allocate memory to hold the data structure logger_biobj_node_t */
-  logger_biobj_avl_item_t *item = (logger_biobj_avl_item_t*) coco_allocate_memory(sizeof(*item));
+  item = (logger_biobj_avl_item_t*) coco_allocate_memory(sizeof(*item));
 
   /* Allocate memory to store the (copied) data of the new node */
   item->x = coco_allocate_vector(dim);
   item->y = coco_allocate_vector(num_obj);
+  coco_memory_set_subsystem(previous_subsystem);
 
   /* Copy the data */
   for (i = 0; i < dim; i++)
@@ -238,6 +257,7 @@ static int logger_biobj_tree_update(logger_biobj_t *logger,
   int dominance;
   size_t i;
   int previous_unavailable = 0;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_ARCHIVE);
 
   /* Find the first point that is not worse than the new point (NULL if such point does not exist) */
   node = avl_item_search_right(logger->archive_tree, node_item, NULL);
@@ -369,27 +389,22 @@ static int logger_biobj_tree_update(logger_biobj_t *logger,
     }
   }
 
+  coco_memory_set_subsystem(previous_subsystem);
   return trigger_update;
 }
 
 /**
- * Initializes the indicator with name indicator_name.
+ * Allocates the indicator with the given name for the given problem without any files.
  */
-static logger_biobj_indicator_t *logger_biobj_indicator(logger_biobj_t *logger,
-                                                        coco_problem_t *problem,
-                                                        const char *indicator_name) {
+static logger_biobj_indicator_t *logger_biobj_indicator_allocate(coco_problem_t *problem,
+                                                                 const char *indicator_name) {
 
-  coco_observer_t *observer;
-  observer_biobj_t *observer_biobj;
   logger_biobj_indicator_t *indicator;
-  char *prefix, *file_name, *path_name;
-  int info_file_exists = 0;
 
   indicator = (logger_biobj_indicator_t *) coco_allocate_memory(sizeof(*indicator));
-  observer = logger->observer;
-  observer_biobj = (observer_biobj_t *) observer->data;
-
   indicator->name = coco_strdup(indicator_name);
+  indicator->log_file = NULL;
+  indicator->info_file = NULL;
 
   indicator->best_value = suite_biobj_get_best_value(indicator->name, problem->problem_id);
   indicator->next_target_id = 0;
@@ -397,6 +412,26 @@ static logger_biobj_indicator_t *logger_biobj_indicator(logger_biobj_t *logger,
   indicator->current_value = 0;
   indicator->additional_penalty = 0;
   indicator->overall_value = 0;
+  indicator->next_output_evaluation_num = 0;
+  return indicator;
+}
+
+/**
+ * Initializes the indicator with name indicator_name and opens its files.
+ */
+static logger_biobj_indicator_t *logger_biobj_indicator(logger_biobj_t *logger,
+                                                        coco_problem_t *problem,
+                                                        const char *indicator_name) {
+
+  coco_observer_t *observer;
+  observer_biobj_t *observer_biobj;
+  logger_biobj_indicator_t *indicator;
+  char *prefix, *file_name, *path_name;
+  int info_file_exists = 0;
+
+  indicator = logger_biobj_indicator_allocate(problem, indicator_name);
+  observer = logger->observer;
+  observer_biobj = (observer_biobj_t *) observer->data;
 
   /* Prepare the info file */
   path_name = (char *) coco_allocate_memory(COCO_PATH_MAX);
@@ -410,6 +445,7 @@ static logger_biobj_indicator_t *logger_biobj_indicator(logger_biobj_t *logger,
     coco_error("logger_biobj_indicator() failed to open file '%s'.", path_name);
     return NULL; /* Never reached */
   }
+  COCO_PROBE3(logger_file_open, "bbob-biobj", path_name, indicator->info_file);
   coco_free_memory(file_name);
   coco_free_memory(path_name);
 
@@ -426,6 +462,8 @@ static logger_biobj_indicator_t *logger_biobj_indicator(logger_biobj_t *logger,
     coco_error("logger_biobj_indicator() failed to open file '%s'.", path_name);
     return NULL; /* Never reached */
   }
+  COCO_PROBE3(logger_file_open, "bbob-biobj", path_name, indicator->log_file);
+  logger_flush_add_file(&logger->flush, indicator->log_file, 0);
 
   /* Output header information to the info file */
   if (!info_file_exists) {
@@ -433,7 +471,8 @@ static logger_biobj_indicator_t *logger_biobj_indicator(logger_biobj_t *logger,
     fprintf(indicator->info_file, "algorithm = '%s', indicator = '%s', folder = '%s'\n%% %s", observer->algorithm_name,
         indicator_name, problem->problem_type, observer->algorithm_info);
   }
-  if (observer_biobj->previous_function != problem->suite_dep_function) {
+  if ((observer_biobj->previous_function != problem->suite_dep_function)
+      || (observer_biobj->previous_dimension != problem->number_of_variables)) {
     fprintf(indicator->info_file, "\nfunction = %2lu, ", problem->suite_dep_function);
     fprintf(indicator->info_file, "dim = %2lu, ", problem->number_of_variables);
     fprintf(indicator->info_file, "%s", file_name);
@@ -465,12 +504,13 @@ static void logger_biobj_indicator_finalize(logger_biobj_indicator_t *indicator,
   if (!indicator->target_hit) {
     fprintf(indicator->log_file, "%lu\t%.*e\t%.*e\n", logger->number_of_evaluations, logger->precision_f,
         indicator->overall_value, logger->precision_f, MO_RELATIVE_TARGET_VALUES[target_index]);
+    COCO_PROBE3(logger_file_write, "bbob-biobj", indicator->log_file, logger->number_of_evaluations);
   }
 
   /* Log the information in the info file */
   fprintf(indicator->info_file, ", %ld:%lu|%.1e", logger->suite_dep_instance, logger->number_of_evaluations,
       indicator->overall_value);
-  fflush(indicator->info_file);
+  COCO_PROBE3(logger_file_write, "bbob-biobj", indicator->info_file, logger->number_of_evaluations);
 }
 
 /**
@@ -503,39 +543,65 @@ static void logger_biobj_indicator_free(void *stuff) {
 }
 
 /**
- * Evaluates the function, increases the number of evaluations and outputs information based on observer
- * options.
+ * Updates the overall value of the indicator (the difference to its best known value plus the penalty for
+ * solutions outside of the region of interest) after the archive has been updated.
  */
-static void logger_biobj_evaluate(coco_problem_t *problem, const double *x, double *y) {
+static void logger_biobj_indicator_update(logger_biobj_indicator_t *indicator,
+                                          logger_biobj_t *logger,
+                                          coco_problem_t *problem) {
 
-  logger_biobj_t *logger;
-
-  logger_biobj_avl_item_t *node_item;
-  logger_biobj_indicator_t *indicator;
   avl_node_t *solution;
-  int update_performed;
-  size_t i;
 
-  logger = (logger_biobj_t *) coco_transformed_get_data(problem);
+  if (strcmp(indicator->name, "hyp") == 0) {
+    if (indicator->current_value == 0) {
+      /* The additional penalty for hypervolume is the minimal distance from the nondominated set to the ROI */
+      indicator->additional_penalty = DBL_MAX;
+      if (logger->archive_tree->tail) {
+        solution = logger->archive_tree->head;
+        while (solution != NULL) {
+          double distance = mo_get_distance_to_ROI(((logger_biobj_avl_item_t*) solution->item)->y,
+              problem->best_value, problem->nadir_value, problem->number_of_objectives);
+          indicator->additional_penalty = coco_min_double(indicator->additional_penalty, distance);
+          solution = solution->next;
+        }
+      }
+      assert(indicator->additional_penalty >= 0);
+    } else {
+      indicator->additional_penalty = 0;
+    }
+    indicator->overall_value = indicator->best_value - indicator->current_value
+        + indicator->additional_penalty;
+  } else {
+    coco_error("logger_biobj_indicator_update(): Indicator computation not implemented yet for indicator %s",
+        indicator->name);
+  }
+}
 
-  /* Evaluate function */
-  coco_evaluate_function(coco_transformed_get_inner_problem(problem), x, y);
-  logger->number_of_evaluations++;
+/**
+ * Outputs the information on the latest evaluation (the new nondominated solution and the indicator values)
+ * based on observer options. The archive must already contain the solution from this evaluation, i.e.,
+ * update_performed is the result of logger_biobj_tree_update. Returns 1 if something was written to the
+ * files (and 0 otherwise) and sets target_hit to 1 if an indicator target was hit.
+ */
+static int logger_biobj_output(logger_biobj_t *logger,
+                               coco_problem_t *problem,
+                               const int update_performed,
+                               int *target_hit) {
 
-  /* Update the archive with the new solution, if it is not dominated by or equal to existing solutions in the archive */
-  node_item = logger_biobj_node_create(x, y, logger->number_of_evaluations, logger->number_of_variables,
-      logger->number_of_objectives);
+  logger_biobj_indicator_t *indicator;
+  size_t i;
+  int evaluation_to_log, has_written = 0;
 
-  update_performed = logger_biobj_tree_update(logger, coco_transformed_get_inner_problem(problem), node_item);
+  evaluation_to_log = logger_evaluation_triggers_is_hit(logger->evaluation_triggers,
+      logger->number_of_evaluations);
 
   /* If the archive was updated and you need to log all nondominated solutions, output the new solution to nondom_file */
   if (update_performed && (logger->log_nondom_mode == ALL)) {
     logger_biobj_tree_output(logger->nondom_file, logger->buffer_tree, logger->number_of_variables,
         logger->number_of_objectives, logger->log_vars, logger->precision_x, logger->precision_f);
     avl_tree_purge(logger->buffer_tree);
-
-    /* Flush output so that impatient users can see progress. */
-    fflush(logger->nondom_file);
+    COCO_PROBE3(logger_file_write, "bbob-biobj", logger->nondom_file, logger->number_of_evaluations);
+    has_written = 1;
   }
 
   /* If the archive was updated and a new target was reached for an indicator or if this is the first evaluation,
@@ -551,30 +617,7 @@ static void logger_biobj_evaluate(coco_problem_t *problem, const double *x, doub
 
       /* If the update was performed, update the overall indicator value */
       if (update_performed) {
-        /* Compute the overall_value of an indicator */
-        if (strcmp(indicator->name, "hyp") == 0) {
-          if (indicator->current_value == 0) {
-            /* The additional penalty for hypervolume is the minimal distance from the nondominated set to the ROI */
-            indicator->additional_penalty = DBL_MAX;
-            if (logger->archive_tree->tail) {
-              solution = logger->archive_tree->head;
-              while (solution != NULL) {
-                double distance = mo_get_distance_to_ROI(((logger_biobj_avl_item_t*) solution->item)->y,
-                    problem->best_value, problem->nadir_value, problem->number_of_objectives);
-                indicator->additional_penalty = coco_min_double(indicator->additional_penalty, distance);
-                solution = solution->next;
-              }
-            }
-            assert(indicator->additional_penalty >= 0);
-          } else {
-            indicator->additional_penalty = 0;
-          }
-          indicator->overall_value = indicator->best_value - indicator->current_value
-              + indicator->additional_penalty;
-        } else {
-          coco_error("logger_biobj_evaluate(): Indicator computation not implemented yet for indicator %s",
-              indicator->name);
-        }
+        logger_biobj_indicator_update(indicator, logger, problem);
 
         /* Check whether a target was hit */
         while ((indicator->next_target_id < MO_NUMBER_OF_TARGETS)
@@ -590,21 +633,232 @@ static void logger_biobj_evaluate(coco_problem_t *problem, const double *x, doub
 
       /* Log the evaluation if a target was hit or the evaluation number matches a predefined value */
       if (indicator->target_hit) {
+        COCO_PROBE5(logger_target_hit, "bbob-biobj", problem->problem_id, logger->number_of_evaluations,
+            &indicator->overall_value, &MO_RELATIVE_TARGET_VALUES[indicator->next_target_id - 1]);
         fprintf(indicator->log_file, "%lu\t%.*e\t%.*e\n", logger->number_of_evaluations, logger->precision_f,
             indicator->overall_value, logger->precision_f,
             MO_RELATIVE_TARGET_VALUES[indicator->next_target_id - 1]);
+        COCO_PROBE3(logger_file_write, "bbob-biobj", indicator->log_file, logger->number_of_evaluations);
+        *target_hit = has_written = 1;
       }
-      else if (coco_observer_evaluation_to_log(logger->number_of_evaluations, problem->number_of_variables)) {
+      else if (evaluation_to_log) {
         size_t target_index = 0;
         if (indicator->next_target_id > 0)
           target_index = indicator->next_target_id - 1;
         fprintf(indicator->log_file, "%lu\t%.*e\t%.*e\n", logger->number_of_evaluations, logger->precision_f,
             indicator->overall_value, logger->precision_f, MO_RELATIVE_TARGET_VALUES[target_index]);
+        COCO_PROBE3(logger_file_write, "bbob-biobj", indicator->log_file, logger->number_of_evaluations);
         indicator->target_hit = 1;
+        has_written = 1;
       }
 
     }
   }
+  return has_written;
+}
+
+/**
+ * Updates the number of evaluations and outputs information on the evaluation of x with the result y
+ * based on observer options.
+ */
+static void logger_biobj_log(void *stuff, const size_t number_of_evaluations, const double *x, const double *y) {
+
+  logger_biobj_t *logger;
+
+  logger_biobj_avl_item_t *node_item;
+  int update_performed, has_written, target_hit = 0;
+
+  logger = (logger_biobj_t *) stuff;
+
+  logger->number_of_evaluations = number_of_evaluations;
+
+  /* Update the archive with the new solution, if it is not dominated by or equal to existing solutions in the archive */
+  node_item = logger_biobj_node_create(x, y, logger->number_of_evaluations, logger->number_of_variables,
+      logger->number_of_objectives);
+
+  update_performed = logger_biobj_tree_update(logger, logger->problem, node_item);
+
+  has_written = logger_biobj_output(logger, logger->problem, update_performed, &target_hit);
+
+  /* Flush output (by default after each evaluation, so that impatient users can see progress) */
+  logger_flush_update(&logger->flush, has_written, target_hit);
+}
+
+/**
+ * Logs the evaluation of x with the result y or passes it to the writer thread.
+ */
+static void logger_biobj_record(void *stuff, const size_t number_of_evaluations, const double *x, const double *y) {
+
+  logger_biobj_t *logger = (logger_biobj_t *) stuff;
+
+  if (logger->async_writer != NULL)
+    logger_async_push(logger->async_writer, number_of_evaluations, x, y);
+  else
+    logger_biobj_log(logger, number_of_evaluations, x, y);
+}
+
+/**
+ * Evaluates the function and logs the evaluation (or passes it to the writer thread).
+ */
+static void logger_biobj_evaluate(coco_problem_t *problem, const double *x, double *y) {
+  coco_evaluate_function(coco_transformed_get_inner_problem(problem), x, y);
+  logger_biobj_record(coco_transformed_get_data(problem), problem->evaluations + 1, x, y);
+}
+
+/**
+ * Objective values and evaluation offset of a solution within a population, used for sorting.
+ */
+typedef struct {
+  double y[2];
+  size_t offset;
+} logger_biobj_population_item_t;
+
+/**
+ * Orders the solutions of a population lexicographically by their objective values and then by the order of
+ * their evaluation.
+ */
+static int logger_biobj_population_compare(const void *a, const void *b) {
+
+  const logger_biobj_population_item_t *item1 = (const logger_biobj_population_item_t *) a;
+  const logger_biobj_population_item_t *item2 = (const logger_biobj_population_item_t *) b;
+
+  if (item1->y[0] != item2->y[0])
+    return (item1->y[0] < item2->y[0]) ? -1 : 1;
+  if (item1->y[1] != item2->y[1])
+    return (item1->y[1] < item2->y[1]) ? -1 : 1;
+  if (item1->offset != item2->offset)
+    return (item1->offset < item2->offset) ? -1 : 1;
+  return 0;
+}
+
+/**
+ * Filters the population of number_of_solutions objective vectors stored in y and sets is_candidate[k] to 1
+ * if the k-th solution is weakly dominated neither by the archive nor by any of the solutions evaluated
+ * before it, and to 0 otherwise. Only the candidates can change the archive, all other solutions would be
+ * rejected by logger_biobj_tree_update.
+ *
+ * The population is sorted by the first objective and swept once. A Fenwick tree indexed by the evaluation
+ * order keeps the prefix minima of the second objective over the already swept solutions, so that the whole
+ * filtering takes O(m log m + m log n) time for a population of size m and an archive of size n.
+ */
+static void logger_biobj_population_filter(logger_biobj_t *logger,
+                                           const double *y,
+                                           const size_t number_of_solutions,
+                                           int *is_candidate) {
+
+  logger_biobj_population_item_t *items;
+  logger_biobj_avl_item_t search_item;
+  avl_node_t *node;
+  double *min_tree, min_value;
+  size_t i, j;
+
+  items = (logger_biobj_population_item_t *) coco_allocate_memory(number_of_solutions * sizeof(*items));
+  min_tree = coco_allocate_vector(number_of_solutions + 1);
+  for (i = 0; i < number_of_solutions; i++) {
+    items[i].y[0] = y[i * logger->number_of_objectives];
+    items[i].y[1] = y[i * logger->number_of_objectives + 1];
+    items[i].offset = i;
+  }
+  for (i = 0; i <= number_of_solutions; i++)
+    min_tree[i] = DBL_MAX;
+
+  qsort(items, number_of_solutions, sizeof(*items), logger_biobj_population_compare);
+
+  for (i = 0; i < number_of_solutions; i++) {
+
+    /* All already swept solutions are not worse in the first objective, so the solution is weakly dominated
+     * by an earlier one if the minimal second objective among those evaluated before it is not worse */
+    min_value = DBL_MAX;
+    for (j = items[i].offset; j > 0; j -= j & (~j + 1))
+      min_value = coco_min_double(min_value, min_tree[j]);
+    is_candidate[items[i].offset] = (min_value > items[i].y[1]);
+
+    for (j = items[i].offset + 1; j <= number_of_solutions; j += j & (~j + 1))
+      min_tree[j] = coco_min_double(min_tree[j], items[i].y[1]);
+
+    /* Check against the archive as in logger_biobj_tree_update (without creating a new item) */
+    if (is_candidate[items[i].offset] && (logger->archive_tree->top != NULL)) {
+      search_item.y = items[i].y;
+      node = avl_item_search_right(logger->archive_tree, &search_item, NULL);
+      if ((node != NULL) && (mo_get_dominance(items[i].y, ((logger_biobj_avl_item_t*) node->item)->y,
+          logger->number_of_objectives) < 0))
+        is_candidate[items[i].offset] = 0;
+    }
+  }
+
+  coco_free_memory(min_tree);
+  coco_free_memory(items);
+}
+
+/**
+ * Evaluates the function in a population of solutions, increases the number of evaluations and outputs
+ * information based on observer options.
+ *
+ * The solutions that cannot enter the archive are filtered out in one sweep before the archive is touched,
+ * so that only the remaining candidates are inserted (and cause the indicator contributions of their
+ * neighbors to be recomputed). The output is identical to the one produced by evaluating the solutions one
+ * by one, including the evaluation numbers of target hits.
+ *
+ * Note that this is not a batched merge into the archive: the candidates are still inserted one at a time
+ * with logger_biobj_tree_update() (with a tree search and a rebalancing each) and every solution is still
+ * passed to logger_biobj_output() one at a time, in the order of evaluation. The indicator values, and with
+ * them the target hits and the logged lines, depend on the archive after each single evaluation, which a
+ * single merge pass would not provide. The population therefore saves only the work for the filtered out
+ * solutions, while a population of mutually nondominated solutions that all enter the archive costs as much
+ * as evaluating them one by one.
+ */
+static void logger_biobj_evaluate_population(coco_problem_t *problem,
+                                             const double *x,
+                                             const size_t number_of_solutions,
+                                             double *y) {
+
+  logger_biobj_t *logger;
+  coco_problem_t *inner_problem;
+
+  logger_biobj_avl_item_t *node_item;
+  int update_performed, has_written = 0, target_hit = 0;
+  int *is_candidate;
+  size_t i;
+
+  if (number_of_solutions == 0)
+    return;
+
+  logger = (logger_biobj_t *) coco_transformed_get_data(problem);
+  inner_problem = coco_transformed_get_inner_problem(problem);
+
+  /* Evaluate function */
+  coco_evaluate_population(inner_problem, x, number_of_solutions, y);
+
+  if (logger->async_writer != NULL) {
+    /* The writer thread logs the solutions one by one, which gives the same output */
+    for (i = 0; i < number_of_solutions; i++) {
+      logger_async_push(logger->async_writer, problem->evaluations + i + 1, &x[i * logger->number_of_variables],
+          &y[i * logger->number_of_objectives]);
+    }
+    return;
+  }
+
+  is_candidate = (int *) coco_allocate_memory(number_of_solutions * sizeof(int));
+  logger_biobj_population_filter(logger, y, number_of_solutions, is_candidate);
+
+  /* Update the archive and log in the order of evaluation */
+  for (i = 0; i < number_of_solutions; i++) {
+    logger->number_of_evaluations = problem->evaluations + i + 1;
+    update_performed = 0;
+    if (is_candidate[i]) {
+      node_item = logger_biobj_node_create(&x[i * logger->number_of_variables],
+          &y[i * logger->number_of_objectives], logger->number_of_evaluations, logger->number_of_variables,
+          logger->number_of_objectives);
+      update_performed = logger_biobj_tree_update(logger, inner_problem, node_item);
+    }
+    if (logger_biobj_output(logger, logger->problem, update_performed, &target_hit))
+      has_written = 1;
+  }
+
+  coco_free_memory(is_candidate);
+
+  /* Flush output once for the whole population */
+  logger_flush_update(&logger->flush, has_written, target_hit);
 }
 
 /**
@@ -629,6 +883,7 @@ static void logger_biobj_finalize(logger_biobj_t *logger) {
 
   logger_biobj_tree_output(logger->nondom_file, resorted_tree, logger->number_of_variables,
       logger->number_of_objectives, logger->log_vars, logger->precision_x, logger->precision_f);
+  COCO_PROBE3(logger_file_write, "bbob-biobj", logger->nondom_file, logger->number_of_evaluations);
 
   avl_tree_destruct(resorted_tree);
 }
@@ -644,13 +899,19 @@ static void logger_biobj_free(void *stuff) {
   assert(stuff != NULL);
   logger = stuff;
 
+  if (logger->async_writer != NULL) {
+    logger_async_stop(logger->async_writer);
+    logger->async_writer = NULL;
+  }
+
   if (logger->log_nondom_mode == FINAL) {
      logger_biobj_finalize(logger);
   }
 
   if (logger->compute_indicators) {
     for (i = 0; i < OBSERVER_BIOBJ_NUMBER_OF_INDICATORS; i++) {
-      logger_biobj_indicator_finalize(logger->indicators[i], logger);
+      if (logger->indicators[i]->log_file != NULL)
+        logger_biobj_indicator_finalize(logger->indicators[i], logger);
       logger_biobj_indicator_free(logger->indicators[i]);
     }
   }
@@ -659,18 +920,62 @@ static void logger_biobj_free(void *stuff) {
     fclose(logger->nondom_file);
     logger->nondom_file = NULL;
   }
+  /* The stream buffers can be freed only after the files have been closed */
+  logger_flush_free(&logger->flush);
 
   avl_tree_destruct(logger->archive_tree);
   avl_tree_destruct(logger->buffer_tree);
+  logger_evaluation_triggers_free(logger->evaluation_triggers);
 
 }
 
 /**
- * Initializes the biobjective logger.
+ * Allocates the data of a biobjective logger for the given problem that keeps the archive of nondominated
+ * solutions and, if compute_indicators is 1, updates the indicators, but has no observer and writes no files.
+ * The memory logger uses it as it is, while logger_biobj_allocate() adds the files of the observer.
  */
-static coco_problem_t *logger_biobj(coco_observer_t *observer, coco_problem_t *problem) {
+static logger_biobj_t *logger_biobj_archive_allocate(coco_problem_t *problem, const int compute_indicators) {
+
+  logger_biobj_t *logger;
+  size_t i;
+
+  logger = (logger_biobj_t *) coco_allocate_memory(sizeof(*logger));
+
+  logger->observer = NULL;
+  logger->problem = problem;
+  logger->log_nondom_mode = NONE;
+  logger->nondom_file = NULL;
+  logger->log_vars = 0;
+  logger->precision_x = 0;
+  logger->precision_f = 0;
+
+  logger->number_of_evaluations = 0;
+  logger->number_of_variables = problem->number_of_variables;
+  logger->number_of_objectives = problem->number_of_objectives;
+  logger->suite_dep_instance = problem->suite_dep_instance;
+  logger->evaluation_triggers = NULL;
+
+  /* Initialize the AVL trees */
+  logger->archive_tree = avl_tree_construct((avl_compare_t) avl_tree_compare_by_last_objective,
+      (avl_free_t) logger_biobj_node_free);
+  logger->buffer_tree = avl_tree_construct((avl_compare_t) avl_tree_compare_by_time_stamp, NULL);
+
+  logger->compute_indicators = compute_indicators;
+  for (i = 0; i < OBSERVER_BIOBJ_NUMBER_OF_INDICATORS; i++) {
+    logger->indicators[i] = compute_indicators
+        ? logger_biobj_indicator_allocate(problem, OBSERVER_BIOBJ_INDICATORS[i]) : NULL;
+  }
+
+  logger->async_writer = NULL;
+  logger_flush_init(&logger->flush, NULL, COCO_FLUSH_ON_CLOSE);
+  return logger;
+}
+
+/**
+ * Allocates the data of the biobjective logger for the given problem.
+ */
+static void *logger_biobj_allocate(coco_observer_t *observer, coco_problem_t *problem) {
 
-  coco_problem_t *self;
   logger_biobj_t *logger;
   observer_biobj_t *observer_biobj;
   const char nondom_folder_name[] = "archive";
@@ -682,14 +987,12 @@ static coco_problem_t *logger_biobj(coco_observer_t *observer, coco_problem_t *p
     return NULL; /* Never reached. */
   }
 
-  logger = coco_allocate_memory(sizeof(*logger));
+  /* The indicators are added below together with their files */
+  logger = logger_biobj_archive_allocate(problem, 0);
 
   logger->observer = observer;
-
-  logger->number_of_evaluations = 0;
-  logger->number_of_variables = problem->number_of_variables;
-  logger->number_of_objectives = problem->number_of_objectives;
-  logger->suite_dep_instance = problem->suite_dep_instance;
+  logger->evaluation_triggers = logger_evaluation_triggers_always_log(problem->number_of_variables);
+  logger_flush_init(&logger->flush, observer, COCO_FLUSH_EVERY);
 
   observer_biobj = (observer_biobj_t *) observer->data;
   /* Copy values from the observes that you might need even if they do not exist any more */
@@ -730,6 +1033,8 @@ static coco_problem_t *logger_biobj(coco_observer_t *observer, coco_problem_t *p
       coco_error("logger_biobj() failed to open file '%s'.", path_name);
       return NULL; /* Never reached */
     }
+    COCO_PROBE3(logger_file_open, "bbob-biobj", path_name, logger->nondom_file);
+    logger_flush_add_file(&logger->flush, logger->nondom_file, 0);
     coco_free_memory(path_name);
 
     /* Output header information */
@@ -743,21 +1048,30 @@ static coco_problem_t *logger_biobj(coco_observer_t *observer, coco_problem_t *p
     }
   }
 
-  /* Initialize the AVL trees */
-  logger->archive_tree = avl_tree_construct((avl_compare_t) avl_tree_compare_by_last_objective,
-      (avl_free_t) logger_biobj_node_free);
-  logger->buffer_tree = avl_tree_construct((avl_compare_t) avl_tree_compare_by_time_stamp, NULL);
-
-  self = coco_transformed_allocate(problem, logger, logger_biobj_free);
-  self->evaluate_function = logger_biobj_evaluate;
-
   /* Initialize the indicators */
   if (logger->compute_indicators) {
     for (i = 0; i < OBSERVER_BIOBJ_NUMBER_OF_INDICATORS; i++)
       logger->indicators[i] = logger_biobj_indicator(logger, problem, OBSERVER_BIOBJ_INDICATORS[i]);
 
     observer_biobj->previous_function = (long) problem->suite_dep_function;
+    observer_biobj->previous_dimension = (long) problem->number_of_variables;
   }
 
+  /* Start the writer thread only after the logger has been completely initialized */
+  logger->async_writer = logger_async_start(observer, problem, logger, logger_biobj_log);
+
+  return logger;
+}
+
+/**
+ * Initializes the biobjective logger.
+ */
+static coco_problem_t *logger_biobj(coco_observer_t *observer, coco_problem_t *problem) {
+
+  coco_problem_t *self;
+
+  self = coco_transformed_allocate(problem, logger_biobj_allocate(observer, problem), logger_biobj_free);
+  self->evaluate_function = logger_biobj_evaluate;
+  self->evaluate_population = logger_biobj_evaluate_population;
   return self;
 }
@@ -35,6 +35,8 @@
 #include <stdlib.h>
 #include <errno.h>
 
+#include "coco.h"
+
 /* We need either depths, counts or both (the latter being the default) */
 #if !defined(AVL_DEPTH) && !defined(AVL_COUNT)
 #define AVL_DEPTH
@@ -432,10 +434,10 @@ static avl_tree_t *avl_tree_init(avl_tree_t *avltree, avl_compare_t cmp, avl_fre
 
 /* Allocates and initializes a new tree for elements that will be
  * ordered using the supplied strcmp()-like function.
- * Returns NULL if memory could not be allocated.
+ * The tree and its nodes are allocated with coco_allocate_memory().
  * O(1) */
 static avl_tree_t *avl_tree_construct(avl_compare_t cmp, avl_free_t free) {
-  return avl_tree_init((avl_tree_t *) malloc(sizeof(avl_tree_t)), cmp, free);
+  return avl_tree_init((avl_tree_t *) coco_allocate_memory(sizeof(avl_tree_t)), cmp, free);
 }
 
 /* Reinitializes the tree structure for reuse. Nothing is free()d.
@@ -458,7 +460,7 @@ static void avl_node_free(avl_tree_t *avltree, avl_node_t *node) {
     if (deallocate)
       deallocate(allocator, node);
   } else {
-    free(node);
+    coco_free_memory(node);
   }
 }
 
@@ -490,7 +492,7 @@ static avl_tree_t *avl_tree_purge(avl_tree_t *avltree) {
       if (deallocate)
         deallocate(allocator, node);
     } else {
-      free(node);
+      coco_free_memory(node);
     }
   }
 
@@ -504,7 +506,7 @@ static void avl_tree_destruct(avl_tree_t *avltree) {
   if (!avltree)
     return;
   (void) avl_tree_purge(avltree);
-  free(avltree);
+  coco_free_memory(avltree);
 }
 
 static void avl_node_clear(avl_node_t *newnode) {
@@ -542,7 +544,7 @@ static avl_node_t *avl_alloc(avl_tree_t *avltree, const void *item) {
       newnode = NULL;
     }
   } else {
-    newnode = (avl_node_t *) malloc(sizeof *newnode);
+    newnode = (avl_node_t *) coco_allocate_memory(sizeof *newnode);
   }
   return avl_node_init(newnode, item);
 }
@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "coco.h"
+#include "coco_internal.h"
+#include "coco_utilities.c"
+#include "coco_probes.h"
+
+/**
+ * The flush policy of a logger determines when the output files of the logger are flushed:
+ * - COCO_FLUSH_EVERY: after each evaluation that has written to the files (no data is lost on a crash)
+ * - COCO_FLUSH_INTERVAL: when at least flush_interval milliseconds have passed since the last flush
+ * - COCO_FLUSH_ON_TARGET: after each evaluation that has hit a target
+ * - COCO_FLUSH_ON_CLOSE: only when the files are closed
+ * In all policies except COCO_FLUSH_EVERY, the files get stream buffers of a fixed size, so that the output
+ * reaches the disk in large blocks. The buffers are then flushed also whenever they are full, which bounds
+ * the amount of data that can be lost.
+ */
+
+/* The maximal number of files a logger can register */
+#define LOGGER_FLUSH_MAX_FILES 4
+
+/* The default size of the stream buffers (used in all policies except COCO_FLUSH_EVERY) */
+#define LOGGER_FLUSH_BUFFER_SIZE 65536
+
+/* The maximal number of evaluations after which the time is checked again in the COCO_FLUSH_INTERVAL policy */
+#define LOGGER_FLUSH_MAX_TIME_CHECK_PERIOD 1024
+
+/**
+ * The flush policy and the files it applies to.
+ */
+typedef struct {
+  coco_flush_mode_e mode;
+  double interval;            /* The time between two flushes in milliseconds (COCO_FLUSH_INTERVAL) */
+  FILE *files[LOGGER_FLUSH_MAX_FILES];
+  char *buffers[LOGGER_FLUSH_MAX_FILES];
+  size_t number_of_files;
+  int has_unflushed_output;   /* Whether something was written since the last flush */
+  size_t time_check_period;   /* The number of evaluations between two readings of the clock */
+  size_t evaluations_to_time_check;
+  double last_time_check;
+  double last_flush_time;
+} logger_flush_t;
+
+/**
+ * Parses the value of the observer option "flush" and sets the flush policy of the observer accordingly.
+ */
+static void logger_flush_read_option(coco_observer_t *observer, const char *value) {
+
+  double interval;
+
+  if (strcmp(value, "every") == 0) {
+    observer->flush_mode = COCO_FLUSH_EVERY;
+  } else if (strcmp(value, "on_target") == 0) {
+    observer->flush_mode = COCO_FLUSH_ON_TARGET;
+  } else if (strcmp(value, "on_close") == 0) {
+    observer->flush_mode = COCO_FLUSH_ON_CLOSE;
+  } else if ((strncmp(value, "interval_ms:", 12) == 0) && (sscanf(value + 12, "%lf", &interval) == 1)
+      && (interval >= 0)) {
+    observer->flush_mode = COCO_FLUSH_INTERVAL;
+    observer->flush_interval = interval;
+  } else {
+    coco_warning("coco_observer(): unknown value %s of the option flush (using the default)", value);
+  }
+}
+
+/**
+ * Initializes the flush policy from the observer options. The default_mode is used if the policy was not
+ * given in the options or if there is no observer (observer is NULL).
+ */
+static void logger_flush_init(logger_flush_t *flush,
+                              const coco_observer_t *observer,
+                              const coco_flush_mode_e default_mode) {
+  if (observer != NULL) {
+    flush->mode = (observer->flush_mode == COCO_FLUSH_DEFAULT) ? default_mode : observer->flush_mode;
+    flush->interval = observer->flush_interval;
+  } else {
+    flush->mode = default_mode;
+    flush->interval = 0;
+  }
+  flush->number_of_files = 0;
+  flush->has_unflushed_output = 0;
+  flush->time_check_period = 1;
+  flush->evaluations_to_time_check = 1;
+  flush->last_flush_time = coco_get_time_ms();
+  flush->last_time_check = flush->last_flush_time;
+}
+
+/**
+ * Registers a newly opened file to be flushed according to the policy. Except for COCO_FLUSH_EVERY, the file
+ * gets a stream buffer of buffer_size bytes (LOGGER_FLUSH_BUFFER_SIZE if 0), which is why the file must not
+ * have been written to yet.
+ */
+static void logger_flush_add_file(logger_flush_t *flush, FILE *file, const size_t buffer_size) {
+
+  char *buffer = NULL;
+  const size_t size = (buffer_size > 0) ? buffer_size : LOGGER_FLUSH_BUFFER_SIZE;
+
+  if (flush->number_of_files >= LOGGER_FLUSH_MAX_FILES) {
+    coco_error("logger_flush_add_file(): cannot register more than %lu files",
+        (unsigned long) LOGGER_FLUSH_MAX_FILES);
+    return; /* Never reached */
+  }
+
+  if (flush->mode != COCO_FLUSH_EVERY) {
+    buffer = (char *) coco_allocate_memory(size);
+    setvbuf(file, buffer, _IOFBF, size);
+  }
+  flush->files[flush->number_of_files] = file;
+  flush->buffers[flush->number_of_files] = buffer;
+  flush->number_of_files++;
+}
+
+/**
+ * Flushes all registered files.
+ */
+static void logger_flush_all(logger_flush_t *flush) {
+  size_t i;
+  COCO_PROBE1(logger_file_flush_entry, flush->number_of_files);
+  for (i = 0; i < flush->number_of_files; i++)
+    fflush(flush->files[i]);
+  COCO_PROBE1(logger_file_flush_exit, flush->number_of_files);
+  flush->has_unflushed_output = 0;
+}
+
+/**
+ * Applies the policy after an evaluation has been logged. Here, has_written tells whether the logger has
+ * written something to the registered files and target_hit whether the evaluation has hit a target.
+ */
+static void logger_flush_update(logger_flush_t *flush, const int has_written, const int target_hit) {
+
+  double time;
+
+  if (has_written)
+    flush->has_unflushed_output = 1;
+  if (!flush->has_unflushed_output)
+    return;
+
+  switch (flush->mode) {
+  case COCO_FLUSH_EVERY:
+    logger_flush_all(flush);
+    break;
+  case COCO_FLUSH_ON_TARGET:
+    if (target_hit)
+      logger_flush_all(flush);
+    break;
+  case COCO_FLUSH_INTERVAL:
+    /* Reading the clock can cost more than evaluating a cheap function, so the clock is read only about ten
+     * times per interval */
+    if (--flush->evaluations_to_time_check > 0)
+      break;
+    time = coco_get_time_ms();
+    if (time - flush->last_flush_time >= flush->interval) {
+      logger_flush_all(flush);
+      flush->last_flush_time = time;
+    }
+    if ((time - flush->last_time_check < flush->interval / 10)
+        && (flush->time_check_period < LOGGER_FLUSH_MAX_TIME_CHECK_PERIOD))
+      flush->time_check_period *= 2;
+    else if ((time - flush->last_time_check >= flush->interval / 10) && (flush->time_check_period > 1))
+      flush->time_check_period /= 2;
+    flush->evaluations_to_time_check = flush->time_check_period;
+    flush->last_time_check = time;
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+ * Unregisters the files and frees their stream buffers. Must be called after the files have been closed.
+ */
+static void logger_flush_free(logger_flush_t *flush) {
+  size_t i;
+  for (i = 0; i < flush->number_of_files; i++) {
+    if (flush->buffers[i] != NULL)
+      coco_free_memory(flush->buffers[i]);
+    flush->files[i] = NULL;
+    flush->buffers[i] = NULL;
+  }
+  flush->number_of_files = 0;
+}
@@ -0,0 +1,177 @@
+#include <assert.h>
+#include <float.h>
+
+#include "coco.h"
+#include "coco_internal.h"
+
+#include "coco_utilities.c"
+#include "coco_problem.c"
+#include "observer_memory.c"
+#include "logger_biobj.c"
+#include "mo_targets.c"
+
+/**
+ * This logger records the results of the problem (target hits, best value and solution and the trajectory
+ * of the best value) into the buffers of its result in the memory observer, without any file output.
+ */
+
+typedef struct {
+  coco_problem_t *problem;   /* The logged problem */
+  observer_memory_result_t *result;
+  double optimal_value;      /* The value subtracted from f for single-objective problems */
+  size_t next_target;
+  double next_target_value;  /* targets[next_target] or -DBL_MAX if all targets have been hit */
+
+  /* The archive of nondominated solutions used to compute the hypervolume indicator of bi-objective
+   * problems (NULL for single-objective problems) */
+  logger_biobj_t *archive;
+} logger_memory_t;
+
+/**
+ * Updates the archive with the solution x and its value y. Returns 1 and stores the new value of the
+ * (first) indicator in value if the archive changed and 0 otherwise.
+ */
+static int logger_memory_archive_update(logger_biobj_t *archive,
+                                        coco_problem_t *problem,
+                                        const double *x,
+                                        const double *y,
+                                        double *value) {
+
+  logger_biobj_avl_item_t *node_item;
+
+  archive->number_of_evaluations++;
+  node_item = logger_biobj_node_create(x, y, archive->number_of_evaluations, archive->number_of_variables,
+      archive->number_of_objectives);
+  if (!logger_biobj_tree_update(archive, problem, node_item))
+    return 0;
+  /* The solutions are not output, so the buffer is not needed */
+  avl_tree_purge(archive->buffer_tree);
+
+  logger_biobj_indicator_update(archive->indicators[0], archive, problem);
+  *value = archive->indicators[0]->overall_value;
+  return 1;
+}
+
+/**
+ * Records the evaluation of x with the result y.
+ */
+static void logger_memory_record(void *stuff, const size_t number_of_evaluations, const double *x, const double *y) {
+
+  logger_memory_t *logger = (logger_memory_t *) stuff;
+  observer_memory_result_t *result = logger->result;
+  double value;
+  size_t i;
+
+  result->number_of_evaluations = number_of_evaluations;
+
+  if (logger->archive == NULL) {
+    value = y[0] - logger->optimal_value;
+  } else if (!logger_memory_archive_update(logger->archive, logger->problem, x, y, &value)) {
+    return;
+  }
+
+  if (value >= result->best_value)
+    return;
+
+  /* The best value has improved */
+  result->best_value = value;
+  for (i = 0; i < result->number_of_variables; i++)
+    result->best_solution[i] = x[i];
+
+  if (result->trajectory_size > 0) {
+    if (result->trajectory_length < result->trajectory_size)
+      result->trajectory_length++;
+    result->trajectory_evaluations[result->trajectory_length - 1] = result->number_of_evaluations;
+    result->trajectory_values[result->trajectory_length - 1] = value;
+  }
+
+  if (value <= logger->next_target_value) {
+    while ((logger->next_target < result->number_of_targets) && (value <= result->targets[logger->next_target])) {
+      result->target_hits[logger->next_target] = result->number_of_evaluations;
+      logger->next_target++;
+    }
+    if (logger->next_target < result->number_of_targets)
+      logger->next_target_value = result->targets[logger->next_target];
+    else
+      logger->next_target_value = -DBL_MAX;
+  }
+}
+
+/**
+ * Evaluates the function and records the evaluation.
+ */
+static void logger_memory_evaluate(coco_problem_t *self, const double *x, double *y) {
+  coco_evaluate_function(coco_transformed_get_inner_problem(self), x, y);
+  logger_memory_record(coco_transformed_get_data(self), self->evaluations + 1, x, y);
+}
+
+/**
+ * Frees the memory logger (its result is kept by the observer).
+ */
+static void logger_memory_free(void *stuff) {
+
+  logger_memory_t *logger;
+
+  assert(stuff != NULL);
+  logger = stuff;
+
+  if (logger->archive != NULL) {
+    logger_biobj_free(logger->archive);
+    coco_free_memory(logger->archive);
+    logger->archive = NULL;
+  }
+}
+
+/**
+ * Allocates the data of the memory logger for the given problem and adds a new result to the memory observer.
+ */
+static void *logger_memory_allocate(coco_observer_t *observer, coco_problem_t *problem) {
+
+  observer_memory_t *observer_memory = (observer_memory_t *) observer->data;
+  logger_memory_t *logger;
+  size_t number_of_targets = 0;
+  const double *targets = NULL;
+
+  logger = (logger_memory_t *) coco_allocate_memory(sizeof(*logger));
+  logger->problem = problem;
+  logger->optimal_value = 0;
+  logger->archive = NULL;
+
+  if (problem->number_of_objectives == 1) {
+    if (problem->best_value != NULL) {
+      logger->optimal_value = *(problem->best_value);
+      number_of_targets = observer_memory->number_of_targets;
+      targets = observer_memory->targets;
+    } else {
+      coco_warning("logger_memory(): The optimal value of problem %s is not known, no targets will be recorded",
+          problem->problem_id);
+    }
+  } else if (problem->number_of_objectives == 2) {
+    logger->archive = logger_biobj_archive_allocate(problem, 1);
+    number_of_targets = MO_NUMBER_OF_TARGETS;
+    targets = MO_RELATIVE_TARGET_VALUES;
+  } else {
+    coco_error("logger_memory(): The memory logger cannot log a problem with %lu objectives",
+        (unsigned long) problem->number_of_objectives);
+    return NULL; /* Never reached */
+  }
+
+  logger->result = observer_memory_add_result(observer_memory, observer_memory_result_allocate(
+      problem->problem_id, problem->suite_dep_function, problem->number_of_variables,
+      problem->number_of_objectives, number_of_targets, targets, observer_memory->trajectory_size));
+  logger->next_target = 0;
+  logger->next_target_value = (number_of_targets > 0) ? targets[0] : -DBL_MAX;
+  return logger;
+}
+
+/**
+ * Initializes the memory logger.
+ */
+static coco_problem_t *logger_memory(coco_observer_t *observer, coco_problem_t *problem) {
+
+  coco_problem_t *self;
+
+  self = coco_transformed_allocate(problem, logger_memory_allocate(observer, problem), logger_memory_free);
+  self->evaluate_function = logger_memory_evaluate;
+  return self;
+}
@@ -0,0 +1,105 @@
+#include <assert.h>
+
+#include "coco.h"
+#include "coco_internal.h"
+
+#include "coco_utilities.c"
+#include "coco_problem.c"
+#include "observer_multi.c"
+
+/**
+ * The multi logger adds a single layer to the problem, which keeps the data of the loggers of all observers
+ * of the multi observer. It evaluates the original problem only once and then passes the result together
+ * with the evaluation number directly to the log function of each logger.
+ */
+
+typedef struct {
+  size_t number_of_loggers;
+  void **loggers;                            /* The data of the loggers */
+  coco_logger_log_function_t *log_functions;
+  coco_logger_free_function_t *free_functions;
+} logger_multi_t;
+
+/**
+ * Evaluates the original problem and passes the evaluation to all loggers.
+ */
+static void logger_multi_evaluate(coco_problem_t *self, const double *x, double *y) {
+
+  logger_multi_t *logger = (logger_multi_t *) coco_transformed_get_data(self);
+  const size_t number_of_evaluations = self->evaluations + 1;
+  size_t i;
+
+  coco_evaluate_function(coco_transformed_get_inner_problem(self), x, y);
+  for (i = 0; i < logger->number_of_loggers; i++)
+    logger->log_functions[i](logger->loggers[i], number_of_evaluations, x, y);
+}
+
+/**
+ * Finishes the output of the loggers (in the reverse order of their allocation) and frees their data.
+ */
+static void logger_multi_free(void *stuff) {
+
+  logger_multi_t *logger;
+  size_t i;
+
+  assert(stuff != NULL);
+  logger = stuff;
+
+  for (i = logger->number_of_loggers; i > 0; i--) {
+    logger->free_functions[i - 1](logger->loggers[i - 1]);
+    coco_free_memory(logger->loggers[i - 1]);
+  }
+  logger->number_of_loggers = 0;
+  if (logger->loggers != NULL) {
+    coco_free_memory(logger->loggers);
+    logger->loggers = NULL;
+  }
+  if (logger->log_functions != NULL) {
+    coco_free_memory(logger->log_functions);
+    logger->log_functions = NULL;
+  }
+  if (logger->free_functions != NULL) {
+    coco_free_memory(logger->free_functions);
+    logger->free_functions = NULL;
+  }
+}
+
+/**
+ * Initializes the multi logger.
+ */
+static coco_problem_t *logger_multi(coco_observer_t *observer, coco_problem_t *problem) {
+
+  observer_multi_t *observer_multi = (observer_multi_t *) observer->data;
+  logger_multi_t *logger;
+  coco_problem_t *self;
+  coco_observer_t *inner_observer;
+  size_t i;
+
+  logger = (logger_multi_t *) coco_allocate_memory(sizeof(*logger));
+  logger->number_of_loggers = 0;
+  logger->loggers = NULL;
+  logger->log_functions = NULL;
+  logger->free_functions = NULL;
+
+  if (observer_multi->number_of_observers > 0) {
+    logger->loggers = (void **) coco_allocate_memory(observer_multi->number_of_observers * sizeof(void *));
+    logger->log_functions = (coco_logger_log_function_t *) coco_allocate_memory(
+        observer_multi->number_of_observers * sizeof(coco_logger_log_function_t));
+    logger->free_functions = (coco_logger_free_function_t *) coco_allocate_memory(
+        observer_multi->number_of_observers * sizeof(coco_logger_free_function_t));
+    for (i = 0; i < observer_multi->number_of_observers; i++) {
+      inner_observer = observer_multi->observers[i];
+      if (!inner_observer->is_active)
+        continue;
+      logger->loggers[logger->number_of_loggers] = inner_observer->logger_allocate_function(inner_observer,
+          problem);
+      logger->log_functions[logger->number_of_loggers] = inner_observer->logger_log_function;
+      logger->free_functions[logger->number_of_loggers] = inner_observer->logger_free_function;
+      logger->number_of_loggers++;
+    }
+  }
+
+  self = coco_transformed_allocate(problem, logger, logger_multi_free);
+  self->evaluate_function = logger_multi_evaluate;
+  return self;
+}
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <assert.h>
+#include <float.h>
 
 #include "coco.h"
 
@@ -7,6 +8,7 @@
 #include "coco_problem.c"
 #include "coco_string.c"
 #include "observer_toy.c"
+#include "logger_async.c"
 
 /**
  * This is a toy logger that logs the evaluation number and function value each time a target has been hit.
@@ -15,43 +17,88 @@
 typedef struct {
   coco_observer_t *observer;
   size_t next_target;
+  double next_target_value; /* targets[next_target] or -DBL_MAX if all targets have been hit */
   long number_of_evaluations;
+  logger_async_t *async_writer; /* NULL if the logger logs synchronously */
 } logger_toy_t;
 
 /**
- * Evaluates the function, increases the number of evaluations and outputs information based on the targets
- * that have been hit.
+ * Updates the number of evaluations and outputs information based on the targets that have been hit.
  */
-static void logger_toy_evaluate(coco_problem_t *self, const double *x, double *y) {
+static void logger_toy_log(void *stuff, const size_t number_of_evaluations, const double *x, const double *y) {
 
   logger_toy_t *logger;
   observer_toy_t *observer_toy;
   double *targets;
+  int target_hit = 0;
 
-  logger = coco_transformed_get_data(self);
+  logger = (logger_toy_t *) stuff;
   observer_toy = (observer_toy_t *) logger->observer->data;
   targets = observer_toy->targets;
 
-  coco_evaluate_function(coco_transformed_get_inner_problem(self), x, y);
-  logger->number_of_evaluations++;
+  logger->number_of_evaluations = (long) number_of_evaluations;
+  (void) x; /* unused */
 
   /* Add a line for each target that has been hit */
-  while (y[0] <= targets[logger->next_target] && logger->next_target < observer_toy->number_of_targets) {
-    fprintf(observer_toy->log_file, "%e\t%5ld\t%.5f\n", targets[logger->next_target],
-        logger->number_of_evaluations, y[0]);
-    logger->next_target++;
+  if (y[0] <= logger->next_target_value) {
+    while (logger->next_target < observer_toy->number_of_targets && y[0] <= targets[logger->next_target]) {
+      fprintf(observer_toy->log_file, "%e\t%5ld\t%.5f\n", targets[logger->next_target],
+          logger->number_of_evaluations, y[0]);
+      logger->next_target++;
+      target_hit = 1;
+    }
+    if (logger->next_target < observer_toy->number_of_targets)
+      logger->next_target_value = targets[logger->next_target];
+    else
+      logger->next_target_value = -DBL_MAX;
   }
-  /* Flush output so that impatient users can see the progress */
-  fflush(observer_toy->log_file);
+  /* Flush output (by default after each evaluation, so that impatient users can see the progress) */
+  logger_flush_update(&observer_toy->flush, target_hit, target_hit);
 }
 
 /**
- * Initializes the toy logger.
+ * Logs the evaluation of x with the result y or passes it to the writer thread.
  */
-static coco_problem_t *logger_toy(coco_observer_t *observer, coco_problem_t *problem) {
+static void logger_toy_record(void *stuff, const size_t number_of_evaluations, const double *x, const double *y) {
+
+  logger_toy_t *logger = (logger_toy_t *) stuff;
+
+  if (logger->async_writer != NULL)
+    logger_async_push(logger->async_writer, number_of_evaluations, x, y);
+  else
+    logger_toy_log(logger, number_of_evaluations, x, y);
+}
+
+/**
+ * Evaluates the function and logs the evaluation (or passes it to the writer thread).
+ */
+static void logger_toy_evaluate(coco_problem_t *self, const double *x, double *y) {
+  coco_evaluate_function(coco_transformed_get_inner_problem(self), x, y);
+  logger_toy_record(coco_transformed_get_data(self), self->evaluations + 1, x, y);
+}
+
+/**
+ * Frees the toy logger after its pending evaluations have been logged.
+ */
+static void logger_toy_free(void *stuff) {
+
+  logger_toy_t *logger;
+
+  assert(stuff != NULL);
+  logger = stuff;
+
+  if (logger->async_writer != NULL) {
+    logger_async_stop(logger->async_writer);
+    logger->async_writer = NULL;
+  }
+}
+
+/**
+ * Allocates the data of the toy logger for the given problem.
+ */
+static void *logger_toy_allocate(coco_observer_t *observer, coco_problem_t *problem) {
 
   logger_toy_t *logger;
-  coco_problem_t *self;
   FILE *output_file;
 
   if (problem->number_of_objectives != 1) {
@@ -61,12 +108,24 @@ static coco_problem_t *logger_toy(coco_observer_t *observer, coco_problem_t *pro
   logger = coco_allocate_memory(sizeof(*logger));
   logger->observer = observer;
   logger->next_target = 0;
+  logger->next_target_value = ((observer_toy_t *) observer->data)->targets[0];
   logger->number_of_evaluations = 0;
 
   output_file = ((observer_toy_t *) logger->observer->data)->log_file;
   fprintf(output_file, "\n%s, %s\n", coco_problem_get_id(problem), coco_problem_get_name(problem));
 
-  self = coco_transformed_allocate(problem, logger, NULL);
+  logger->async_writer = logger_async_start(observer, problem, logger, logger_toy_log);
+  return logger;
+}
+
+/**
+ * Initializes the toy logger.
+ */
+static coco_problem_t *logger_toy(coco_observer_t *observer, coco_problem_t *problem) {
+
+  coco_problem_t *self;
+
+  self = coco_transformed_allocate(problem, logger_toy_allocate(observer, problem), logger_toy_free);
   self->evaluate_function = logger_toy_evaluate;
   return self;
 }
@@ -0,0 +1,229 @@
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+
+#include "coco.h"
+#include "coco_utilities.c"
+
+/**
+ * Logging triggers: the evaluation numbers and f-value targets at which the loggers output data are computed
+ * once per problem and stored in sorted tables. Checking whether an evaluation needs to be logged then
+ * amounts to comparing it with the next trigger, instead of computing powers for each evaluation.
+ *
+ * The tables are computed with exactly the same expressions as were used before, so the output does not
+ * change.
+ */
+
+/* Evaluation numbers larger than this (or than a tenth of the largest size_t) are not included in the tables
+ * of evaluation triggers */
+#define LOGGER_TRIGGERS_MAX_EVALUATIONS 1e15
+
+/* The f-value targets are precomputed for exponents between -LOGGER_TRIGGERS_MAX_DECADES and
+ * LOGGER_TRIGGERS_MAX_DECADES (and computed on demand outside this range) */
+#define LOGGER_TRIGGERS_MAX_DECADES 20
+
+/* An upper bound on the number of evaluations that are logged by all loggers (up to 1e15 evaluations) */
+#define LOGGER_TRIGGERS_MAX_ALWAYS_LOG 64
+
+/**
+ * A set of numbers from which the evaluations that should always be logged are computed. For example, if
+ * logger_triggers_always_log[3] = {1, 2, 5}, the logger will always output evaluations
+ * 1, dim*1, dim*2, dim*5, 10*dim*1, 10*dim*2, 10*dim*5, 100*dim*1, 100*dim*2, 100*dim*5, ...
+ */
+static const size_t logger_triggers_always_log[3] = {1, 2, 5};
+
+/**
+ * A sorted table of evaluation numbers.
+ */
+typedef struct {
+  size_t *values;          /* Sorted evaluation numbers without duplicates */
+  size_t number_of_values;
+  size_t next;             /* Index of the first value that has not been reached yet */
+} logger_evaluation_triggers_t;
+
+/**
+ * A table of f-value targets 10**(i/number_of_targets_per_decade) for i from min_index to max_index.
+ */
+typedef struct {
+  double *values;
+  int min_index;
+  int max_index;
+  size_t number_of_targets_per_decade;
+} logger_f_triggers_t;
+
+/**
+ * Compares two evaluation numbers (used for sorting).
+ */
+static int logger_evaluation_triggers_compare(const void *a, const void *b) {
+  const size_t value1 = *(const size_t *) a;
+  const size_t value2 = *(const size_t *) b;
+  if (value1 < value2)
+    return -1;
+  return (value1 > value2) ? 1 : 0;
+}
+
+/**
+ * Allocates evaluation triggers with space for max_number_of_values values.
+ */
+static logger_evaluation_triggers_t *logger_evaluation_triggers_allocate(const size_t max_number_of_values) {
+  logger_evaluation_triggers_t *triggers;
+
+  triggers = (logger_evaluation_triggers_t *) coco_allocate_memory(sizeof(*triggers));
+  triggers->values = (size_t *) coco_allocate_memory(max_number_of_values * sizeof(size_t));
+  triggers->number_of_values = 0;
+  triggers->next = 0;
+  return triggers;
+}
+
+/**
+ * Returns the largest evaluation number that is included in the tables of evaluation triggers.
+ */
+static double logger_triggers_max_evaluations(void) {
+  return coco_min_double(LOGGER_TRIGGERS_MAX_EVALUATIONS, (double) (size_t) -1 / 10.0);
+}
+
+/**
+ * Sorts the values and removes the duplicates.
+ */
+static void logger_evaluation_triggers_sort(logger_evaluation_triggers_t *triggers) {
+  size_t i, count = 0;
+
+  qsort(triggers->values, triggers->number_of_values, sizeof(size_t), logger_evaluation_triggers_compare);
+  for (i = 0; i < triggers->number_of_values; i++) {
+    if ((count == 0) || (triggers->values[i] != triggers->values[count - 1]))
+      triggers->values[count++] = triggers->values[i];
+  }
+  triggers->number_of_values = count;
+}
+
+/**
+ * Frees the evaluation triggers.
+ */
+static void logger_evaluation_triggers_free(logger_evaluation_triggers_t *triggers) {
+  if (triggers == NULL)
+    return;
+  coco_free_memory(triggers->values);
+  coco_free_memory(triggers);
+}
+
+/**
+ * Adds the evaluation numbers 1, dim*1, dim*2, dim*5, 10*dim*1, 10*dim*2, 10*dim*5, ... (see
+ * logger_triggers_always_log) that are logged by all loggers.
+ */
+static void logger_evaluation_triggers_add_always_log(logger_evaluation_triggers_t *triggers,
+                                                      const size_t dimension) {
+
+  const size_t count = sizeof(logger_triggers_always_log) / sizeof(size_t);
+  const double factor = 10;
+  double j;
+  size_t i;
+
+  triggers->values[triggers->number_of_values++] = 1;
+  for (j = 0; pow(factor, j) * (double) dimension <= logger_triggers_max_evaluations(); j++) {
+    for (i = 0; i < count; i++) {
+      triggers->values[triggers->number_of_values++] = (size_t) pow(factor, j) * dimension
+          * logger_triggers_always_log[i];
+    }
+  }
+}
+
+/**
+ * Returns the evaluation triggers of the evaluations that are logged by all loggers.
+ */
+static logger_evaluation_triggers_t *logger_evaluation_triggers_always_log(const size_t dimension) {
+
+  logger_evaluation_triggers_t *triggers;
+
+  triggers = logger_evaluation_triggers_allocate(LOGGER_TRIGGERS_MAX_ALWAYS_LOG);
+  logger_evaluation_triggers_add_always_log(triggers, dimension);
+  logger_evaluation_triggers_sort(triggers);
+  return triggers;
+}
+
+/**
+ * Returns the evaluation triggers of the .tdat files of the bbob logger, that is, the union of the values
+ * floor(10**(i/number_of_triggers_per_decade)), dim * 10**i for i = 0, 1, ... and the evaluations that are
+ * logged by all loggers.
+ */
+static logger_evaluation_triggers_t *logger_evaluation_triggers_bbob(const size_t dimension,
+                                                                     const size_t number_of_triggers_per_decade) {
+  logger_evaluation_triggers_t *triggers;
+  double value;
+  int i;
+
+  triggers = logger_evaluation_triggers_allocate(LOGGER_TRIGGERS_MAX_ALWAYS_LOG
+      + (LOGGER_TRIGGERS_MAX_DECADES + 1) * (number_of_triggers_per_decade + 1));
+  for (i = 0;; i++) {
+    value = floor(pow(10, (double) i / (double) (long) number_of_triggers_per_decade));
+    if (value > logger_triggers_max_evaluations())
+      break;
+    triggers->values[triggers->number_of_values++] = (size_t) value;
+  }
+  for (i = 0;; i++) {
+    value = (double) (long) dimension * pow(10, (double) i);
+    if (value > logger_triggers_max_evaluations())
+      break;
+    triggers->values[triggers->number_of_values++] = (size_t) value;
+  }
+  logger_evaluation_triggers_add_always_log(triggers, dimension);
+  logger_evaluation_triggers_sort(triggers);
+  return triggers;
+}
+
+/**
+ * Returns 1 if number_of_evaluations is one of the triggers and 0 otherwise. The evaluation numbers given in
+ * consecutive calls must not decrease.
+ */
+static int logger_evaluation_triggers_is_hit(logger_evaluation_triggers_t *triggers,
+                                             const size_t number_of_evaluations) {
+
+  while ((triggers->next < triggers->number_of_values)
+      && (triggers->values[triggers->next] < number_of_evaluations))
+    triggers->next++;
+
+  if ((triggers->next < triggers->number_of_values)
+      && (triggers->values[triggers->next] == number_of_evaluations)) {
+    triggers->next++;
+    return 1;
+  }
+  return 0;
+}
+
+/**
+ * Returns the f-value targets 10**(i/number_of_targets_per_decade).
+ */
+static logger_f_triggers_t *logger_f_triggers(const size_t number_of_targets_per_decade) {
+
+  logger_f_triggers_t *triggers;
+  int i;
+
+  triggers = (logger_f_triggers_t *) coco_allocate_memory(sizeof(*triggers));
+  triggers->number_of_targets_per_decade = number_of_targets_per_decade;
+  triggers->max_index = LOGGER_TRIGGERS_MAX_DECADES * (int) number_of_targets_per_decade;
+  triggers->min_index = -triggers->max_index;
+  triggers->values = coco_allocate_vector((size_t) (triggers->max_index - triggers->min_index + 1));
+  for (i = triggers->min_index; i <= triggers->max_index; i++) {
+    triggers->values[i - triggers->min_index] = pow(10,
+        i * 1.0 / (double) (long) number_of_targets_per_decade);
+  }
+  return triggers;
+}
+
+/**
+ * Returns the target 10**(index/number_of_targets_per_decade).
+ */
+static double logger_f_triggers_get(const logger_f_triggers_t *triggers, const int index) {
+  if ((index < triggers->min_index) || (index > triggers->max_index))
+    return pow(10, index * 1.0 / (double) (long) triggers->number_of_targets_per_decade);
+  return triggers->values[index - triggers->min_index];
+}
+
+/**
+ * Frees the f-value targets.
+ */
+static void logger_f_triggers_free(logger_f_triggers_t *triggers) {
+  if (triggers == NULL)
+    return;
+  coco_free_memory(triggers->values);
+  coco_free_memory(triggers);
+}
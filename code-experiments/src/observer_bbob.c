@@ -2,21 +2,30 @@
 #include "coco_utilities.c"
 
 static coco_problem_t *logger_bbob(coco_observer_t *observer, coco_problem_t *problem);
+static void *logger_bbob_allocate(coco_observer_t *observer, coco_problem_t *problem);
+static void logger_bbob_record(void *stuff, const size_t number_of_evaluations, const double *x, const double *y);
+static void logger_bbob_free(void *stuff);
 
 typedef struct {
   size_t bbob_nbpts_nbevals;
   size_t bbob_nbpts_fval;
+  int binary_format;
 } observer_bbob_t;
 
 /**
  * Initializes the bbob observer. Possible options:
  * - bbob_nbpts_nbevals: nb fun eval triggers are at 10**(i/bbob_nbpts_nbevals) (the default value in bbob is 20 )
  * - bbob_nbpts_fval: f value difference to the optimal triggers are at 10**(i/bbob_nbpts_fval)(the default value in bbob is 5 )
+ * - format: text (write the .dat, .tdat and .rdat files as text; default value)
+ * - format: binary (write the same data as fixed-width binary records into buffered .dat.bin, .tdat.bin and
+ * .rdat.bin files that can be converted to the text files with coco_bbob_binary_to_text; unless the general
+ * option flush is given, these files are flushed only when closed)
  */
 static void observer_bbob(coco_observer_t *self, const char *options) {
   
   observer_bbob_t *data;
-  
+  char string_value[COCO_PATH_MAX];
+
   data = coco_allocate_memory(sizeof(*data));  
 
   if ((coco_options_read_size_t(options, "nbpts_nbevals", &(data->bbob_nbpts_nbevals)) == 0)) {
@@ -26,7 +35,18 @@ static void observer_bbob(coco_observer_t *self, const char *options) {
     data->bbob_nbpts_fval = 5;
   }
 
+  data->binary_format = 0;
+  if (coco_options_read_string(options, "format", string_value) > 0) {
+    if (strcmp(string_value, "binary") == 0)
+      data->binary_format = 1;
+    else if (strcmp(string_value, "text") != 0)
+      coco_warning("observer_bbob(): unknown format '%s', using text instead", string_value);
+  }
+
   self->logger_initialize_function = logger_bbob;
+  self->logger_allocate_function = logger_bbob_allocate;
+  self->logger_log_function = logger_bbob_record;
+  self->logger_free_function = logger_bbob_free;
   self->data_free_function = NULL;
   self->data = data;
 }
@@ -28,10 +28,14 @@ typedef struct {
 
   /* Information on the previous logged problem */
   long previous_function;
+  long previous_dimension;
 
 } observer_biobj_t;
 
 static coco_problem_t *logger_biobj(coco_observer_t *self, coco_problem_t *problem);
+static void *logger_biobj_allocate(coco_observer_t *observer, coco_problem_t *problem);
+static void logger_biobj_record(void *stuff, const size_t number_of_evaluations, const double *x, const double *y);
+static void logger_biobj_free(void *stuff);
 
 /**
  * Initializes the biobjective observer. Possible options:
@@ -83,9 +87,13 @@ static void observer_biobj(coco_observer_t *self, const char *options) {
 
   if (data->compute_indicators) {
     data->previous_function = -1;
+    data->previous_dimension = -1;
   }
 
   self->logger_initialize_function = logger_biobj;
+  self->logger_allocate_function = logger_biobj_allocate;
+  self->logger_log_function = logger_biobj_record;
+  self->logger_free_function = logger_biobj_free;
   self->data_free_function = NULL;
   self->data = data;
 
@@ -0,0 +1,558 @@
+#include "coco.h"
+#include "coco_internal.h"
+#include "coco_utilities.c"
+#include "observer_multi.c"
+
+static coco_problem_t *logger_memory(coco_observer_t *observer, coco_problem_t *problem);
+static void *logger_memory_allocate(coco_observer_t *observer, coco_problem_t *problem);
+static void logger_memory_record(void *stuff, const size_t number_of_evaluations, const double *x, const double *y);
+static void logger_memory_free(void *stuff);
+
+/**
+ * The results of one problem observed by the memory observer. All buffers are allocated when the problem
+ * is wrapped by the logger, so that logging does not allocate any memory (except for the archive of
+ * nondominated solutions of bi-objective problems).
+ */
+typedef struct {
+  char *problem_id;
+  size_t function;
+  size_t number_of_variables;
+  size_t number_of_objectives;
+  size_t number_of_evaluations;
+
+  /* The best value (f - f_opt for single-objective problems and the hypervolume indicator difference for
+   * bi-objective problems) and the solution with which it was reached */
+  double best_value;
+  double *best_solution;
+
+  /* The targets for the best value and the evaluations in which they were first hit (0 if not hit) */
+  size_t number_of_targets;
+  const double *targets;
+  size_t *target_hits;
+
+  /* The evaluations in which the best value improved and the improved best values */
+  size_t trajectory_length;
+  size_t trajectory_size;
+  size_t *trajectory_evaluations;
+  double *trajectory_values;
+} observer_memory_result_t;
+
+/**
+ * The exponents of the largest and smallest target 10**exponent for single-objective problems.
+ */
+#define OBSERVER_MEMORY_MAX_TARGET_EXPONENT 2
+#define OBSERVER_MEMORY_MIN_TARGET_EXPONENT -8
+
+/**
+ * The budgets of the ECDF bins of the summary are 10**(i/OBSERVER_MEMORY_SUMMARY_BINS_PER_DECADE) times
+ * the dimension for i = 0, 1, ..., OBSERVER_MEMORY_SUMMARY_NUMBER_OF_BINS - 1.
+ */
+#define OBSERVER_MEMORY_SUMMARY_BINS_PER_DECADE 5
+#define OBSERVER_MEMORY_SUMMARY_NUMBER_OF_BINS (7 * OBSERVER_MEMORY_SUMMARY_BINS_PER_DECADE + 1)
+
+/**
+ * The aggregated results of all runs on the problems with the same function and dimension (that is, of
+ * all instances).
+ */
+typedef struct {
+  size_t function;
+  size_t number_of_variables;
+  size_t number_of_objectives;
+  size_t number_of_runs;
+  size_t number_of_evaluations;
+
+  size_t number_of_targets;
+  const double *targets;
+  /* The ERT of a target is its numerator (the evaluations of all runs until the target was hit or until
+   * the end of the run) divided by its denominator (the number of runs that hit it) */
+  size_t *ert_numerators;
+  size_t *ert_denominators;
+  /* The number of (run, target) pairs first hit within the budget of the bin, but not of the previous one */
+  size_t hits_per_bin[OBSERVER_MEMORY_SUMMARY_NUMBER_OF_BINS];
+} observer_memory_summary_t;
+
+/* Data for the memory observer */
+typedef struct {
+  size_t number_of_targets_per_decade;
+  size_t trajectory_size;
+  double *targets; /* The targets for single-objective problems */
+  size_t number_of_targets;
+
+  size_t number_of_results;
+  size_t max_number_of_results;
+  observer_memory_result_t **results;
+
+  /* The summaries are only kept if the option summary is set; they are written to a file in the folder
+   * summary_folder (copied from the observer, which frees its own copy before the data) */
+  int write_summary;
+  char *summary_folder;
+  char *algorithm_name;
+  size_t number_of_summaries;
+  size_t max_number_of_summaries;
+  observer_memory_summary_t *summaries;
+  double budgets[OBSERVER_MEMORY_SUMMARY_NUMBER_OF_BINS];
+} observer_memory_t;
+
+/**
+ * Allocates the result of a problem with the given number of targets and trajectory size.
+ */
+static observer_memory_result_t *observer_memory_result_allocate(const char *problem_id,
+                                                                 const size_t function,
+                                                                 const size_t number_of_variables,
+                                                                 const size_t number_of_objectives,
+                                                                 const size_t number_of_targets,
+                                                                 const double *targets,
+                                                                 const size_t trajectory_size) {
+
+  observer_memory_result_t *result;
+  size_t i;
+
+  result = (observer_memory_result_t *) coco_allocate_memory(sizeof(*result));
+  result->problem_id = coco_strdup(problem_id);
+  result->function = function;
+  result->number_of_variables = number_of_variables;
+  result->number_of_objectives = number_of_objectives;
+  result->number_of_evaluations = 0;
+  result->best_value = DBL_MAX;
+  result->best_solution = coco_allocate_vector(number_of_variables);
+  for (i = 0; i < number_of_variables; i++)
+    result->best_solution[i] = NAN;
+
+  result->number_of_targets = number_of_targets;
+  result->targets = targets;
+  result->target_hits = NULL;
+  if (number_of_targets > 0) {
+    result->target_hits = (size_t *) coco_allocate_memory(number_of_targets * sizeof(size_t));
+    for (i = 0; i < number_of_targets; i++)
+      result->target_hits[i] = 0;
+  }
+
+  result->trajectory_length = 0;
+  result->trajectory_size = trajectory_size;
+  result->trajectory_evaluations = NULL;
+  result->trajectory_values = NULL;
+  if (trajectory_size > 0) {
+    result->trajectory_evaluations = (size_t *) coco_allocate_memory(trajectory_size * sizeof(size_t));
+    result->trajectory_values = coco_allocate_vector(trajectory_size);
+  }
+  return result;
+}
+
+/**
+ * Frees the given result.
+ */
+static void observer_memory_result_free(observer_memory_result_t *result) {
+
+  coco_free_memory(result->problem_id);
+  coco_free_memory(result->best_solution);
+  if (result->target_hits != NULL)
+    coco_free_memory(result->target_hits);
+  if (result->trajectory_evaluations != NULL)
+    coco_free_memory(result->trajectory_evaluations);
+  if (result->trajectory_values != NULL)
+    coco_free_memory(result->trajectory_values);
+  coco_free_memory(result);
+}
+
+/**
+ * Adds a result to the memory observer and returns it. The observer keeps the results also after the
+ * problems have been freed.
+ */
+static observer_memory_result_t *observer_memory_add_result(observer_memory_t *data,
+                                                            observer_memory_result_t *result) {
+
+  observer_memory_result_t **results;
+  size_t i;
+
+  if (data->number_of_results == data->max_number_of_results) {
+    data->max_number_of_results = (data->max_number_of_results == 0) ? 64 : 2 * data->max_number_of_results;
+    results = (observer_memory_result_t **) coco_allocate_memory(data->max_number_of_results
+        * sizeof(observer_memory_result_t *));
+    for (i = 0; i < data->number_of_results; i++)
+      results[i] = data->results[i];
+    if (data->results != NULL)
+      coco_free_memory(data->results);
+    data->results = results;
+  }
+  data->results[data->number_of_results++] = result;
+  return result;
+}
+
+/**
+ * Returns the summary of the function and dimension of the given result (adding it if needed).
+ */
+static observer_memory_summary_t *observer_memory_get_summary(observer_memory_t *data,
+                                                              const observer_memory_result_t *result) {
+
+  observer_memory_summary_t *summaries, *summary;
+  size_t i;
+
+  for (i = 0; i < data->number_of_summaries; i++) {
+    summary = &data->summaries[i];
+    if ((summary->function == result->function) && (summary->number_of_variables == result->number_of_variables)
+        && (summary->number_of_objectives == result->number_of_objectives))
+      return summary;
+  }
+
+  if (data->number_of_summaries == data->max_number_of_summaries) {
+    data->max_number_of_summaries = (data->max_number_of_summaries == 0) ? 64 : 2 * data->max_number_of_summaries;
+    summaries = (observer_memory_summary_t *) coco_allocate_memory(data->max_number_of_summaries
+        * sizeof(observer_memory_summary_t));
+    if (data->summaries != NULL) {
+      memcpy(summaries, data->summaries, data->number_of_summaries * sizeof(observer_memory_summary_t));
+      coco_free_memory(data->summaries);
+    }
+    data->summaries = summaries;
+  }
+
+  summary = &data->summaries[data->number_of_summaries++];
+  summary->function = result->function;
+  summary->number_of_variables = result->number_of_variables;
+  summary->number_of_objectives = result->number_of_objectives;
+  summary->number_of_runs = 0;
+  summary->number_of_evaluations = 0;
+  summary->number_of_targets = result->number_of_targets;
+  summary->targets = result->targets;
+  summary->ert_numerators = NULL;
+  summary->ert_denominators = NULL;
+  if (summary->number_of_targets > 0) {
+    summary->ert_numerators = (size_t *) coco_allocate_memory(summary->number_of_targets * sizeof(size_t));
+    summary->ert_denominators = (size_t *) coco_allocate_memory(summary->number_of_targets * sizeof(size_t));
+    for (i = 0; i < summary->number_of_targets; i++)
+      summary->ert_numerators[i] = summary->ert_denominators[i] = 0;
+  }
+  for (i = 0; i < OBSERVER_MEMORY_SUMMARY_NUMBER_OF_BINS; i++)
+    summary->hits_per_bin[i] = 0;
+  return summary;
+}
+
+/**
+ * Adds the (finished) run of the given result to the summary of its function and dimension.
+ */
+static void observer_memory_summary_add(observer_memory_t *data, const observer_memory_result_t *result) {
+
+  observer_memory_summary_t *summary = observer_memory_get_summary(data, result);
+  size_t i, bin;
+  double budget;
+
+  summary->number_of_runs++;
+  summary->number_of_evaluations += result->number_of_evaluations;
+
+  for (i = 0; i < summary->number_of_targets; i++) {
+    if (result->target_hits[i] > 0) {
+      summary->ert_numerators[i] += result->target_hits[i];
+      summary->ert_denominators[i]++;
+      /* Find the first bin with a budget that is not smaller than the hit */
+      budget = (double) result->target_hits[i] / (double) result->number_of_variables;
+      for (bin = 0; (bin < OBSERVER_MEMORY_SUMMARY_NUMBER_OF_BINS) && (data->budgets[bin] < budget); bin++)
+        ;
+      if (bin < OBSERVER_MEMORY_SUMMARY_NUMBER_OF_BINS)
+        summary->hits_per_bin[bin]++;
+    } else {
+      summary->ert_numerators[i] += result->number_of_evaluations;
+    }
+  }
+}
+
+/**
+ * Writes the summaries to the file summary.txt in the summary folder. For each function and dimension,
+ * the file contains a header line followed by the lines with the targets, the ERT numerators and
+ * denominators for each target and the ECDF of the (run, target) pairs at the budgets of the bins.
+ */
+static void observer_memory_write_summary(observer_memory_t *data) {
+
+  observer_memory_summary_t *summary;
+  char *file_name;
+  FILE *file;
+  size_t i, j, hits;
+
+  file_name = (char *) coco_allocate_memory(COCO_PATH_MAX);
+  memcpy(file_name, data->summary_folder, strlen(data->summary_folder) + 1);
+  coco_create_unique_path(&file_name);
+  coco_info("Summary will be output to folder %s", file_name);
+  coco_join_path(file_name, COCO_PATH_MAX, "summary.txt", NULL);
+
+  file = fopen(file_name, "w");
+  if (file == NULL) {
+    coco_error("observer_memory_write_summary(): failed to open file %s.", file_name);
+    return; /* Never reached */
+  }
+
+  fprintf(file, "%% algorithm = %s\n", data->algorithm_name);
+  fprintf(file, "%% ERT of a target = ert_numerator / ert_denominator\n");
+  fprintf(file, "%% ECDF of the (run, target) pairs at budgets 10**(i/%d) * dimension for i = 0, ..., %d\n",
+      OBSERVER_MEMORY_SUMMARY_BINS_PER_DECADE, OBSERVER_MEMORY_SUMMARY_NUMBER_OF_BINS - 1);
+  for (i = 0; i < data->number_of_summaries; i++) {
+    summary = &data->summaries[i];
+    fprintf(file, "function = %lu, dimension = %lu, objectives = %lu, runs = %lu, evaluations = %lu\n",
+        (unsigned long) summary->function, (unsigned long) summary->number_of_variables,
+        (unsigned long) summary->number_of_objectives, (unsigned long) summary->number_of_runs,
+        (unsigned long) summary->number_of_evaluations);
+    fprintf(file, "targets");
+    for (j = 0; j < summary->number_of_targets; j++)
+      fprintf(file, " %.4e", summary->targets[j]);
+    fprintf(file, "\nert_numerator");
+    for (j = 0; j < summary->number_of_targets; j++)
+      fprintf(file, " %lu", (unsigned long) summary->ert_numerators[j]);
+    fprintf(file, "\nert_denominator");
+    for (j = 0; j < summary->number_of_targets; j++)
+      fprintf(file, " %lu", (unsigned long) summary->ert_denominators[j]);
+    fprintf(file, "\necdf");
+    hits = 0;
+    for (j = 0; j < OBSERVER_MEMORY_SUMMARY_NUMBER_OF_BINS; j++) {
+      hits += summary->hits_per_bin[j];
+      fprintf(file, " %.4f", (summary->number_of_targets > 0) ?
+          (double) hits / (double) (summary->number_of_runs * summary->number_of_targets) : 0.0);
+    }
+    fprintf(file, "\n");
+  }
+  fclose(file);
+  coco_free_memory(file_name);
+}
+
+/**
+ * Frees all results of the memory observer (after adding them to the summaries, if these are kept).
+ */
+static void observer_memory_clear(observer_memory_t *data) {
+
+  size_t i;
+
+  for (i = 0; i < data->number_of_results; i++) {
+    if (data->write_summary)
+      observer_memory_summary_add(data, data->results[i]);
+    observer_memory_result_free(data->results[i]);
+  }
+  if (data->results != NULL)
+    coco_free_memory(data->results);
+  data->results = NULL;
+  data->number_of_results = 0;
+  data->max_number_of_results = 0;
+}
+
+/**
+ * Frees memory for the given coco_observer_t's data field observer_memory_t. Writes the summary file if
+ * the option summary is set.
+ */
+static void observer_memory_free(void *stuff) {
+
+  observer_memory_t *data;
+  size_t i;
+
+  assert(stuff != NULL);
+  data = stuff;
+
+  observer_memory_clear(data);
+  if (data->write_summary)
+    observer_memory_write_summary(data);
+
+  for (i = 0; i < data->number_of_summaries; i++) {
+    if (data->summaries[i].ert_numerators != NULL)
+      coco_free_memory(data->summaries[i].ert_numerators);
+    if (data->summaries[i].ert_denominators != NULL)
+      coco_free_memory(data->summaries[i].ert_denominators);
+  }
+  if (data->summaries != NULL) {
+    coco_free_memory(data->summaries);
+    data->summaries = NULL;
+  }
+  if (data->summary_folder != NULL) {
+    coco_free_memory(data->summary_folder);
+    data->summary_folder = NULL;
+  }
+  if (data->algorithm_name != NULL) {
+    coco_free_memory(data->algorithm_name);
+    data->algorithm_name = NULL;
+  }
+  if (data->targets != NULL) {
+    coco_free_memory(data->targets);
+    data->targets = NULL;
+  }
+}
+
+/**
+ * Initializes the memory observer, which keeps the results of the observed problems in memory instead of
+ * writing them to files, so that they can be used directly (for example, when tuning an algorithm). For
+ * each problem, it records the evaluations in which the targets were first hit, the best value with the
+ * corresponding solution and optionally the trajectory of the best value. The targets are the same as
+ * those of the bbob observer for single-objective problems (f - f_opt <= 10**(i/nbpts_fval) for f - f_opt
+ * between 1e2 and 1e-8) and those of the bbob-biobj observer for bi-objective problems (hypervolume
+ * indicator differences). Possible options:
+ * - nbpts_fval: VALUE (number of targets per decade for single-objective problems; default value is 5)
+ * - trajectory: VALUE (number of improvements of the best value to record for each problem; when there are
+ * more, the last one is overwritten, so that it always holds the final best value; default value is 0)
+ * - summary: 1 (aggregates the results of all instances of each function and dimension into the ERT and
+ * the ECDF of the target hits, which are written to the file summary.txt in the result folder when the
+ * observer is freed; this is the only file output of the memory observer; default value is 0)
+ */
+static void observer_memory(coco_observer_t *self, const char *options) {
+
+  observer_memory_t *data;
+  size_t i;
+  long exponent_index;
+
+  data = coco_allocate_memory(sizeof(*data));
+
+  if ((coco_options_read_size_t(options, "nbpts_fval", &data->number_of_targets_per_decade) == 0)
+      || (data->number_of_targets_per_decade < 1)) {
+    data->number_of_targets_per_decade = 5;
+  }
+  if (coco_options_read_size_t(options, "trajectory", &data->trajectory_size) == 0) {
+    data->trajectory_size = 0;
+  }
+
+  /* Compute the targets from the largest to the smallest one */
+  data->number_of_targets = (size_t) (OBSERVER_MEMORY_MAX_TARGET_EXPONENT - OBSERVER_MEMORY_MIN_TARGET_EXPONENT)
+      * data->number_of_targets_per_decade + 1;
+  data->targets = coco_allocate_vector(data->number_of_targets);
+  for (i = 0; i < data->number_of_targets; i++) {
+    exponent_index = OBSERVER_MEMORY_MAX_TARGET_EXPONENT * (long) data->number_of_targets_per_decade - (long) i;
+    data->targets[i] = pow(10, (double) exponent_index / (double) (long) data->number_of_targets_per_decade);
+  }
+
+  data->number_of_results = 0;
+  data->max_number_of_results = 0;
+  data->results = NULL;
+
+  if (coco_options_read_int(options, "summary", &data->write_summary) == 0)
+    data->write_summary = 0;
+  data->summary_folder = coco_strdup(self->output_folder);
+  data->algorithm_name = coco_strdup(self->algorithm_name);
+  data->number_of_summaries = 0;
+  data->max_number_of_summaries = 0;
+  data->summaries = NULL;
+  for (i = 0; i < OBSERVER_MEMORY_SUMMARY_NUMBER_OF_BINS; i++)
+    data->budgets[i] = pow(10, (double) (long) i / (double) OBSERVER_MEMORY_SUMMARY_BINS_PER_DECADE);
+
+  self->logger_initialize_function = logger_memory;
+  self->logger_allocate_function = logger_memory_allocate;
+  self->logger_log_function = logger_memory_record;
+  self->logger_free_function = logger_memory_free;
+  self->data_free_function = observer_memory_free;
+  self->data = data;
+}
+
+/**
+ * Returns the data of the memory observer (or of the first memory observer within a multi observer).
+ * Returns NULL if there is no memory observer.
+ */
+static observer_memory_t *observer_memory_get_data(const coco_observer_t *observer) {
+
+  observer_memory_t *data;
+  observer_multi_t *observer_multi;
+  size_t i;
+
+  if (observer == NULL)
+    return NULL;
+  if (observer->logger_initialize_function == logger_memory)
+    return (observer_memory_t *) observer->data;
+  if (observer->logger_initialize_function == logger_multi) {
+    observer_multi = (observer_multi_t *) observer->data;
+    for (i = 0; i < observer_multi->number_of_observers; i++) {
+      data = observer_memory_get_data(observer_multi->observers[i]);
+      if (data != NULL)
+        return data;
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Returns the result with the given index.
+ */
+static observer_memory_result_t *observer_memory_get_result(const coco_observer_t *observer,
+                                                            const size_t result_index) {
+
+  observer_memory_t *data = observer_memory_get_data(observer);
+
+  if (data == NULL) {
+    coco_error("observer_memory_get_result(): the observer is not a memory observer");
+    return NULL; /* Never reached */
+  }
+  if (result_index >= data->number_of_results) {
+    coco_error("observer_memory_get_result(): result index %lu out of range (there are %lu results)",
+        (unsigned long) result_index, (unsigned long) data->number_of_results);
+    return NULL; /* Never reached */
+  }
+  return data->results[result_index];
+}
+
+size_t coco_observer_memory_get_number_of_results(const coco_observer_t *observer) {
+
+  observer_memory_t *data = observer_memory_get_data(observer);
+
+  if (data == NULL) {
+    coco_error("coco_observer_memory_get_number_of_results(): the observer is not a memory observer");
+    return 0; /* Never reached */
+  }
+  return data->number_of_results;
+}
+
+const char *coco_observer_memory_get_problem_id(const coco_observer_t *observer, const size_t result_index) {
+  return observer_memory_get_result(observer, result_index)->problem_id;
+}
+
+size_t coco_observer_memory_get_evaluations(const coco_observer_t *observer, const size_t result_index) {
+  return observer_memory_get_result(observer, result_index)->number_of_evaluations;
+}
+
+double coco_observer_memory_get_best_value(const coco_observer_t *observer, const size_t result_index) {
+  return observer_memory_get_result(observer, result_index)->best_value;
+}
+
+const double *coco_observer_memory_get_best_solution(const coco_observer_t *observer,
+                                                     const size_t result_index,
+                                                     size_t *number_of_variables) {
+
+  observer_memory_result_t *result = observer_memory_get_result(observer, result_index);
+
+  if (number_of_variables != NULL)
+    *number_of_variables = result->number_of_variables;
+  return result->best_solution;
+}
+
+const double *coco_observer_memory_get_targets(const coco_observer_t *observer,
+                                               const size_t result_index,
+                                               size_t *number_of_targets) {
+
+  observer_memory_result_t *result = observer_memory_get_result(observer, result_index);
+
+  if (number_of_targets != NULL)
+    *number_of_targets = result->number_of_targets;
+  return result->targets;
+}
+
+const size_t *coco_observer_memory_get_target_hits(const coco_observer_t *observer,
+                                                   const size_t result_index,
+                                                   size_t *number_of_targets) {
+
+  observer_memory_result_t *result = observer_memory_get_result(observer, result_index);
+
+  if (number_of_targets != NULL)
+    *number_of_targets = result->number_of_targets;
+  return result->target_hits;
+}
+
+size_t coco_observer_memory_get_trajectory(const coco_observer_t *observer,
+                                           const size_t result_index,
+                                           const size_t **evaluations,
+                                           const double **values) {
+
+  observer_memory_result_t *result = observer_memory_get_result(observer, result_index);
+
+  if (evaluations != NULL)
+    *evaluations = result->trajectory_evaluations;
+  if (values != NULL)
+    *values = result->trajectory_values;
+  return result->trajectory_length;
+}
+
+void coco_observer_memory_clear(coco_observer_t *observer) {
+
+  observer_memory_t *data = observer_memory_get_data(observer);
+
+  if (data == NULL) {
+    coco_error("coco_observer_memory_clear(): the observer is not a memory observer");
+    return; /* Never reached */
+  }
+  observer_memory_clear(data);
+}
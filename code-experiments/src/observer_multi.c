@@ -0,0 +1,96 @@
+#include "coco.h"
+#include "coco_internal.h"
+#include "coco_utilities.c"
+
+static coco_problem_t *logger_multi(coco_observer_t *observer, coco_problem_t *problem);
+
+/* Data for the multi observer */
+typedef struct {
+  size_t number_of_observers;
+  coco_observer_t **observers;
+} observer_multi_t;
+
+/**
+ * Frees the observers of the multi observer.
+ */
+static void observer_multi_free(void *stuff) {
+
+  observer_multi_t *data;
+  size_t i;
+
+  assert(stuff != NULL);
+  data = stuff;
+
+  if (data->observers != NULL) {
+    for (i = 0; i < data->number_of_observers; i++)
+      coco_observer_free(data->observers[i]);
+    coco_free_memory(data->observers);
+    data->observers = NULL;
+  }
+}
+
+/**
+ * Initializes the multi observer, which logs each evaluation with several observers, but evaluates the
+ * problem only once. Possible options:
+ * - observers: LIST (a comma-separated list of the observers to use, for example "bbob,toy"; each observer
+ * outputs its results into the subfolder of the result folder with the name of the observer)
+ * All other options are passed on to the observers.
+ */
+static void observer_multi(coco_observer_t *self, const char *options) {
+
+  observer_multi_t *data;
+  char string_value[COCO_PATH_MAX];
+  char **names, *observer_options, *result_folder;
+  coco_observer_t *observer;
+  size_t i, count;
+
+  data = coco_allocate_memory(sizeof(*data));
+  data->number_of_observers = 0;
+  data->observers = NULL;
+
+  self->logger_initialize_function = logger_multi;
+  self->data_free_function = observer_multi_free;
+  self->data = data;
+
+  if (coco_options_read_values(options, "observers", string_value) <= 0) {
+    coco_warning("observer_multi(): no observers given (use, for example, 'observers: bbob,toy')");
+    return;
+  }
+
+  names = coco_string_split(string_value, ',');
+  for (count = 0; names[count] != NULL; count++)
+    ;
+  if (count == 0) {
+    coco_free_memory(names);
+    return;
+  }
+  data->observers = (coco_observer_t **) coco_allocate_memory(count * sizeof(coco_observer_t *));
+
+  for (i = 0; i < count; i++) {
+    if ((strcmp(names[i], "multi") == 0) || (strcmp(names[i], "no_observer") == 0)) {
+      coco_warning("observer_multi(): ignoring observer %s", names[i]);
+    } else {
+      /* The result folder given here is found before the one in options */
+      result_folder = (char *) coco_allocate_memory(COCO_PATH_MAX);
+      memcpy(result_folder, self->output_folder, strlen(self->output_folder) + 1);
+      coco_join_path(result_folder, COCO_PATH_MAX, names[i], NULL);
+      observer_options = coco_strdupf("result_folder: \"%s\" %s", result_folder, options);
+      observer = coco_observer(names[i], observer_options);
+      if ((observer != NULL) && ((observer->logger_allocate_function == NULL)
+          || (observer->logger_log_function == NULL) || (observer->logger_free_function == NULL))) {
+        coco_warning("observer_multi(): observer %s cannot be used within the multi observer", names[i]);
+        coco_observer_free(observer);
+        observer = NULL;
+      }
+      if (observer != NULL) {
+        /* The multi observer calls the loggers directly, so only the multi observer itself can be timed */
+        observer->timing = 0;
+        data->observers[data->number_of_observers++] = observer;
+      }
+      coco_free_memory(observer_options);
+      coco_free_memory(result_folder);
+    }
+    coco_free_memory(names[i]);
+  }
+  coco_free_memory(names);
+}
@@ -1,13 +1,18 @@
 #include "coco.h"
 #include "coco_utilities.c"
+#include "logger_flush.c"
 
 static coco_problem_t *logger_toy(coco_observer_t *observer, coco_problem_t *problem);
+static void *logger_toy_allocate(coco_observer_t *observer, coco_problem_t *problem);
+static void logger_toy_record(void *stuff, const size_t number_of_evaluations, const double *x, const double *y);
+static void logger_toy_free(void *stuff);
 
 /* Data for the toy observer */
 typedef struct {
   FILE *log_file;
   size_t number_of_targets;
   double *targets;
+  logger_flush_t flush; /* When the log file is flushed */
 } observer_toy_t;
 
 /**
@@ -24,6 +29,7 @@ static void observer_toy_free(void *stuff) {
     fclose(data->log_file);
     data->log_file = NULL;
   }
+  logger_flush_free(&data->flush);
 
   if (data->targets != NULL) {
     coco_free_memory(data->targets);
@@ -67,6 +73,8 @@ static void observer_toy(coco_observer_t *self, const char *options) {
     coco_error("observer_toy(): failed to open file %s.", file_name);
     return; /* Never reached */
   }
+  logger_flush_init(&data->flush, self, COCO_FLUSH_EVERY);
+  logger_flush_add_file(&data->flush, data->log_file, 0);
 
   /* Compute targets */
   data->targets = coco_allocate_vector(data->number_of_targets);
@@ -75,6 +83,9 @@ static void observer_toy(coco_observer_t *self, const char *options) {
   }
 
   self->logger_initialize_function = logger_toy;
+  self->logger_allocate_function = logger_toy_allocate;
+  self->logger_log_function = logger_toy_record;
+  self->logger_free_function = logger_toy_free;
   self->data_free_function = observer_toy_free;
   self->data = data;
 }
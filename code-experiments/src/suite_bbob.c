@@ -27,6 +27,12 @@ static coco_suite_t *coco_suite_allocate(const char *suite_name,
                                          const size_t *dimensions,
                                          const char *default_instances);
 
+/** @brief The template of the problem ids of the bbob suite (and the bbob-largescale suite). */
+static const char *suite_bbob_problem_id_template = "bbob_f%03lu_i%02lu_d%02lu";
+
+/** @brief The template of the problem names of the bbob suite (and the bbob-largescale suite). */
+static const char *suite_bbob_problem_name_template = "BBOB suite problem f%lu instance %lu in %luD";
+
 static coco_suite_t *suite_bbob_allocate(void) {
 
   coco_suite_t *suite;
@@ -72,8 +78,8 @@ static coco_problem_t *get_bbob_problem(const size_t function,
                                         const size_t instance) {
   coco_problem_t *problem = NULL;
 
-  const char *problem_id_template = "bbob_f%03lu_i%02lu_d%02lu";
-  const char *problem_name_template = "BBOB suite problem f%lu instance %lu in %luD";
+  const char *problem_id_template = suite_bbob_problem_id_template;
+  const char *problem_name_template = suite_bbob_problem_name_template;
 
   const long rseed = (long) (function + 10000 * instance);
   const long rseed_3 = (long) (3 + 10000 * instance);
@@ -178,3 +184,23 @@ static coco_problem_t *suite_bbob_get_problem(coco_suite_t *suite,
 
   return problem;
 }
+
+/**
+ * @brief Returns the id, name and number of objectives of the problem without constructing it.
+ */
+static void suite_bbob_get_problem_metadata(coco_suite_t *suite,
+                                            const size_t function_idx,
+                                            const size_t dimension_idx,
+                                            const size_t instance_idx,
+                                            char **problem_id,
+                                            char **problem_name,
+                                            size_t *number_of_objectives) {
+
+  const size_t function = suite->functions[function_idx];
+  const size_t dimension = suite->dimensions[dimension_idx];
+  const size_t instance = suite->instances[instance_idx];
+
+  *problem_id = coco_strdupf(suite_bbob_problem_id_template, function, instance, dimension);
+  *problem_name = coco_strdupf(suite_bbob_problem_name_template, function, instance, dimension);
+  *number_of_objectives = 1;
+}
@@ -1,7 +1,17 @@
+#include <stdlib.h>
+
 #include "coco.h"
 #include "mo_generics.c"
 #include "suite_bbob.c"
-#include "suite_biobj_best_values_hyp.c"
+
+/* A best known indicator value of a problem (the tables of these values are generated from the
+ * suite_biobj_best_values_*.txt files during amalgamation and are sorted by key) */
+typedef struct {
+  const char *key;
+  double value;
+} suite_biobj_best_value_t;
+
+#include "suite_biobj_best_values_hyp.txt"
 
 /* An array of triples biobj_instance - problem1_instance - problem2_instance that should be updated
  * with new instances when they are selected. */
@@ -62,20 +72,24 @@ static char *suite_biobj_get_instances_by_year(const int year) {
   }
 }
 
-static coco_problem_t *suite_biobj_get_problem(coco_suite_t *suite,
-                                               const size_t function_idx,
-                                               const size_t dimension_idx,
-                                               const size_t instance_idx) {
+/**
+ * @brief Computes the bbob functions and instances that are combined into the bi-objective problem with the
+ * given function and instance indices (creating a new instance if the instance is not one of
+ * suite_biobj_instances and has not been created before).
+ */
+static void suite_biobj_get_bbob_functions_and_instances(coco_suite_t *suite,
+                                                         const size_t function_idx,
+                                                         const size_t instance_idx,
+                                                         size_t *function1,
+                                                         size_t *function2,
+                                                         size_t *instance1,
+                                                         size_t *instance2) {
 
   const size_t num_bbob_functions = 10;
   const size_t bbob_functions[] = { 1, 2, 6, 8, 13, 14, 15, 17, 20, 21 };
 
-  coco_problem_t *problem1, *problem2, *problem = NULL;
   size_t function1_idx, function2_idx;
-  size_t instance1 = 0, instance2 = 0;
 
-  const size_t function = suite->functions[function_idx];
-  const size_t dimension = suite->dimensions[dimension_idx];
   const size_t instance = suite->instances[instance_idx];
 
   suite_biobj_t *data = (suite_biobj_t *) suite->data;
@@ -88,13 +102,15 @@ static coco_problem_t *suite_biobj_get_problem(coco_suite_t *suite,
       (size_t) (-0.5 + sqrt(0.25 + 2.0 * (double) (suite->number_of_functions - function_idx - 1))) - 1;
   function2_idx = function_idx - (function1_idx * num_bbob_functions) +
       (function1_idx * (function1_idx + 1)) / 2;
+  *function1 = bbob_functions[function1_idx];
+  *function2 = bbob_functions[function2_idx];
 
   /* First search for instance in suite_biobj_instances */
   for (i = 0; i < num_existing_instances; i++) {
     if (suite_biobj_instances[i][0] == instance) {
       /* The instance has been found in suite_biobj_instances */
-      instance1 = suite_biobj_instances[i][1];
-      instance2 = suite_biobj_instances[i][2];
+      *instance1 = suite_biobj_instances[i][1];
+      *instance2 = suite_biobj_instances[i][2];
       instance_found = 1;
       break;
     }
@@ -107,8 +123,8 @@ static coco_problem_t *suite_biobj_get_problem(coco_suite_t *suite,
         break;
       if (data->new_instances[i][0] == instance) {
         /* The instance has been found in new_instances */
-        instance1 = data->new_instances[i][1];
-        instance2 = data->new_instances[i][2];
+        *instance1 = data->new_instances[i][1];
+        *instance2 = data->new_instances[i][2];
         instance_found = 1;
         break;
       }
@@ -129,7 +145,7 @@ static coco_problem_t *suite_biobj_get_problem(coco_suite_t *suite,
 
       data->new_instances = coco_allocate_memory(data->max_new_instances * sizeof(size_t *));
       for (i = 0; i < data->max_new_instances; i++) {
-        data->new_instances[i] = malloc(3 * sizeof(size_t));
+        data->new_instances[i] = (size_t *) coco_allocate_memory(3 * sizeof(size_t));
         for (j = 0; j < 3; j++) {
           data->new_instances[i][j] = 0;
         }
@@ -139,12 +155,29 @@ static coco_problem_t *suite_biobj_get_problem(coco_suite_t *suite,
     }
 
     /* A simple formula to set the first instance */
-    instance1 = 2 * instance + 1;
-    instance2 = suite_biobj_get_new_instance(suite, instance, instance1, num_bbob_functions, bbob_functions);
+    *instance1 = 2 * instance + 1;
+    *instance2 = suite_biobj_get_new_instance(suite, instance, *instance1, num_bbob_functions, bbob_functions);
   }
+}
 
-  problem1 = get_bbob_problem(bbob_functions[function1_idx], dimension, instance1);
-  problem2 = get_bbob_problem(bbob_functions[function2_idx], dimension, instance2);
+static coco_problem_t *suite_biobj_get_problem(coco_suite_t *suite,
+                                               const size_t function_idx,
+                                               const size_t dimension_idx,
+                                               const size_t instance_idx) {
+
+  coco_problem_t *problem1, *problem2, *problem = NULL;
+  size_t function1, function2;
+  size_t instance1 = 0, instance2 = 0;
+
+  const size_t function = suite->functions[function_idx];
+  const size_t dimension = suite->dimensions[dimension_idx];
+  const size_t instance = suite->instances[instance_idx];
+
+  suite_biobj_get_bbob_functions_and_instances(suite, function_idx, instance_idx, &function1, &function2,
+      &instance1, &instance2);
+
+  problem1 = get_bbob_problem(function1, dimension, instance1);
+  problem2 = get_bbob_problem(function2, dimension, instance2);
 
   problem = coco_stacked_problem_allocate(problem1, problem2);
 
@@ -162,6 +195,110 @@ static coco_problem_t *suite_biobj_get_problem(coco_suite_t *suite,
   return problem;
 }
 
+/**
+ * @brief Returns the id, name and number of objectives of the problem without constructing it.
+ *
+ * As for the constructed problem, the name is the id of the stacked problem of the two bbob problems.
+ */
+static void suite_biobj_get_problem_metadata(coco_suite_t *suite,
+                                             const size_t function_idx,
+                                             const size_t dimension_idx,
+                                             const size_t instance_idx,
+                                             char **problem_id,
+                                             char **problem_name,
+                                             size_t *number_of_objectives) {
+
+  size_t function1, function2;
+  size_t instance1 = 0, instance2 = 0;
+  char *problem1_id, *problem2_id;
+
+  const size_t function = suite->functions[function_idx];
+  const size_t dimension = suite->dimensions[dimension_idx];
+  const size_t instance = suite->instances[instance_idx];
+
+  suite_biobj_get_bbob_functions_and_instances(suite, function_idx, instance_idx, &function1, &function2,
+      &instance1, &instance2);
+
+  problem1_id = coco_strdupf(suite_bbob_problem_id_template, function1, instance1, dimension);
+  problem2_id = coco_strdupf(suite_bbob_problem_id_template, function2, instance2, dimension);
+  *problem_id = coco_strdupf("bbob-biobj_f%02lu_i%02lu_d%02lu", function, instance, dimension);
+  *problem_name = coco_strdupf("%s__%s", problem1_id, problem2_id);
+  *number_of_objectives = 2;
+
+  coco_free_memory(problem1_id);
+  coco_free_memory(problem2_id);
+}
+
+/**
+ * Allocates the bbob problems of the given dimension and instance for all num_bbob_functions functions.
+ */
+static coco_problem_t **suite_biobj_allocate_bbob_problems(const size_t dimension,
+                                                           const size_t instance,
+                                                           const size_t num_bbob_functions,
+                                                           const size_t *bbob_functions) {
+  coco_problem_t **problems;
+  size_t f;
+
+  problems = (coco_problem_t **) coco_allocate_memory(num_bbob_functions * sizeof(coco_problem_t *));
+  for (f = 0; f < num_bbob_functions; f++) {
+    problems[f] = get_bbob_problem(bbob_functions[f], dimension, instance);
+  }
+  return problems;
+}
+
+/**
+ * Frees the bbob problems allocated with suite_biobj_allocate_bbob_problems (problems can be NULL).
+ */
+static void suite_biobj_free_bbob_problems(coco_problem_t **problems, const size_t num_bbob_functions) {
+  size_t f;
+
+  if (problems == NULL)
+    return;
+  for (f = 0; f < num_bbob_functions; f++) {
+    coco_problem_free(problems[f]);
+  }
+  coco_free_memory(problems);
+}
+
+/**
+ * Returns 1 if the problem composed of problem1 and problem2 is "appropriate", that is, if its ideal and
+ * nadir points in the objective space and its two extreme optimal points in the decision space are apart
+ * enough, and 0 otherwise. The checks are the same as those that would be made on the stacked problem, but
+ * no stacked problem needs to be allocated.
+ */
+static int suite_biobj_is_appropriate_pair(coco_problem_t *problem1, coco_problem_t *problem2) {
+
+  const double apart_enough = 1e-4;
+  double ideal[2], nadir[2];
+  double norm;
+
+  /* Check whether the ideal and reference points are too close in the objective space */
+  ideal[0] = problem1->best_value[0];
+  ideal[1] = problem2->best_value[0];
+  coco_evaluate_function(problem1, problem2->best_parameter, &nadir[0]);
+  coco_evaluate_function(problem2, problem1->best_parameter, &nadir[1]);
+  norm = mo_get_norm(ideal, nadir, 2);
+  if (norm < 1e-1) { /* TODO How to set this value in a sensible manner? */
+    coco_debug(
+        "suite_biobj_get_new_instance(): The ideal and nadir points of %s__%s are too close in the objective space",
+        problem1->problem_id, problem2->problem_id);
+    coco_debug("norm = %e, ideal = %e\t%e, nadir = %e\t%e", norm, ideal[0], ideal[1], nadir[0], nadir[1]);
+    return 0;
+  }
+
+  /* Check whether the extreme optimal points are too close in the decision space */
+  norm = mo_get_norm(problem1->best_parameter, problem2->best_parameter, problem1->number_of_variables);
+  if (norm < apart_enough) {
+    coco_debug(
+        "suite_biobj_get_new_instance(): The extremal optimal points of %s__%s are too close in the decision space",
+        problem1->problem_id, problem2->problem_id);
+    coco_debug("norm = %e", norm);
+    return 0;
+  }
+
+  return 1;
+}
+
 static size_t suite_biobj_get_new_instance(coco_suite_t *suite,
                                            const size_t instance,
                                            const size_t instance1,
@@ -170,17 +307,22 @@ static size_t suite_biobj_get_new_instance(coco_suite_t *suite,
   size_t instance2 = 0;
   size_t num_tries = 0;
   const size_t max_tries = 1000;
-  const double apart_enough = 1e-4;
   int appropriate_instance_found = 0, break_search, warning_produced = 0;
-  coco_problem_t *problem1, *problem2, *problem = NULL;
+  coco_problem_t ***problems1, **problems2;
   size_t d, f1, f2, i;
-  size_t function1, function2, dimension;
-  double norm;
+  size_t dimension;
 
   suite_biobj_t *data;
   assert(suite->data);
   data = (suite_biobj_t *) suite->data;
 
+  /* The problems of instance1 are the same in all tries, so they are allocated (once per dimension) only
+   * when first needed and kept until the search is over */
+  problems1 = (coco_problem_t ***) coco_allocate_memory(suite->number_of_dimensions * sizeof(coco_problem_t **));
+  for (d = 0; d < suite->number_of_dimensions; d++) {
+    problems1[d] = NULL;
+  }
+
   while ((!appropriate_instance_found) && (num_tries < max_tries)) {
     num_tries++;
     instance2 = instance1 + num_tries;
@@ -188,56 +330,31 @@ static size_t suite_biobj_get_new_instance(coco_suite_t *suite,
 
     /* An instance is "appropriate" if the ideal and nadir points in the objective space and the two
      * extreme optimal points in the decisions space are apart enough for all problems (all dimensions
-     * and function combinations); therefore iterate over all dimensions and function combinations  */
-    for (f1 = 0; (f1 < num_bbob_functions) && !break_search; f1++) {
-      function1 = bbob_functions[f1];
-      for (f2 = f1; (f2 < num_bbob_functions) && !break_search; f2++) {
-        function2 = bbob_functions[f2];
-        for (d = 0; (d < suite->number_of_dimensions) && !break_search; d++) {
-          dimension = suite->dimensions[d];
-
-          if (dimension == 0) {
-            if (!warning_produced)
-              coco_warning("suite_biobj_get_new_instance(): remove filtering of dimensions to get generally acceptable instances!");
-            warning_produced = 1;
-            continue;
-          }
-
-          problem1 = get_bbob_problem(function1, dimension, instance1);
-          problem2 = get_bbob_problem(function2, dimension, instance2);
-          if (problem) {
-            coco_stacked_problem_free(problem);
-            problem = NULL;
-          }
-          problem = coco_stacked_problem_allocate(problem1, problem2);
-
-          /* Check whether the ideal and reference points are too close in the objective space */
-          norm = mo_get_norm(problem->best_value, problem->nadir_value, 2);
-          if (norm < 1e-1) { /* TODO How to set this value in a sensible manner? */
-            coco_debug(
-                "suite_biobj_get_new_instance(): The ideal and nadir points of %s are too close in the objective space",
-                problem->problem_id);
-            coco_debug("norm = %e, ideal = %e\t%e, nadir = %e\t%e", norm, problem->best_value[0],
-                problem->best_value[1], problem->nadir_value[0], problem->nadir_value[1]);
-            break_search = 1;
-          }
-
-          /* Check whether the extreme optimal points are too close in the decision space */
-          norm = mo_get_norm(problem1->best_parameter, problem2->best_parameter, problem->number_of_variables);
-          if (norm < apart_enough) {
-            coco_debug(
-                "suite_biobj_get_new_instance(): The extremal optimal points of %s are too close in the decision space",
-                problem->problem_id);
-            coco_debug("norm = %e", norm);
+     * and function combinations); therefore iterate over all dimensions and function combinations.
+     * Each bbob problem is allocated only once per dimension and not once for every combination. */
+    for (d = 0; (d < suite->number_of_dimensions) && !break_search; d++) {
+      dimension = suite->dimensions[d];
+
+      if (dimension == 0) {
+        if (!warning_produced)
+          coco_warning("suite_biobj_get_new_instance(): remove filtering of dimensions to get generally acceptable instances!");
+        warning_produced = 1;
+        continue;
+      }
+
+      if (problems1[d] == NULL)
+        problems1[d] = suite_biobj_allocate_bbob_problems(dimension, instance1, num_bbob_functions,
+            bbob_functions);
+      problems2 = suite_biobj_allocate_bbob_problems(dimension, instance2, num_bbob_functions, bbob_functions);
+
+      for (f1 = 0; (f1 < num_bbob_functions) && !break_search; f1++) {
+        for (f2 = f1; (f2 < num_bbob_functions) && !break_search; f2++) {
+          if (!suite_biobj_is_appropriate_pair(problems1[d][f1], problems2[f2]))
             break_search = 1;
-          }
         }
       }
-    }
-    /* Clean up */
-    if (problem) {
-      coco_stacked_problem_free(problem);
-      problem = NULL;
+
+      suite_biobj_free_bbob_problems(problems2, num_bbob_functions);
     }
 
     if (break_search) {
@@ -261,8 +378,14 @@ static size_t suite_biobj_get_new_instance(coco_suite_t *suite,
     }
   }
 
+  /* Clean up */
+  for (d = 0; d < suite->number_of_dimensions; d++) {
+    suite_biobj_free_bbob_problems(problems1[d], num_bbob_functions);
+  }
+  coco_free_memory(problems1);
+
   if (!appropriate_instance_found) {
-    coco_error("suite_biobj_get_new_instance(): Could not find suitable instance %lu in $lu tries", instance, num_tries);
+    coco_error("suite_biobj_get_new_instance(): Could not find suitable instance %lu in %lu tries", instance, num_tries);
     return 0; /* Never reached */
   }
 
@@ -292,28 +415,29 @@ static void suite_biobj_free(void *stuff) {
   data->new_instances = NULL;
 }
 
+/**
+ * Compares the key with the key of the given table item (used for searching the tables of best values).
+ */
+static int suite_biobj_best_value_compare(const void *key, const void *item) {
+  return strcmp((const char *) key, ((const suite_biobj_best_value_t *) item)->key);
+}
+
 /**
  * Returns the best known value for indicator_name matching the given key if the key is found, and raises an
  * error otherwise.  */
 static double suite_biobj_get_best_value(const char *indicator_name, const char *key) {
 
-  size_t i, count;
-  double best_value = 0;
-  char *curr_key;
+  const suite_biobj_best_value_t *item;
+  size_t count;
 
   if (strcmp(indicator_name, "hyp") == 0) {
 
-    curr_key = coco_allocate_memory(COCO_PATH_MAX * sizeof(char));
-    count = sizeof(suite_biobj_best_values_hyp) / sizeof(char *);
-    for (i = 0; i < count; i++) {
-      sscanf(suite_biobj_best_values_hyp[i], "%s %lf", curr_key, &best_value);
-      if (strcmp(curr_key, key) == 0) {
-        coco_free_memory(curr_key);
-        return best_value;
-      }
-    }
+    count = sizeof(suite_biobj_best_values_hyp) / sizeof(suite_biobj_best_values_hyp[0]);
+    item = (const suite_biobj_best_value_t *) bsearch(key, suite_biobj_best_values_hyp, count,
+        sizeof(suite_biobj_best_values_hyp[0]), suite_biobj_best_value_compare);
+    if (item != NULL)
+      return item->value;
 
-    coco_free_memory(curr_key);
     coco_warning("suite_biobj_get_best_value(): best value of %s could not be found; set to 1.0", key);
     return 1.0;
 
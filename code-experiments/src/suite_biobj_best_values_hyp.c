@@ -1,3302 +0,0 @@
-static const char *suite_biobj_best_values_hyp[] = {
-  "bbob-biobj_f01_i01_d02 0.833332381880295",
-  "bbob-biobj_f02_i01_d02 0.995822556045719",
-  "bbob-biobj_f03_i01_d02 0.811763839749560",
-  "bbob-biobj_f04_i01_d02 0.965338541757230",
-  "bbob-biobj_f05_i01_d02 0.754127772584089",
-  "bbob-biobj_f06_i01_d02 0.667254078045086",
-  "bbob-biobj_f07_i01_d02 0.936972394688744",
-  "bbob-biobj_f08_i01_d02 0.903849266969214",
-  "bbob-biobj_f09_i01_d02 0.925657479493310",
-  "bbob-biobj_f10_i01_d02 0.922987538734603",
-  "bbob-biobj_f11_i01_d02 0.823972801661334",
-  "bbob-biobj_f12_i01_d02 0.981018923089192",
-  "bbob-biobj_f13_i01_d02 0.944887984976649",
-  "bbob-biobj_f14_i01_d02 0.912471738968398",
-  "bbob-biobj_f15_i01_d02 0.978306336956131",
-  "bbob-biobj_f16_i01_d02 0.981136699536161",
-  "bbob-biobj_f17_i01_d02 0.979958695543183",
-  "bbob-biobj_f18_i01_d02 0.969204862736960",
-  "bbob-biobj_f19_i01_d02 0.865811586473494",
-  "bbob-biobj_f20_i01_d02 0.995717988090093",
-  "bbob-biobj_f21_i01_d02 0.999736610851221",
-  "bbob-biobj_f22_i01_d02 0.700915089341030",
-  "bbob-biobj_f23_i01_d02 0.992533949247653",
-  "bbob-biobj_f24_i01_d02 0.886262886736722",
-  "bbob-biobj_f25_i01_d02 0.890542921944345",
-  "bbob-biobj_f26_i01_d02 0.978921933860648",
-  "bbob-biobj_f27_i01_d02 0.903502204113926",
-  "bbob-biobj_f28_i01_d02 0.977401734681390",
-  "bbob-biobj_f29_i01_d02 0.972456361472672",
-  "bbob-biobj_f30_i01_d02 0.976212389263759",
-  "bbob-biobj_f31_i01_d02 0.955984084027268",
-  "bbob-biobj_f32_i01_d02 0.920330760313077",
-  "bbob-biobj_f33_i01_d02 0.997888832413846",
-  "bbob-biobj_f34_i01_d02 0.929758803965651",
-  "bbob-biobj_f35_i01_d02 0.928163014468774",
-  "bbob-biobj_f36_i01_d02 0.945913606633571",
-  "bbob-biobj_f37_i01_d02 0.887325683129611",
-  "bbob-biobj_f38_i01_d02 0.877156589643738",
-  "bbob-biobj_f39_i01_d02 0.904223376562383",
-  "bbob-biobj_f40_i01_d02 0.800161239789517",
-  "bbob-biobj_f41_i01_d02 0.822032599539178",
-  "bbob-biobj_f42_i01_d02 0.948464760953435",
-  "bbob-biobj_f43_i01_d02 0.806235779393273",
-  "bbob-biobj_f44_i01_d02 0.990000539848556",
-  "bbob-biobj_f45_i01_d02 0.951720470099642",
-  "bbob-biobj_f46_i01_d02 0.761065142390955",
-  "bbob-biobj_f47_i01_d02 0.712271512083957",
-  "bbob-biobj_f48_i01_d02 0.848025761787477",
-  "bbob-biobj_f49_i01_d02 0.926653565305302",
-  "bbob-biobj_f50_i01_d02 0.908152950514152",
-  "bbob-biobj_f51_i01_d02 0.940860536161742",
-  "bbob-biobj_f52_i01_d02 0.947011510956342",
-  "bbob-biobj_f53_i01_d02 0.997875678381243",
-  "bbob-biobj_f54_i01_d02 0.943563862014704",
-  "bbob-biobj_f55_i01_d02 0.994911895481398",
-  "bbob-biobj_f01_i02_d02 0.833332702706814",
-  "bbob-biobj_f02_i02_d02 0.917892764681189",
-  "bbob-biobj_f03_i02_d02 0.870718411906487",
-  "bbob-biobj_f04_i02_d02 0.970390620254440",
-  "bbob-biobj_f05_i02_d02 0.954989278665609",
-  "bbob-biobj_f06_i02_d02 0.901470226591165",
-  "bbob-biobj_f07_i02_d02 0.906340754327532",
-  "bbob-biobj_f08_i02_d02 0.784765068625940",
-  "bbob-biobj_f09_i02_d02 0.977793675518883",
-  "bbob-biobj_f10_i02_d02 0.889244296995994",
-  "bbob-biobj_f11_i02_d02 0.834474630498268",
-  "bbob-biobj_f12_i02_d02 0.999911393192066",
-  "bbob-biobj_f13_i02_d02 0.999759633691082",
-  "bbob-biobj_f14_i02_d02 0.997754487039552",
-  "bbob-biobj_f15_i02_d02 0.941436752524279",
-  "bbob-biobj_f16_i02_d02 0.965606133139248",
-  "bbob-biobj_f17_i02_d02 0.942990084985095",
-  "bbob-biobj_f18_i02_d02 0.953409527167994",
-  "bbob-biobj_f19_i02_d02 0.920899374306612",
-  "bbob-biobj_f20_i02_d02 0.910959902066631",
-  "bbob-biobj_f21_i02_d02 0.985471374619735",
-  "bbob-biobj_f22_i02_d02 0.999055909737319",
-  "bbob-biobj_f23_i02_d02 0.996445249237841",
-  "bbob-biobj_f24_i02_d02 0.988139628791233",
-  "bbob-biobj_f25_i02_d02 0.944370780971908",
-  "bbob-biobj_f26_i02_d02 0.994494596966963",
-  "bbob-biobj_f27_i02_d02 0.951958965619902",
-  "bbob-biobj_f28_i02_d02 0.998930188872317",
-  "bbob-biobj_f29_i02_d02 0.999165519331051",
-  "bbob-biobj_f30_i02_d02 0.996222765792260",
-  "bbob-biobj_f31_i02_d02 0.963697231127155",
-  "bbob-biobj_f32_i02_d02 0.675234304274444",
-  "bbob-biobj_f33_i02_d02 0.997492967539081",
-  "bbob-biobj_f34_i02_d02 0.996825921713365",
-  "bbob-biobj_f35_i02_d02 0.502441558908274",
-  "bbob-biobj_f36_i02_d02 0.982338855577553",
-  "bbob-biobj_f37_i02_d02 0.737269275089530",
-  "bbob-biobj_f38_i02_d02 0.906613078300759",
-  "bbob-biobj_f39_i02_d02 0.983637059586349",
-  "bbob-biobj_f40_i02_d02 0.814422881685882",
-  "bbob-biobj_f41_i02_d02 0.914731705960483",
-  "bbob-biobj_f42_i02_d02 0.938889923994633",
-  "bbob-biobj_f43_i02_d02 0.928981096739791",
-  "bbob-biobj_f44_i02_d02 0.996682440185835",
-  "bbob-biobj_f45_i02_d02 0.797327487716362",
-  "bbob-biobj_f46_i02_d02 0.848797232382807",
-  "bbob-biobj_f47_i02_d02 0.939177828232952",
-  "bbob-biobj_f48_i02_d02 0.994793668269219",
-  "bbob-biobj_f49_i02_d02 0.961467340366137",
-  "bbob-biobj_f50_i02_d02 0.951055944905910",
-  "bbob-biobj_f51_i02_d02 0.909955737710893",
-  "bbob-biobj_f52_i02_d02 0.786879893098394",
-  "bbob-biobj_f53_i02_d02 0.975730723054336",
-  "bbob-biobj_f54_i02_d02 0.929274289867332",
-  "bbob-biobj_f55_i02_d02 0.936711237564454",
-  "bbob-biobj_f01_i03_d02 0.833332308645262",
-  "bbob-biobj_f02_i03_d02 0.990979154749639",
-  "bbob-biobj_f03_i03_d02 0.843026921526248",
-  "bbob-biobj_f04_i03_d02 0.971131575360400",
-  "bbob-biobj_f05_i03_d02 0.684482240828589",
-  "bbob-biobj_f06_i03_d02 0.884299586864210",
-  "bbob-biobj_f07_i03_d02 0.886134176223403",
-  "bbob-biobj_f08_i03_d02 0.748604736034215",
-  "bbob-biobj_f09_i03_d02 0.968705721628269",
-  "bbob-biobj_f10_i03_d02 0.921417910401632",
-  "bbob-biobj_f11_i03_d02 0.817436851656416",
-  "bbob-biobj_f12_i03_d02 0.999915738925275",
-  "bbob-biobj_f13_i03_d02 0.999951135495008",
-  "bbob-biobj_f14_i03_d02 0.966432413236932",
-  "bbob-biobj_f15_i03_d02 0.998672050309677",
-  "bbob-biobj_f16_i03_d02 0.959401148905943",
-  "bbob-biobj_f17_i03_d02 0.941726836105394",
-  "bbob-biobj_f18_i03_d02 0.999403466523437",
-  "bbob-biobj_f19_i03_d02 0.904545238945873",
-  "bbob-biobj_f20_i03_d02 0.985777662447601",
-  "bbob-biobj_f21_i03_d02 0.973889754548564",
-  "bbob-biobj_f22_i03_d02 0.678522876973610",
-  "bbob-biobj_f23_i03_d02 0.923156435473200",
-  "bbob-biobj_f24_i03_d02 0.952811571802282",
-  "bbob-biobj_f25_i03_d02 0.978559979410386",
-  "bbob-biobj_f26_i03_d02 0.999888275904127",
-  "bbob-biobj_f27_i03_d02 0.957759309603809",
-  "bbob-biobj_f28_i03_d02 0.999666277471747",
-  "bbob-biobj_f29_i03_d02 0.993280308173123",
-  "bbob-biobj_f30_i03_d02 0.941596011487025",
-  "bbob-biobj_f31_i03_d02 0.981722020457142",
-  "bbob-biobj_f32_i03_d02 0.921767706667579",
-  "bbob-biobj_f33_i03_d02 0.999823325123336",
-  "bbob-biobj_f34_i03_d02 0.990964370887801",
-  "bbob-biobj_f35_i03_d02 0.875494760634630",
-  "bbob-biobj_f36_i03_d02 0.808774314903373",
-  "bbob-biobj_f37_i03_d02 0.802436053394483",
-  "bbob-biobj_f38_i03_d02 0.700820133315453",
-  "bbob-biobj_f39_i03_d02 0.979200981846001",
-  "bbob-biobj_f40_i03_d02 0.841353965905939",
-  "bbob-biobj_f41_i03_d02 0.853587361521924",
-  "bbob-biobj_f42_i03_d02 0.813087181156719",
-  "bbob-biobj_f43_i03_d02 0.703325481833674",
-  "bbob-biobj_f44_i03_d02 0.982516592468149",
-  "bbob-biobj_f45_i03_d02 0.729949985493878",
-  "bbob-biobj_f46_i03_d02 0.924046813817190",
-  "bbob-biobj_f47_i03_d02 0.739793088506663",
-  "bbob-biobj_f48_i03_d02 0.974655292653474",
-  "bbob-biobj_f49_i03_d02 0.848123276637367",
-  "bbob-biobj_f50_i03_d02 0.921885271065775",
-  "bbob-biobj_f51_i03_d02 0.941593174399642",
-  "bbob-biobj_f52_i03_d02 0.931104781087782",
-  "bbob-biobj_f53_i03_d02 0.975730722493676",
-  "bbob-biobj_f54_i03_d02 0.991716129205650",
-  "bbob-biobj_f55_i03_d02 0.979743447263764",
-  "bbob-biobj_f01_i04_d02 0.833332466832419",
-  "bbob-biobj_f02_i04_d02 0.956280219817568",
-  "bbob-biobj_f03_i04_d02 0.816336889930302",
-  "bbob-biobj_f04_i04_d02 0.977012410891707",
-  "bbob-biobj_f05_i04_d02 0.878628972558252",
-  "bbob-biobj_f06_i04_d02 0.945804093632039",
-  "bbob-biobj_f07_i04_d02 0.870759571247920",
-  "bbob-biobj_f08_i04_d02 0.743267143878666",
-  "bbob-biobj_f09_i04_d02 0.948342390905787",
-  "bbob-biobj_f10_i04_d02 0.942089275587398",
-  "bbob-biobj_f11_i04_d02 0.883087513516298",
-  "bbob-biobj_f12_i04_d02 0.891857684789194",
-  "bbob-biobj_f13_i04_d02 0.999963191340162",
-  "bbob-biobj_f14_i04_d02 0.982899445074872",
-  "bbob-biobj_f15_i04_d02 0.825078940847438",
-  "bbob-biobj_f16_i04_d02 0.995345563275184",
-  "bbob-biobj_f17_i04_d02 0.766767349502570",
-  "bbob-biobj_f18_i04_d02 0.990014933357924",
-  "bbob-biobj_f19_i04_d02 0.999884820902939",
-  "bbob-biobj_f20_i04_d02 0.890179810267597",
-  "bbob-biobj_f21_i04_d02 0.999788748780840",
-  "bbob-biobj_f22_i04_d02 0.846364918537386",
-  "bbob-biobj_f23_i04_d02 0.963999189380296",
-  "bbob-biobj_f24_i04_d02 0.953732210965317",
-  "bbob-biobj_f25_i04_d02 0.827380282336984",
-  "bbob-biobj_f26_i04_d02 0.929918973100548",
-  "bbob-biobj_f27_i04_d02 0.960857685351265",
-  "bbob-biobj_f28_i04_d02 0.984721335437252",
-  "bbob-biobj_f29_i04_d02 0.966908552820882",
-  "bbob-biobj_f30_i04_d02 0.983029995579055",
-  "bbob-biobj_f31_i04_d02 0.952958503821472",
-  "bbob-biobj_f32_i04_d02 0.944003922120117",
-  "bbob-biobj_f33_i04_d02 0.959892839230054",
-  "bbob-biobj_f34_i04_d02 0.967251356146663",
-  "bbob-biobj_f35_i04_d02 0.818249295839983",
-  "bbob-biobj_f36_i04_d02 0.913201795196784",
-  "bbob-biobj_f37_i04_d02 0.827629878786050",
-  "bbob-biobj_f38_i04_d02 0.629303680384380",
-  "bbob-biobj_f39_i04_d02 0.978307286629431",
-  "bbob-biobj_f40_i04_d02 0.545131536551849",
-  "bbob-biobj_f41_i04_d02 0.512372984066831",
-  "bbob-biobj_f42_i04_d02 0.882605825029119",
-  "bbob-biobj_f43_i04_d02 0.955511245826293",
-  "bbob-biobj_f44_i04_d02 0.975372264066639",
-  "bbob-biobj_f45_i04_d02 0.962996534388227",
-  "bbob-biobj_f46_i04_d02 0.934266785105635",
-  "bbob-biobj_f47_i04_d02 0.779551089811421",
-  "bbob-biobj_f48_i04_d02 0.991892533182284",
-  "bbob-biobj_f49_i04_d02 0.934365738264289",
-  "bbob-biobj_f50_i04_d02 0.908169127554731",
-  "bbob-biobj_f51_i04_d02 0.986038923713432",
-  "bbob-biobj_f52_i04_d02 0.719116574845850",
-  "bbob-biobj_f53_i04_d02 0.997875679038962",
-  "bbob-biobj_f54_i04_d02 0.984075278318847",
-  "bbob-biobj_f55_i04_d02 0.931559626376912",
-  "bbob-biobj_f01_i05_d02 0.833332473672737",
-  "bbob-biobj_f02_i05_d02 0.960749285196603",
-  "bbob-biobj_f03_i05_d02 0.854018790706943",
-  "bbob-biobj_f04_i05_d02 0.924874180331373",
-  "bbob-biobj_f05_i05_d02 0.926274334896450",
-  "bbob-biobj_f06_i05_d02 0.942603142355389",
-  "bbob-biobj_f07_i05_d02 0.911523131921032",
-  "bbob-biobj_f08_i05_d02 0.865136507485212",
-  "bbob-biobj_f09_i05_d02 0.860780267730441",
-  "bbob-biobj_f10_i05_d02 0.940003461277463",
-  "bbob-biobj_f11_i05_d02 0.849343550099736",
-  "bbob-biobj_f12_i05_d02 0.908759812361773",
-  "bbob-biobj_f13_i05_d02 0.999818303887064",
-  "bbob-biobj_f14_i05_d02 0.987027886030896",
-  "bbob-biobj_f15_i05_d02 0.988337532350678",
-  "bbob-biobj_f16_i05_d02 0.999043228362523",
-  "bbob-biobj_f17_i05_d02 0.940686723549207",
-  "bbob-biobj_f18_i05_d02 0.999935347950664",
-  "bbob-biobj_f19_i05_d02 0.997258703820410",
-  "bbob-biobj_f20_i05_d02 0.980549181813676",
-  "bbob-biobj_f21_i05_d02 0.890724777349068",
-  "bbob-biobj_f22_i05_d02 0.856038284580849",
-  "bbob-biobj_f23_i05_d02 0.738908820827753",
-  "bbob-biobj_f24_i05_d02 0.823876901281695",
-  "bbob-biobj_f25_i05_d02 0.903625066204998",
-  "bbob-biobj_f26_i05_d02 0.732358949009342",
-  "bbob-biobj_f27_i05_d02 0.930274708362895",
-  "bbob-biobj_f28_i05_d02 0.999901255187674",
-  "bbob-biobj_f29_i05_d02 0.988529001485094",
-  "bbob-biobj_f30_i05_d02 0.995608407690678",
-  "bbob-biobj_f31_i05_d02 0.989988681723107",
-  "bbob-biobj_f32_i05_d02 0.844964257151837",
-  "bbob-biobj_f33_i05_d02 0.966110375002355",
-  "bbob-biobj_f34_i05_d02 0.956107363130014",
-  "bbob-biobj_f35_i05_d02 0.572775132157389",
-  "bbob-biobj_f36_i05_d02 0.771461371110819",
-  "bbob-biobj_f37_i05_d02 0.833850863453652",
-  "bbob-biobj_f38_i05_d02 0.802625408060758",
-  "bbob-biobj_f39_i05_d02 0.986275105475074",
-  "bbob-biobj_f40_i05_d02 0.710069754586310",
-  "bbob-biobj_f41_i05_d02 0.821557876863414",
-  "bbob-biobj_f42_i05_d02 0.980207488827826",
-  "bbob-biobj_f43_i05_d02 0.527808619658566",
-  "bbob-biobj_f44_i05_d02 0.992233423072499",
-  "bbob-biobj_f45_i05_d02 0.924715061037750",
-  "bbob-biobj_f46_i05_d02 0.925925504479710",
-  "bbob-biobj_f47_i05_d02 0.944459621622800",
-  "bbob-biobj_f48_i05_d02 0.988654636530694",
-  "bbob-biobj_f49_i05_d02 0.928529326530270",
-  "bbob-biobj_f50_i05_d02 0.808869729563639",
-  "bbob-biobj_f51_i05_d02 0.971128837321376",
-  "bbob-biobj_f52_i05_d02 0.781598659109070",
-  "bbob-biobj_f53_i05_d02 0.706100990975307",
-  "bbob-biobj_f54_i05_d02 0.977343736135633",
-  "bbob-biobj_f55_i05_d02 0.890941429551648",
-  "bbob-biobj_f01_i01_d03 0.833330625661050",
-  "bbob-biobj_f02_i01_d03 0.879310044577270",
-  "bbob-biobj_f03_i01_d03 0.974987097859968",
-  "bbob-biobj_f04_i01_d03 0.968687164946734",
-  "bbob-biobj_f05_i01_d03 0.728470633560049",
-  "bbob-biobj_f06_i01_d03 0.954291127409624",
-  "bbob-biobj_f07_i01_d03 0.937571153021485",
-  "bbob-biobj_f08_i01_d03 0.911798594849045",
-  "bbob-biobj_f09_i01_d03 0.904194957863023",
-  "bbob-biobj_f10_i01_d03 0.927567677878328",
-  "bbob-biobj_f11_i01_d03 0.878620361843933",
-  "bbob-biobj_f12_i01_d03 0.996585174463940",
-  "bbob-biobj_f13_i01_d03 0.999495770222436",
-  "bbob-biobj_f14_i01_d03 0.832549445682511",
-  "bbob-biobj_f15_i01_d03 0.928761731458004",
-  "bbob-biobj_f16_i01_d03 0.999116510660995",
-  "bbob-biobj_f17_i01_d03 0.899961432050402",
-  "bbob-biobj_f18_i01_d03 0.998688618941126",
-  "bbob-biobj_f19_i01_d03 0.973016856746679",
-  "bbob-biobj_f20_i01_d03 0.813226512698083",
-  "bbob-biobj_f21_i01_d03 0.911539415650202",
-  "bbob-biobj_f22_i01_d03 0.694480232049214",
-  "bbob-biobj_f23_i01_d03 0.872234566808190",
-  "bbob-biobj_f24_i01_d03 0.987113954053245",
-  "bbob-biobj_f25_i01_d03 0.996715641165654",
-  "bbob-biobj_f26_i01_d03 0.999860002469473",
-  "bbob-biobj_f27_i01_d03 0.987126435674334",
-  "bbob-biobj_f28_i01_d03 0.998639588439490",
-  "bbob-biobj_f29_i01_d03 0.866365245335982",
-  "bbob-biobj_f30_i01_d03 0.795597023991393",
-  "bbob-biobj_f31_i01_d03 0.988038407614155",
-  "bbob-biobj_f32_i01_d03 0.915330390200906",
-  "bbob-biobj_f33_i01_d03 0.997624560661621",
-  "bbob-biobj_f34_i01_d03 0.914923757473936",
-  "bbob-biobj_f35_i01_d03 0.534050189516324",
-  "bbob-biobj_f36_i01_d03 0.700104510378408",
-  "bbob-biobj_f37_i01_d03 0.807646369904650",
-  "bbob-biobj_f38_i01_d03 0.866616427546108",
-  "bbob-biobj_f39_i01_d03 0.853571429088739",
-  "bbob-biobj_f40_i01_d03 0.914339495288001",
-  "bbob-biobj_f41_i01_d03 0.885735346283810",
-  "bbob-biobj_f42_i01_d03 0.964392943937267",
-  "bbob-biobj_f43_i01_d03 0.961022421747782",
-  "bbob-biobj_f44_i01_d03 0.989550386270271",
-  "bbob-biobj_f45_i01_d03 0.828185757495603",
-  "bbob-biobj_f46_i01_d03 0.903454081049543",
-  "bbob-biobj_f47_i01_d03 0.868929027146708",
-  "bbob-biobj_f48_i01_d03 0.973369990523646",
-  "bbob-biobj_f49_i01_d03 0.957627069123927",
-  "bbob-biobj_f50_i01_d03 0.969141599163299",
-  "bbob-biobj_f51_i01_d03 0.868050177774589",
-  "bbob-biobj_f52_i01_d03 0.887645413730364",
-  "bbob-biobj_f53_i01_d03 0.999784713871949",
-  "bbob-biobj_f54_i01_d03 0.975179043634054",
-  "bbob-biobj_f55_i01_d03 0.969815953388893",
-  "bbob-biobj_f01_i02_d03 0.833330862027532",
-  "bbob-biobj_f02_i02_d03 0.981135795583470",
-  "bbob-biobj_f03_i02_d03 0.845123943144692",
-  "bbob-biobj_f04_i02_d03 0.955013920344669",
-  "bbob-biobj_f05_i02_d03 0.688039742765706",
-  "bbob-biobj_f06_i02_d03 0.863890745758219",
-  "bbob-biobj_f07_i02_d03 0.923759709009026",
-  "bbob-biobj_f08_i02_d03 0.881999475736607",
-  "bbob-biobj_f09_i02_d03 0.992207196354342",
-  "bbob-biobj_f10_i02_d03 0.883785944698432",
-  "bbob-biobj_f11_i02_d03 0.833333045070521",
-  "bbob-biobj_f12_i02_d03 0.999935181038573",
-  "bbob-biobj_f13_i02_d03 0.998700044654841",
-  "bbob-biobj_f14_i02_d03 0.996012898774857",
-  "bbob-biobj_f15_i02_d03 0.954421200561461",
-  "bbob-biobj_f16_i02_d03 0.934170171805547",
-  "bbob-biobj_f17_i02_d03 0.931413069408532",
-  "bbob-biobj_f18_i02_d03 0.993777465831754",
-  "bbob-biobj_f19_i02_d03 0.986110860218861",
-  "bbob-biobj_f20_i02_d03 0.974016935549722",
-  "bbob-biobj_f21_i02_d03 0.980783963376774",
-  "bbob-biobj_f22_i02_d03 0.742598839023062",
-  "bbob-biobj_f23_i02_d03 0.862093818070480",
-  "bbob-biobj_f24_i02_d03 0.906306212968833",
-  "bbob-biobj_f25_i02_d03 0.961641429125833",
-  "bbob-biobj_f26_i02_d03 0.988829159179452",
-  "bbob-biobj_f27_i02_d03 0.953825801036066",
-  "bbob-biobj_f28_i02_d03 0.993519338993658",
-  "bbob-biobj_f29_i02_d03 0.939190481177387",
-  "bbob-biobj_f30_i02_d03 0.931860098796110",
-  "bbob-biobj_f31_i02_d03 0.923773258244386",
-  "bbob-biobj_f32_i02_d03 0.922150697719170",
-  "bbob-biobj_f33_i02_d03 0.998822645972432",
-  "bbob-biobj_f34_i02_d03 0.914729556179324",
-  "bbob-biobj_f35_i02_d03 0.788702400676018",
-  "bbob-biobj_f36_i02_d03 0.737149966770445",
-  "bbob-biobj_f37_i02_d03 0.835003569058186",
-  "bbob-biobj_f38_i02_d03 0.793052225590621",
-  "bbob-biobj_f39_i02_d03 0.963320808065134",
-  "bbob-biobj_f40_i02_d03 0.684383656263477",
-  "bbob-biobj_f41_i02_d03 0.923050849072400",
-  "bbob-biobj_f42_i02_d03 0.896772979402947",
-  "bbob-biobj_f43_i02_d03 0.900486501147008",
-  "bbob-biobj_f44_i02_d03 0.744914585896674",
-  "bbob-biobj_f45_i02_d03 0.976528182782067",
-  "bbob-biobj_f46_i02_d03 0.962406648963739",
-  "bbob-biobj_f47_i02_d03 0.954698871412203",
-  "bbob-biobj_f48_i02_d03 0.870171996025677",
-  "bbob-biobj_f49_i02_d03 0.946678900765912",
-  "bbob-biobj_f50_i02_d03 0.967313830200992",
-  "bbob-biobj_f51_i02_d03 0.990170952029660",
-  "bbob-biobj_f52_i02_d03 0.975826617684440",
-  "bbob-biobj_f53_i02_d03 0.981828773918581",
-  "bbob-biobj_f54_i02_d03 0.971505406466657",
-  "bbob-biobj_f55_i02_d03 0.932686521297934",
-  "bbob-biobj_f01_i03_d03 0.833330453018851",
-  "bbob-biobj_f02_i03_d03 0.952600924477390",
-  "bbob-biobj_f03_i03_d03 0.860124995330607",
-  "bbob-biobj_f04_i03_d03 0.910479626757205",
-  "bbob-biobj_f05_i03_d03 0.802883672795523",
-  "bbob-biobj_f06_i03_d03 0.833636257813634",
-  "bbob-biobj_f07_i03_d03 0.921397877927388",
-  "bbob-biobj_f08_i03_d03 0.850945391164016",
-  "bbob-biobj_f09_i03_d03 0.986085287643183",
-  "bbob-biobj_f10_i03_d03 0.901132994991743",
-  "bbob-biobj_f11_i03_d03 0.827369814756058",
-  "bbob-biobj_f12_i03_d03 0.999886884014938",
-  "bbob-biobj_f13_i03_d03 0.962145745196926",
-  "bbob-biobj_f14_i03_d03 0.983419659230451",
-  "bbob-biobj_f15_i03_d03 0.994036317066106",
-  "bbob-biobj_f16_i03_d03 0.943744207185075",
-  "bbob-biobj_f17_i03_d03 0.956408713997142",
-  "bbob-biobj_f18_i03_d03 0.999304353336504",
-  "bbob-biobj_f19_i03_d03 0.957586878136096",
-  "bbob-biobj_f20_i03_d03 0.999442770417740",
-  "bbob-biobj_f21_i03_d03 0.968953448582413",
-  "bbob-biobj_f22_i03_d03 0.951233969408275",
-  "bbob-biobj_f23_i03_d03 0.880341977880396",
-  "bbob-biobj_f24_i03_d03 0.855065188105058",
-  "bbob-biobj_f25_i03_d03 0.957694706824249",
-  "bbob-biobj_f26_i03_d03 0.996485237016538",
-  "bbob-biobj_f27_i03_d03 0.964059233915336",
-  "bbob-biobj_f28_i03_d03 0.977206316465709",
-  "bbob-biobj_f29_i03_d03 0.980540427492229",
-  "bbob-biobj_f30_i03_d03 0.913952638696125",
-  "bbob-biobj_f31_i03_d03 0.984775968884612",
-  "bbob-biobj_f32_i03_d03 0.968195228796908",
-  "bbob-biobj_f33_i03_d03 0.935833285400742",
-  "bbob-biobj_f34_i03_d03 0.962893742806279",
-  "bbob-biobj_f35_i03_d03 0.573977375862587",
-  "bbob-biobj_f36_i03_d03 0.842941404105936",
-  "bbob-biobj_f37_i03_d03 0.779815835700207",
-  "bbob-biobj_f38_i03_d03 0.753306133299475",
-  "bbob-biobj_f39_i03_d03 0.842273286569522",
-  "bbob-biobj_f40_i03_d03 0.938506336709179",
-  "bbob-biobj_f41_i03_d03 0.914426171797939",
-  "bbob-biobj_f42_i03_d03 0.936775797328375",
-  "bbob-biobj_f43_i03_d03 0.738226600212524",
-  "bbob-biobj_f44_i03_d03 0.988829928149258",
-  "bbob-biobj_f45_i03_d03 0.953105203861944",
-  "bbob-biobj_f46_i03_d03 0.899712681623091",
-  "bbob-biobj_f47_i03_d03 0.961190084929696",
-  "bbob-biobj_f48_i03_d03 0.980824613790234",
-  "bbob-biobj_f49_i03_d03 0.942235584921603",
-  "bbob-biobj_f50_i03_d03 0.912990448629017",
-  "bbob-biobj_f51_i03_d03 0.933222623382586",
-  "bbob-biobj_f52_i03_d03 0.944891086251895",
-  "bbob-biobj_f53_i03_d03 0.981828806073236",
-  "bbob-biobj_f54_i03_d03 0.991021288687016",
-  "bbob-biobj_f55_i03_d03 0.960030175857650",
-  "bbob-biobj_f01_i04_d03 0.833330439399264",
-  "bbob-biobj_f02_i04_d03 0.889456786293680",
-  "bbob-biobj_f03_i04_d03 0.965016673576464",
-  "bbob-biobj_f04_i04_d03 0.994699591408625",
-  "bbob-biobj_f05_i04_d03 0.744993050883400",
-  "bbob-biobj_f06_i04_d03 0.921369955953119",
-  "bbob-biobj_f07_i04_d03 0.933979869632330",
-  "bbob-biobj_f08_i04_d03 0.667005234415415",
-  "bbob-biobj_f09_i04_d03 0.940843066710342",
-  "bbob-biobj_f10_i04_d03 0.932701717371814",
-  "bbob-biobj_f11_i04_d03 0.841523496261840",
-  "bbob-biobj_f12_i04_d03 0.934335915105271",
-  "bbob-biobj_f13_i04_d03 0.999978298631445",
-  "bbob-biobj_f14_i04_d03 0.999112786189168",
-  "bbob-biobj_f15_i04_d03 0.975014444393992",
-  "bbob-biobj_f16_i04_d03 0.997825549172083",
-  "bbob-biobj_f17_i04_d03 0.860455977643319",
-  "bbob-biobj_f18_i04_d03 0.998331130655686",
-  "bbob-biobj_f19_i04_d03 0.996380900904860",
-  "bbob-biobj_f20_i04_d03 0.925391239228724",
-  "bbob-biobj_f21_i04_d03 0.954073899348508",
-  "bbob-biobj_f22_i04_d03 0.803804038308167",
-  "bbob-biobj_f23_i04_d03 0.925755832451665",
-  "bbob-biobj_f24_i04_d03 0.931779667951526",
-  "bbob-biobj_f25_i04_d03 0.985238565236331",
-  "bbob-biobj_f26_i04_d03 0.996886142025746",
-  "bbob-biobj_f27_i04_d03 0.952867261004457",
-  "bbob-biobj_f28_i04_d03 0.992073880591932",
-  "bbob-biobj_f29_i04_d03 0.973837872435705",
-  "bbob-biobj_f30_i04_d03 0.977327596327004",
-  "bbob-biobj_f31_i04_d03 0.994016359061764",
-  "bbob-biobj_f32_i04_d03 0.906090113753270",
-  "bbob-biobj_f33_i04_d03 0.989064144200488",
-  "bbob-biobj_f34_i04_d03 0.985996576175221",
-  "bbob-biobj_f35_i04_d03 0.945462624909156",
-  "bbob-biobj_f36_i04_d03 0.970230594996878",
-  "bbob-biobj_f37_i04_d03 0.927470551875993",
-  "bbob-biobj_f38_i04_d03 0.886831959453645",
-  "bbob-biobj_f39_i04_d03 0.956662451361173",
-  "bbob-biobj_f40_i04_d03 0.820235647557919",
-  "bbob-biobj_f41_i04_d03 0.695234921931116",
-  "bbob-biobj_f42_i04_d03 0.956285579577800",
-  "bbob-biobj_f43_i04_d03 0.898274387524015",
-  "bbob-biobj_f44_i04_d03 0.927812988201398",
-  "bbob-biobj_f45_i04_d03 0.954353857297788",
-  "bbob-biobj_f46_i04_d03 0.892786780071618",
-  "bbob-biobj_f47_i04_d03 0.939953605978330",
-  "bbob-biobj_f48_i04_d03 0.977080994868941",
-  "bbob-biobj_f49_i04_d03 0.927009769272452",
-  "bbob-biobj_f50_i04_d03 0.826467322858010",
-  "bbob-biobj_f51_i04_d03 0.947516570775813",
-  "bbob-biobj_f52_i04_d03 0.963896486103395",
-  "bbob-biobj_f53_i04_d03 0.999784713869230",
-  "bbob-biobj_f54_i04_d03 0.985246589920415",
-  "bbob-biobj_f55_i04_d03 0.978790992231310",
-  "bbob-biobj_f01_i05_d03 0.833330487059910",
-  "bbob-biobj_f02_i05_d03 0.924022323888533",
-  "bbob-biobj_f03_i05_d03 0.879234393038782",
-  "bbob-biobj_f04_i05_d03 0.923160620965396",
-  "bbob-biobj_f05_i05_d03 0.701514053994569",
-  "bbob-biobj_f06_i05_d03 0.899135381658772",
-  "bbob-biobj_f07_i05_d03 0.887626238519752",
-  "bbob-biobj_f08_i05_d03 0.893995568811727",
-  "bbob-biobj_f09_i05_d03 0.939788089015001",
-  "bbob-biobj_f10_i05_d03 0.934362569190694",
-  "bbob-biobj_f11_i05_d03 0.775580552202392",
-  "bbob-biobj_f12_i05_d03 0.934982056573171",
-  "bbob-biobj_f13_i05_d03 0.999920715812960",
-  "bbob-biobj_f14_i05_d03 0.986701882411767",
-  "bbob-biobj_f15_i05_d03 0.932552037707103",
-  "bbob-biobj_f16_i05_d03 0.953342473193128",
-  "bbob-biobj_f17_i05_d03 0.855772678108889",
-  "bbob-biobj_f18_i05_d03 0.975931585763652",
-  "bbob-biobj_f19_i05_d03 0.959361637514777",
-  "bbob-biobj_f20_i05_d03 0.963674532282437",
-  "bbob-biobj_f21_i05_d03 0.999573344448168",
-  "bbob-biobj_f22_i05_d03 0.929852433616299",
-  "bbob-biobj_f23_i05_d03 0.840964634500044",
-  "bbob-biobj_f24_i05_d03 0.892822563372256",
-  "bbob-biobj_f25_i05_d03 0.987241521970443",
-  "bbob-biobj_f26_i05_d03 0.919257061669218",
-  "bbob-biobj_f27_i05_d03 0.960952524777076",
-  "bbob-biobj_f28_i05_d03 0.990126902830565",
-  "bbob-biobj_f29_i05_d03 0.949153924567331",
-  "bbob-biobj_f30_i05_d03 0.938513305197803",
-  "bbob-biobj_f31_i05_d03 0.975602048556156",
-  "bbob-biobj_f32_i05_d03 0.983672743739564",
-  "bbob-biobj_f33_i05_d03 0.998861207154187",
-  "bbob-biobj_f34_i05_d03 0.990692064296993",
-  "bbob-biobj_f35_i05_d03 0.773373144669810",
-  "bbob-biobj_f36_i05_d03 0.852779821331026",
-  "bbob-biobj_f37_i05_d03 0.841495012859572",
-  "bbob-biobj_f38_i05_d03 0.930554242816143",
-  "bbob-biobj_f39_i05_d03 0.958678871287242",
-  "bbob-biobj_f40_i05_d03 0.761268354646857",
-  "bbob-biobj_f41_i05_d03 0.822869743753209",
-  "bbob-biobj_f42_i05_d03 0.933371877335820",
-  "bbob-biobj_f43_i05_d03 0.967868455163294",
-  "bbob-biobj_f44_i05_d03 0.972160421709319",
-  "bbob-biobj_f45_i05_d03 0.942410710847329",
-  "bbob-biobj_f46_i05_d03 0.846189881536941",
-  "bbob-biobj_f47_i05_d03 0.910086304698320",
-  "bbob-biobj_f48_i05_d03 0.980478419308161",
-  "bbob-biobj_f49_i05_d03 0.899347714075874",
-  "bbob-biobj_f50_i05_d03 0.990885002779570",
-  "bbob-biobj_f51_i05_d03 0.983375775680358",
-  "bbob-biobj_f52_i05_d03 0.970414164343752",
-  "bbob-biobj_f53_i05_d03 0.998471495709904",
-  "bbob-biobj_f54_i05_d03 0.956276743155901",
-  "bbob-biobj_f55_i05_d03 0.890296523345115",
-  "bbob-biobj_f01_i01_d05 0.833323613048522",
-  "bbob-biobj_f02_i01_d05 0.953382480572129",
-  "bbob-biobj_f03_i01_d05 0.846748978060505",
-  "bbob-biobj_f04_i01_d05 0.943986240958572",
-  "bbob-biobj_f05_i01_d05 0.732271882563166",
-  "bbob-biobj_f06_i01_d05 0.846008217982165",
-  "bbob-biobj_f07_i01_d05 0.860198720717520",
-  "bbob-biobj_f08_i01_d05 0.942636159464674",
-  "bbob-biobj_f09_i01_d05 0.932177848166126",
-  "bbob-biobj_f10_i01_d05 0.867906439608168",
-  "bbob-biobj_f11_i01_d05 0.812582904862866",
-  "bbob-biobj_f12_i01_d05 0.999992978765985",
-  "bbob-biobj_f13_i01_d05 0.999802985541884",
-  "bbob-biobj_f14_i01_d05 0.935767091759654",
-  "bbob-biobj_f15_i01_d05 0.948210966449382",
-  "bbob-biobj_f16_i01_d05 0.991904920470480",
-  "bbob-biobj_f17_i01_d05 0.980121146965135",
-  "bbob-biobj_f18_i01_d05 0.998492797896518",
-  "bbob-biobj_f19_i01_d05 0.992521209197766",
-  "bbob-biobj_f20_i01_d05 0.967868337013301",
-  "bbob-biobj_f21_i01_d05 0.912539986187987",
-  "bbob-biobj_f22_i01_d05 0.986971314681578",
-  "bbob-biobj_f23_i01_d05 0.980181428165705",
-  "bbob-biobj_f24_i01_d05 0.869765596613810",
-  "bbob-biobj_f25_i01_d05 0.992992939913715",
-  "bbob-biobj_f26_i01_d05 0.949032729323168",
-  "bbob-biobj_f27_i01_d05 0.992203653046644",
-  "bbob-biobj_f28_i01_d05 0.995557132172934",
-  "bbob-biobj_f29_i01_d05 0.870409620405391",
-  "bbob-biobj_f30_i01_d05 0.940209025665832",
-  "bbob-biobj_f31_i01_d05 0.973300514645855",
-  "bbob-biobj_f32_i01_d05 0.972535028583623",
-  "bbob-biobj_f33_i01_d05 0.998341534043992",
-  "bbob-biobj_f34_i01_d05 0.981336357786654",
-  "bbob-biobj_f35_i01_d05 0.635731327611580",
-  "bbob-biobj_f36_i01_d05 0.885930265615739",
-  "bbob-biobj_f37_i01_d05 0.835092213812330",
-  "bbob-biobj_f38_i01_d05 0.915463977226424",
-  "bbob-biobj_f39_i01_d05 0.891171288243724",
-  "bbob-biobj_f40_i01_d05 0.903887041271556",
-  "bbob-biobj_f41_i01_d05 0.975606933105833",
-  "bbob-biobj_f42_i01_d05 0.935336117367536",
-  "bbob-biobj_f43_i01_d05 0.898037239151051",
-  "bbob-biobj_f44_i01_d05 0.993557077920995",
-  "bbob-biobj_f45_i01_d05 0.917823354092003",
-  "bbob-biobj_f46_i01_d05 0.947148190193365",
-  "bbob-biobj_f47_i01_d05 0.941993431399186",
-  "bbob-biobj_f48_i01_d05 0.970790086010117",
-  "bbob-biobj_f49_i01_d05 0.956450784209943",
-  "bbob-biobj_f50_i01_d05 0.971029074709937",
-  "bbob-biobj_f51_i01_d05 0.986037375175202",
-  "bbob-biobj_f52_i01_d05 0.961482111814171",
-  "bbob-biobj_f53_i01_d05 0.999101042830160",
-  "bbob-biobj_f54_i01_d05 0.986735369472236",
-  "bbob-biobj_f55_i01_d05 0.966512656733354",
-  "bbob-biobj_f01_i02_d05 0.833323678644197",
-  "bbob-biobj_f02_i02_d05 0.966471970749557",
-  "bbob-biobj_f03_i02_d05 0.961673575952914",
-  "bbob-biobj_f04_i02_d05 0.963227369233591",
-  "bbob-biobj_f05_i02_d05 0.714726002035663",
-  "bbob-biobj_f06_i02_d05 0.867717106453388",
-  "bbob-biobj_f07_i02_d05 0.893270563392809",
-  "bbob-biobj_f08_i02_d05 0.909304697813100",
-  "bbob-biobj_f09_i02_d05 0.961852667556734",
-  "bbob-biobj_f10_i02_d05 0.898112374939464",
-  "bbob-biobj_f11_i02_d05 0.813661370076743",
-  "bbob-biobj_f12_i02_d05 0.999910204628200",
-  "bbob-biobj_f13_i02_d05 0.998548417006938",
-  "bbob-biobj_f14_i02_d05 0.842152409419129",
-  "bbob-biobj_f15_i02_d05 0.979712501508148",
-  "bbob-biobj_f16_i02_d05 0.954676931265197",
-  "bbob-biobj_f17_i02_d05 0.971536148799575",
-  "bbob-biobj_f18_i02_d05 0.991742303696388",
-  "bbob-biobj_f19_i02_d05 0.989653695603756",
-  "bbob-biobj_f20_i02_d05 0.813995737299184",
-  "bbob-biobj_f21_i02_d05 0.998160272065372",
-  "bbob-biobj_f22_i02_d05 0.764257613844081",
-  "bbob-biobj_f23_i02_d05 0.919714796662331",
-  "bbob-biobj_f24_i02_d05 0.947901589829288",
-  "bbob-biobj_f25_i02_d05 0.983777178858051",
-  "bbob-biobj_f26_i02_d05 0.979221336328691",
-  "bbob-biobj_f27_i02_d05 0.932656508740310",
-  "bbob-biobj_f28_i02_d05 0.991805254328833",
-  "bbob-biobj_f29_i02_d05 0.882783597714326",
-  "bbob-biobj_f30_i02_d05 0.982389954779447",
-  "bbob-biobj_f31_i02_d05 0.977009713031631",
-  "bbob-biobj_f32_i02_d05 0.938355889064927",
-  "bbob-biobj_f33_i02_d05 0.989647286586073",
-  "bbob-biobj_f34_i02_d05 0.991099202459270",
-  "bbob-biobj_f35_i02_d05 0.581799542679685",
-  "bbob-biobj_f36_i02_d05 0.930155890009152",
-  "bbob-biobj_f37_i02_d05 0.929629661624318",
-  "bbob-biobj_f38_i02_d05 0.872919173674776",
-  "bbob-biobj_f39_i02_d05 0.979050846839239",
-  "bbob-biobj_f40_i02_d05 0.823839715183383",
-  "bbob-biobj_f41_i02_d05 0.924063808544279",
-  "bbob-biobj_f42_i02_d05 0.918085094763491",
-  "bbob-biobj_f43_i02_d05 0.953483956754120",
-  "bbob-biobj_f44_i02_d05 0.951280016927477",
-  "bbob-biobj_f45_i02_d05 0.892693151302912",
-  "bbob-biobj_f46_i02_d05 0.902611800665956",
-  "bbob-biobj_f47_i02_d05 0.930094310793038",
-  "bbob-biobj_f48_i02_d05 0.991207696805778",
-  "bbob-biobj_f49_i02_d05 0.955513219623643",
-  "bbob-biobj_f50_i02_d05 0.954380000682352",
-  "bbob-biobj_f51_i02_d05 0.980566922057903",
-  "bbob-biobj_f52_i02_d05 0.978948285713597",
-  "bbob-biobj_f53_i02_d05 0.998939985445457",
-  "bbob-biobj_f54_i02_d05 0.988596134781331",
-  "bbob-biobj_f55_i02_d05 0.982278785271738",
-  "bbob-biobj_f01_i03_d05 0.833323412201801",
-  "bbob-biobj_f02_i03_d05 0.950361831175043",
-  "bbob-biobj_f03_i03_d05 0.836863196221714",
-  "bbob-biobj_f04_i03_d05 0.937875769562535",
-  "bbob-biobj_f05_i03_d05 0.699885573619157",
-  "bbob-biobj_f06_i03_d05 0.848586604888048",
-  "bbob-biobj_f07_i03_d05 0.868172809095841",
-  "bbob-biobj_f08_i03_d05 0.805160900475253",
-  "bbob-biobj_f09_i03_d05 0.930449808633550",
-  "bbob-biobj_f10_i03_d05 0.890596373492179",
-  "bbob-biobj_f11_i03_d05 0.841063082375848",
-  "bbob-biobj_f12_i03_d05 0.947356672555347",
-  "bbob-biobj_f13_i03_d05 0.999817326476568",
-  "bbob-biobj_f14_i03_d05 0.792210323343157",
-  "bbob-biobj_f15_i03_d05 0.980683450638681",
-  "bbob-biobj_f16_i03_d05 0.990026143743998",
-  "bbob-biobj_f17_i03_d05 0.967728389540592",
-  "bbob-biobj_f18_i03_d05 0.946581624974437",
-  "bbob-biobj_f19_i03_d05 0.982448542162378",
-  "bbob-biobj_f20_i03_d05 0.892400286535832",
-  "bbob-biobj_f21_i03_d05 0.929902738511761",
-  "bbob-biobj_f22_i03_d05 0.735414605775649",
-  "bbob-biobj_f23_i03_d05 0.894398402347281",
-  "bbob-biobj_f24_i03_d05 0.935398598296377",
-  "bbob-biobj_f25_i03_d05 0.969545388922887",
-  "bbob-biobj_f26_i03_d05 0.984009930418544",
-  "bbob-biobj_f27_i03_d05 0.978490094776665",
-  "bbob-biobj_f28_i03_d05 0.993681730562182",
-  "bbob-biobj_f29_i03_d05 0.830278849915943",
-  "bbob-biobj_f30_i03_d05 0.914680090254004",
-  "bbob-biobj_f31_i03_d05 0.975956139468783",
-  "bbob-biobj_f32_i03_d05 0.983060370685761",
-  "bbob-biobj_f33_i03_d05 0.999015972826592",
-  "bbob-biobj_f34_i03_d05 0.968962634460452",
-  "bbob-biobj_f35_i03_d05 0.768217022723346",
-  "bbob-biobj_f36_i03_d05 0.627299549868112",
-  "bbob-biobj_f37_i03_d05 0.841049270484574",
-  "bbob-biobj_f38_i03_d05 0.890858931496801",
-  "bbob-biobj_f39_i03_d05 0.903021027298148",
-  "bbob-biobj_f40_i03_d05 0.809171122082573",
-  "bbob-biobj_f41_i03_d05 0.974027388952628",
-  "bbob-biobj_f42_i03_d05 0.860961686699998",
-  "bbob-biobj_f43_i03_d05 0.988523450616811",
-  "bbob-biobj_f44_i03_d05 0.958337980323592",
-  "bbob-biobj_f45_i03_d05 0.953228105854077",
-  "bbob-biobj_f46_i03_d05 0.892809921198084",
-  "bbob-biobj_f47_i03_d05 0.976633663786186",
-  "bbob-biobj_f48_i03_d05 0.992966678801973",
-  "bbob-biobj_f49_i03_d05 0.964436030451722",
-  "bbob-biobj_f50_i03_d05 0.961250256199450",
-  "bbob-biobj_f51_i03_d05 0.972182902233710",
-  "bbob-biobj_f52_i03_d05 0.981022713204623",
-  "bbob-biobj_f53_i03_d05 0.997632016077083",
-  "bbob-biobj_f54_i03_d05 0.990016829409416",
-  "bbob-biobj_f55_i03_d05 0.964540771222069",
-  "bbob-biobj_f01_i04_d05 0.833323604552418",
-  "bbob-biobj_f02_i04_d05 0.881361047681442",
-  "bbob-biobj_f03_i04_d05 0.832969879000999",
-  "bbob-biobj_f04_i04_d05 0.944466760345521",
-  "bbob-biobj_f05_i04_d05 0.776079683001309",
-  "bbob-biobj_f06_i04_d05 0.935940507310882",
-  "bbob-biobj_f07_i04_d05 0.870192086993759",
-  "bbob-biobj_f08_i04_d05 0.927620206885280",
-  "bbob-biobj_f09_i04_d05 0.950693931608951",
-  "bbob-biobj_f10_i04_d05 0.946968847494744",
-  "bbob-biobj_f11_i04_d05 0.886487621972585",
-  "bbob-biobj_f12_i04_d05 0.973685651248799",
-  "bbob-biobj_f13_i04_d05 0.999810911991238",
-  "bbob-biobj_f14_i04_d05 0.854022178778476",
-  "bbob-biobj_f15_i04_d05 0.944759123319520",
-  "bbob-biobj_f16_i04_d05 0.984582374899148",
-  "bbob-biobj_f17_i04_d05 0.995587732952418",
-  "bbob-biobj_f18_i04_d05 0.973768217428830",
-  "bbob-biobj_f19_i04_d05 0.992031326175875",
-  "bbob-biobj_f20_i04_d05 0.999111453421520",
-  "bbob-biobj_f21_i04_d05 0.928301112745217",
-  "bbob-biobj_f22_i04_d05 0.834631475894313",
-  "bbob-biobj_f23_i04_d05 0.887969873232309",
-  "bbob-biobj_f24_i04_d05 0.880840406920242",
-  "bbob-biobj_f25_i04_d05 0.992528890753554",
-  "bbob-biobj_f26_i04_d05 0.965391874605957",
-  "bbob-biobj_f27_i04_d05 0.981448534698392",
-  "bbob-biobj_f28_i04_d05 0.997392629399003",
-  "bbob-biobj_f29_i04_d05 0.899704016430431",
-  "bbob-biobj_f30_i04_d05 0.979631070337090",
-  "bbob-biobj_f31_i04_d05 0.977972027972164",
-  "bbob-biobj_f32_i04_d05 0.987959694560786",
-  "bbob-biobj_f33_i04_d05 0.999672662969389",
-  "bbob-biobj_f34_i04_d05 0.990433078244488",
-  "bbob-biobj_f35_i04_d05 0.735374749381652",
-  "bbob-biobj_f36_i04_d05 0.914705891979480",
-  "bbob-biobj_f37_i04_d05 0.767371858941308",
-  "bbob-biobj_f38_i04_d05 0.807350027097187",
-  "bbob-biobj_f39_i04_d05 0.968068726151961",
-  "bbob-biobj_f40_i04_d05 0.914038069032498",
-  "bbob-biobj_f41_i04_d05 0.889981332187799",
-  "bbob-biobj_f42_i04_d05 0.929451911522505",
-  "bbob-biobj_f43_i04_d05 0.945402755603790",
-  "bbob-biobj_f44_i04_d05 0.965363681112066",
-  "bbob-biobj_f45_i04_d05 0.946643284078182",
-  "bbob-biobj_f46_i04_d05 0.909674476002128",
-  "bbob-biobj_f47_i04_d05 0.922198297806564",
-  "bbob-biobj_f48_i04_d05 0.979017031441479",
-  "bbob-biobj_f49_i04_d05 0.968252711990607",
-  "bbob-biobj_f50_i04_d05 0.972701814467758",
-  "bbob-biobj_f51_i04_d05 0.983435426314444",
-  "bbob-biobj_f52_i04_d05 0.990680814430356",
-  "bbob-biobj_f53_i04_d05 0.999956638376682",
-  "bbob-biobj_f54_i04_d05 0.992621223363064",
-  "bbob-biobj_f55_i04_d05 0.987526196728242",
-  "bbob-biobj_f01_i05_d05 0.833323980042135",
-  "bbob-biobj_f02_i05_d05 0.861588901038615",
-  "bbob-biobj_f03_i05_d05 0.959274685295916",
-  "bbob-biobj_f04_i05_d05 0.942088111842157",
-  "bbob-biobj_f05_i05_d05 0.737157063871410",
-  "bbob-biobj_f06_i05_d05 0.930563028723551",
-  "bbob-biobj_f07_i05_d05 0.911636778860361",
-  "bbob-biobj_f08_i05_d05 0.917781387881829",
-  "bbob-biobj_f09_i05_d05 0.968559812719704",
-  "bbob-biobj_f10_i05_d05 0.934944731954434",
-  "bbob-biobj_f11_i05_d05 0.834554829532043",
-  "bbob-biobj_f12_i05_d05 0.999480702962406",
-  "bbob-biobj_f13_i05_d05 0.999369898449103",
-  "bbob-biobj_f14_i05_d05 0.966157234627486",
-  "bbob-biobj_f15_i05_d05 0.867414820839768",
-  "bbob-biobj_f16_i05_d05 0.995250994802709",
-  "bbob-biobj_f17_i05_d05 0.989412571977172",
-  "bbob-biobj_f18_i05_d05 0.941220367027244",
-  "bbob-biobj_f19_i05_d05 0.993758171916552",
-  "bbob-biobj_f20_i05_d05 0.946993713194924",
-  "bbob-biobj_f21_i05_d05 0.997869805143790",
-  "bbob-biobj_f22_i05_d05 0.892864250824833",
-  "bbob-biobj_f23_i05_d05 0.891337009773493",
-  "bbob-biobj_f24_i05_d05 0.958073366124566",
-  "bbob-biobj_f25_i05_d05 0.938499543222742",
-  "bbob-biobj_f26_i05_d05 0.999565002960340",
-  "bbob-biobj_f27_i05_d05 0.975425664056032",
-  "bbob-biobj_f28_i05_d05 0.987355817298832",
-  "bbob-biobj_f29_i05_d05 0.927425993744280",
-  "bbob-biobj_f30_i05_d05 0.933169511358876",
-  "bbob-biobj_f31_i05_d05 0.985496065614287",
-  "bbob-biobj_f32_i05_d05 0.982435899136349",
-  "bbob-biobj_f33_i05_d05 0.999853010933812",
-  "bbob-biobj_f34_i05_d05 0.991915429264175",
-  "bbob-biobj_f35_i05_d05 0.761468769860206",
-  "bbob-biobj_f36_i05_d05 0.954687157341047",
-  "bbob-biobj_f37_i05_d05 0.837648548374559",
-  "bbob-biobj_f38_i05_d05 0.906706204321810",
-  "bbob-biobj_f39_i05_d05 0.921014246577477",
-  "bbob-biobj_f40_i05_d05 0.946421955464566",
-  "bbob-biobj_f41_i05_d05 0.876463711014165",
-  "bbob-biobj_f42_i05_d05 0.970370080999607",
-  "bbob-biobj_f43_i05_d05 0.902429181207842",
-  "bbob-biobj_f44_i05_d05 0.966251217785535",
-  "bbob-biobj_f45_i05_d05 0.909303851254534",
-  "bbob-biobj_f46_i05_d05 0.942517226712857",
-  "bbob-biobj_f47_i05_d05 0.870061627456340",
-  "bbob-biobj_f48_i05_d05 0.973954640318775",
-  "bbob-biobj_f49_i05_d05 0.951109201752516",
-  "bbob-biobj_f50_i05_d05 0.994266661801892",
-  "bbob-biobj_f51_i05_d05 0.994438896814828",
-  "bbob-biobj_f52_i05_d05 0.985991910384035",
-  "bbob-biobj_f53_i05_d05 0.998401667793023",
-  "bbob-biobj_f54_i05_d05 0.991382280345378",
-  "bbob-biobj_f55_i05_d05 0.971967974360685",
-  "bbob-biobj_f01_i01_d10 0.833292978406429",
-  "bbob-biobj_f02_i01_d10 0.978186157890750",
-  "bbob-biobj_f03_i01_d10 0.916881240370743",
-  "bbob-biobj_f04_i01_d10 0.944821826480296",
-  "bbob-biobj_f05_i01_d10 0.714020831794021",
-  "bbob-biobj_f06_i01_d10 0.936989707669913",
-  "bbob-biobj_f07_i01_d10 0.892671295146030",
-  "bbob-biobj_f08_i01_d10 0.980887156696771",
-  "bbob-biobj_f09_i01_d10 0.940787123769946",
-  "bbob-biobj_f10_i01_d10 0.879640686792226",
-  "bbob-biobj_f11_i01_d10 0.836568513611919",
-  "bbob-biobj_f12_i01_d10 0.997429679126502",
-  "bbob-biobj_f13_i01_d10 0.999276391665501",
-  "bbob-biobj_f14_i01_d10 0.855942383415148",
-  "bbob-biobj_f15_i01_d10 0.964995546568669",
-  "bbob-biobj_f16_i01_d10 0.983714350137259",
-  "bbob-biobj_f17_i01_d10 0.989748917262919",
-  "bbob-biobj_f18_i01_d10 0.992629101085457",
-  "bbob-biobj_f19_i01_d10 0.992011817987032",
-  "bbob-biobj_f20_i01_d10 0.999902649949533",
-  "bbob-biobj_f21_i01_d10 0.993976563634552",
-  "bbob-biobj_f22_i01_d10 0.837772481127108",
-  "bbob-biobj_f23_i01_d10 0.991303780174126",
-  "bbob-biobj_f24_i01_d10 0.951302434936020",
-  "bbob-biobj_f25_i01_d10 0.985022819774543",
-  "bbob-biobj_f26_i01_d10 0.999623620340383",
-  "bbob-biobj_f27_i01_d10 0.981630264752229",
-  "bbob-biobj_f28_i01_d10 0.994065399842423",
-  "bbob-biobj_f29_i01_d10 0.893969124629912",
-  "bbob-biobj_f30_i01_d10 0.926766592526958",
-  "bbob-biobj_f31_i01_d10 0.954335155663069",
-  "bbob-biobj_f32_i01_d10 0.947204575153772",
-  "bbob-biobj_f33_i01_d10 0.995511594131477",
-  "bbob-biobj_f34_i01_d10 0.966121457771338",
-  "bbob-biobj_f35_i01_d10 0.580711713148923",
-  "bbob-biobj_f36_i01_d10 0.781206395704261",
-  "bbob-biobj_f37_i01_d10 0.781596154216846",
-  "bbob-biobj_f38_i01_d10 0.839658644425447",
-  "bbob-biobj_f39_i01_d10 0.980090073789881",
-  "bbob-biobj_f40_i01_d10 0.728253186329877",
-  "bbob-biobj_f41_i01_d10 0.976581999493699",
-  "bbob-biobj_f42_i01_d10 0.941402475493333",
-  "bbob-biobj_f43_i01_d10 0.992948107011226",
-  "bbob-biobj_f44_i01_d10 0.977876816504011",
-  "bbob-biobj_f45_i01_d10 0.962462125568001",
-  "bbob-biobj_f46_i01_d10 0.912013396057950",
-  "bbob-biobj_f47_i01_d10 0.952444770559979",
-  "bbob-biobj_f48_i01_d10 0.971871224059603",
-  "bbob-biobj_f49_i01_d10 0.923586013533762",
-  "bbob-biobj_f50_i01_d10 0.933926263240110",
-  "bbob-biobj_f51_i01_d10 0.978991639829062",
-  "bbob-biobj_f52_i01_d10 0.871725659507174",
-  "bbob-biobj_f53_i01_d10 0.997770035036584",
-  "bbob-biobj_f54_i01_d10 0.971012057853709",
-  "bbob-biobj_f55_i01_d10 0.911747267012899",
-  "bbob-biobj_f01_i02_d10 0.833290582871414",
-  "bbob-biobj_f02_i02_d10 0.954015387344154",
-  "bbob-biobj_f03_i02_d10 0.980158545829574",
-  "bbob-biobj_f04_i02_d10 0.954662390636814",
-  "bbob-biobj_f05_i02_d10 0.730694945666825",
-  "bbob-biobj_f06_i02_d10 0.875212175676682",
-  "bbob-biobj_f07_i02_d10 0.893835936342750",
-  "bbob-biobj_f08_i02_d10 0.914384234660696",
-  "bbob-biobj_f09_i02_d10 0.975986289864238",
-  "bbob-biobj_f10_i02_d10 0.798453979906590",
-  "bbob-biobj_f11_i02_d10 0.829484211464355",
-  "bbob-biobj_f12_i02_d10 0.999751278208595",
-  "bbob-biobj_f13_i02_d10 0.999204837951072",
-  "bbob-biobj_f14_i02_d10 0.880190575748954",
-  "bbob-biobj_f15_i02_d10 0.992132257104426",
-  "bbob-biobj_f16_i02_d10 0.953795427645086",
-  "bbob-biobj_f17_i02_d10 0.981080411732161",
-  "bbob-biobj_f18_i02_d10 0.962760412503552",
-  "bbob-biobj_f19_i02_d10 0.998068771692893",
-  "bbob-biobj_f20_i02_d10 0.999674665199401",
-  "bbob-biobj_f21_i02_d10 0.994603489196482",
-  "bbob-biobj_f22_i02_d10 0.728688051429797",
-  "bbob-biobj_f23_i02_d10 0.957095980950643",
-  "bbob-biobj_f24_i02_d10 0.894438074642480",
-  "bbob-biobj_f25_i02_d10 0.971411549291309",
-  "bbob-biobj_f26_i02_d10 0.999634961765278",
-  "bbob-biobj_f27_i02_d10 0.903581186079658",
-  "bbob-biobj_f28_i02_d10 0.992207380799539",
-  "bbob-biobj_f29_i02_d10 0.804885884975236",
-  "bbob-biobj_f30_i02_d10 0.979256713902900",
-  "bbob-biobj_f31_i02_d10 0.937099221837444",
-  "bbob-biobj_f32_i02_d10 0.962293389331358",
-  "bbob-biobj_f33_i02_d10 0.995928694733017",
-  "bbob-biobj_f34_i02_d10 0.959843707994441",
-  "bbob-biobj_f35_i02_d10 0.592123826021201",
-  "bbob-biobj_f36_i02_d10 0.793724479284668",
-  "bbob-biobj_f37_i02_d10 0.806039400985827",
-  "bbob-biobj_f38_i02_d10 0.885571675810017",
-  "bbob-biobj_f39_i02_d10 0.936962624051114",
-  "bbob-biobj_f40_i02_d10 0.744507529762664",
-  "bbob-biobj_f41_i02_d10 0.931044605526823",
-  "bbob-biobj_f42_i02_d10 0.928064521463463",
-  "bbob-biobj_f43_i02_d10 0.942162067513955",
-  "bbob-biobj_f44_i02_d10 0.975027661488822",
-  "bbob-biobj_f45_i02_d10 0.937565228444463",
-  "bbob-biobj_f46_i02_d10 0.897891387257671",
-  "bbob-biobj_f47_i02_d10 0.899311341134821",
-  "bbob-biobj_f48_i02_d10 0.986529674800281",
-  "bbob-biobj_f49_i02_d10 0.847194810018122",
-  "bbob-biobj_f50_i02_d10 0.957430436852076",
-  "bbob-biobj_f51_i02_d10 0.990809788249675",
-  "bbob-biobj_f52_i02_d10 0.908040542561868",
-  "bbob-biobj_f53_i02_d10 0.995011570971999",
-  "bbob-biobj_f54_i02_d10 0.979013067298796",
-  "bbob-biobj_f55_i02_d10 0.933494200367506",
-  "bbob-biobj_f01_i03_d10 0.833290074261168",
-  "bbob-biobj_f02_i03_d10 0.890659367706656",
-  "bbob-biobj_f03_i03_d10 0.985495762424353",
-  "bbob-biobj_f04_i03_d10 0.951441054303583",
-  "bbob-biobj_f05_i03_d10 0.683889567823860",
-  "bbob-biobj_f06_i03_d10 0.895911962613326",
-  "bbob-biobj_f07_i03_d10 0.889141490151494",
-  "bbob-biobj_f08_i03_d10 0.929528209845753",
-  "bbob-biobj_f09_i03_d10 0.955035805359493",
-  "bbob-biobj_f10_i03_d10 0.710801768774196",
-  "bbob-biobj_f11_i03_d10 0.821919374566912",
-  "bbob-biobj_f12_i03_d10 0.999904509420673",
-  "bbob-biobj_f13_i03_d10 0.999218783176809",
-  "bbob-biobj_f14_i03_d10 0.931139097610614",
-  "bbob-biobj_f15_i03_d10 0.991358691358509",
-  "bbob-biobj_f16_i03_d10 0.967220788577883",
-  "bbob-biobj_f17_i03_d10 0.989693685552891",
-  "bbob-biobj_f18_i03_d10 0.992473381710274",
-  "bbob-biobj_f19_i03_d10 0.991727239977203",
-  "bbob-biobj_f20_i03_d10 0.972677430070006",
-  "bbob-biobj_f21_i03_d10 0.998433693554811",
-  "bbob-biobj_f22_i03_d10 0.862392606638333",
-  "bbob-biobj_f23_i03_d10 0.985383623808623",
-  "bbob-biobj_f24_i03_d10 0.908859896675063",
-  "bbob-biobj_f25_i03_d10 0.987502886787558",
-  "bbob-biobj_f26_i03_d10 0.997282016963610",
-  "bbob-biobj_f27_i03_d10 0.991361868145687",
-  "bbob-biobj_f28_i03_d10 0.994065468345770",
-  "bbob-biobj_f29_i03_d10 0.851027090910249",
-  "bbob-biobj_f30_i03_d10 0.986307083425666",
-  "bbob-biobj_f31_i03_d10 0.952876582353792",
-  "bbob-biobj_f32_i03_d10 0.960252193878653",
-  "bbob-biobj_f33_i03_d10 0.998451520498762",
-  "bbob-biobj_f34_i03_d10 0.983079617313669",
-  "bbob-biobj_f35_i03_d10 0.606593739472515",
-  "bbob-biobj_f36_i03_d10 0.756162001692599",
-  "bbob-biobj_f37_i03_d10 0.832532461249713",
-  "bbob-biobj_f38_i03_d10 0.874391675806419",
-  "bbob-biobj_f39_i03_d10 0.857769726279999",
-  "bbob-biobj_f40_i03_d10 0.729629427484062",
-  "bbob-biobj_f41_i03_d10 0.871973857380220",
-  "bbob-biobj_f42_i03_d10 0.906855287051747",
-  "bbob-biobj_f43_i03_d10 0.981933844465956",
-  "bbob-biobj_f44_i03_d10 0.978358085126126",
-  "bbob-biobj_f45_i03_d10 0.939019471197658",
-  "bbob-biobj_f46_i03_d10 0.887418745213056",
-  "bbob-biobj_f47_i03_d10 0.945131223885536",
-  "bbob-biobj_f48_i03_d10 0.979584767225720",
-  "bbob-biobj_f49_i03_d10 0.926518854653493",
-  "bbob-biobj_f50_i03_d10 0.933296224836959",
-  "bbob-biobj_f51_i03_d10 0.968183663247016",
-  "bbob-biobj_f52_i03_d10 0.927273659877501",
-  "bbob-biobj_f53_i03_d10 0.999758254041145",
-  "bbob-biobj_f54_i03_d10 0.971479343841167",
-  "bbob-biobj_f55_i03_d10 0.953336701115373",
-  "bbob-biobj_f01_i04_d10 0.833290616484510",
-  "bbob-biobj_f02_i04_d10 0.972586493712609",
-  "bbob-biobj_f03_i04_d10 0.908641915848349",
-  "bbob-biobj_f04_i04_d10 0.936521549540696",
-  "bbob-biobj_f05_i04_d10 0.716260273341175",
-  "bbob-biobj_f06_i04_d10 0.930039833002329",
-  "bbob-biobj_f07_i04_d10 0.883309054692379",
-  "bbob-biobj_f08_i04_d10 0.950092630117365",
-  "bbob-biobj_f09_i04_d10 0.944313359892786",
-  "bbob-biobj_f10_i04_d10 0.904274355825781",
-  "bbob-biobj_f11_i04_d10 0.834665692135462",
-  "bbob-biobj_f12_i04_d10 0.999925818132752",
-  "bbob-biobj_f13_i04_d10 0.991555249595398",
-  "bbob-biobj_f14_i04_d10 0.871642182353333",
-  "bbob-biobj_f15_i04_d10 0.994602668464917",
-  "bbob-biobj_f16_i04_d10 0.984001143853939",
-  "bbob-biobj_f17_i04_d10 0.992358720621488",
-  "bbob-biobj_f18_i04_d10 0.950020765554779",
-  "bbob-biobj_f19_i04_d10 0.992321911751036",
-  "bbob-biobj_f20_i04_d10 0.999930879613361",
-  "bbob-biobj_f21_i04_d10 0.904309427391170",
-  "bbob-biobj_f22_i04_d10 0.842157199476190",
-  "bbob-biobj_f23_i04_d10 0.980009144094798",
-  "bbob-biobj_f24_i04_d10 0.967444562272865",
-  "bbob-biobj_f25_i04_d10 0.971825471108975",
-  "bbob-biobj_f26_i04_d10 0.999901964296866",
-  "bbob-biobj_f27_i04_d10 0.987018409937990",
-  "bbob-biobj_f28_i04_d10 0.992784318025797",
-  "bbob-biobj_f29_i04_d10 0.894877823153367",
-  "bbob-biobj_f30_i04_d10 0.980895333912404",
-  "bbob-biobj_f31_i04_d10 0.968424501416157",
-  "bbob-biobj_f32_i04_d10 0.986592717525944",
-  "bbob-biobj_f33_i04_d10 0.996076390480589",
-  "bbob-biobj_f34_i04_d10 0.985600748857182",
-  "bbob-biobj_f35_i04_d10 0.582430180978704",
-  "bbob-biobj_f36_i04_d10 0.850505488775800",
-  "bbob-biobj_f37_i04_d10 0.782186014741844",
-  "bbob-biobj_f38_i04_d10 0.883814171115460",
-  "bbob-biobj_f39_i04_d10 0.905978834540773",
-  "bbob-biobj_f40_i04_d10 0.707815492885900",
-  "bbob-biobj_f41_i04_d10 0.951214535801685",
-  "bbob-biobj_f42_i04_d10 0.868210535403942",
-  "bbob-biobj_f43_i04_d10 0.961476365589940",
-  "bbob-biobj_f44_i04_d10 0.987127077215091",
-  "bbob-biobj_f45_i04_d10 0.932558858551399",
-  "bbob-biobj_f46_i04_d10 0.902412857071501",
-  "bbob-biobj_f47_i04_d10 0.951407500128080",
-  "bbob-biobj_f48_i04_d10 0.970244582385456",
-  "bbob-biobj_f49_i04_d10 0.878070391585995",
-  "bbob-biobj_f50_i04_d10 0.978954738647618",
-  "bbob-biobj_f51_i04_d10 0.997434032890661",
-  "bbob-biobj_f52_i04_d10 0.991665441681003",
-  "bbob-biobj_f53_i04_d10 0.998086298388451",
-  "bbob-biobj_f54_i04_d10 0.987229116292269",
-  "bbob-biobj_f55_i04_d10 0.853189259275938",
-  "bbob-biobj_f01_i05_d10 0.833292291687670",
-  "bbob-biobj_f02_i05_d10 0.933906138198159",
-  "bbob-biobj_f03_i05_d10 0.881566802414681",
-  "bbob-biobj_f04_i05_d10 0.941617512589267",
-  "bbob-biobj_f05_i05_d10 0.749448355510482",
-  "bbob-biobj_f06_i05_d10 0.743322727228610",
-  "bbob-biobj_f07_i05_d10 0.867122678653645",
-  "bbob-biobj_f08_i05_d10 0.928738765599749",
-  "bbob-biobj_f09_i05_d10 0.940721644129061",
-  "bbob-biobj_f10_i05_d10 0.842803695957583",
-  "bbob-biobj_f11_i05_d10 0.840890202958803",
-  "bbob-biobj_f12_i05_d10 0.999713183960265",
-  "bbob-biobj_f13_i05_d10 0.994187469334294",
-  "bbob-biobj_f14_i05_d10 0.940413629063480",
-  "bbob-biobj_f15_i05_d10 0.985317312964736",
-  "bbob-biobj_f16_i05_d10 0.973755090012530",
-  "bbob-biobj_f17_i05_d10 0.987526807338334",
-  "bbob-biobj_f18_i05_d10 0.954457659398138",
-  "bbob-biobj_f19_i05_d10 0.992080633898391",
-  "bbob-biobj_f20_i05_d10 0.999846078037702",
-  "bbob-biobj_f21_i05_d10 0.958073478645331",
-  "bbob-biobj_f22_i05_d10 0.819446456617006",
-  "bbob-biobj_f23_i05_d10 0.954447620118574",
-  "bbob-biobj_f24_i05_d10 0.938514787676160",
-  "bbob-biobj_f25_i05_d10 0.956803883288751",
-  "bbob-biobj_f26_i05_d10 0.998146168797799",
-  "bbob-biobj_f27_i05_d10 0.981690114394249",
-  "bbob-biobj_f28_i05_d10 0.993719824098620",
-  "bbob-biobj_f29_i05_d10 0.900580483041280",
-  "bbob-biobj_f30_i05_d10 0.978381478368368",
-  "bbob-biobj_f31_i05_d10 0.970546900414730",
-  "bbob-biobj_f32_i05_d10 0.992912108242810",
-  "bbob-biobj_f33_i05_d10 0.999693756289780",
-  "bbob-biobj_f34_i05_d10 0.986747418676788",
-  "bbob-biobj_f35_i05_d10 0.597642642362544",
-  "bbob-biobj_f36_i05_d10 0.808684862939724",
-  "bbob-biobj_f37_i05_d10 0.754869791041963",
-  "bbob-biobj_f38_i05_d10 0.872711761339408",
-  "bbob-biobj_f39_i05_d10 0.884061916865357",
-  "bbob-biobj_f40_i05_d10 0.738254830143031",
-  "bbob-biobj_f41_i05_d10 0.966114871816312",
-  "bbob-biobj_f42_i05_d10 0.912900396135625",
-  "bbob-biobj_f43_i05_d10 0.968627057192036",
-  "bbob-biobj_f44_i05_d10 0.972820224675321",
-  "bbob-biobj_f45_i05_d10 0.875458356931092",
-  "bbob-biobj_f46_i05_d10 0.895569952154866",
-  "bbob-biobj_f47_i05_d10 0.974872587495967",
-  "bbob-biobj_f48_i05_d10 0.979607662302305",
-  "bbob-biobj_f49_i05_d10 0.874128159982844",
-  "bbob-biobj_f50_i05_d10 0.973107044380098",
-  "bbob-biobj_f51_i05_d10 0.964617015167318",
-  "bbob-biobj_f52_i05_d10 0.879809048011156",
-  "bbob-biobj_f53_i05_d10 0.999964504148671",
-  "bbob-biobj_f54_i05_d10 0.963565055756231",
-  "bbob-biobj_f55_i05_d10 0.931471452678062",
-  "bbob-biobj_f01_i01_d20 0.833185904412730",
-  "bbob-biobj_f02_i01_d20 0.951879760885421",
-  "bbob-biobj_f03_i01_d20 0.887034106660898",
-  "bbob-biobj_f04_i01_d20 0.935828732838047",
-  "bbob-biobj_f05_i01_d20 0.694320591154180",
-  "bbob-biobj_f06_i01_d20 0.930982077320492",
-  "bbob-biobj_f07_i01_d20 0.941094512447098",
-  "bbob-biobj_f08_i01_d20 0.964979887551948",
-  "bbob-biobj_f09_i01_d20 0.960292556025729",
-  "bbob-biobj_f10_i01_d20 0.840913568791116",
-  "bbob-biobj_f11_i01_d20 0.836353784774267",
-  "bbob-biobj_f12_i01_d20 0.999353367517152",
-  "bbob-biobj_f13_i01_d20 0.949968158767985",
-  "bbob-biobj_f14_i01_d20 0.838028753234985",
-  "bbob-biobj_f15_i01_d20 0.988152204597621",
-  "bbob-biobj_f16_i01_d20 0.967418396951644",
-  "bbob-biobj_f17_i01_d20 0.961976829573151",
-  "bbob-biobj_f18_i01_d20 0.947902479133759",
-  "bbob-biobj_f19_i01_d20 0.985654207450615",
-  "bbob-biobj_f20_i01_d20 0.999754625794669",
-  "bbob-biobj_f21_i01_d20 0.981392978940988",
-  "bbob-biobj_f22_i01_d20 0.771073216843813",
-  "bbob-biobj_f23_i01_d20 0.941082365614892",
-  "bbob-biobj_f24_i01_d20 0.938837784563285",
-  "bbob-biobj_f25_i01_d20 0.973606632317517",
-  "bbob-biobj_f26_i01_d20 0.999902167548546",
-  "bbob-biobj_f27_i01_d20 0.977435672212356",
-  "bbob-biobj_f28_i01_d20 0.992419760470962",
-  "bbob-biobj_f29_i01_d20 0.808558091384653",
-  "bbob-biobj_f30_i01_d20 0.961962695453807",
-  "bbob-biobj_f31_i01_d20 0.952918435698674",
-  "bbob-biobj_f32_i01_d20 0.974201660284137",
-  "bbob-biobj_f33_i01_d20 0.990220567975616",
-  "bbob-biobj_f34_i01_d20 0.949944119709586",
-  "bbob-biobj_f35_i01_d20 0.554742901893168",
-  "bbob-biobj_f36_i01_d20 0.804503390556641",
-  "bbob-biobj_f37_i01_d20 0.839647691394615",
-  "bbob-biobj_f38_i01_d20 0.852470443769851",
-  "bbob-biobj_f39_i01_d20 0.866767035706089",
-  "bbob-biobj_f40_i01_d20 0.603655395940413",
-  "bbob-biobj_f41_i01_d20 0.971476433309333",
-  "bbob-biobj_f42_i01_d20 0.957800101909049",
-  "bbob-biobj_f43_i01_d20 0.933698802979667",
-  "bbob-biobj_f44_i01_d20 0.989473622757610",
-  "bbob-biobj_f45_i01_d20 0.916261834183411",
-  "bbob-biobj_f46_i01_d20 0.930681466224983",
-  "bbob-biobj_f47_i01_d20 0.945093837018368",
-  "bbob-biobj_f48_i01_d20 0.967793252199761",
-  "bbob-biobj_f49_i01_d20 0.882218965514988",
-  "bbob-biobj_f50_i01_d20 0.961919064060329",
-  "bbob-biobj_f51_i01_d20 0.985273744129146",
-  "bbob-biobj_f52_i01_d20 0.945425704680598",
-  "bbob-biobj_f53_i01_d20 0.993616976712955",
-  "bbob-biobj_f54_i01_d20 0.975704363282836",
-  "bbob-biobj_f55_i01_d20 0.589593665487798",
-  "bbob-biobj_f01_i02_d20 0.833207552060403",
-  "bbob-biobj_f02_i02_d20 0.980904237253779",
-  "bbob-biobj_f03_i02_d20 0.950022939724837",
-  "bbob-biobj_f04_i02_d20 0.941710836096996",
-  "bbob-biobj_f05_i02_d20 0.689040055642120",
-  "bbob-biobj_f06_i02_d20 0.910480566964683",
-  "bbob-biobj_f07_i02_d20 0.896241865239925",
-  "bbob-biobj_f08_i02_d20 0.900729077728150",
-  "bbob-biobj_f09_i02_d20 0.962586221986243",
-  "bbob-biobj_f10_i02_d20 0.812023622265132",
-  "bbob-biobj_f11_i02_d20 0.835438688258357",
-  "bbob-biobj_f12_i02_d20 0.999563671412677",
-  "bbob-biobj_f13_i02_d20 0.970013320088166",
-  "bbob-biobj_f14_i02_d20 0.908925932399497",
-  "bbob-biobj_f15_i02_d20 0.957692036968514",
-  "bbob-biobj_f16_i02_d20 0.968556195438330",
-  "bbob-biobj_f17_i02_d20 0.958204217188874",
-  "bbob-biobj_f18_i02_d20 0.950121118486904",
-  "bbob-biobj_f19_i02_d20 0.971648034605764",
-  "bbob-biobj_f20_i02_d20 0.999628088279715",
-  "bbob-biobj_f21_i02_d20 0.993485919542800",
-  "bbob-biobj_f22_i02_d20 0.756555470428662",
-  "bbob-biobj_f23_i02_d20 0.916152727277069",
-  "bbob-biobj_f24_i02_d20 0.985351328166353",
-  "bbob-biobj_f25_i02_d20 0.927089439963058",
-  "bbob-biobj_f26_i02_d20 0.996319681989621",
-  "bbob-biobj_f27_i02_d20 0.966076293144647",
-  "bbob-biobj_f28_i02_d20 0.989904675571837",
-  "bbob-biobj_f29_i02_d20 0.858914192126769",
-  "bbob-biobj_f30_i02_d20 0.948003767444235",
-  "bbob-biobj_f31_i02_d20 0.954964697786911",
-  "bbob-biobj_f32_i02_d20 0.952825148680034",
-  "bbob-biobj_f33_i02_d20 0.995145856008500",
-  "bbob-biobj_f34_i02_d20 0.945734288886854",
-  "bbob-biobj_f35_i02_d20 0.562626515534495",
-  "bbob-biobj_f36_i02_d20 0.853002962519736",
-  "bbob-biobj_f37_i02_d20 0.791206082149838",
-  "bbob-biobj_f38_i02_d20 0.831416002232897",
-  "bbob-biobj_f39_i02_d20 0.925983417616201",
-  "bbob-biobj_f40_i02_d20 0.642477793559315",
-  "bbob-biobj_f41_i02_d20 0.981567395886612",
-  "bbob-biobj_f42_i02_d20 0.923183103750550",
-  "bbob-biobj_f43_i02_d20 0.949407597000968",
-  "bbob-biobj_f44_i02_d20 0.984808860864267",
-  "bbob-biobj_f45_i02_d20 0.852098050671580",
-  "bbob-biobj_f46_i02_d20 0.958146492122573",
-  "bbob-biobj_f47_i02_d20 0.945678805745313",
-  "bbob-biobj_f48_i02_d20 0.967533523071136",
-  "bbob-biobj_f49_i02_d20 0.837247494706153",
-  "bbob-biobj_f50_i02_d20 0.959931559263060",
-  "bbob-biobj_f51_i02_d20 0.992534422266171",
-  "bbob-biobj_f52_i02_d20 0.950858291006400",
-  "bbob-biobj_f53_i02_d20 0.987969509582036",
-  "bbob-biobj_f54_i02_d20 0.978225145117985",
-  "bbob-biobj_f55_i02_d20 0.699993045686106",
-  "bbob-biobj_f01_i03_d20 0.833207521400968",
-  "bbob-biobj_f02_i03_d20 0.971885666260855",
-  "bbob-biobj_f03_i03_d20 0.867590832620030",
-  "bbob-biobj_f04_i03_d20 0.931434213203625",
-  "bbob-biobj_f05_i03_d20 0.696985444884746",
-  "bbob-biobj_f06_i03_d20 0.932749941659490",
-  "bbob-biobj_f07_i03_d20 0.892063400048704",
-  "bbob-biobj_f08_i03_d20 0.942965524283337",
-  "bbob-biobj_f09_i03_d20 0.970314871167049",
-  "bbob-biobj_f10_i03_d20 0.798213543037889",
-  "bbob-biobj_f11_i03_d20 0.835169240533775",
-  "bbob-biobj_f12_i03_d20 0.999764598785675",
-  "bbob-biobj_f13_i03_d20 0.945554751631722",
-  "bbob-biobj_f14_i03_d20 0.918198725867560",
-  "bbob-biobj_f15_i03_d20 0.982795143126842",
-  "bbob-biobj_f16_i03_d20 0.982441628031722",
-  "bbob-biobj_f17_i03_d20 0.982008215732887",
-  "bbob-biobj_f18_i03_d20 0.960648393061043",
-  "bbob-biobj_f19_i03_d20 0.991084701753494",
-  "bbob-biobj_f20_i03_d20 0.999797571885116",
-  "bbob-biobj_f21_i03_d20 0.993042259812321",
-  "bbob-biobj_f22_i03_d20 0.863037194905385",
-  "bbob-biobj_f23_i03_d20 0.969015262636722",
-  "bbob-biobj_f24_i03_d20 0.974158431697382",
-  "bbob-biobj_f25_i03_d20 0.980237145217646",
-  "bbob-biobj_f26_i03_d20 0.999941845924102",
-  "bbob-biobj_f27_i03_d20 0.966326579324806",
-  "bbob-biobj_f28_i03_d20 0.993689625845595",
-  "bbob-biobj_f29_i03_d20 0.830492615308720",
-  "bbob-biobj_f30_i03_d20 0.967954312930621",
-  "bbob-biobj_f31_i03_d20 0.965341381122931",
-  "bbob-biobj_f32_i03_d20 0.976568072290851",
-  "bbob-biobj_f33_i03_d20 0.998359564750281",
-  "bbob-biobj_f34_i03_d20 0.940411316149631",
-  "bbob-biobj_f35_i03_d20 0.607203080701355",
-  "bbob-biobj_f36_i03_d20 0.787245980941896",
-  "bbob-biobj_f37_i03_d20 0.803796059074190",
-  "bbob-biobj_f38_i03_d20 0.823215690310603",
-  "bbob-biobj_f39_i03_d20 0.867987216605950",
-  "bbob-biobj_f40_i03_d20 0.526915574313714",
-  "bbob-biobj_f41_i03_d20 0.940969566962786",
-  "bbob-biobj_f42_i03_d20 0.934841434007581",
-  "bbob-biobj_f43_i03_d20 0.969352413799934",
-  "bbob-biobj_f44_i03_d20 0.977777943741785",
-  "bbob-biobj_f45_i03_d20 0.945073198593724",
-  "bbob-biobj_f46_i03_d20 0.909377080263067",
-  "bbob-biobj_f47_i03_d20 0.934536748258848",
-  "bbob-biobj_f48_i03_d20 0.968046040742238",
-  "bbob-biobj_f49_i03_d20 0.866707518347003",
-  "bbob-biobj_f50_i03_d20 0.952394555329134",
-  "bbob-biobj_f51_i03_d20 0.979882710827667",
-  "bbob-biobj_f52_i03_d20 0.884818897545810",
-  "bbob-biobj_f53_i03_d20 0.998224919757182",
-  "bbob-biobj_f54_i03_d20 0.985256057145942",
-  "bbob-biobj_f55_i03_d20 0.627087123225424",
-  "bbob-biobj_f01_i04_d20 0.833192956226617",
-  "bbob-biobj_f02_i04_d20 0.977340500860808",
-  "bbob-biobj_f03_i04_d20 0.932742245214901",
-  "bbob-biobj_f04_i04_d20 0.942489452391897",
-  "bbob-biobj_f05_i04_d20 0.705079145373040",
-  "bbob-biobj_f06_i04_d20 0.900973814111433",
-  "bbob-biobj_f07_i04_d20 0.890270640994631",
-  "bbob-biobj_f08_i04_d20 0.952939543470624",
-  "bbob-biobj_f09_i04_d20 0.961704687457553",
-  "bbob-biobj_f10_i04_d20 0.799982069242448",
-  "bbob-biobj_f11_i04_d20 0.838271802147750",
-  "bbob-biobj_f12_i04_d20 0.999893480350420",
-  "bbob-biobj_f13_i04_d20 0.997752775119298",
-  "bbob-biobj_f14_i04_d20 0.901904902084317",
-  "bbob-biobj_f15_i04_d20 0.973572777182183",
-  "bbob-biobj_f16_i04_d20 0.970719482640897",
-  "bbob-biobj_f17_i04_d20 0.991471773388835",
-  "bbob-biobj_f18_i04_d20 0.933574764370316",
-  "bbob-biobj_f19_i04_d20 0.976602774560082",
-  "bbob-biobj_f20_i04_d20 0.999612927554968",
-  "bbob-biobj_f21_i04_d20 0.996013897009277",
-  "bbob-biobj_f22_i04_d20 0.915550717900235",
-  "bbob-biobj_f23_i04_d20 0.983076179674251",
-  "bbob-biobj_f24_i04_d20 0.946754908478271",
-  "bbob-biobj_f25_i04_d20 0.989725294009121",
-  "bbob-biobj_f26_i04_d20 0.999909932046990",
-  "bbob-biobj_f27_i04_d20 0.978836095719902",
-  "bbob-biobj_f28_i04_d20 0.994424823780871",
-  "bbob-biobj_f29_i04_d20 0.865072550285352",
-  "bbob-biobj_f30_i04_d20 0.980946148952653",
-  "bbob-biobj_f31_i04_d20 0.972561422620203",
-  "bbob-biobj_f32_i04_d20 0.987310542589914",
-  "bbob-biobj_f33_i04_d20 0.996908039867623",
-  "bbob-biobj_f34_i04_d20 0.941896717675520",
-  "bbob-biobj_f35_i04_d20 0.561293360823185",
-  "bbob-biobj_f36_i04_d20 0.765144559919577",
-  "bbob-biobj_f37_i04_d20 0.832238517568998",
-  "bbob-biobj_f38_i04_d20 0.895786547029985",
-  "bbob-biobj_f39_i04_d20 0.876651090885301",
-  "bbob-biobj_f40_i04_d20 0.748024984489584",
-  "bbob-biobj_f41_i04_d20 0.913016279845638",
-  "bbob-biobj_f42_i04_d20 0.946069738747989",
-  "bbob-biobj_f43_i04_d20 0.961067346749245",
-  "bbob-biobj_f44_i04_d20 0.984380170569094",
-  "bbob-biobj_f45_i04_d20 0.929099360296714",
-  "bbob-biobj_f46_i04_d20 0.929183556098456",
-  "bbob-biobj_f47_i04_d20 0.937896856037121",
-  "bbob-biobj_f48_i04_d20 0.971950258196312",
-  "bbob-biobj_f49_i04_d20 0.864994789361628",
-  "bbob-biobj_f50_i04_d20 0.983291149779151",
-  "bbob-biobj_f51_i04_d20 0.984992310658653",
-  "bbob-biobj_f52_i04_d20 0.918989825158548",
-  "bbob-biobj_f53_i04_d20 0.998920489662993",
-  "bbob-biobj_f54_i04_d20 0.980047132463936",
-  "bbob-biobj_f55_i04_d20 0.672975982289736",
-  "bbob-biobj_f01_i05_d20 0.833193870767885",
-  "bbob-biobj_f02_i05_d20 0.962907610238820",
-  "bbob-biobj_f03_i05_d20 0.875546362923703",
-  "bbob-biobj_f04_i05_d20 0.948719015894941",
-  "bbob-biobj_f05_i05_d20 0.695336775493654",
-  "bbob-biobj_f06_i05_d20 0.918011871071976",
-  "bbob-biobj_f07_i05_d20 0.882566753824316",
-  "bbob-biobj_f08_i05_d20 0.899000868137602",
-  "bbob-biobj_f09_i05_d20 0.963712318231473",
-  "bbob-biobj_f10_i05_d20 0.778425108988740",
-  "bbob-biobj_f11_i05_d20 0.841599694854327",
-  "bbob-biobj_f12_i05_d20 0.999092422297150",
-  "bbob-biobj_f13_i05_d20 0.998296287709533",
-  "bbob-biobj_f14_i05_d20 0.885441381715590",
-  "bbob-biobj_f15_i05_d20 0.988065459065354",
-  "bbob-biobj_f16_i05_d20 0.972334277129038",
-  "bbob-biobj_f17_i05_d20 0.997205869239149",
-  "bbob-biobj_f18_i05_d20 0.975433208837123",
-  "bbob-biobj_f19_i05_d20 0.984394589632036",
-  "bbob-biobj_f20_i05_d20 0.958353867297278",
-  "bbob-biobj_f21_i05_d20 0.982048525244220",
-  "bbob-biobj_f22_i05_d20 0.789275134960876",
-  "bbob-biobj_f23_i05_d20 0.958464846939110",
-  "bbob-biobj_f24_i05_d20 0.920973148314878",
-  "bbob-biobj_f25_i05_d20 0.952640635479999",
-  "bbob-biobj_f26_i05_d20 0.994301440957288",
-  "bbob-biobj_f27_i05_d20 0.926053468064325",
-  "bbob-biobj_f28_i05_d20 0.995255418032090",
-  "bbob-biobj_f29_i05_d20 0.835821580662857",
-  "bbob-biobj_f30_i05_d20 0.986514821846012",
-  "bbob-biobj_f31_i05_d20 0.956051937738176",
-  "bbob-biobj_f32_i05_d20 0.986798393586952",
-  "bbob-biobj_f33_i05_d20 0.994306994720448",
-  "bbob-biobj_f34_i05_d20 0.946864128557638",
-  "bbob-biobj_f35_i05_d20 0.540572168829766",
-  "bbob-biobj_f36_i05_d20 0.865754635393962",
-  "bbob-biobj_f37_i05_d20 0.755137216311259",
-  "bbob-biobj_f38_i05_d20 0.873197184881281",
-  "bbob-biobj_f39_i05_d20 0.868176430670188",
-  "bbob-biobj_f40_i05_d20 0.618872595399021",
-  "bbob-biobj_f41_i05_d20 0.924477043807865",
-  "bbob-biobj_f42_i05_d20 0.947227551485381",
-  "bbob-biobj_f43_i05_d20 0.976336336221268",
-  "bbob-biobj_f44_i05_d20 0.974125388255757",
-  "bbob-biobj_f45_i05_d20 0.913161181130696",
-  "bbob-biobj_f46_i05_d20 0.893095136109460",
-  "bbob-biobj_f47_i05_d20 0.907278089365908",
-  "bbob-biobj_f48_i05_d20 0.951741879255749",
-  "bbob-biobj_f49_i05_d20 0.838461412725769",
-  "bbob-biobj_f50_i05_d20 0.977959065747409",
-  "bbob-biobj_f51_i05_d20 0.980069732709530",
-  "bbob-biobj_f52_i05_d20 0.935549795477864",
-  "bbob-biobj_f53_i05_d20 0.995339867406872",
-  "bbob-biobj_f54_i05_d20 0.984327935423081",
-  "bbob-biobj_f55_i05_d20 0.831000840653062",
-  "bbob-biobj_f01_i01_d40 1",
-  "bbob-biobj_f02_i01_d40 1",
-  "bbob-biobj_f03_i01_d40 1",
-  "bbob-biobj_f04_i01_d40 1",
-  "bbob-biobj_f05_i01_d40 1",
-  "bbob-biobj_f06_i01_d40 1",
-  "bbob-biobj_f07_i01_d40 1",
-  "bbob-biobj_f08_i01_d40 1",
-  "bbob-biobj_f09_i01_d40 1",
-  "bbob-biobj_f10_i01_d40 1",
-  "bbob-biobj_f11_i01_d40 1",
-  "bbob-biobj_f12_i01_d40 1",
-  "bbob-biobj_f13_i01_d40 1",
-  "bbob-biobj_f14_i01_d40 1",
-  "bbob-biobj_f15_i01_d40 1",
-  "bbob-biobj_f16_i01_d40 1",
-  "bbob-biobj_f17_i01_d40 1",
-  "bbob-biobj_f18_i01_d40 1",
-  "bbob-biobj_f19_i01_d40 1",
-  "bbob-biobj_f20_i01_d40 1",
-  "bbob-biobj_f21_i01_d40 1",
-  "bbob-biobj_f22_i01_d40 1",
-  "bbob-biobj_f23_i01_d40 1",
-  "bbob-biobj_f24_i01_d40 1",
-  "bbob-biobj_f25_i01_d40 1",
-  "bbob-biobj_f26_i01_d40 1",
-  "bbob-biobj_f27_i01_d40 1",
-  "bbob-biobj_f28_i01_d40 1",
-  "bbob-biobj_f29_i01_d40 1",
-  "bbob-biobj_f30_i01_d40 1",
-  "bbob-biobj_f31_i01_d40 1",
-  "bbob-biobj_f32_i01_d40 1",
-  "bbob-biobj_f33_i01_d40 1",
-  "bbob-biobj_f34_i01_d40 1",
-  "bbob-biobj_f35_i01_d40 1",
-  "bbob-biobj_f36_i01_d40 1",
-  "bbob-biobj_f37_i01_d40 1",
-  "bbob-biobj_f38_i01_d40 1",
-  "bbob-biobj_f39_i01_d40 1",
-  "bbob-biobj_f40_i01_d40 1",
-  "bbob-biobj_f41_i01_d40 1",
-  "bbob-biobj_f42_i01_d40 1",
-  "bbob-biobj_f43_i01_d40 1",
-  "bbob-biobj_f44_i01_d40 1",
-  "bbob-biobj_f45_i01_d40 1",
-  "bbob-biobj_f46_i01_d40 1",
-  "bbob-biobj_f47_i01_d40 1",
-  "bbob-biobj_f48_i01_d40 1",
-  "bbob-biobj_f49_i01_d40 1",
-  "bbob-biobj_f50_i01_d40 1",
-  "bbob-biobj_f51_i01_d40 1",
-  "bbob-biobj_f52_i01_d40 1",
-  "bbob-biobj_f53_i01_d40 1",
-  "bbob-biobj_f54_i01_d40 1",
-  "bbob-biobj_f55_i01_d40 1",
-  "bbob-biobj_f01_i02_d40 1",
-  "bbob-biobj_f02_i02_d40 1",
-  "bbob-biobj_f03_i02_d40 1",
-  "bbob-biobj_f04_i02_d40 1",
-  "bbob-biobj_f05_i02_d40 1",
-  "bbob-biobj_f06_i02_d40 1",
-  "bbob-biobj_f07_i02_d40 1",
-  "bbob-biobj_f08_i02_d40 1",
-  "bbob-biobj_f09_i02_d40 1",
-  "bbob-biobj_f10_i02_d40 1",
-  "bbob-biobj_f11_i02_d40 1",
-  "bbob-biobj_f12_i02_d40 1",
-  "bbob-biobj_f13_i02_d40 1",
-  "bbob-biobj_f14_i02_d40 1",
-  "bbob-biobj_f15_i02_d40 1",
-  "bbob-biobj_f16_i02_d40 1",
-  "bbob-biobj_f17_i02_d40 1",
-  "bbob-biobj_f18_i02_d40 1",
-  "bbob-biobj_f19_i02_d40 1",
-  "bbob-biobj_f20_i02_d40 1",
-  "bbob-biobj_f21_i02_d40 1",
-  "bbob-biobj_f22_i02_d40 1",
-  "bbob-biobj_f23_i02_d40 1",
-  "bbob-biobj_f24_i02_d40 1",
-  "bbob-biobj_f25_i02_d40 1",
-  "bbob-biobj_f26_i02_d40 1",
-  "bbob-biobj_f27_i02_d40 1",
-  "bbob-biobj_f28_i02_d40 1",
-  "bbob-biobj_f29_i02_d40 1",
-  "bbob-biobj_f30_i02_d40 1",
-  "bbob-biobj_f31_i02_d40 1",
-  "bbob-biobj_f32_i02_d40 1",
-  "bbob-biobj_f33_i02_d40 1",
-  "bbob-biobj_f34_i02_d40 1",
-  "bbob-biobj_f35_i02_d40 1",
-  "bbob-biobj_f36_i02_d40 1",
-  "bbob-biobj_f37_i02_d40 1",
-  "bbob-biobj_f38_i02_d40 1",
-  "bbob-biobj_f39_i02_d40 1",
-  "bbob-biobj_f40_i02_d40 1",
-  "bbob-biobj_f41_i02_d40 1",
-  "bbob-biobj_f42_i02_d40 1",
-  "bbob-biobj_f43_i02_d40 1",
-  "bbob-biobj_f44_i02_d40 1",
-  "bbob-biobj_f45_i02_d40 1",
-  "bbob-biobj_f46_i02_d40 1",
-  "bbob-biobj_f47_i02_d40 1",
-  "bbob-biobj_f48_i02_d40 1",
-  "bbob-biobj_f49_i02_d40 1",
-  "bbob-biobj_f50_i02_d40 1",
-  "bbob-biobj_f51_i02_d40 1",
-  "bbob-biobj_f52_i02_d40 1",
-  "bbob-biobj_f53_i02_d40 1",
-  "bbob-biobj_f54_i02_d40 1",
-  "bbob-biobj_f55_i02_d40 1",
-  "bbob-biobj_f01_i03_d40 1",
-  "bbob-biobj_f02_i03_d40 1",
-  "bbob-biobj_f03_i03_d40 1",
-  "bbob-biobj_f04_i03_d40 1",
-  "bbob-biobj_f05_i03_d40 1",
-  "bbob-biobj_f06_i03_d40 1",
-  "bbob-biobj_f07_i03_d40 1",
-  "bbob-biobj_f08_i03_d40 1",
-  "bbob-biobj_f09_i03_d40 1",
-  "bbob-biobj_f10_i03_d40 1",
-  "bbob-biobj_f11_i03_d40 1",
-  "bbob-biobj_f12_i03_d40 1",
-  "bbob-biobj_f13_i03_d40 1",
-  "bbob-biobj_f14_i03_d40 1",
-  "bbob-biobj_f15_i03_d40 1",
-  "bbob-biobj_f16_i03_d40 1",
-  "bbob-biobj_f17_i03_d40 1",
-  "bbob-biobj_f18_i03_d40 1",
-  "bbob-biobj_f19_i03_d40 1",
-  "bbob-biobj_f20_i03_d40 1",
-  "bbob-biobj_f21_i03_d40 1",
-  "bbob-biobj_f22_i03_d40 1",
-  "bbob-biobj_f23_i03_d40 1",
-  "bbob-biobj_f24_i03_d40 1",
-  "bbob-biobj_f25_i03_d40 1",
-  "bbob-biobj_f26_i03_d40 1",
-  "bbob-biobj_f27_i03_d40 1",
-  "bbob-biobj_f28_i03_d40 1",
-  "bbob-biobj_f29_i03_d40 1",
-  "bbob-biobj_f30_i03_d40 1",
-  "bbob-biobj_f31_i03_d40 1",
-  "bbob-biobj_f32_i03_d40 1",
-  "bbob-biobj_f33_i03_d40 1",
-  "bbob-biobj_f34_i03_d40 1",
-  "bbob-biobj_f35_i03_d40 1",
-  "bbob-biobj_f36_i03_d40 1",
-  "bbob-biobj_f37_i03_d40 1",
-  "bbob-biobj_f38_i03_d40 1",
-  "bbob-biobj_f39_i03_d40 1",
-  "bbob-biobj_f40_i03_d40 1",
-  "bbob-biobj_f41_i03_d40 1",
-  "bbob-biobj_f42_i03_d40 1",
-  "bbob-biobj_f43_i03_d40 1",
-  "bbob-biobj_f44_i03_d40 1",
-  "bbob-biobj_f45_i03_d40 1",
-  "bbob-biobj_f46_i03_d40 1",
-  "bbob-biobj_f47_i03_d40 1",
-  "bbob-biobj_f48_i03_d40 1",
-  "bbob-biobj_f49_i03_d40 1",
-  "bbob-biobj_f50_i03_d40 1",
-  "bbob-biobj_f51_i03_d40 1",
-  "bbob-biobj_f52_i03_d40 1",
-  "bbob-biobj_f53_i03_d40 1",
-  "bbob-biobj_f54_i03_d40 1",
-  "bbob-biobj_f55_i03_d40 1",
-  "bbob-biobj_f01_i04_d40 1",
-  "bbob-biobj_f02_i04_d40 1",
-  "bbob-biobj_f03_i04_d40 1",
-  "bbob-biobj_f04_i04_d40 1",
-  "bbob-biobj_f05_i04_d40 1",
-  "bbob-biobj_f06_i04_d40 1",
-  "bbob-biobj_f07_i04_d40 1",
-  "bbob-biobj_f08_i04_d40 1",
-  "bbob-biobj_f09_i04_d40 1",
-  "bbob-biobj_f10_i04_d40 1",
-  "bbob-biobj_f11_i04_d40 1",
-  "bbob-biobj_f12_i04_d40 1",
-  "bbob-biobj_f13_i04_d40 1",
-  "bbob-biobj_f14_i04_d40 1",
-  "bbob-biobj_f15_i04_d40 1",
-  "bbob-biobj_f16_i04_d40 1",
-  "bbob-biobj_f17_i04_d40 1",
-  "bbob-biobj_f18_i04_d40 1",
-  "bbob-biobj_f19_i04_d40 1",
-  "bbob-biobj_f20_i04_d40 1",
-  "bbob-biobj_f21_i04_d40 1",
-  "bbob-biobj_f22_i04_d40 1",
-  "bbob-biobj_f23_i04_d40 1",
-  "bbob-biobj_f24_i04_d40 1",
-  "bbob-biobj_f25_i04_d40 1",
-  "bbob-biobj_f26_i04_d40 1",
-  "bbob-biobj_f27_i04_d40 1",
-  "bbob-biobj_f28_i04_d40 1",
-  "bbob-biobj_f29_i04_d40 1",
-  "bbob-biobj_f30_i04_d40 1",
-  "bbob-biobj_f31_i04_d40 1",
-  "bbob-biobj_f32_i04_d40 1",
-  "bbob-biobj_f33_i04_d40 1",
-  "bbob-biobj_f34_i04_d40 1",
-  "bbob-biobj_f35_i04_d40 1",
-  "bbob-biobj_f36_i04_d40 1",
-  "bbob-biobj_f37_i04_d40 1",
-  "bbob-biobj_f38_i04_d40 1",
-  "bbob-biobj_f39_i04_d40 1",
-  "bbob-biobj_f40_i04_d40 1",
-  "bbob-biobj_f41_i04_d40 1",
-  "bbob-biobj_f42_i04_d40 1",
-  "bbob-biobj_f43_i04_d40 1",
-  "bbob-biobj_f44_i04_d40 1",
-  "bbob-biobj_f45_i04_d40 1",
-  "bbob-biobj_f46_i04_d40 1",
-  "bbob-biobj_f47_i04_d40 1",
-  "bbob-biobj_f48_i04_d40 1",
-  "bbob-biobj_f49_i04_d40 1",
-  "bbob-biobj_f50_i04_d40 1",
-  "bbob-biobj_f51_i04_d40 1",
-  "bbob-biobj_f52_i04_d40 1",
-  "bbob-biobj_f53_i04_d40 1",
-  "bbob-biobj_f54_i04_d40 1",
-  "bbob-biobj_f55_i04_d40 1",
-  "bbob-biobj_f01_i05_d40 1",
-  "bbob-biobj_f02_i05_d40 1",
-  "bbob-biobj_f03_i05_d40 1",
-  "bbob-biobj_f04_i05_d40 1",
-  "bbob-biobj_f05_i05_d40 1",
-  "bbob-biobj_f06_i05_d40 1",
-  "bbob-biobj_f07_i05_d40 1",
-  "bbob-biobj_f08_i05_d40 1",
-  "bbob-biobj_f09_i05_d40 1",
-  "bbob-biobj_f10_i05_d40 1",
-  "bbob-biobj_f11_i05_d40 1",
-  "bbob-biobj_f12_i05_d40 1",
-  "bbob-biobj_f13_i05_d40 1",
-  "bbob-biobj_f14_i05_d40 1",
-  "bbob-biobj_f15_i05_d40 1",
-  "bbob-biobj_f16_i05_d40 1",
-  "bbob-biobj_f17_i05_d40 1",
-  "bbob-biobj_f18_i05_d40 1",
-  "bbob-biobj_f19_i05_d40 1",
-  "bbob-biobj_f20_i05_d40 1",
-  "bbob-biobj_f21_i05_d40 1",
-  "bbob-biobj_f22_i05_d40 1",
-  "bbob-biobj_f23_i05_d40 1",
-  "bbob-biobj_f24_i05_d40 1",
-  "bbob-biobj_f25_i05_d40 1",
-  "bbob-biobj_f26_i05_d40 1",
-  "bbob-biobj_f27_i05_d40 1",
-  "bbob-biobj_f28_i05_d40 1",
-  "bbob-biobj_f29_i05_d40 1",
-  "bbob-biobj_f30_i05_d40 1",
-  "bbob-biobj_f31_i05_d40 1",
-  "bbob-biobj_f32_i05_d40 1",
-  "bbob-biobj_f33_i05_d40 1",
-  "bbob-biobj_f34_i05_d40 1",
-  "bbob-biobj_f35_i05_d40 1",
-  "bbob-biobj_f36_i05_d40 1",
-  "bbob-biobj_f37_i05_d40 1",
-  "bbob-biobj_f38_i05_d40 1",
-  "bbob-biobj_f39_i05_d40 1",
-  "bbob-biobj_f40_i05_d40 1",
-  "bbob-biobj_f41_i05_d40 1",
-  "bbob-biobj_f42_i05_d40 1",
-  "bbob-biobj_f43_i05_d40 1",
-  "bbob-biobj_f44_i05_d40 1",
-  "bbob-biobj_f45_i05_d40 1",
-  "bbob-biobj_f46_i05_d40 1",
-  "bbob-biobj_f47_i05_d40 1",
-  "bbob-biobj_f48_i05_d40 1",
-  "bbob-biobj_f49_i05_d40 1",
-  "bbob-biobj_f50_i05_d40 1",
-  "bbob-biobj_f51_i05_d40 1",
-  "bbob-biobj_f52_i05_d40 1",
-  "bbob-biobj_f53_i05_d40 1",
-  "bbob-biobj_f54_i05_d40 1",
-  "bbob-biobj_f55_i05_d40 1",
-  "bbob-biobj_f01_i06_d02 1",
-  "bbob-biobj_f02_i06_d02 1",
-  "bbob-biobj_f03_i06_d02 1",
-  "bbob-biobj_f04_i06_d02 1",
-  "bbob-biobj_f05_i06_d02 1",
-  "bbob-biobj_f06_i06_d02 1",
-  "bbob-biobj_f07_i06_d02 1",
-  "bbob-biobj_f08_i06_d02 1",
-  "bbob-biobj_f09_i06_d02 1",
-  "bbob-biobj_f10_i06_d02 1",
-  "bbob-biobj_f11_i06_d02 1",
-  "bbob-biobj_f12_i06_d02 1",
-  "bbob-biobj_f13_i06_d02 1",
-  "bbob-biobj_f14_i06_d02 1",
-  "bbob-biobj_f15_i06_d02 1",
-  "bbob-biobj_f16_i06_d02 1",
-  "bbob-biobj_f17_i06_d02 1",
-  "bbob-biobj_f18_i06_d02 1",
-  "bbob-biobj_f19_i06_d02 1",
-  "bbob-biobj_f20_i06_d02 1",
-  "bbob-biobj_f21_i06_d02 1",
-  "bbob-biobj_f22_i06_d02 1",
-  "bbob-biobj_f23_i06_d02 1",
-  "bbob-biobj_f24_i06_d02 1",
-  "bbob-biobj_f25_i06_d02 1",
-  "bbob-biobj_f26_i06_d02 1",
-  "bbob-biobj_f27_i06_d02 1",
-  "bbob-biobj_f28_i06_d02 1",
-  "bbob-biobj_f29_i06_d02 1",
-  "bbob-biobj_f30_i06_d02 1",
-  "bbob-biobj_f31_i06_d02 1",
-  "bbob-biobj_f32_i06_d02 1",
-  "bbob-biobj_f33_i06_d02 1",
-  "bbob-biobj_f34_i06_d02 1",
-  "bbob-biobj_f35_i06_d02 1",
-  "bbob-biobj_f36_i06_d02 1",
-  "bbob-biobj_f37_i06_d02 1",
-  "bbob-biobj_f38_i06_d02 1",
-  "bbob-biobj_f39_i06_d02 1",
-  "bbob-biobj_f40_i06_d02 1",
-  "bbob-biobj_f41_i06_d02 1",
-  "bbob-biobj_f42_i06_d02 1",
-  "bbob-biobj_f43_i06_d02 1",
-  "bbob-biobj_f44_i06_d02 1",
-  "bbob-biobj_f45_i06_d02 1",
-  "bbob-biobj_f46_i06_d02 1",
-  "bbob-biobj_f47_i06_d02 1",
-  "bbob-biobj_f48_i06_d02 1",
-  "bbob-biobj_f49_i06_d02 1",
-  "bbob-biobj_f50_i06_d02 1",
-  "bbob-biobj_f51_i06_d02 1",
-  "bbob-biobj_f52_i06_d02 1",
-  "bbob-biobj_f53_i06_d02 1",
-  "bbob-biobj_f54_i06_d02 1",
-  "bbob-biobj_f55_i06_d02 1",
-  "bbob-biobj_f01_i07_d02 1",
-  "bbob-biobj_f02_i07_d02 1",
-  "bbob-biobj_f03_i07_d02 1",
-  "bbob-biobj_f04_i07_d02 1",
-  "bbob-biobj_f05_i07_d02 1",
-  "bbob-biobj_f06_i07_d02 1",
-  "bbob-biobj_f07_i07_d02 1",
-  "bbob-biobj_f08_i07_d02 1",
-  "bbob-biobj_f09_i07_d02 1",
-  "bbob-biobj_f10_i07_d02 1",
-  "bbob-biobj_f11_i07_d02 1",
-  "bbob-biobj_f12_i07_d02 1",
-  "bbob-biobj_f13_i07_d02 1",
-  "bbob-biobj_f14_i07_d02 1",
-  "bbob-biobj_f15_i07_d02 1",
-  "bbob-biobj_f16_i07_d02 1",
-  "bbob-biobj_f17_i07_d02 1",
-  "bbob-biobj_f18_i07_d02 1",
-  "bbob-biobj_f19_i07_d02 1",
-  "bbob-biobj_f20_i07_d02 1",
-  "bbob-biobj_f21_i07_d02 1",
-  "bbob-biobj_f22_i07_d02 1",
-  "bbob-biobj_f23_i07_d02 1",
-  "bbob-biobj_f24_i07_d02 1",
-  "bbob-biobj_f25_i07_d02 1",
-  "bbob-biobj_f26_i07_d02 1",
-  "bbob-biobj_f27_i07_d02 1",
-  "bbob-biobj_f28_i07_d02 1",
-  "bbob-biobj_f29_i07_d02 1",
-  "bbob-biobj_f30_i07_d02 1",
-  "bbob-biobj_f31_i07_d02 1",
-  "bbob-biobj_f32_i07_d02 1",
-  "bbob-biobj_f33_i07_d02 1",
-  "bbob-biobj_f34_i07_d02 1",
-  "bbob-biobj_f35_i07_d02 1",
-  "bbob-biobj_f36_i07_d02 1",
-  "bbob-biobj_f37_i07_d02 1",
-  "bbob-biobj_f38_i07_d02 1",
-  "bbob-biobj_f39_i07_d02 1",
-  "bbob-biobj_f40_i07_d02 1",
-  "bbob-biobj_f41_i07_d02 1",
-  "bbob-biobj_f42_i07_d02 1",
-  "bbob-biobj_f43_i07_d02 1",
-  "bbob-biobj_f44_i07_d02 1",
-  "bbob-biobj_f45_i07_d02 1",
-  "bbob-biobj_f46_i07_d02 1",
-  "bbob-biobj_f47_i07_d02 1",
-  "bbob-biobj_f48_i07_d02 1",
-  "bbob-biobj_f49_i07_d02 1",
-  "bbob-biobj_f50_i07_d02 1",
-  "bbob-biobj_f51_i07_d02 1",
-  "bbob-biobj_f52_i07_d02 1",
-  "bbob-biobj_f53_i07_d02 1",
-  "bbob-biobj_f54_i07_d02 1",
-  "bbob-biobj_f55_i07_d02 1",
-  "bbob-biobj_f01_i08_d02 1",
-  "bbob-biobj_f02_i08_d02 1",
-  "bbob-biobj_f03_i08_d02 1",
-  "bbob-biobj_f04_i08_d02 1",
-  "bbob-biobj_f05_i08_d02 1",
-  "bbob-biobj_f06_i08_d02 1",
-  "bbob-biobj_f07_i08_d02 1",
-  "bbob-biobj_f08_i08_d02 1",
-  "bbob-biobj_f09_i08_d02 1",
-  "bbob-biobj_f10_i08_d02 1",
-  "bbob-biobj_f11_i08_d02 1",
-  "bbob-biobj_f12_i08_d02 1",
-  "bbob-biobj_f13_i08_d02 1",
-  "bbob-biobj_f14_i08_d02 1",
-  "bbob-biobj_f15_i08_d02 1",
-  "bbob-biobj_f16_i08_d02 1",
-  "bbob-biobj_f17_i08_d02 1",
-  "bbob-biobj_f18_i08_d02 1",
-  "bbob-biobj_f19_i08_d02 1",
-  "bbob-biobj_f20_i08_d02 1",
-  "bbob-biobj_f21_i08_d02 1",
-  "bbob-biobj_f22_i08_d02 1",
-  "bbob-biobj_f23_i08_d02 1",
-  "bbob-biobj_f24_i08_d02 1",
-  "bbob-biobj_f25_i08_d02 1",
-  "bbob-biobj_f26_i08_d02 1",
-  "bbob-biobj_f27_i08_d02 1",
-  "bbob-biobj_f28_i08_d02 1",
-  "bbob-biobj_f29_i08_d02 1",
-  "bbob-biobj_f30_i08_d02 1",
-  "bbob-biobj_f31_i08_d02 1",
-  "bbob-biobj_f32_i08_d02 1",
-  "bbob-biobj_f33_i08_d02 1",
-  "bbob-biobj_f34_i08_d02 1",
-  "bbob-biobj_f35_i08_d02 1",
-  "bbob-biobj_f36_i08_d02 1",
-  "bbob-biobj_f37_i08_d02 1",
-  "bbob-biobj_f38_i08_d02 1",
-  "bbob-biobj_f39_i08_d02 1",
-  "bbob-biobj_f40_i08_d02 1",
-  "bbob-biobj_f41_i08_d02 1",
-  "bbob-biobj_f42_i08_d02 1",
-  "bbob-biobj_f43_i08_d02 1",
-  "bbob-biobj_f44_i08_d02 1",
-  "bbob-biobj_f45_i08_d02 1",
-  "bbob-biobj_f46_i08_d02 1",
-  "bbob-biobj_f47_i08_d02 1",
-  "bbob-biobj_f48_i08_d02 1",
-  "bbob-biobj_f49_i08_d02 1",
-  "bbob-biobj_f50_i08_d02 1",
-  "bbob-biobj_f51_i08_d02 1",
-  "bbob-biobj_f52_i08_d02 1",
-  "bbob-biobj_f53_i08_d02 1",
-  "bbob-biobj_f54_i08_d02 1",
-  "bbob-biobj_f55_i08_d02 1",
-  "bbob-biobj_f01_i09_d02 1",
-  "bbob-biobj_f02_i09_d02 1",
-  "bbob-biobj_f03_i09_d02 1",
-  "bbob-biobj_f04_i09_d02 1",
-  "bbob-biobj_f05_i09_d02 1",
-  "bbob-biobj_f06_i09_d02 1",
-  "bbob-biobj_f07_i09_d02 1",
-  "bbob-biobj_f08_i09_d02 1",
-  "bbob-biobj_f09_i09_d02 1",
-  "bbob-biobj_f10_i09_d02 1",
-  "bbob-biobj_f11_i09_d02 1",
-  "bbob-biobj_f12_i09_d02 1",
-  "bbob-biobj_f13_i09_d02 1",
-  "bbob-biobj_f14_i09_d02 1",
-  "bbob-biobj_f15_i09_d02 1",
-  "bbob-biobj_f16_i09_d02 1",
-  "bbob-biobj_f17_i09_d02 1",
-  "bbob-biobj_f18_i09_d02 1",
-  "bbob-biobj_f19_i09_d02 1",
-  "bbob-biobj_f20_i09_d02 1",
-  "bbob-biobj_f21_i09_d02 1",
-  "bbob-biobj_f22_i09_d02 1",
-  "bbob-biobj_f23_i09_d02 1",
-  "bbob-biobj_f24_i09_d02 1",
-  "bbob-biobj_f25_i09_d02 1",
-  "bbob-biobj_f26_i09_d02 1",
-  "bbob-biobj_f27_i09_d02 1",
-  "bbob-biobj_f28_i09_d02 1",
-  "bbob-biobj_f29_i09_d02 1",
-  "bbob-biobj_f30_i09_d02 1",
-  "bbob-biobj_f31_i09_d02 1",
-  "bbob-biobj_f32_i09_d02 1",
-  "bbob-biobj_f33_i09_d02 1",
-  "bbob-biobj_f34_i09_d02 1",
-  "bbob-biobj_f35_i09_d02 1",
-  "bbob-biobj_f36_i09_d02 1",
-  "bbob-biobj_f37_i09_d02 1",
-  "bbob-biobj_f38_i09_d02 1",
-  "bbob-biobj_f39_i09_d02 1",
-  "bbob-biobj_f40_i09_d02 1",
-  "bbob-biobj_f41_i09_d02 1",
-  "bbob-biobj_f42_i09_d02 1",
-  "bbob-biobj_f43_i09_d02 1",
-  "bbob-biobj_f44_i09_d02 1",
-  "bbob-biobj_f45_i09_d02 1",
-  "bbob-biobj_f46_i09_d02 1",
-  "bbob-biobj_f47_i09_d02 1",
-  "bbob-biobj_f48_i09_d02 1",
-  "bbob-biobj_f49_i09_d02 1",
-  "bbob-biobj_f50_i09_d02 1",
-  "bbob-biobj_f51_i09_d02 1",
-  "bbob-biobj_f52_i09_d02 1",
-  "bbob-biobj_f53_i09_d02 1",
-  "bbob-biobj_f54_i09_d02 1",
-  "bbob-biobj_f55_i09_d02 1",
-  "bbob-biobj_f01_i10_d02 1",
-  "bbob-biobj_f02_i10_d02 1",
-  "bbob-biobj_f03_i10_d02 1",
-  "bbob-biobj_f04_i10_d02 1",
-  "bbob-biobj_f05_i10_d02 1",
-  "bbob-biobj_f06_i10_d02 1",
-  "bbob-biobj_f07_i10_d02 1",
-  "bbob-biobj_f08_i10_d02 1",
-  "bbob-biobj_f09_i10_d02 1",
-  "bbob-biobj_f10_i10_d02 1",
-  "bbob-biobj_f11_i10_d02 1",
-  "bbob-biobj_f12_i10_d02 1",
-  "bbob-biobj_f13_i10_d02 1",
-  "bbob-biobj_f14_i10_d02 1",
-  "bbob-biobj_f15_i10_d02 1",
-  "bbob-biobj_f16_i10_d02 1",
-  "bbob-biobj_f17_i10_d02 1",
-  "bbob-biobj_f18_i10_d02 1",
-  "bbob-biobj_f19_i10_d02 1",
-  "bbob-biobj_f20_i10_d02 1",
-  "bbob-biobj_f21_i10_d02 1",
-  "bbob-biobj_f22_i10_d02 1",
-  "bbob-biobj_f23_i10_d02 1",
-  "bbob-biobj_f24_i10_d02 1",
-  "bbob-biobj_f25_i10_d02 1",
-  "bbob-biobj_f26_i10_d02 1",
-  "bbob-biobj_f27_i10_d02 1",
-  "bbob-biobj_f28_i10_d02 1",
-  "bbob-biobj_f29_i10_d02 1",
-  "bbob-biobj_f30_i10_d02 1",
-  "bbob-biobj_f31_i10_d02 1",
-  "bbob-biobj_f32_i10_d02 1",
-  "bbob-biobj_f33_i10_d02 1",
-  "bbob-biobj_f34_i10_d02 1",
-  "bbob-biobj_f35_i10_d02 1",
-  "bbob-biobj_f36_i10_d02 1",
-  "bbob-biobj_f37_i10_d02 1",
-  "bbob-biobj_f38_i10_d02 1",
-  "bbob-biobj_f39_i10_d02 1",
-  "bbob-biobj_f40_i10_d02 1",
-  "bbob-biobj_f41_i10_d02 1",
-  "bbob-biobj_f42_i10_d02 1",
-  "bbob-biobj_f43_i10_d02 1",
-  "bbob-biobj_f44_i10_d02 1",
-  "bbob-biobj_f45_i10_d02 1",
-  "bbob-biobj_f46_i10_d02 1",
-  "bbob-biobj_f47_i10_d02 1",
-  "bbob-biobj_f48_i10_d02 1",
-  "bbob-biobj_f49_i10_d02 1",
-  "bbob-biobj_f50_i10_d02 1",
-  "bbob-biobj_f51_i10_d02 1",
-  "bbob-biobj_f52_i10_d02 1",
-  "bbob-biobj_f53_i10_d02 1",
-  "bbob-biobj_f54_i10_d02 1",
-  "bbob-biobj_f55_i10_d02 1",
-  "bbob-biobj_f01_i06_d03 1",
-  "bbob-biobj_f02_i06_d03 1",
-  "bbob-biobj_f03_i06_d03 1",
-  "bbob-biobj_f04_i06_d03 1",
-  "bbob-biobj_f05_i06_d03 1",
-  "bbob-biobj_f06_i06_d03 1",
-  "bbob-biobj_f07_i06_d03 1",
-  "bbob-biobj_f08_i06_d03 1",
-  "bbob-biobj_f09_i06_d03 1",
-  "bbob-biobj_f10_i06_d03 1",
-  "bbob-biobj_f11_i06_d03 1",
-  "bbob-biobj_f12_i06_d03 1",
-  "bbob-biobj_f13_i06_d03 1",
-  "bbob-biobj_f14_i06_d03 1",
-  "bbob-biobj_f15_i06_d03 1",
-  "bbob-biobj_f16_i06_d03 1",
-  "bbob-biobj_f17_i06_d03 1",
-  "bbob-biobj_f18_i06_d03 1",
-  "bbob-biobj_f19_i06_d03 1",
-  "bbob-biobj_f20_i06_d03 1",
-  "bbob-biobj_f21_i06_d03 1",
-  "bbob-biobj_f22_i06_d03 1",
-  "bbob-biobj_f23_i06_d03 1",
-  "bbob-biobj_f24_i06_d03 1",
-  "bbob-biobj_f25_i06_d03 1",
-  "bbob-biobj_f26_i06_d03 1",
-  "bbob-biobj_f27_i06_d03 1",
-  "bbob-biobj_f28_i06_d03 1",
-  "bbob-biobj_f29_i06_d03 1",
-  "bbob-biobj_f30_i06_d03 1",
-  "bbob-biobj_f31_i06_d03 1",
-  "bbob-biobj_f32_i06_d03 1",
-  "bbob-biobj_f33_i06_d03 1",
-  "bbob-biobj_f34_i06_d03 1",
-  "bbob-biobj_f35_i06_d03 1",
-  "bbob-biobj_f36_i06_d03 1",
-  "bbob-biobj_f37_i06_d03 1",
-  "bbob-biobj_f38_i06_d03 1",
-  "bbob-biobj_f39_i06_d03 1",
-  "bbob-biobj_f40_i06_d03 1",
-  "bbob-biobj_f41_i06_d03 1",
-  "bbob-biobj_f42_i06_d03 1",
-  "bbob-biobj_f43_i06_d03 1",
-  "bbob-biobj_f44_i06_d03 1",
-  "bbob-biobj_f45_i06_d03 1",
-  "bbob-biobj_f46_i06_d03 1",
-  "bbob-biobj_f47_i06_d03 1",
-  "bbob-biobj_f48_i06_d03 1",
-  "bbob-biobj_f49_i06_d03 1",
-  "bbob-biobj_f50_i06_d03 1",
-  "bbob-biobj_f51_i06_d03 1",
-  "bbob-biobj_f52_i06_d03 1",
-  "bbob-biobj_f53_i06_d03 1",
-  "bbob-biobj_f54_i06_d03 1",
-  "bbob-biobj_f55_i06_d03 1",
-  "bbob-biobj_f01_i07_d03 1",
-  "bbob-biobj_f02_i07_d03 1",
-  "bbob-biobj_f03_i07_d03 1",
-  "bbob-biobj_f04_i07_d03 1",
-  "bbob-biobj_f05_i07_d03 1",
-  "bbob-biobj_f06_i07_d03 1",
-  "bbob-biobj_f07_i07_d03 1",
-  "bbob-biobj_f08_i07_d03 1",
-  "bbob-biobj_f09_i07_d03 1",
-  "bbob-biobj_f10_i07_d03 1",
-  "bbob-biobj_f11_i07_d03 1",
-  "bbob-biobj_f12_i07_d03 1",
-  "bbob-biobj_f13_i07_d03 1",
-  "bbob-biobj_f14_i07_d03 1",
-  "bbob-biobj_f15_i07_d03 1",
-  "bbob-biobj_f16_i07_d03 1",
-  "bbob-biobj_f17_i07_d03 1",
-  "bbob-biobj_f18_i07_d03 1",
-  "bbob-biobj_f19_i07_d03 1",
-  "bbob-biobj_f20_i07_d03 1",
-  "bbob-biobj_f21_i07_d03 1",
-  "bbob-biobj_f22_i07_d03 1",
-  "bbob-biobj_f23_i07_d03 1",
-  "bbob-biobj_f24_i07_d03 1",
-  "bbob-biobj_f25_i07_d03 1",
-  "bbob-biobj_f26_i07_d03 1",
-  "bbob-biobj_f27_i07_d03 1",
-  "bbob-biobj_f28_i07_d03 1",
-  "bbob-biobj_f29_i07_d03 1",
-  "bbob-biobj_f30_i07_d03 1",
-  "bbob-biobj_f31_i07_d03 1",
-  "bbob-biobj_f32_i07_d03 1",
-  "bbob-biobj_f33_i07_d03 1",
-  "bbob-biobj_f34_i07_d03 1",
-  "bbob-biobj_f35_i07_d03 1",
-  "bbob-biobj_f36_i07_d03 1",
-  "bbob-biobj_f37_i07_d03 1",
-  "bbob-biobj_f38_i07_d03 1",
-  "bbob-biobj_f39_i07_d03 1",
-  "bbob-biobj_f40_i07_d03 1",
-  "bbob-biobj_f41_i07_d03 1",
-  "bbob-biobj_f42_i07_d03 1",
-  "bbob-biobj_f43_i07_d03 1",
-  "bbob-biobj_f44_i07_d03 1",
-  "bbob-biobj_f45_i07_d03 1",
-  "bbob-biobj_f46_i07_d03 1",
-  "bbob-biobj_f47_i07_d03 1",
-  "bbob-biobj_f48_i07_d03 1",
-  "bbob-biobj_f49_i07_d03 1",
-  "bbob-biobj_f50_i07_d03 1",
-  "bbob-biobj_f51_i07_d03 1",
-  "bbob-biobj_f52_i07_d03 1",
-  "bbob-biobj_f53_i07_d03 1",
-  "bbob-biobj_f54_i07_d03 1",
-  "bbob-biobj_f55_i07_d03 1",
-  "bbob-biobj_f01_i08_d03 1",
-  "bbob-biobj_f02_i08_d03 1",
-  "bbob-biobj_f03_i08_d03 1",
-  "bbob-biobj_f04_i08_d03 1",
-  "bbob-biobj_f05_i08_d03 1",
-  "bbob-biobj_f06_i08_d03 1",
-  "bbob-biobj_f07_i08_d03 1",
-  "bbob-biobj_f08_i08_d03 1",
-  "bbob-biobj_f09_i08_d03 1",
-  "bbob-biobj_f10_i08_d03 1",
-  "bbob-biobj_f11_i08_d03 1",
-  "bbob-biobj_f12_i08_d03 1",
-  "bbob-biobj_f13_i08_d03 1",
-  "bbob-biobj_f14_i08_d03 1",
-  "bbob-biobj_f15_i08_d03 1",
-  "bbob-biobj_f16_i08_d03 1",
-  "bbob-biobj_f17_i08_d03 1",
-  "bbob-biobj_f18_i08_d03 1",
-  "bbob-biobj_f19_i08_d03 1",
-  "bbob-biobj_f20_i08_d03 1",
-  "bbob-biobj_f21_i08_d03 1",
-  "bbob-biobj_f22_i08_d03 1",
-  "bbob-biobj_f23_i08_d03 1",
-  "bbob-biobj_f24_i08_d03 1",
-  "bbob-biobj_f25_i08_d03 1",
-  "bbob-biobj_f26_i08_d03 1",
-  "bbob-biobj_f27_i08_d03 1",
-  "bbob-biobj_f28_i08_d03 1",
-  "bbob-biobj_f29_i08_d03 1",
-  "bbob-biobj_f30_i08_d03 1",
-  "bbob-biobj_f31_i08_d03 1",
-  "bbob-biobj_f32_i08_d03 1",
-  "bbob-biobj_f33_i08_d03 1",
-  "bbob-biobj_f34_i08_d03 1",
-  "bbob-biobj_f35_i08_d03 1",
-  "bbob-biobj_f36_i08_d03 1",
-  "bbob-biobj_f37_i08_d03 1",
-  "bbob-biobj_f38_i08_d03 1",
-  "bbob-biobj_f39_i08_d03 1",
-  "bbob-biobj_f40_i08_d03 1",
-  "bbob-biobj_f41_i08_d03 1",
-  "bbob-biobj_f42_i08_d03 1",
-  "bbob-biobj_f43_i08_d03 1",
-  "bbob-biobj_f44_i08_d03 1",
-  "bbob-biobj_f45_i08_d03 1",
-  "bbob-biobj_f46_i08_d03 1",
-  "bbob-biobj_f47_i08_d03 1",
-  "bbob-biobj_f48_i08_d03 1",
-  "bbob-biobj_f49_i08_d03 1",
-  "bbob-biobj_f50_i08_d03 1",
-  "bbob-biobj_f51_i08_d03 1",
-  "bbob-biobj_f52_i08_d03 1",
-  "bbob-biobj_f53_i08_d03 1",
-  "bbob-biobj_f54_i08_d03 1",
-  "bbob-biobj_f55_i08_d03 1",
-  "bbob-biobj_f01_i09_d03 1",
-  "bbob-biobj_f02_i09_d03 1",
-  "bbob-biobj_f03_i09_d03 1",
-  "bbob-biobj_f04_i09_d03 1",
-  "bbob-biobj_f05_i09_d03 1",
-  "bbob-biobj_f06_i09_d03 1",
-  "bbob-biobj_f07_i09_d03 1",
-  "bbob-biobj_f08_i09_d03 1",
-  "bbob-biobj_f09_i09_d03 1",
-  "bbob-biobj_f10_i09_d03 1",
-  "bbob-biobj_f11_i09_d03 1",
-  "bbob-biobj_f12_i09_d03 1",
-  "bbob-biobj_f13_i09_d03 1",
-  "bbob-biobj_f14_i09_d03 1",
-  "bbob-biobj_f15_i09_d03 1",
-  "bbob-biobj_f16_i09_d03 1",
-  "bbob-biobj_f17_i09_d03 1",
-  "bbob-biobj_f18_i09_d03 1",
-  "bbob-biobj_f19_i09_d03 1",
-  "bbob-biobj_f20_i09_d03 1",
-  "bbob-biobj_f21_i09_d03 1",
-  "bbob-biobj_f22_i09_d03 1",
-  "bbob-biobj_f23_i09_d03 1",
-  "bbob-biobj_f24_i09_d03 1",
-  "bbob-biobj_f25_i09_d03 1",
-  "bbob-biobj_f26_i09_d03 1",
-  "bbob-biobj_f27_i09_d03 1",
-  "bbob-biobj_f28_i09_d03 1",
-  "bbob-biobj_f29_i09_d03 1",
-  "bbob-biobj_f30_i09_d03 1",
-  "bbob-biobj_f31_i09_d03 1",
-  "bbob-biobj_f32_i09_d03 1",
-  "bbob-biobj_f33_i09_d03 1",
-  "bbob-biobj_f34_i09_d03 1",
-  "bbob-biobj_f35_i09_d03 1",
-  "bbob-biobj_f36_i09_d03 1",
-  "bbob-biobj_f37_i09_d03 1",
-  "bbob-biobj_f38_i09_d03 1",
-  "bbob-biobj_f39_i09_d03 1",
-  "bbob-biobj_f40_i09_d03 1",
-  "bbob-biobj_f41_i09_d03 1",
-  "bbob-biobj_f42_i09_d03 1",
-  "bbob-biobj_f43_i09_d03 1",
-  "bbob-biobj_f44_i09_d03 1",
-  "bbob-biobj_f45_i09_d03 1",
-  "bbob-biobj_f46_i09_d03 1",
-  "bbob-biobj_f47_i09_d03 1",
-  "bbob-biobj_f48_i09_d03 1",
-  "bbob-biobj_f49_i09_d03 1",
-  "bbob-biobj_f50_i09_d03 1",
-  "bbob-biobj_f51_i09_d03 1",
-  "bbob-biobj_f52_i09_d03 1",
-  "bbob-biobj_f53_i09_d03 1",
-  "bbob-biobj_f54_i09_d03 1",
-  "bbob-biobj_f55_i09_d03 1",
-  "bbob-biobj_f01_i10_d03 1",
-  "bbob-biobj_f02_i10_d03 1",
-  "bbob-biobj_f03_i10_d03 1",
-  "bbob-biobj_f04_i10_d03 1",
-  "bbob-biobj_f05_i10_d03 1",
-  "bbob-biobj_f06_i10_d03 1",
-  "bbob-biobj_f07_i10_d03 1",
-  "bbob-biobj_f08_i10_d03 1",
-  "bbob-biobj_f09_i10_d03 1",
-  "bbob-biobj_f10_i10_d03 1",
-  "bbob-biobj_f11_i10_d03 1",
-  "bbob-biobj_f12_i10_d03 1",
-  "bbob-biobj_f13_i10_d03 1",
-  "bbob-biobj_f14_i10_d03 1",
-  "bbob-biobj_f15_i10_d03 1",
-  "bbob-biobj_f16_i10_d03 1",
-  "bbob-biobj_f17_i10_d03 1",
-  "bbob-biobj_f18_i10_d03 1",
-  "bbob-biobj_f19_i10_d03 1",
-  "bbob-biobj_f20_i10_d03 1",
-  "bbob-biobj_f21_i10_d03 1",
-  "bbob-biobj_f22_i10_d03 1",
-  "bbob-biobj_f23_i10_d03 1",
-  "bbob-biobj_f24_i10_d03 1",
-  "bbob-biobj_f25_i10_d03 1",
-  "bbob-biobj_f26_i10_d03 1",
-  "bbob-biobj_f27_i10_d03 1",
-  "bbob-biobj_f28_i10_d03 1",
-  "bbob-biobj_f29_i10_d03 1",
-  "bbob-biobj_f30_i10_d03 1",
-  "bbob-biobj_f31_i10_d03 1",
-  "bbob-biobj_f32_i10_d03 1",
-  "bbob-biobj_f33_i10_d03 1",
-  "bbob-biobj_f34_i10_d03 1",
-  "bbob-biobj_f35_i10_d03 1",
-  "bbob-biobj_f36_i10_d03 1",
-  "bbob-biobj_f37_i10_d03 1",
-  "bbob-biobj_f38_i10_d03 1",
-  "bbob-biobj_f39_i10_d03 1",
-  "bbob-biobj_f40_i10_d03 1",
-  "bbob-biobj_f41_i10_d03 1",
-  "bbob-biobj_f42_i10_d03 1",
-  "bbob-biobj_f43_i10_d03 1",
-  "bbob-biobj_f44_i10_d03 1",
-  "bbob-biobj_f45_i10_d03 1",
-  "bbob-biobj_f46_i10_d03 1",
-  "bbob-biobj_f47_i10_d03 1",
-  "bbob-biobj_f48_i10_d03 1",
-  "bbob-biobj_f49_i10_d03 1",
-  "bbob-biobj_f50_i10_d03 1",
-  "bbob-biobj_f51_i10_d03 1",
-  "bbob-biobj_f52_i10_d03 1",
-  "bbob-biobj_f53_i10_d03 1",
-  "bbob-biobj_f54_i10_d03 1",
-  "bbob-biobj_f55_i10_d03 1",
-  "bbob-biobj_f01_i06_d05 1",
-  "bbob-biobj_f02_i06_d05 1",
-  "bbob-biobj_f03_i06_d05 1",
-  "bbob-biobj_f04_i06_d05 1",
-  "bbob-biobj_f05_i06_d05 1",
-  "bbob-biobj_f06_i06_d05 1",
-  "bbob-biobj_f07_i06_d05 1",
-  "bbob-biobj_f08_i06_d05 1",
-  "bbob-biobj_f09_i06_d05 1",
-  "bbob-biobj_f10_i06_d05 1",
-  "bbob-biobj_f11_i06_d05 1",
-  "bbob-biobj_f12_i06_d05 1",
-  "bbob-biobj_f13_i06_d05 1",
-  "bbob-biobj_f14_i06_d05 1",
-  "bbob-biobj_f15_i06_d05 1",
-  "bbob-biobj_f16_i06_d05 1",
-  "bbob-biobj_f17_i06_d05 1",
-  "bbob-biobj_f18_i06_d05 1",
-  "bbob-biobj_f19_i06_d05 1",
-  "bbob-biobj_f20_i06_d05 1",
-  "bbob-biobj_f21_i06_d05 1",
-  "bbob-biobj_f22_i06_d05 1",
-  "bbob-biobj_f23_i06_d05 1",
-  "bbob-biobj_f24_i06_d05 1",
-  "bbob-biobj_f25_i06_d05 1",
-  "bbob-biobj_f26_i06_d05 1",
-  "bbob-biobj_f27_i06_d05 1",
-  "bbob-biobj_f28_i06_d05 1",
-  "bbob-biobj_f29_i06_d05 1",
-  "bbob-biobj_f30_i06_d05 1",
-  "bbob-biobj_f31_i06_d05 1",
-  "bbob-biobj_f32_i06_d05 1",
-  "bbob-biobj_f33_i06_d05 1",
-  "bbob-biobj_f34_i06_d05 1",
-  "bbob-biobj_f35_i06_d05 1",
-  "bbob-biobj_f36_i06_d05 1",
-  "bbob-biobj_f37_i06_d05 1",
-  "bbob-biobj_f38_i06_d05 1",
-  "bbob-biobj_f39_i06_d05 1",
-  "bbob-biobj_f40_i06_d05 1",
-  "bbob-biobj_f41_i06_d05 1",
-  "bbob-biobj_f42_i06_d05 1",
-  "bbob-biobj_f43_i06_d05 1",
-  "bbob-biobj_f44_i06_d05 1",
-  "bbob-biobj_f45_i06_d05 1",
-  "bbob-biobj_f46_i06_d05 1",
-  "bbob-biobj_f47_i06_d05 1",
-  "bbob-biobj_f48_i06_d05 1",
-  "bbob-biobj_f49_i06_d05 1",
-  "bbob-biobj_f50_i06_d05 1",
-  "bbob-biobj_f51_i06_d05 1",
-  "bbob-biobj_f52_i06_d05 1",
-  "bbob-biobj_f53_i06_d05 1",
-  "bbob-biobj_f54_i06_d05 1",
-  "bbob-biobj_f55_i06_d05 1",
-  "bbob-biobj_f01_i07_d05 1",
-  "bbob-biobj_f02_i07_d05 1",
-  "bbob-biobj_f03_i07_d05 1",
-  "bbob-biobj_f04_i07_d05 1",
-  "bbob-biobj_f05_i07_d05 1",
-  "bbob-biobj_f06_i07_d05 1",
-  "bbob-biobj_f07_i07_d05 1",
-  "bbob-biobj_f08_i07_d05 1",
-  "bbob-biobj_f09_i07_d05 1",
-  "bbob-biobj_f10_i07_d05 1",
-  "bbob-biobj_f11_i07_d05 1",
-  "bbob-biobj_f12_i07_d05 1",
-  "bbob-biobj_f13_i07_d05 1",
-  "bbob-biobj_f14_i07_d05 1",
-  "bbob-biobj_f15_i07_d05 1",
-  "bbob-biobj_f16_i07_d05 1",
-  "bbob-biobj_f17_i07_d05 1",
-  "bbob-biobj_f18_i07_d05 1",
-  "bbob-biobj_f19_i07_d05 1",
-  "bbob-biobj_f20_i07_d05 1",
-  "bbob-biobj_f21_i07_d05 1",
-  "bbob-biobj_f22_i07_d05 1",
-  "bbob-biobj_f23_i07_d05 1",
-  "bbob-biobj_f24_i07_d05 1",
-  "bbob-biobj_f25_i07_d05 1",
-  "bbob-biobj_f26_i07_d05 1",
-  "bbob-biobj_f27_i07_d05 1",
-  "bbob-biobj_f28_i07_d05 1",
-  "bbob-biobj_f29_i07_d05 1",
-  "bbob-biobj_f30_i07_d05 1",
-  "bbob-biobj_f31_i07_d05 1",
-  "bbob-biobj_f32_i07_d05 1",
-  "bbob-biobj_f33_i07_d05 1",
-  "bbob-biobj_f34_i07_d05 1",
-  "bbob-biobj_f35_i07_d05 1",
-  "bbob-biobj_f36_i07_d05 1",
-  "bbob-biobj_f37_i07_d05 1",
-  "bbob-biobj_f38_i07_d05 1",
-  "bbob-biobj_f39_i07_d05 1",
-  "bbob-biobj_f40_i07_d05 1",
-  "bbob-biobj_f41_i07_d05 1",
-  "bbob-biobj_f42_i07_d05 1",
-  "bbob-biobj_f43_i07_d05 1",
-  "bbob-biobj_f44_i07_d05 1",
-  "bbob-biobj_f45_i07_d05 1",
-  "bbob-biobj_f46_i07_d05 1",
-  "bbob-biobj_f47_i07_d05 1",
-  "bbob-biobj_f48_i07_d05 1",
-  "bbob-biobj_f49_i07_d05 1",
-  "bbob-biobj_f50_i07_d05 1",
-  "bbob-biobj_f51_i07_d05 1",
-  "bbob-biobj_f52_i07_d05 1",
-  "bbob-biobj_f53_i07_d05 1",
-  "bbob-biobj_f54_i07_d05 1",
-  "bbob-biobj_f55_i07_d05 1",
-  "bbob-biobj_f01_i08_d05 1",
-  "bbob-biobj_f02_i08_d05 1",
-  "bbob-biobj_f03_i08_d05 1",
-  "bbob-biobj_f04_i08_d05 1",
-  "bbob-biobj_f05_i08_d05 1",
-  "bbob-biobj_f06_i08_d05 1",
-  "bbob-biobj_f07_i08_d05 1",
-  "bbob-biobj_f08_i08_d05 1",
-  "bbob-biobj_f09_i08_d05 1",
-  "bbob-biobj_f10_i08_d05 1",
-  "bbob-biobj_f11_i08_d05 1",
-  "bbob-biobj_f12_i08_d05 1",
-  "bbob-biobj_f13_i08_d05 1",
-  "bbob-biobj_f14_i08_d05 1",
-  "bbob-biobj_f15_i08_d05 1",
-  "bbob-biobj_f16_i08_d05 1",
-  "bbob-biobj_f17_i08_d05 1",
-  "bbob-biobj_f18_i08_d05 1",
-  "bbob-biobj_f19_i08_d05 1",
-  "bbob-biobj_f20_i08_d05 1",
-  "bbob-biobj_f21_i08_d05 1",
-  "bbob-biobj_f22_i08_d05 1",
-  "bbob-biobj_f23_i08_d05 1",
-  "bbob-biobj_f24_i08_d05 1",
-  "bbob-biobj_f25_i08_d05 1",
-  "bbob-biobj_f26_i08_d05 1",
-  "bbob-biobj_f27_i08_d05 1",
-  "bbob-biobj_f28_i08_d05 1",
-  "bbob-biobj_f29_i08_d05 1",
-  "bbob-biobj_f30_i08_d05 1",
-  "bbob-biobj_f31_i08_d05 1",
-  "bbob-biobj_f32_i08_d05 1",
-  "bbob-biobj_f33_i08_d05 1",
-  "bbob-biobj_f34_i08_d05 1",
-  "bbob-biobj_f35_i08_d05 1",
-  "bbob-biobj_f36_i08_d05 1",
-  "bbob-biobj_f37_i08_d05 1",
-  "bbob-biobj_f38_i08_d05 1",
-  "bbob-biobj_f39_i08_d05 1",
-  "bbob-biobj_f40_i08_d05 1",
-  "bbob-biobj_f41_i08_d05 1",
-  "bbob-biobj_f42_i08_d05 1",
-  "bbob-biobj_f43_i08_d05 1",
-  "bbob-biobj_f44_i08_d05 1",
-  "bbob-biobj_f45_i08_d05 1",
-  "bbob-biobj_f46_i08_d05 1",
-  "bbob-biobj_f47_i08_d05 1",
-  "bbob-biobj_f48_i08_d05 1",
-  "bbob-biobj_f49_i08_d05 1",
-  "bbob-biobj_f50_i08_d05 1",
-  "bbob-biobj_f51_i08_d05 1",
-  "bbob-biobj_f52_i08_d05 1",
-  "bbob-biobj_f53_i08_d05 1",
-  "bbob-biobj_f54_i08_d05 1",
-  "bbob-biobj_f55_i08_d05 1",
-  "bbob-biobj_f01_i09_d05 1",
-  "bbob-biobj_f02_i09_d05 1",
-  "bbob-biobj_f03_i09_d05 1",
-  "bbob-biobj_f04_i09_d05 1",
-  "bbob-biobj_f05_i09_d05 1",
-  "bbob-biobj_f06_i09_d05 1",
-  "bbob-biobj_f07_i09_d05 1",
-  "bbob-biobj_f08_i09_d05 1",
-  "bbob-biobj_f09_i09_d05 1",
-  "bbob-biobj_f10_i09_d05 1",
-  "bbob-biobj_f11_i09_d05 1",
-  "bbob-biobj_f12_i09_d05 1",
-  "bbob-biobj_f13_i09_d05 1",
-  "bbob-biobj_f14_i09_d05 1",
-  "bbob-biobj_f15_i09_d05 1",
-  "bbob-biobj_f16_i09_d05 1",
-  "bbob-biobj_f17_i09_d05 1",
-  "bbob-biobj_f18_i09_d05 1",
-  "bbob-biobj_f19_i09_d05 1",
-  "bbob-biobj_f20_i09_d05 1",
-  "bbob-biobj_f21_i09_d05 1",
-  "bbob-biobj_f22_i09_d05 1",
-  "bbob-biobj_f23_i09_d05 1",
-  "bbob-biobj_f24_i09_d05 1",
-  "bbob-biobj_f25_i09_d05 1",
-  "bbob-biobj_f26_i09_d05 1",
-  "bbob-biobj_f27_i09_d05 1",
-  "bbob-biobj_f28_i09_d05 1",
-  "bbob-biobj_f29_i09_d05 1",
-  "bbob-biobj_f30_i09_d05 1",
-  "bbob-biobj_f31_i09_d05 1",
-  "bbob-biobj_f32_i09_d05 1",
-  "bbob-biobj_f33_i09_d05 1",
-  "bbob-biobj_f34_i09_d05 1",
-  "bbob-biobj_f35_i09_d05 1",
-  "bbob-biobj_f36_i09_d05 1",
-  "bbob-biobj_f37_i09_d05 1",
-  "bbob-biobj_f38_i09_d05 1",
-  "bbob-biobj_f39_i09_d05 1",
-  "bbob-biobj_f40_i09_d05 1",
-  "bbob-biobj_f41_i09_d05 1",
-  "bbob-biobj_f42_i09_d05 1",
-  "bbob-biobj_f43_i09_d05 1",
-  "bbob-biobj_f44_i09_d05 1",
-  "bbob-biobj_f45_i09_d05 1",
-  "bbob-biobj_f46_i09_d05 1",
-  "bbob-biobj_f47_i09_d05 1",
-  "bbob-biobj_f48_i09_d05 1",
-  "bbob-biobj_f49_i09_d05 1",
-  "bbob-biobj_f50_i09_d05 1",
-  "bbob-biobj_f51_i09_d05 1",
-  "bbob-biobj_f52_i09_d05 1",
-  "bbob-biobj_f53_i09_d05 1",
-  "bbob-biobj_f54_i09_d05 1",
-  "bbob-biobj_f55_i09_d05 1",
-  "bbob-biobj_f01_i10_d05 1",
-  "bbob-biobj_f02_i10_d05 1",
-  "bbob-biobj_f03_i10_d05 1",
-  "bbob-biobj_f04_i10_d05 1",
-  "bbob-biobj_f05_i10_d05 1",
-  "bbob-biobj_f06_i10_d05 1",
-  "bbob-biobj_f07_i10_d05 1",
-  "bbob-biobj_f08_i10_d05 1",
-  "bbob-biobj_f09_i10_d05 1",
-  "bbob-biobj_f10_i10_d05 1",
-  "bbob-biobj_f11_i10_d05 1",
-  "bbob-biobj_f12_i10_d05 1",
-  "bbob-biobj_f13_i10_d05 1",
-  "bbob-biobj_f14_i10_d05 1",
-  "bbob-biobj_f15_i10_d05 1",
-  "bbob-biobj_f16_i10_d05 1",
-  "bbob-biobj_f17_i10_d05 1",
-  "bbob-biobj_f18_i10_d05 1",
-  "bbob-biobj_f19_i10_d05 1",
-  "bbob-biobj_f20_i10_d05 1",
-  "bbob-biobj_f21_i10_d05 1",
-  "bbob-biobj_f22_i10_d05 1",
-  "bbob-biobj_f23_i10_d05 1",
-  "bbob-biobj_f24_i10_d05 1",
-  "bbob-biobj_f25_i10_d05 1",
-  "bbob-biobj_f26_i10_d05 1",
-  "bbob-biobj_f27_i10_d05 1",
-  "bbob-biobj_f28_i10_d05 1",
-  "bbob-biobj_f29_i10_d05 1",
-  "bbob-biobj_f30_i10_d05 1",
-  "bbob-biobj_f31_i10_d05 1",
-  "bbob-biobj_f32_i10_d05 1",
-  "bbob-biobj_f33_i10_d05 1",
-  "bbob-biobj_f34_i10_d05 1",
-  "bbob-biobj_f35_i10_d05 1",
-  "bbob-biobj_f36_i10_d05 1",
-  "bbob-biobj_f37_i10_d05 1",
-  "bbob-biobj_f38_i10_d05 1",
-  "bbob-biobj_f39_i10_d05 1",
-  "bbob-biobj_f40_i10_d05 1",
-  "bbob-biobj_f41_i10_d05 1",
-  "bbob-biobj_f42_i10_d05 1",
-  "bbob-biobj_f43_i10_d05 1",
-  "bbob-biobj_f44_i10_d05 1",
-  "bbob-biobj_f45_i10_d05 1",
-  "bbob-biobj_f46_i10_d05 1",
-  "bbob-biobj_f47_i10_d05 1",
-  "bbob-biobj_f48_i10_d05 1",
-  "bbob-biobj_f49_i10_d05 1",
-  "bbob-biobj_f50_i10_d05 1",
-  "bbob-biobj_f51_i10_d05 1",
-  "bbob-biobj_f52_i10_d05 1",
-  "bbob-biobj_f53_i10_d05 1",
-  "bbob-biobj_f54_i10_d05 1",
-  "bbob-biobj_f55_i10_d05 1",
-  "bbob-biobj_f01_i06_d10 1",
-  "bbob-biobj_f02_i06_d10 1",
-  "bbob-biobj_f03_i06_d10 1",
-  "bbob-biobj_f04_i06_d10 1",
-  "bbob-biobj_f05_i06_d10 1",
-  "bbob-biobj_f06_i06_d10 1",
-  "bbob-biobj_f07_i06_d10 1",
-  "bbob-biobj_f08_i06_d10 1",
-  "bbob-biobj_f09_i06_d10 1",
-  "bbob-biobj_f10_i06_d10 1",
-  "bbob-biobj_f11_i06_d10 1",
-  "bbob-biobj_f12_i06_d10 1",
-  "bbob-biobj_f13_i06_d10 1",
-  "bbob-biobj_f14_i06_d10 1",
-  "bbob-biobj_f15_i06_d10 1",
-  "bbob-biobj_f16_i06_d10 1",
-  "bbob-biobj_f17_i06_d10 1",
-  "bbob-biobj_f18_i06_d10 1",
-  "bbob-biobj_f19_i06_d10 1",
-  "bbob-biobj_f20_i06_d10 1",
-  "bbob-biobj_f21_i06_d10 1",
-  "bbob-biobj_f22_i06_d10 1",
-  "bbob-biobj_f23_i06_d10 1",
-  "bbob-biobj_f24_i06_d10 1",
-  "bbob-biobj_f25_i06_d10 1",
-  "bbob-biobj_f26_i06_d10 1",
-  "bbob-biobj_f27_i06_d10 1",
-  "bbob-biobj_f28_i06_d10 1",
-  "bbob-biobj_f29_i06_d10 1",
-  "bbob-biobj_f30_i06_d10 1",
-  "bbob-biobj_f31_i06_d10 1",
-  "bbob-biobj_f32_i06_d10 1",
-  "bbob-biobj_f33_i06_d10 1",
-  "bbob-biobj_f34_i06_d10 1",
-  "bbob-biobj_f35_i06_d10 1",
-  "bbob-biobj_f36_i06_d10 1",
-  "bbob-biobj_f37_i06_d10 1",
-  "bbob-biobj_f38_i06_d10 1",
-  "bbob-biobj_f39_i06_d10 1",
-  "bbob-biobj_f40_i06_d10 1",
-  "bbob-biobj_f41_i06_d10 1",
-  "bbob-biobj_f42_i06_d10 1",
-  "bbob-biobj_f43_i06_d10 1",
-  "bbob-biobj_f44_i06_d10 1",
-  "bbob-biobj_f45_i06_d10 1",
-  "bbob-biobj_f46_i06_d10 1",
-  "bbob-biobj_f47_i06_d10 1",
-  "bbob-biobj_f48_i06_d10 1",
-  "bbob-biobj_f49_i06_d10 1",
-  "bbob-biobj_f50_i06_d10 1",
-  "bbob-biobj_f51_i06_d10 1",
-  "bbob-biobj_f52_i06_d10 1",
-  "bbob-biobj_f53_i06_d10 1",
-  "bbob-biobj_f54_i06_d10 1",
-  "bbob-biobj_f55_i06_d10 1",
-  "bbob-biobj_f01_i07_d10 1",
-  "bbob-biobj_f02_i07_d10 1",
-  "bbob-biobj_f03_i07_d10 1",
-  "bbob-biobj_f04_i07_d10 1",
-  "bbob-biobj_f05_i07_d10 1",
-  "bbob-biobj_f06_i07_d10 1",
-  "bbob-biobj_f07_i07_d10 1",
-  "bbob-biobj_f08_i07_d10 1",
-  "bbob-biobj_f09_i07_d10 1",
-  "bbob-biobj_f10_i07_d10 1",
-  "bbob-biobj_f11_i07_d10 1",
-  "bbob-biobj_f12_i07_d10 1",
-  "bbob-biobj_f13_i07_d10 1",
-  "bbob-biobj_f14_i07_d10 1",
-  "bbob-biobj_f15_i07_d10 1",
-  "bbob-biobj_f16_i07_d10 1",
-  "bbob-biobj_f17_i07_d10 1",
-  "bbob-biobj_f18_i07_d10 1",
-  "bbob-biobj_f19_i07_d10 1",
-  "bbob-biobj_f20_i07_d10 1",
-  "bbob-biobj_f21_i07_d10 1",
-  "bbob-biobj_f22_i07_d10 1",
-  "bbob-biobj_f23_i07_d10 1",
-  "bbob-biobj_f24_i07_d10 1",
-  "bbob-biobj_f25_i07_d10 1",
-  "bbob-biobj_f26_i07_d10 1",
-  "bbob-biobj_f27_i07_d10 1",
-  "bbob-biobj_f28_i07_d10 1",
-  "bbob-biobj_f29_i07_d10 1",
-  "bbob-biobj_f30_i07_d10 1",
-  "bbob-biobj_f31_i07_d10 1",
-  "bbob-biobj_f32_i07_d10 1",
-  "bbob-biobj_f33_i07_d10 1",
-  "bbob-biobj_f34_i07_d10 1",
-  "bbob-biobj_f35_i07_d10 1",
-  "bbob-biobj_f36_i07_d10 1",
-  "bbob-biobj_f37_i07_d10 1",
-  "bbob-biobj_f38_i07_d10 1",
-  "bbob-biobj_f39_i07_d10 1",
-  "bbob-biobj_f40_i07_d10 1",
-  "bbob-biobj_f41_i07_d10 1",
-  "bbob-biobj_f42_i07_d10 1",
-  "bbob-biobj_f43_i07_d10 1",
-  "bbob-biobj_f44_i07_d10 1",
-  "bbob-biobj_f45_i07_d10 1",
-  "bbob-biobj_f46_i07_d10 1",
-  "bbob-biobj_f47_i07_d10 1",
-  "bbob-biobj_f48_i07_d10 1",
-  "bbob-biobj_f49_i07_d10 1",
-  "bbob-biobj_f50_i07_d10 1",
-  "bbob-biobj_f51_i07_d10 1",
-  "bbob-biobj_f52_i07_d10 1",
-  "bbob-biobj_f53_i07_d10 1",
-  "bbob-biobj_f54_i07_d10 1",
-  "bbob-biobj_f55_i07_d10 1",
-  "bbob-biobj_f01_i08_d10 1",
-  "bbob-biobj_f02_i08_d10 1",
-  "bbob-biobj_f03_i08_d10 1",
-  "bbob-biobj_f04_i08_d10 1",
-  "bbob-biobj_f05_i08_d10 1",
-  "bbob-biobj_f06_i08_d10 1",
-  "bbob-biobj_f07_i08_d10 1",
-  "bbob-biobj_f08_i08_d10 1",
-  "bbob-biobj_f09_i08_d10 1",
-  "bbob-biobj_f10_i08_d10 1",
-  "bbob-biobj_f11_i08_d10 1",
-  "bbob-biobj_f12_i08_d10 1",
-  "bbob-biobj_f13_i08_d10 1",
-  "bbob-biobj_f14_i08_d10 1",
-  "bbob-biobj_f15_i08_d10 1",
-  "bbob-biobj_f16_i08_d10 1",
-  "bbob-biobj_f17_i08_d10 1",
-  "bbob-biobj_f18_i08_d10 1",
-  "bbob-biobj_f19_i08_d10 1",
-  "bbob-biobj_f20_i08_d10 1",
-  "bbob-biobj_f21_i08_d10 1",
-  "bbob-biobj_f22_i08_d10 1",
-  "bbob-biobj_f23_i08_d10 1",
-  "bbob-biobj_f24_i08_d10 1",
-  "bbob-biobj_f25_i08_d10 1",
-  "bbob-biobj_f26_i08_d10 1",
-  "bbob-biobj_f27_i08_d10 1",
-  "bbob-biobj_f28_i08_d10 1",
-  "bbob-biobj_f29_i08_d10 1",
-  "bbob-biobj_f30_i08_d10 1",
-  "bbob-biobj_f31_i08_d10 1",
-  "bbob-biobj_f32_i08_d10 1",
-  "bbob-biobj_f33_i08_d10 1",
-  "bbob-biobj_f34_i08_d10 1",
-  "bbob-biobj_f35_i08_d10 1",
-  "bbob-biobj_f36_i08_d10 1",
-  "bbob-biobj_f37_i08_d10 1",
-  "bbob-biobj_f38_i08_d10 1",
-  "bbob-biobj_f39_i08_d10 1",
-  "bbob-biobj_f40_i08_d10 1",
-  "bbob-biobj_f41_i08_d10 1",
-  "bbob-biobj_f42_i08_d10 1",
-  "bbob-biobj_f43_i08_d10 1",
-  "bbob-biobj_f44_i08_d10 1",
-  "bbob-biobj_f45_i08_d10 1",
-  "bbob-biobj_f46_i08_d10 1",
-  "bbob-biobj_f47_i08_d10 1",
-  "bbob-biobj_f48_i08_d10 1",
-  "bbob-biobj_f49_i08_d10 1",
-  "bbob-biobj_f50_i08_d10 1",
-  "bbob-biobj_f51_i08_d10 1",
-  "bbob-biobj_f52_i08_d10 1",
-  "bbob-biobj_f53_i08_d10 1",
-  "bbob-biobj_f54_i08_d10 1",
-  "bbob-biobj_f55_i08_d10 1",
-  "bbob-biobj_f01_i09_d10 1",
-  "bbob-biobj_f02_i09_d10 1",
-  "bbob-biobj_f03_i09_d10 1",
-  "bbob-biobj_f04_i09_d10 1",
-  "bbob-biobj_f05_i09_d10 1",
-  "bbob-biobj_f06_i09_d10 1",
-  "bbob-biobj_f07_i09_d10 1",
-  "bbob-biobj_f08_i09_d10 1",
-  "bbob-biobj_f09_i09_d10 1",
-  "bbob-biobj_f10_i09_d10 1",
-  "bbob-biobj_f11_i09_d10 1",
-  "bbob-biobj_f12_i09_d10 1",
-  "bbob-biobj_f13_i09_d10 1",
-  "bbob-biobj_f14_i09_d10 1",
-  "bbob-biobj_f15_i09_d10 1",
-  "bbob-biobj_f16_i09_d10 1",
-  "bbob-biobj_f17_i09_d10 1",
-  "bbob-biobj_f18_i09_d10 1",
-  "bbob-biobj_f19_i09_d10 1",
-  "bbob-biobj_f20_i09_d10 1",
-  "bbob-biobj_f21_i09_d10 1",
-  "bbob-biobj_f22_i09_d10 1",
-  "bbob-biobj_f23_i09_d10 1",
-  "bbob-biobj_f24_i09_d10 1",
-  "bbob-biobj_f25_i09_d10 1",
-  "bbob-biobj_f26_i09_d10 1",
-  "bbob-biobj_f27_i09_d10 1",
-  "bbob-biobj_f28_i09_d10 1",
-  "bbob-biobj_f29_i09_d10 1",
-  "bbob-biobj_f30_i09_d10 1",
-  "bbob-biobj_f31_i09_d10 1",
-  "bbob-biobj_f32_i09_d10 1",
-  "bbob-biobj_f33_i09_d10 1",
-  "bbob-biobj_f34_i09_d10 1",
-  "bbob-biobj_f35_i09_d10 1",
-  "bbob-biobj_f36_i09_d10 1",
-  "bbob-biobj_f37_i09_d10 1",
-  "bbob-biobj_f38_i09_d10 1",
-  "bbob-biobj_f39_i09_d10 1",
-  "bbob-biobj_f40_i09_d10 1",
-  "bbob-biobj_f41_i09_d10 1",
-  "bbob-biobj_f42_i09_d10 1",
-  "bbob-biobj_f43_i09_d10 1",
-  "bbob-biobj_f44_i09_d10 1",
-  "bbob-biobj_f45_i09_d10 1",
-  "bbob-biobj_f46_i09_d10 1",
-  "bbob-biobj_f47_i09_d10 1",
-  "bbob-biobj_f48_i09_d10 1",
-  "bbob-biobj_f49_i09_d10 1",
-  "bbob-biobj_f50_i09_d10 1",
-  "bbob-biobj_f51_i09_d10 1",
-  "bbob-biobj_f52_i09_d10 1",
-  "bbob-biobj_f53_i09_d10 1",
-  "bbob-biobj_f54_i09_d10 1",
-  "bbob-biobj_f55_i09_d10 1",
-  "bbob-biobj_f01_i10_d10 1",
-  "bbob-biobj_f02_i10_d10 1",
-  "bbob-biobj_f03_i10_d10 1",
-  "bbob-biobj_f04_i10_d10 1",
-  "bbob-biobj_f05_i10_d10 1",
-  "bbob-biobj_f06_i10_d10 1",
-  "bbob-biobj_f07_i10_d10 1",
-  "bbob-biobj_f08_i10_d10 1",
-  "bbob-biobj_f09_i10_d10 1",
-  "bbob-biobj_f10_i10_d10 1",
-  "bbob-biobj_f11_i10_d10 1",
-  "bbob-biobj_f12_i10_d10 1",
-  "bbob-biobj_f13_i10_d10 1",
-  "bbob-biobj_f14_i10_d10 1",
-  "bbob-biobj_f15_i10_d10 1",
-  "bbob-biobj_f16_i10_d10 1",
-  "bbob-biobj_f17_i10_d10 1",
-  "bbob-biobj_f18_i10_d10 1",
-  "bbob-biobj_f19_i10_d10 1",
-  "bbob-biobj_f20_i10_d10 1",
-  "bbob-biobj_f21_i10_d10 1",
-  "bbob-biobj_f22_i10_d10 1",
-  "bbob-biobj_f23_i10_d10 1",
-  "bbob-biobj_f24_i10_d10 1",
-  "bbob-biobj_f25_i10_d10 1",
-  "bbob-biobj_f26_i10_d10 1",
-  "bbob-biobj_f27_i10_d10 1",
-  "bbob-biobj_f28_i10_d10 1",
-  "bbob-biobj_f29_i10_d10 1",
-  "bbob-biobj_f30_i10_d10 1",
-  "bbob-biobj_f31_i10_d10 1",
-  "bbob-biobj_f32_i10_d10 1",
-  "bbob-biobj_f33_i10_d10 1",
-  "bbob-biobj_f34_i10_d10 1",
-  "bbob-biobj_f35_i10_d10 1",
-  "bbob-biobj_f36_i10_d10 1",
-  "bbob-biobj_f37_i10_d10 1",
-  "bbob-biobj_f38_i10_d10 1",
-  "bbob-biobj_f39_i10_d10 1",
-  "bbob-biobj_f40_i10_d10 1",
-  "bbob-biobj_f41_i10_d10 1",
-  "bbob-biobj_f42_i10_d10 1",
-  "bbob-biobj_f43_i10_d10 1",
-  "bbob-biobj_f44_i10_d10 1",
-  "bbob-biobj_f45_i10_d10 1",
-  "bbob-biobj_f46_i10_d10 1",
-  "bbob-biobj_f47_i10_d10 1",
-  "bbob-biobj_f48_i10_d10 1",
-  "bbob-biobj_f49_i10_d10 1",
-  "bbob-biobj_f50_i10_d10 1",
-  "bbob-biobj_f51_i10_d10 1",
-  "bbob-biobj_f52_i10_d10 1",
-  "bbob-biobj_f53_i10_d10 1",
-  "bbob-biobj_f54_i10_d10 1",
-  "bbob-biobj_f55_i10_d10 1",
-  "bbob-biobj_f01_i06_d20 1",
-  "bbob-biobj_f02_i06_d20 1",
-  "bbob-biobj_f03_i06_d20 1",
-  "bbob-biobj_f04_i06_d20 1",
-  "bbob-biobj_f05_i06_d20 1",
-  "bbob-biobj_f06_i06_d20 1",
-  "bbob-biobj_f07_i06_d20 1",
-  "bbob-biobj_f08_i06_d20 1",
-  "bbob-biobj_f09_i06_d20 1",
-  "bbob-biobj_f10_i06_d20 1",
-  "bbob-biobj_f11_i06_d20 1",
-  "bbob-biobj_f12_i06_d20 1",
-  "bbob-biobj_f13_i06_d20 1",
-  "bbob-biobj_f14_i06_d20 1",
-  "bbob-biobj_f15_i06_d20 1",
-  "bbob-biobj_f16_i06_d20 1",
-  "bbob-biobj_f17_i06_d20 1",
-  "bbob-biobj_f18_i06_d20 1",
-  "bbob-biobj_f19_i06_d20 1",
-  "bbob-biobj_f20_i06_d20 1",
-  "bbob-biobj_f21_i06_d20 1",
-  "bbob-biobj_f22_i06_d20 1",
-  "bbob-biobj_f23_i06_d20 1",
-  "bbob-biobj_f24_i06_d20 1",
-  "bbob-biobj_f25_i06_d20 1",
-  "bbob-biobj_f26_i06_d20 1",
-  "bbob-biobj_f27_i06_d20 1",
-  "bbob-biobj_f28_i06_d20 1",
-  "bbob-biobj_f29_i06_d20 1",
-  "bbob-biobj_f30_i06_d20 1",
-  "bbob-biobj_f31_i06_d20 1",
-  "bbob-biobj_f32_i06_d20 1",
-  "bbob-biobj_f33_i06_d20 1",
-  "bbob-biobj_f34_i06_d20 1",
-  "bbob-biobj_f35_i06_d20 1",
-  "bbob-biobj_f36_i06_d20 1",
-  "bbob-biobj_f37_i06_d20 1",
-  "bbob-biobj_f38_i06_d20 1",
-  "bbob-biobj_f39_i06_d20 1",
-  "bbob-biobj_f40_i06_d20 1",
-  "bbob-biobj_f41_i06_d20 1",
-  "bbob-biobj_f42_i06_d20 1",
-  "bbob-biobj_f43_i06_d20 1",
-  "bbob-biobj_f44_i06_d20 1",
-  "bbob-biobj_f45_i06_d20 1",
-  "bbob-biobj_f46_i06_d20 1",
-  "bbob-biobj_f47_i06_d20 1",
-  "bbob-biobj_f48_i06_d20 1",
-  "bbob-biobj_f49_i06_d20 1",
-  "bbob-biobj_f50_i06_d20 1",
-  "bbob-biobj_f51_i06_d20 1",
-  "bbob-biobj_f52_i06_d20 1",
-  "bbob-biobj_f53_i06_d20 1",
-  "bbob-biobj_f54_i06_d20 1",
-  "bbob-biobj_f55_i06_d20 1",
-  "bbob-biobj_f01_i07_d20 1",
-  "bbob-biobj_f02_i07_d20 1",
-  "bbob-biobj_f03_i07_d20 1",
-  "bbob-biobj_f04_i07_d20 1",
-  "bbob-biobj_f05_i07_d20 1",
-  "bbob-biobj_f06_i07_d20 1",
-  "bbob-biobj_f07_i07_d20 1",
-  "bbob-biobj_f08_i07_d20 1",
-  "bbob-biobj_f09_i07_d20 1",
-  "bbob-biobj_f10_i07_d20 1",
-  "bbob-biobj_f11_i07_d20 1",
-  "bbob-biobj_f12_i07_d20 1",
-  "bbob-biobj_f13_i07_d20 1",
-  "bbob-biobj_f14_i07_d20 1",
-  "bbob-biobj_f15_i07_d20 1",
-  "bbob-biobj_f16_i07_d20 1",
-  "bbob-biobj_f17_i07_d20 1",
-  "bbob-biobj_f18_i07_d20 1",
-  "bbob-biobj_f19_i07_d20 1",
-  "bbob-biobj_f20_i07_d20 1",
-  "bbob-biobj_f21_i07_d20 1",
-  "bbob-biobj_f22_i07_d20 1",
-  "bbob-biobj_f23_i07_d20 1",
-  "bbob-biobj_f24_i07_d20 1",
-  "bbob-biobj_f25_i07_d20 1",
-  "bbob-biobj_f26_i07_d20 1",
-  "bbob-biobj_f27_i07_d20 1",
-  "bbob-biobj_f28_i07_d20 1",
-  "bbob-biobj_f29_i07_d20 1",
-  "bbob-biobj_f30_i07_d20 1",
-  "bbob-biobj_f31_i07_d20 1",
-  "bbob-biobj_f32_i07_d20 1",
-  "bbob-biobj_f33_i07_d20 1",
-  "bbob-biobj_f34_i07_d20 1",
-  "bbob-biobj_f35_i07_d20 1",
-  "bbob-biobj_f36_i07_d20 1",
-  "bbob-biobj_f37_i07_d20 1",
-  "bbob-biobj_f38_i07_d20 1",
-  "bbob-biobj_f39_i07_d20 1",
-  "bbob-biobj_f40_i07_d20 1",
-  "bbob-biobj_f41_i07_d20 1",
-  "bbob-biobj_f42_i07_d20 1",
-  "bbob-biobj_f43_i07_d20 1",
-  "bbob-biobj_f44_i07_d20 1",
-  "bbob-biobj_f45_i07_d20 1",
-  "bbob-biobj_f46_i07_d20 1",
-  "bbob-biobj_f47_i07_d20 1",
-  "bbob-biobj_f48_i07_d20 1",
-  "bbob-biobj_f49_i07_d20 1",
-  "bbob-biobj_f50_i07_d20 1",
-  "bbob-biobj_f51_i07_d20 1",
-  "bbob-biobj_f52_i07_d20 1",
-  "bbob-biobj_f53_i07_d20 1",
-  "bbob-biobj_f54_i07_d20 1",
-  "bbob-biobj_f55_i07_d20 1",
-  "bbob-biobj_f01_i08_d20 1",
-  "bbob-biobj_f02_i08_d20 1",
-  "bbob-biobj_f03_i08_d20 1",
-  "bbob-biobj_f04_i08_d20 1",
-  "bbob-biobj_f05_i08_d20 1",
-  "bbob-biobj_f06_i08_d20 1",
-  "bbob-biobj_f07_i08_d20 1",
-  "bbob-biobj_f08_i08_d20 1",
-  "bbob-biobj_f09_i08_d20 1",
-  "bbob-biobj_f10_i08_d20 1",
-  "bbob-biobj_f11_i08_d20 1",
-  "bbob-biobj_f12_i08_d20 1",
-  "bbob-biobj_f13_i08_d20 1",
-  "bbob-biobj_f14_i08_d20 1",
-  "bbob-biobj_f15_i08_d20 1",
-  "bbob-biobj_f16_i08_d20 1",
-  "bbob-biobj_f17_i08_d20 1",
-  "bbob-biobj_f18_i08_d20 1",
-  "bbob-biobj_f19_i08_d20 1",
-  "bbob-biobj_f20_i08_d20 1",
-  "bbob-biobj_f21_i08_d20 1",
-  "bbob-biobj_f22_i08_d20 1",
-  "bbob-biobj_f23_i08_d20 1",
-  "bbob-biobj_f24_i08_d20 1",
-  "bbob-biobj_f25_i08_d20 1",
-  "bbob-biobj_f26_i08_d20 1",
-  "bbob-biobj_f27_i08_d20 1",
-  "bbob-biobj_f28_i08_d20 1",
-  "bbob-biobj_f29_i08_d20 1",
-  "bbob-biobj_f30_i08_d20 1",
-  "bbob-biobj_f31_i08_d20 1",
-  "bbob-biobj_f32_i08_d20 1",
-  "bbob-biobj_f33_i08_d20 1",
-  "bbob-biobj_f34_i08_d20 1",
-  "bbob-biobj_f35_i08_d20 1",
-  "bbob-biobj_f36_i08_d20 1",
-  "bbob-biobj_f37_i08_d20 1",
-  "bbob-biobj_f38_i08_d20 1",
-  "bbob-biobj_f39_i08_d20 1",
-  "bbob-biobj_f40_i08_d20 1",
-  "bbob-biobj_f41_i08_d20 1",
-  "bbob-biobj_f42_i08_d20 1",
-  "bbob-biobj_f43_i08_d20 1",
-  "bbob-biobj_f44_i08_d20 1",
-  "bbob-biobj_f45_i08_d20 1",
-  "bbob-biobj_f46_i08_d20 1",
-  "bbob-biobj_f47_i08_d20 1",
-  "bbob-biobj_f48_i08_d20 1",
-  "bbob-biobj_f49_i08_d20 1",
-  "bbob-biobj_f50_i08_d20 1",
-  "bbob-biobj_f51_i08_d20 1",
-  "bbob-biobj_f52_i08_d20 1",
-  "bbob-biobj_f53_i08_d20 1",
-  "bbob-biobj_f54_i08_d20 1",
-  "bbob-biobj_f55_i08_d20 1",
-  "bbob-biobj_f01_i09_d20 1",
-  "bbob-biobj_f02_i09_d20 1",
-  "bbob-biobj_f03_i09_d20 1",
-  "bbob-biobj_f04_i09_d20 1",
-  "bbob-biobj_f05_i09_d20 1",
-  "bbob-biobj_f06_i09_d20 1",
-  "bbob-biobj_f07_i09_d20 1",
-  "bbob-biobj_f08_i09_d20 1",
-  "bbob-biobj_f09_i09_d20 1",
-  "bbob-biobj_f10_i09_d20 1",
-  "bbob-biobj_f11_i09_d20 1",
-  "bbob-biobj_f12_i09_d20 1",
-  "bbob-biobj_f13_i09_d20 1",
-  "bbob-biobj_f14_i09_d20 1",
-  "bbob-biobj_f15_i09_d20 1",
-  "bbob-biobj_f16_i09_d20 1",
-  "bbob-biobj_f17_i09_d20 1",
-  "bbob-biobj_f18_i09_d20 1",
-  "bbob-biobj_f19_i09_d20 1",
-  "bbob-biobj_f20_i09_d20 1",
-  "bbob-biobj_f21_i09_d20 1",
-  "bbob-biobj_f22_i09_d20 1",
-  "bbob-biobj_f23_i09_d20 1",
-  "bbob-biobj_f24_i09_d20 1",
-  "bbob-biobj_f25_i09_d20 1",
-  "bbob-biobj_f26_i09_d20 1",
-  "bbob-biobj_f27_i09_d20 1",
-  "bbob-biobj_f28_i09_d20 1",
-  "bbob-biobj_f29_i09_d20 1",
-  "bbob-biobj_f30_i09_d20 1",
-  "bbob-biobj_f31_i09_d20 1",
-  "bbob-biobj_f32_i09_d20 1",
-  "bbob-biobj_f33_i09_d20 1",
-  "bbob-biobj_f34_i09_d20 1",
-  "bbob-biobj_f35_i09_d20 1",
-  "bbob-biobj_f36_i09_d20 1",
-  "bbob-biobj_f37_i09_d20 1",
-  "bbob-biobj_f38_i09_d20 1",
-  "bbob-biobj_f39_i09_d20 1",
-  "bbob-biobj_f40_i09_d20 1",
-  "bbob-biobj_f41_i09_d20 1",
-  "bbob-biobj_f42_i09_d20 1",
-  "bbob-biobj_f43_i09_d20 1",
-  "bbob-biobj_f44_i09_d20 1",
-  "bbob-biobj_f45_i09_d20 1",
-  "bbob-biobj_f46_i09_d20 1",
-  "bbob-biobj_f47_i09_d20 1",
-  "bbob-biobj_f48_i09_d20 1",
-  "bbob-biobj_f49_i09_d20 1",
-  "bbob-biobj_f50_i09_d20 1",
-  "bbob-biobj_f51_i09_d20 1",
-  "bbob-biobj_f52_i09_d20 1",
-  "bbob-biobj_f53_i09_d20 1",
-  "bbob-biobj_f54_i09_d20 1",
-  "bbob-biobj_f55_i09_d20 1",
-  "bbob-biobj_f01_i10_d20 1",
-  "bbob-biobj_f02_i10_d20 1",
-  "bbob-biobj_f03_i10_d20 1",
-  "bbob-biobj_f04_i10_d20 1",
-  "bbob-biobj_f05_i10_d20 1",
-  "bbob-biobj_f06_i10_d20 1",
-  "bbob-biobj_f07_i10_d20 1",
-  "bbob-biobj_f08_i10_d20 1",
-  "bbob-biobj_f09_i10_d20 1",
-  "bbob-biobj_f10_i10_d20 1",
-  "bbob-biobj_f11_i10_d20 1",
-  "bbob-biobj_f12_i10_d20 1",
-  "bbob-biobj_f13_i10_d20 1",
-  "bbob-biobj_f14_i10_d20 1",
-  "bbob-biobj_f15_i10_d20 1",
-  "bbob-biobj_f16_i10_d20 1",
-  "bbob-biobj_f17_i10_d20 1",
-  "bbob-biobj_f18_i10_d20 1",
-  "bbob-biobj_f19_i10_d20 1",
-  "bbob-biobj_f20_i10_d20 1",
-  "bbob-biobj_f21_i10_d20 1",
-  "bbob-biobj_f22_i10_d20 1",
-  "bbob-biobj_f23_i10_d20 1",
-  "bbob-biobj_f24_i10_d20 1",
-  "bbob-biobj_f25_i10_d20 1",
-  "bbob-biobj_f26_i10_d20 1",
-  "bbob-biobj_f27_i10_d20 1",
-  "bbob-biobj_f28_i10_d20 1",
-  "bbob-biobj_f29_i10_d20 1",
-  "bbob-biobj_f30_i10_d20 1",
-  "bbob-biobj_f31_i10_d20 1",
-  "bbob-biobj_f32_i10_d20 1",
-  "bbob-biobj_f33_i10_d20 1",
-  "bbob-biobj_f34_i10_d20 1",
-  "bbob-biobj_f35_i10_d20 1",
-  "bbob-biobj_f36_i10_d20 1",
-  "bbob-biobj_f37_i10_d20 1",
-  "bbob-biobj_f38_i10_d20 1",
-  "bbob-biobj_f39_i10_d20 1",
-  "bbob-biobj_f40_i10_d20 1",
-  "bbob-biobj_f41_i10_d20 1",
-  "bbob-biobj_f42_i10_d20 1",
-  "bbob-biobj_f43_i10_d20 1",
-  "bbob-biobj_f44_i10_d20 1",
-  "bbob-biobj_f45_i10_d20 1",
-  "bbob-biobj_f46_i10_d20 1",
-  "bbob-biobj_f47_i10_d20 1",
-  "bbob-biobj_f48_i10_d20 1",
-  "bbob-biobj_f49_i10_d20 1",
-  "bbob-biobj_f50_i10_d20 1",
-  "bbob-biobj_f51_i10_d20 1",
-  "bbob-biobj_f52_i10_d20 1",
-  "bbob-biobj_f53_i10_d20 1",
-  "bbob-biobj_f54_i10_d20 1",
-  "bbob-biobj_f55_i10_d20 1",
-  "bbob-biobj_f01_i06_d40 1",
-  "bbob-biobj_f02_i06_d40 1",
-  "bbob-biobj_f03_i06_d40 1",
-  "bbob-biobj_f04_i06_d40 1",
-  "bbob-biobj_f05_i06_d40 1",
-  "bbob-biobj_f06_i06_d40 1",
-  "bbob-biobj_f07_i06_d40 1",
-  "bbob-biobj_f08_i06_d40 1",
-  "bbob-biobj_f09_i06_d40 1",
-  "bbob-biobj_f10_i06_d40 1",
-  "bbob-biobj_f11_i06_d40 1",
-  "bbob-biobj_f12_i06_d40 1",
-  "bbob-biobj_f13_i06_d40 1",
-  "bbob-biobj_f14_i06_d40 1",
-  "bbob-biobj_f15_i06_d40 1",
-  "bbob-biobj_f16_i06_d40 1",
-  "bbob-biobj_f17_i06_d40 1",
-  "bbob-biobj_f18_i06_d40 1",
-  "bbob-biobj_f19_i06_d40 1",
-  "bbob-biobj_f20_i06_d40 1",
-  "bbob-biobj_f21_i06_d40 1",
-  "bbob-biobj_f22_i06_d40 1",
-  "bbob-biobj_f23_i06_d40 1",
-  "bbob-biobj_f24_i06_d40 1",
-  "bbob-biobj_f25_i06_d40 1",
-  "bbob-biobj_f26_i06_d40 1",
-  "bbob-biobj_f27_i06_d40 1",
-  "bbob-biobj_f28_i06_d40 1",
-  "bbob-biobj_f29_i06_d40 1",
-  "bbob-biobj_f30_i06_d40 1",
-  "bbob-biobj_f31_i06_d40 1",
-  "bbob-biobj_f32_i06_d40 1",
-  "bbob-biobj_f33_i06_d40 1",
-  "bbob-biobj_f34_i06_d40 1",
-  "bbob-biobj_f35_i06_d40 1",
-  "bbob-biobj_f36_i06_d40 1",
-  "bbob-biobj_f37_i06_d40 1",
-  "bbob-biobj_f38_i06_d40 1",
-  "bbob-biobj_f39_i06_d40 1",
-  "bbob-biobj_f40_i06_d40 1",
-  "bbob-biobj_f41_i06_d40 1",
-  "bbob-biobj_f42_i06_d40 1",
-  "bbob-biobj_f43_i06_d40 1",
-  "bbob-biobj_f44_i06_d40 1",
-  "bbob-biobj_f45_i06_d40 1",
-  "bbob-biobj_f46_i06_d40 1",
-  "bbob-biobj_f47_i06_d40 1",
-  "bbob-biobj_f48_i06_d40 1",
-  "bbob-biobj_f49_i06_d40 1",
-  "bbob-biobj_f50_i06_d40 1",
-  "bbob-biobj_f51_i06_d40 1",
-  "bbob-biobj_f52_i06_d40 1",
-  "bbob-biobj_f53_i06_d40 1",
-  "bbob-biobj_f54_i06_d40 1",
-  "bbob-biobj_f55_i06_d40 1",
-  "bbob-biobj_f01_i07_d40 1",
-  "bbob-biobj_f02_i07_d40 1",
-  "bbob-biobj_f03_i07_d40 1",
-  "bbob-biobj_f04_i07_d40 1",
-  "bbob-biobj_f05_i07_d40 1",
-  "bbob-biobj_f06_i07_d40 1",
-  "bbob-biobj_f07_i07_d40 1",
-  "bbob-biobj_f08_i07_d40 1",
-  "bbob-biobj_f09_i07_d40 1",
-  "bbob-biobj_f10_i07_d40 1",
-  "bbob-biobj_f11_i07_d40 1",
-  "bbob-biobj_f12_i07_d40 1",
-  "bbob-biobj_f13_i07_d40 1",
-  "bbob-biobj_f14_i07_d40 1",
-  "bbob-biobj_f15_i07_d40 1",
-  "bbob-biobj_f16_i07_d40 1",
-  "bbob-biobj_f17_i07_d40 1",
-  "bbob-biobj_f18_i07_d40 1",
-  "bbob-biobj_f19_i07_d40 1",
-  "bbob-biobj_f20_i07_d40 1",
-  "bbob-biobj_f21_i07_d40 1",
-  "bbob-biobj_f22_i07_d40 1",
-  "bbob-biobj_f23_i07_d40 1",
-  "bbob-biobj_f24_i07_d40 1",
-  "bbob-biobj_f25_i07_d40 1",
-  "bbob-biobj_f26_i07_d40 1",
-  "bbob-biobj_f27_i07_d40 1",
-  "bbob-biobj_f28_i07_d40 1",
-  "bbob-biobj_f29_i07_d40 1",
-  "bbob-biobj_f30_i07_d40 1",
-  "bbob-biobj_f31_i07_d40 1",
-  "bbob-biobj_f32_i07_d40 1",
-  "bbob-biobj_f33_i07_d40 1",
-  "bbob-biobj_f34_i07_d40 1",
-  "bbob-biobj_f35_i07_d40 1",
-  "bbob-biobj_f36_i07_d40 1",
-  "bbob-biobj_f37_i07_d40 1",
-  "bbob-biobj_f38_i07_d40 1",
-  "bbob-biobj_f39_i07_d40 1",
-  "bbob-biobj_f40_i07_d40 1",
-  "bbob-biobj_f41_i07_d40 1",
-  "bbob-biobj_f42_i07_d40 1",
-  "bbob-biobj_f43_i07_d40 1",
-  "bbob-biobj_f44_i07_d40 1",
-  "bbob-biobj_f45_i07_d40 1",
-  "bbob-biobj_f46_i07_d40 1",
-  "bbob-biobj_f47_i07_d40 1",
-  "bbob-biobj_f48_i07_d40 1",
-  "bbob-biobj_f49_i07_d40 1",
-  "bbob-biobj_f50_i07_d40 1",
-  "bbob-biobj_f51_i07_d40 1",
-  "bbob-biobj_f52_i07_d40 1",
-  "bbob-biobj_f53_i07_d40 1",
-  "bbob-biobj_f54_i07_d40 1",
-  "bbob-biobj_f55_i07_d40 1",
-  "bbob-biobj_f01_i08_d40 1",
-  "bbob-biobj_f02_i08_d40 1",
-  "bbob-biobj_f03_i08_d40 1",
-  "bbob-biobj_f04_i08_d40 1",
-  "bbob-biobj_f05_i08_d40 1",
-  "bbob-biobj_f06_i08_d40 1",
-  "bbob-biobj_f07_i08_d40 1",
-  "bbob-biobj_f08_i08_d40 1",
-  "bbob-biobj_f09_i08_d40 1",
-  "bbob-biobj_f10_i08_d40 1",
-  "bbob-biobj_f11_i08_d40 1",
-  "bbob-biobj_f12_i08_d40 1",
-  "bbob-biobj_f13_i08_d40 1",
-  "bbob-biobj_f14_i08_d40 1",
-  "bbob-biobj_f15_i08_d40 1",
-  "bbob-biobj_f16_i08_d40 1",
-  "bbob-biobj_f17_i08_d40 1",
-  "bbob-biobj_f18_i08_d40 1",
-  "bbob-biobj_f19_i08_d40 1",
-  "bbob-biobj_f20_i08_d40 1",
-  "bbob-biobj_f21_i08_d40 1",
-  "bbob-biobj_f22_i08_d40 1",
-  "bbob-biobj_f23_i08_d40 1",
-  "bbob-biobj_f24_i08_d40 1",
-  "bbob-biobj_f25_i08_d40 1",
-  "bbob-biobj_f26_i08_d40 1",
-  "bbob-biobj_f27_i08_d40 1",
-  "bbob-biobj_f28_i08_d40 1",
-  "bbob-biobj_f29_i08_d40 1",
-  "bbob-biobj_f30_i08_d40 1",
-  "bbob-biobj_f31_i08_d40 1",
-  "bbob-biobj_f32_i08_d40 1",
-  "bbob-biobj_f33_i08_d40 1",
-  "bbob-biobj_f34_i08_d40 1",
-  "bbob-biobj_f35_i08_d40 1",
-  "bbob-biobj_f36_i08_d40 1",
-  "bbob-biobj_f37_i08_d40 1",
-  "bbob-biobj_f38_i08_d40 1",
-  "bbob-biobj_f39_i08_d40 1",
-  "bbob-biobj_f40_i08_d40 1",
-  "bbob-biobj_f41_i08_d40 1",
-  "bbob-biobj_f42_i08_d40 1",
-  "bbob-biobj_f43_i08_d40 1",
-  "bbob-biobj_f44_i08_d40 1",
-  "bbob-biobj_f45_i08_d40 1",
-  "bbob-biobj_f46_i08_d40 1",
-  "bbob-biobj_f47_i08_d40 1",
-  "bbob-biobj_f48_i08_d40 1",
-  "bbob-biobj_f49_i08_d40 1",
-  "bbob-biobj_f50_i08_d40 1",
-  "bbob-biobj_f51_i08_d40 1",
-  "bbob-biobj_f52_i08_d40 1",
-  "bbob-biobj_f53_i08_d40 1",
-  "bbob-biobj_f54_i08_d40 1",
-  "bbob-biobj_f55_i08_d40 1",
-  "bbob-biobj_f01_i09_d40 1",
-  "bbob-biobj_f02_i09_d40 1",
-  "bbob-biobj_f03_i09_d40 1",
-  "bbob-biobj_f04_i09_d40 1",
-  "bbob-biobj_f05_i09_d40 1",
-  "bbob-biobj_f06_i09_d40 1",
-  "bbob-biobj_f07_i09_d40 1",
-  "bbob-biobj_f08_i09_d40 1",
-  "bbob-biobj_f09_i09_d40 1",
-  "bbob-biobj_f10_i09_d40 1",
-  "bbob-biobj_f11_i09_d40 1",
-  "bbob-biobj_f12_i09_d40 1",
-  "bbob-biobj_f13_i09_d40 1",
-  "bbob-biobj_f14_i09_d40 1",
-  "bbob-biobj_f15_i09_d40 1",
-  "bbob-biobj_f16_i09_d40 1",
-  "bbob-biobj_f17_i09_d40 1",
-  "bbob-biobj_f18_i09_d40 1",
-  "bbob-biobj_f19_i09_d40 1",
-  "bbob-biobj_f20_i09_d40 1",
-  "bbob-biobj_f21_i09_d40 1",
-  "bbob-biobj_f22_i09_d40 1",
-  "bbob-biobj_f23_i09_d40 1",
-  "bbob-biobj_f24_i09_d40 1",
-  "bbob-biobj_f25_i09_d40 1",
-  "bbob-biobj_f26_i09_d40 1",
-  "bbob-biobj_f27_i09_d40 1",
-  "bbob-biobj_f28_i09_d40 1",
-  "bbob-biobj_f29_i09_d40 1",
-  "bbob-biobj_f30_i09_d40 1",
-  "bbob-biobj_f31_i09_d40 1",
-  "bbob-biobj_f32_i09_d40 1",
-  "bbob-biobj_f33_i09_d40 1",
-  "bbob-biobj_f34_i09_d40 1",
-  "bbob-biobj_f35_i09_d40 1",
-  "bbob-biobj_f36_i09_d40 1",
-  "bbob-biobj_f37_i09_d40 1",
-  "bbob-biobj_f38_i09_d40 1",
-  "bbob-biobj_f39_i09_d40 1",
-  "bbob-biobj_f40_i09_d40 1",
-  "bbob-biobj_f41_i09_d40 1",
-  "bbob-biobj_f42_i09_d40 1",
-  "bbob-biobj_f43_i09_d40 1",
-  "bbob-biobj_f44_i09_d40 1",
-  "bbob-biobj_f45_i09_d40 1",
-  "bbob-biobj_f46_i09_d40 1",
-  "bbob-biobj_f47_i09_d40 1",
-  "bbob-biobj_f48_i09_d40 1",
-  "bbob-biobj_f49_i09_d40 1",
-  "bbob-biobj_f50_i09_d40 1",
-  "bbob-biobj_f51_i09_d40 1",
-  "bbob-biobj_f52_i09_d40 1",
-  "bbob-biobj_f53_i09_d40 1",
-  "bbob-biobj_f54_i09_d40 1",
-  "bbob-biobj_f55_i09_d40 1",
-  "bbob-biobj_f01_i10_d40 1",
-  "bbob-biobj_f02_i10_d40 1",
-  "bbob-biobj_f03_i10_d40 1",
-  "bbob-biobj_f04_i10_d40 1",
-  "bbob-biobj_f05_i10_d40 1",
-  "bbob-biobj_f06_i10_d40 1",
-  "bbob-biobj_f07_i10_d40 1",
-  "bbob-biobj_f08_i10_d40 1",
-  "bbob-biobj_f09_i10_d40 1",
-  "bbob-biobj_f10_i10_d40 1",
-  "bbob-biobj_f11_i10_d40 1",
-  "bbob-biobj_f12_i10_d40 1",
-  "bbob-biobj_f13_i10_d40 1",
-  "bbob-biobj_f14_i10_d40 1",
-  "bbob-biobj_f15_i10_d40 1",
-  "bbob-biobj_f16_i10_d40 1",
-  "bbob-biobj_f17_i10_d40 1",
-  "bbob-biobj_f18_i10_d40 1",
-  "bbob-biobj_f19_i10_d40 1",
-  "bbob-biobj_f20_i10_d40 1",
-  "bbob-biobj_f21_i10_d40 1",
-  "bbob-biobj_f22_i10_d40 1",
-  "bbob-biobj_f23_i10_d40 1",
-  "bbob-biobj_f24_i10_d40 1",
-  "bbob-biobj_f25_i10_d40 1",
-  "bbob-biobj_f26_i10_d40 1",
-  "bbob-biobj_f27_i10_d40 1",
-  "bbob-biobj_f28_i10_d40 1",
-  "bbob-biobj_f29_i10_d40 1",
-  "bbob-biobj_f30_i10_d40 1",
-  "bbob-biobj_f31_i10_d40 1",
-  "bbob-biobj_f32_i10_d40 1",
-  "bbob-biobj_f33_i10_d40 1",
-  "bbob-biobj_f34_i10_d40 1",
-  "bbob-biobj_f35_i10_d40 1",
-  "bbob-biobj_f36_i10_d40 1",
-  "bbob-biobj_f37_i10_d40 1",
-  "bbob-biobj_f38_i10_d40 1",
-  "bbob-biobj_f39_i10_d40 1",
-  "bbob-biobj_f40_i10_d40 1",
-  "bbob-biobj_f41_i10_d40 1",
-  "bbob-biobj_f42_i10_d40 1",
-  "bbob-biobj_f43_i10_d40 1",
-  "bbob-biobj_f44_i10_d40 1",
-  "bbob-biobj_f45_i10_d40 1",
-  "bbob-biobj_f46_i10_d40 1",
-  "bbob-biobj_f47_i10_d40 1",
-  "bbob-biobj_f48_i10_d40 1",
-  "bbob-biobj_f49_i10_d40 1",
-  "bbob-biobj_f50_i10_d40 1",
-  "bbob-biobj_f51_i10_d40 1",
-  "bbob-biobj_f52_i10_d40 1",
-  "bbob-biobj_f53_i10_d40 1",
-  "bbob-biobj_f54_i10_d40 1",
-  "bbob-biobj_f55_i10_d40 1"
-};
@@ -58,3 +58,35 @@ static coco_problem_t *suite_toy_get_problem(coco_suite_t *suite,
 
   return problem;
 }
+
+/**
+ * @brief Returns the id, name and number of objectives of the problem without constructing it.
+ *
+ * The ids and names are those set by the f_*_allocate() functions of the toy problems.
+ */
+static void suite_toy_get_problem_metadata(coco_suite_t *suite,
+                                           const size_t function_idx,
+                                           const size_t dimension_idx,
+                                           const size_t instance_idx,
+                                           char **problem_id,
+                                           char **problem_name,
+                                           size_t *number_of_objectives) {
+
+  static const char *ids[] = { "sphere", "ellipsoid", "rastrigin", "bueche-rastrigin", "linear_slope",
+      "rosenbrock" };
+  static const char *names[] = { "sphere function", "ellipsoid function", "Rastrigin function",
+      "Bueche-Rastrigin function", "linear slope function", "Rosenbrock function" };
+
+  const size_t function = suite->functions[function_idx];
+  const size_t dimension = suite->dimensions[dimension_idx];
+
+  if ((function < 1) || (function > 6)) {
+    coco_error("suite_toy_get_problem_metadata(): function %lu does not exist in this suite", function);
+    return; /* Never reached */
+  }
+
+  *problem_id = coco_strdupf("%s_d%02lu", ids[function - 1], dimension);
+  *problem_name = coco_strdup(names[function - 1]);
+  *number_of_objectives = 1;
+  (void) instance_idx; /* unused */
+}
@@ -28,10 +28,12 @@ static void transform_obj_oscillate_evaluate(coco_problem_t *self, const double
  */
 static coco_problem_t *f_transform_obj_oscillate(coco_problem_t *inner_problem) {
   coco_problem_t *self;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
   self = coco_transformed_allocate(inner_problem, NULL, NULL);
   self->evaluate_function = transform_obj_oscillate_evaluate;
   /* Compute best value */
   /* Maybe not the most efficient solution */
   transform_obj_oscillate_evaluate(self, self->best_parameter, self->best_value);
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
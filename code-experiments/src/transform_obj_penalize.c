@@ -38,6 +38,7 @@ static void transform_obj_penalize_evaluate(coco_problem_t *self, const double *
 static coco_problem_t *f_transform_obj_penalize(coco_problem_t *inner_problem, const double factor) {
   coco_problem_t *self;
   transform_obj_penalize_data_t *data;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
   assert(inner_problem != NULL);
   /* assert(offset != NULL); */
 
@@ -46,5 +47,6 @@ static coco_problem_t *f_transform_obj_penalize(coco_problem_t *inner_problem, c
   self = coco_transformed_allocate(inner_problem, data, NULL);
   self->evaluate_function = transform_obj_penalize_evaluate;
   /* No need to update the best value as the best parameter is feasible */
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
@@ -24,6 +24,7 @@ static void transform_obj_power_evaluate(coco_problem_t *self, const double *x,
 static coco_problem_t *f_transform_obj_power(coco_problem_t *inner_problem, const double exponent) {
   transform_obj_power_data_t *data;
   coco_problem_t *self;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
 
   data = coco_allocate_memory(sizeof(*data));
   data->exponent = exponent;
@@ -32,5 +33,6 @@ static coco_problem_t *f_transform_obj_power(coco_problem_t *inner_problem, cons
   self->evaluate_function = transform_obj_power_evaluate;
   /* Compute best value */
   transform_obj_power_evaluate(self, self->best_parameter, self->best_value);
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
@@ -24,6 +24,7 @@ static coco_problem_t *f_transform_obj_shift(coco_problem_t *inner_problem, cons
   coco_problem_t *self;
   transform_obj_shift_data_t *data;
   size_t i;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
   data = coco_allocate_memory(sizeof(*data));
   data->offset = offset;
 
@@ -32,5 +33,6 @@ static coco_problem_t *f_transform_obj_shift(coco_problem_t *inner_problem, cons
   for (i = 0; i < self->number_of_objectives; i++) {
       self->best_value[0] += offset;
   }
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
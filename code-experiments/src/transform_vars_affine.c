@@ -55,6 +55,7 @@ static coco_problem_t *f_transform_vars_affine(coco_problem_t *inner_problem,
   coco_problem_t *self;
   transform_vars_affine_data_t *data;
   size_t entries_in_M;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
 
   entries_in_M = inner_problem->number_of_variables * number_of_variables;
   data = coco_allocate_memory(sizeof(*data));
@@ -64,5 +65,6 @@ static coco_problem_t *f_transform_vars_affine(coco_problem_t *inner_problem,
 
   self = coco_transformed_allocate(inner_problem, data, transform_vars_affine_free);
   self->evaluate_function = transform_vars_affine_evaluate;
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
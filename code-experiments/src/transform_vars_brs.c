@@ -50,9 +50,11 @@ static void transform_vars_brs_free(void *thing) {
 static coco_problem_t *f_transform_vars_brs(coco_problem_t *inner_problem) {
   transform_vars_brs_data_t *data;
   coco_problem_t *self;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
   data = coco_allocate_memory(sizeof(*data));
   data->x = coco_allocate_vector(inner_problem->number_of_variables);
   self = coco_transformed_allocate(inner_problem, data, transform_vars_brs_free);
   self->evaluate_function = transform_vars_brs_evaluate;
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
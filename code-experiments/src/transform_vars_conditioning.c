@@ -41,10 +41,12 @@ static void transform_vars_conditioning_free(void *thing) {
 static coco_problem_t *f_transform_vars_conditioning(coco_problem_t *inner_problem, const double alpha) {
   transform_vars_conditioning_data_t *data;
   coco_problem_t *self;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
   data = coco_allocate_memory(sizeof(*data));
   data->x = coco_allocate_vector(inner_problem->number_of_variables);
   data->alpha = alpha;
   self = coco_transformed_allocate(inner_problem, data, transform_vars_conditioning_free);
   self->evaluate_function = transform_vars_conditioning_evaluate;
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
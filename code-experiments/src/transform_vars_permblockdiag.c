@@ -66,6 +66,7 @@ static coco_problem_t *f_ls_transform_vars_permblockdiag(coco_problem_t *inner_p
   ls_transform_vars_permblockdiag_t *data;
   size_t entries_in_M, idx_blocksize, next_bs_change, current_blocksize;
   int i;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
   entries_in_M = 0;
   assert(number_of_variables > 0);/*tmp*/
   for (i = 0; i < nb_blocks; i++) {
@@ -95,6 +96,7 @@ static coco_problem_t *f_ls_transform_vars_permblockdiag(coco_problem_t *inner_p
   
   self = coco_transformed_allocate(inner_problem, data, ls_transform_vars_permblockdiag_free);
   self->evaluate_function = ls_transform_vars_permblockdiag_evaluate;
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
 
@@ -39,6 +39,7 @@ static void transform_vars_scale_free(void *thing) {
 static coco_problem_t *f_transform_vars_scale(coco_problem_t *inner_problem, const double factor) {
   transform_vars_scale_data_t *data;
   coco_problem_t *self;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
 
   data = coco_allocate_memory(sizeof(*data));
   data->factor = factor;
@@ -46,5 +47,6 @@ static coco_problem_t *f_transform_vars_scale(coco_problem_t *inner_problem, con
 
   self = coco_transformed_allocate(inner_problem, data, transform_vars_scale_free);
   self->evaluate_function = transform_vars_scale_evaluate;
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
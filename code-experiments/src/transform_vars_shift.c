@@ -39,6 +39,7 @@ static coco_problem_t *f_transform_vars_shift(coco_problem_t *inner_problem,
   transform_vars_shift_data_t *data;
   coco_problem_t *self;
   size_t i;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
   if (shift_bounds)
     coco_error("shift_bounds not implemented.");
 
@@ -52,5 +53,6 @@ static coco_problem_t *f_transform_vars_shift(coco_problem_t *inner_problem,
   for (i = 0; i < self->number_of_variables; i++) {
       self->best_parameter[i] += data->offset[i];
   }
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
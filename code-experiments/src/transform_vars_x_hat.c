@@ -42,6 +42,7 @@ static coco_problem_t *f_transform_vars_x_hat(coco_problem_t *inner_problem, lon
   transform_vars_x_hat_data_t *data;
   coco_problem_t *self;
   size_t i;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
 
   data = coco_allocate_memory(sizeof(*data));
   data->seed = seed;
@@ -58,5 +59,6 @@ static coco_problem_t *f_transform_vars_x_hat(coco_problem_t *inner_problem, lon
           self->best_parameter[i] = 0.5 * 4.2096874633;
       }
   }
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
@@ -38,6 +38,7 @@ static void transform_vars_z_hat_free(void *thing) {
 static coco_problem_t *f_transform_vars_z_hat(coco_problem_t *inner_problem, const double *xopt) {
   transform_vars_z_hat_data_t *data;
   coco_problem_t *self;
+  coco_memory_subsystem_e previous_subsystem = coco_memory_set_subsystem(COCO_MEMORY_TRANSFORMATION);
 
   data = coco_allocate_memory(sizeof(*data));
   data->xopt = coco_duplicate_vector(xopt, inner_problem->number_of_variables);
@@ -45,5 +46,6 @@ static coco_problem_t *f_transform_vars_z_hat(coco_problem_t *inner_problem, con
 
   self = coco_transformed_allocate(inner_problem, data, transform_vars_z_hat_free);
   self->evaluate_function = transform_vars_z_hat_evaluate;
+  coco_memory_set_subsystem(previous_subsystem);
   return self;
 }
@@ -0,0 +1,491 @@
+/*
+ * Microbenchmarks of the COCO platform.
+ *
+ * Measures (in nanoseconds per call)
+ * - the construction of the first instance of every function of the chosen suites in every dimension,
+ * - the evaluation of these problems without an observer and with each of the chosen observers that can
+ * observe them,
+ * - the evaluation of each transform_vars_* and transform_obj_* layer in isolation, i.e. wrapped around a
+ * sphere function, which is also measured on its own.
+ *
+ * Every measurement repeats the call until at least min_seconds of wall-clock time have passed. The
+ * evaluations cycle through BENCHMARK_NUMBER_OF_POINTS uniformly sampled points, so that the loggers record
+ * the improvements of the first cycle and their trigger-based output afterwards.
+ *
+ * Usage: benchmark ["options"], where the options are given in the form "name1: value1 name2: value2":
+ * - output_file: the name of the output file (default: benchmark.json)
+ * - min_seconds: the minimal time in seconds spent in each measurement (default: 0.01)
+ * - suites: comma-separated list of the suites (default: bbob,bbob-biobj,bbob-largescale), use "none" to
+ * measure only the transformations
+ * - suite_options: the options (in double quotes) passed to every suite, for example
+ * "suite_options: \"function_idx: 1-3 dimension_idx: 1\"" (default: "")
+ * - observers: comma-separated list of the observers (default: toy,bbob,bbob-biobj,memory), use "none" to
+ * measure only the evaluations without observers
+ * - transformation_dimensions: the dimensions used for the transformations (default:
+ * 2,3,5,10,20,40,80,160,320,640), use "none" to skip the transformations
+ *
+ * The results are written in JSON with the following schema (version BENCHMARK_SCHEMA_VERSION), where
+ * every result has all the listed keys and the id is unique and stable across versions of COCO:
+ *
+ * {
+ *   "schema": "coco-benchmark",
+ *   "schema_version": 1,
+ *   "settings": { "min_seconds": ..., "suites": "...", "suite_options": "...", "observers": "...",
+ *                 "transformation_dimensions": "..." },
+ *   "results": [
+ *     { "id": "evaluation/bbob/f001/d02/none",
+ *       "category": "construction" | "evaluation" | "transformation",
+ *       "suite": "bbob", "function": 1, "dimension": 2,
+ *       "observer": "none", "transformation": "",
+ *       "calls": 1000000, "seconds": 0.0123,
+ *       "ns_per_call": 12.3, "net_ns_per_call": 12.3 },
+ *     ...
+ *   ]
+ * }
+ *
+ * The ids have the forms construction/SUITE/fFFF/dDD, evaluation/SUITE/fFFF/dDD/OBSERVER and
+ * transformation/TRANSFORMATION/dDD (with "none" for the plain sphere function). The net_ns_per_call is
+ * the time of the observer or of the transformation alone, i.e. ns_per_call minus the ns_per_call of the
+ * same evaluation without the observer or without the transformation, and equals ns_per_call otherwise.
+ *
+ * The script do.py runs the benchmark with "python do.py bench-c" and compares its results to a stored
+ * baseline (a previous output file) with "python do.py bench-c BASELINE_FILE [TOLERANCE]".
+ */
+#include "coco.c"
+#include "coco.h"
+
+#define BENCHMARK_SCHEMA_VERSION 1
+
+/* The number of points the evaluations cycle through */
+#define BENCHMARK_NUMBER_OF_POINTS 256
+
+/* The maximal length of the option values */
+#define BENCHMARK_MAX_OPTION 1000
+
+/**
+ * The names of the observers and the number of objectives of the problems they can observe (0 for any).
+ */
+static const char *benchmark_observer_names[] = { "toy", "bbob", "bbob-biobj", "memory" };
+static const size_t benchmark_observer_objectives[] = { 1, 1, 2, 0 };
+#define BENCHMARK_NUMBER_OF_OBSERVERS 4
+
+/**
+ * The names of the benchmarked transformations.
+ */
+static const char *benchmark_transformation_names[] = { "transform_vars_affine", "transform_vars_asymmetric",
+    "transform_vars_brs", "transform_vars_conditioning", "transform_vars_oscillate",
+    "transform_vars_permblockdiag", "transform_vars_scale", "transform_vars_shift", "transform_vars_x_hat",
+    "transform_vars_z_hat", "transform_obj_oscillate", "transform_obj_penalize", "transform_obj_power",
+    "transform_obj_shift" };
+#define BENCHMARK_NUMBER_OF_TRANSFORMATIONS 14
+
+/**
+ * The benchmark settings and the output file.
+ */
+typedef struct {
+  double min_seconds;
+  FILE *file;
+  size_t number_of_results;
+} benchmark_t;
+
+/**
+ * The result of a measurement.
+ */
+typedef struct {
+  unsigned long calls;
+  double seconds;
+} benchmark_measurement_t;
+
+/**
+ * Returns the time of a single call in nanoseconds.
+ */
+static double benchmark_ns_per_call(const benchmark_measurement_t *measurement) {
+  return 1e9 * measurement->seconds / (double) measurement->calls;
+}
+
+/**
+ * Writes the result of a measurement to the output file.
+ */
+static void benchmark_write_result(benchmark_t *benchmark,
+                                   const char *category,
+                                   const char *suite_name,
+                                   const size_t function,
+                                   const size_t dimension,
+                                   const char *observer_name,
+                                   const char *transformation_name,
+                                   const benchmark_measurement_t *measurement,
+                                   const double net_ns_per_call) {
+
+  char *id;
+
+  if (strcmp(category, "construction") == 0)
+    id = coco_strdupf("%s/%s/f%03lu/d%02lu", category, suite_name, (unsigned long) function,
+        (unsigned long) dimension);
+  else if (strcmp(category, "evaluation") == 0)
+    id = coco_strdupf("%s/%s/f%03lu/d%02lu/%s", category, suite_name, (unsigned long) function,
+        (unsigned long) dimension, observer_name);
+  else
+    id = coco_strdupf("%s/%s/d%02lu", category, transformation_name, (unsigned long) dimension);
+
+  fprintf(benchmark->file, "%s\n    { \"id\": \"%s\", \"category\": \"%s\", \"suite\": \"%s\", \"function\": %lu, "
+      "\"dimension\": %lu, \"observer\": \"%s\", \"transformation\": \"%s\", \"calls\": %lu, \"seconds\": %.6e, "
+      "\"ns_per_call\": %.6e, \"net_ns_per_call\": %.6e }", (benchmark->number_of_results > 0) ? "," : "", id,
+      category, suite_name, (unsigned long) function, (unsigned long) dimension, observer_name,
+      transformation_name, measurement->calls, measurement->seconds, benchmark_ns_per_call(measurement),
+      net_ns_per_call);
+  fflush(benchmark->file);
+  benchmark->number_of_results++;
+  coco_free_memory(id);
+}
+
+/**
+ * Measures the construction (and freeing) of the problem of the suite with the given indices.
+ */
+static void benchmark_construction(benchmark_t *benchmark,
+                                   coco_suite_t *suite,
+                                   const size_t function_idx,
+                                   const size_t dimension_idx,
+                                   const size_t instance_idx,
+                                   benchmark_measurement_t *measurement) {
+
+  coco_problem_t *problem;
+  double start = coco_get_monotonic_time();
+
+  measurement->calls = 0;
+  do {
+    problem = coco_suite_get_problem_from_indices(suite, function_idx, dimension_idx, instance_idx);
+    coco_problem_free(problem);
+    measurement->calls++;
+    measurement->seconds = coco_get_monotonic_time() - start;
+  } while (measurement->seconds < benchmark->min_seconds);
+}
+
+/**
+ * Measures the evaluation of the problem by cycling through uniformly sampled points within its region of
+ * interest.
+ */
+static void benchmark_evaluation(benchmark_t *benchmark,
+                                 coco_problem_t *problem,
+                                 benchmark_measurement_t *measurement) {
+
+  size_t dimension = coco_problem_get_dimension(problem);
+  const double *lower_bounds = coco_problem_get_smallest_values_of_interest(problem);
+  const double *upper_bounds = coco_problem_get_largest_values_of_interest(problem);
+  coco_random_state_t *random_generator = coco_random_new(12345);
+  double *points = coco_allocate_vector(BENCHMARK_NUMBER_OF_POINTS * dimension);
+  double *y = coco_allocate_vector(coco_problem_get_number_of_objectives(problem));
+  double start;
+  size_t i, j;
+
+  for (i = 0; i < BENCHMARK_NUMBER_OF_POINTS; i++) {
+    for (j = 0; j < dimension; j++) {
+      points[i * dimension + j] = lower_bounds[j]
+          + coco_random_uniform(random_generator) * (upper_bounds[j] - lower_bounds[j]);
+    }
+  }
+
+  /* The clock is read only after each cycle through the points */
+  measurement->calls = 0;
+  start = coco_get_monotonic_time();
+  do {
+    for (i = 0; i < BENCHMARK_NUMBER_OF_POINTS; i++) {
+      coco_evaluate_function(problem, &points[i * dimension], y);
+    }
+    measurement->calls += BENCHMARK_NUMBER_OF_POINTS;
+    measurement->seconds = coco_get_monotonic_time() - start;
+  } while (measurement->seconds < benchmark->min_seconds);
+
+  coco_random_free(random_generator);
+  coco_free_memory(points);
+  coco_free_memory(y);
+}
+
+/**
+ * Returns the observer with the given name that writes its output (if any) to a folder named
+ * benchmark_OBSERVER_NAME.
+ */
+static coco_observer_t *benchmark_observer(const char *observer_name) {
+
+  coco_observer_t *observer;
+  char *observer_options;
+
+  observer_options = coco_strdupf("result_folder: benchmark_%s algorithm_name: benchmark", observer_name);
+  observer = coco_observer(observer_name, observer_options);
+  coco_free_memory(observer_options);
+  return observer;
+}
+
+/**
+ * Returns 1 if the name is contained in the comma-separated list and 0 otherwise.
+ */
+static int benchmark_list_contains(const char *list, const char *name) {
+
+  char **items = coco_string_split(list, ',');
+  int result = 0;
+  size_t i;
+
+  for (i = 0; items[i] != NULL; i++) {
+    if (strcmp(items[i], name) == 0)
+      result = 1;
+    coco_free_memory(items[i]);
+  }
+  coco_free_memory(items);
+  return result;
+}
+
+/**
+ * Measures the construction and the evaluation (without and with the chosen observers) of the first
+ * instance of every function of the suite in every dimension.
+ */
+static void benchmark_suite(benchmark_t *benchmark,
+                            const char *suite_name,
+                            const char *suite_options,
+                            const char *observer_names) {
+
+  coco_suite_t *suite;
+  coco_observer_t *observers[BENCHMARK_NUMBER_OF_OBSERVERS];
+  coco_problem_t *problem;
+  benchmark_measurement_t measurement;
+  size_t function_idx, dimension_idx, instance_idx, number_of_objectives, function, dimension, i;
+  double ns_per_call;
+  char *output_folder;
+
+  suite = coco_suite(suite_name, "", suite_options);
+  instance_idx = coco_suite_get_first_item_idx(suite->number_of_instances, suite->instances);
+
+  /* The observers are constructed once per suite, when they are first needed */
+  for (i = 0; i < BENCHMARK_NUMBER_OF_OBSERVERS; i++)
+    observers[i] = NULL;
+
+  for (dimension_idx = 0; dimension_idx < suite->number_of_dimensions; dimension_idx++) {
+    if (suite->dimensions[dimension_idx] == 0)
+      continue;
+    dimension = suite->dimensions[dimension_idx];
+    coco_info("benchmark_suite(): %s in dimension %lu", suite_name, (unsigned long) dimension);
+
+    for (function_idx = 0; function_idx < suite->number_of_functions; function_idx++) {
+      if (suite->functions[function_idx] == 0)
+        continue;
+      function = suite->functions[function_idx];
+
+      benchmark_construction(benchmark, suite, function_idx, dimension_idx, instance_idx, &measurement);
+      benchmark_write_result(benchmark, "construction", suite_name, function, dimension, "", "", &measurement,
+          benchmark_ns_per_call(&measurement));
+
+      problem = coco_suite_get_problem_from_indices(suite, function_idx, dimension_idx, instance_idx);
+      number_of_objectives = coco_problem_get_number_of_objectives(problem);
+      benchmark_evaluation(benchmark, problem, &measurement);
+      coco_problem_free(problem);
+      ns_per_call = benchmark_ns_per_call(&measurement);
+      benchmark_write_result(benchmark, "evaluation", suite_name, function, dimension, "none", "", &measurement,
+          ns_per_call);
+
+      for (i = 0; i < BENCHMARK_NUMBER_OF_OBSERVERS; i++) {
+        if (!benchmark_list_contains(observer_names, benchmark_observer_names[i]))
+          continue;
+        if ((benchmark_observer_objectives[i] != 0) && (benchmark_observer_objectives[i] != number_of_objectives))
+          continue;
+        if (observers[i] == NULL)
+          observers[i] = benchmark_observer(benchmark_observer_names[i]);
+        problem = coco_suite_get_problem_from_indices(suite, function_idx, dimension_idx, instance_idx);
+        problem = coco_problem_add_observer(problem, observers[i]);
+        benchmark_evaluation(benchmark, problem, &measurement);
+        coco_problem_free(problem);
+        benchmark_write_result(benchmark, "evaluation", suite_name, function, dimension,
+            benchmark_observer_names[i], "", &measurement, benchmark_ns_per_call(&measurement) - ns_per_call);
+      }
+    }
+  }
+
+  /* The output of the observers is not needed */
+  for (i = 0; i < BENCHMARK_NUMBER_OF_OBSERVERS; i++) {
+    if (observers[i] == NULL)
+      continue;
+    output_folder = coco_strdup(observers[i]->output_folder);
+    coco_observer_free(observers[i]);
+    coco_remove_directory(output_folder);
+    coco_free_memory(output_folder);
+  }
+  coco_suite_free(suite);
+}
+
+/**
+ * Returns the transformation with the given name wrapped around the sphere function in the given dimension
+ * (with the parameters of the transformation as used by the bbob functions) or the sphere function alone if
+ * the name is "none". Returns NULL if the transformation is not defined in the given dimension.
+ */
+static coco_problem_t *benchmark_transformation_allocate(const char *transformation_name,
+                                                         const size_t dimension) {
+
+  coco_problem_t *problem = f_sphere_allocate(dimension);
+  const long rseed = 1001;
+  coco_random_state_t *random_generator;
+  double *xopt, *M, *b, **rot;
+  size_t *P1, *P2, *block_sizes, nb_blocks, swap_range, nb_swaps, i;
+
+  if (strcmp(transformation_name, "none") == 0) {
+    return problem;
+  } else if (strcmp(transformation_name, "transform_vars_affine") == 0) {
+    /* The timing does not depend on the orthogonality of the matrix, so a random matrix is used also in
+     * the dimensions where the bbob rotations are not defined */
+    M = coco_allocate_vector(dimension * dimension);
+    b = coco_allocate_vector(dimension);
+    random_generator = coco_random_new((uint32_t) rseed);
+    for (i = 0; i < dimension * dimension; i++)
+      M[i] = coco_random_normal(random_generator) / sqrt((double) dimension);
+    for (i = 0; i < dimension; i++)
+      b[i] = 0;
+    coco_random_free(random_generator);
+    problem = f_transform_vars_affine(problem, M, b, dimension);
+    coco_free_memory(M);
+    coco_free_memory(b);
+  } else if (strcmp(transformation_name, "transform_vars_asymmetric") == 0) {
+    problem = f_transform_vars_asymmetric(problem, 0.5);
+  } else if (strcmp(transformation_name, "transform_vars_brs") == 0) {
+    problem = f_transform_vars_brs(problem);
+  } else if (strcmp(transformation_name, "transform_vars_conditioning") == 0) {
+    problem = f_transform_vars_conditioning(problem, 10.0);
+  } else if (strcmp(transformation_name, "transform_vars_oscillate") == 0) {
+    problem = f_transform_vars_oscillate(problem);
+  } else if (strcmp(transformation_name, "transform_vars_permblockdiag") == 0) {
+    /* The blocks of dimension / 4 variables need to be nonempty */
+    if (dimension < 4) {
+      coco_problem_free(problem);
+      return NULL;
+    }
+    block_sizes = ls_get_block_sizes(&nb_blocks, dimension);
+    swap_range = ls_get_swap_range(dimension);
+    nb_swaps = ls_get_nb_swaps(dimension);
+    rot = ls_allocate_blockmatrix(dimension, block_sizes, nb_blocks);
+    P1 = (size_t *) coco_allocate_memory(dimension * sizeof(size_t));
+    P2 = (size_t *) coco_allocate_memory(dimension * sizeof(size_t));
+    ls_compute_blockrotation(rot, rseed + 1000000, dimension, block_sizes, nb_blocks);
+    ls_compute_truncated_uniform_swap_permutation(P1, rseed + 2000000, dimension, nb_swaps, swap_range);
+    ls_compute_truncated_uniform_swap_permutation(P2, rseed + 3000000, dimension, nb_swaps, swap_range);
+    problem = f_ls_transform_vars_permblockdiag(problem, (const double *const *) rot, P1, P2, dimension,
+        block_sizes, nb_blocks);
+    ls_free_block_matrix(rot, dimension);
+    coco_free_memory(P1);
+    coco_free_memory(P2);
+    coco_free_memory(block_sizes);
+  } else if (strcmp(transformation_name, "transform_vars_scale") == 0) {
+    problem = f_transform_vars_scale(problem, 0.5);
+  } else if (strcmp(transformation_name, "transform_vars_shift") == 0) {
+    xopt = coco_allocate_vector(dimension);
+    bbob2009_compute_xopt(xopt, rseed, dimension);
+    problem = f_transform_vars_shift(problem, xopt, 0);
+    coco_free_memory(xopt);
+  } else if (strcmp(transformation_name, "transform_vars_x_hat") == 0) {
+    problem = f_transform_vars_x_hat(problem, rseed);
+  } else if (strcmp(transformation_name, "transform_vars_z_hat") == 0) {
+    xopt = coco_allocate_vector(dimension);
+    bbob2009_compute_xopt(xopt, rseed, dimension);
+    problem = f_transform_vars_z_hat(problem, xopt);
+    coco_free_memory(xopt);
+  } else if (strcmp(transformation_name, "transform_obj_oscillate") == 0) {
+    problem = f_transform_obj_oscillate(problem);
+  } else if (strcmp(transformation_name, "transform_obj_penalize") == 0) {
+    problem = f_transform_obj_penalize(problem, 1.0);
+  } else if (strcmp(transformation_name, "transform_obj_power") == 0) {
+    problem = f_transform_obj_power(problem, 0.9);
+  } else if (strcmp(transformation_name, "transform_obj_shift") == 0) {
+    problem = f_transform_obj_shift(problem, 79.48);
+  } else {
+    coco_error("benchmark_transformation_allocate(): unknown transformation %s", transformation_name);
+    return NULL; /* Never reached */
+  }
+  return problem;
+}
+
+/**
+ * Measures the evaluation of the sphere function and of each transformation wrapped around it in the given
+ * dimensions.
+ */
+static void benchmark_transformations(benchmark_t *benchmark, const size_t *dimensions) {
+
+  coco_problem_t *problem;
+  benchmark_measurement_t measurement;
+  double ns_per_call;
+  size_t i, j;
+
+  for (i = 0; dimensions[i] != 0; i++) {
+    coco_info("benchmark_transformations(): dimension %lu", (unsigned long) dimensions[i]);
+
+    problem = benchmark_transformation_allocate("none", dimensions[i]);
+    benchmark_evaluation(benchmark, problem, &measurement);
+    coco_problem_free(problem);
+    ns_per_call = benchmark_ns_per_call(&measurement);
+    benchmark_write_result(benchmark, "transformation", "", 0, dimensions[i], "", "none", &measurement,
+        ns_per_call);
+
+    for (j = 0; j < BENCHMARK_NUMBER_OF_TRANSFORMATIONS; j++) {
+      problem = benchmark_transformation_allocate(benchmark_transformation_names[j], dimensions[i]);
+      if (problem == NULL)
+        continue;
+      benchmark_evaluation(benchmark, problem, &measurement);
+      coco_problem_free(problem);
+      benchmark_write_result(benchmark, "transformation", "", 0, dimensions[i], "",
+          benchmark_transformation_names[j], &measurement, benchmark_ns_per_call(&measurement) - ns_per_call);
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+
+  const char *options = (argc > 1) ? argv[1] : "";
+  benchmark_t benchmark;
+  char output_file[COCO_PATH_MAX] = "benchmark.json";
+  char suites[BENCHMARK_MAX_OPTION] = "bbob,bbob-biobj,bbob-largescale";
+  char suite_options[BENCHMARK_MAX_OPTION] = "";
+  char observers[BENCHMARK_MAX_OPTION] = "toy,bbob,bbob-biobj,memory";
+  char transformation_dimensions[BENCHMARK_MAX_OPTION] = "2,3,5,10,20,40,80,160,320,640";
+  char **suite_names;
+  size_t *dimensions, i;
+
+  coco_set_log_level("info");
+
+  benchmark.min_seconds = 0.01;
+  coco_options_read(options, "min_seconds", "%lf", &benchmark.min_seconds);
+  coco_options_read_string(options, "output_file", output_file);
+  coco_options_read_values(options, "suites", suites);
+  coco_options_read_string(options, "suite_options", suite_options);
+  coco_options_read_values(options, "observers", observers);
+  coco_options_read_values(options, "transformation_dimensions", transformation_dimensions);
+
+  benchmark.file = fopen(output_file, "w");
+  if (benchmark.file == NULL) {
+    coco_error("benchmark: failed to open file %s", output_file);
+    return 1; /* Never reached */
+  }
+  benchmark.number_of_results = 0;
+  fprintf(benchmark.file, "{\n  \"schema\": \"coco-benchmark\",\n  \"schema_version\": %d,\n",
+      BENCHMARK_SCHEMA_VERSION);
+  fprintf(benchmark.file, "  \"settings\": { \"min_seconds\": %.6e, \"suites\": \"%s\", \"suite_options\": \"%s\", "
+      "\"observers\": \"%s\", \"transformation_dimensions\": \"%s\" },\n", benchmark.min_seconds, suites,
+      suite_options, observers, transformation_dimensions);
+  fprintf(benchmark.file, "  \"results\": [");
+
+  if (strcmp(suites, "none") != 0) {
+    suite_names = coco_string_split(suites, ',');
+    for (i = 0; suite_names[i] != NULL; i++) {
+      benchmark_suite(&benchmark, suite_names[i], suite_options, observers);
+      coco_free_memory(suite_names[i]);
+    }
+    coco_free_memory(suite_names);
+  }
+
+  if (strcmp(transformation_dimensions, "none") != 0) {
+    dimensions = coco_string_get_numbers_from_ranges(transformation_dimensions, "transformation_dimensions", 1,
+        0);
+    if (dimensions != NULL) {
+      benchmark_transformations(&benchmark, dimensions);
+      coco_free_memory(dimensions);
+    }
+  }
+
+  fprintf(benchmark.file, "\n  ]\n}\n");
+  fclose(benchmark.file);
+  coco_info("benchmark: %lu results written to %s", (unsigned long) benchmark.number_of_results, output_file);
+
+  return 0;
+}
@@ -0,0 +1,79 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include "cmocka.h"
+#include "coco.h"
+
+/**
+ * Tests the setting of the subsystem and the attribution of the allocations to the subsystems if COCO was
+ * compiled with COCO_MEMORY_TRACKING (otherwise setting the subsystem does nothing).
+ */
+static void test_coco_memory(void **state) {
+
+  coco_suite_t *suite;
+  coco_problem_t *problem;
+  const coco_memory_stats_t *stats;
+  size_t live_bytes[COCO_MEMORY_NUMBER_OF_SUBSYSTEMS], live_blocks, allocations, i;
+  double *x;
+
+  stats = coco_memory_stats();
+  if (stats == NULL) {
+    assert(coco_memory_set_subsystem(COCO_MEMORY_LOGGER) == COCO_MEMORY_OTHER);
+    assert(coco_memory_set_subsystem(COCO_MEMORY_OTHER) == COCO_MEMORY_OTHER);
+    return;
+  }
+
+  assert(coco_memory_set_subsystem(COCO_MEMORY_LOGGER) == COCO_MEMORY_OTHER);
+  assert(coco_memory_set_subsystem(COCO_MEMORY_OTHER) == COCO_MEMORY_LOGGER);
+
+  suite = coco_suite("bbob", "instances: 1", "");
+  assert(stats->live_bytes[COCO_MEMORY_SUITE] > 0);
+
+  for (i = 0; i < COCO_MEMORY_NUMBER_OF_SUBSYSTEMS; i++)
+    live_bytes[i] = stats->live_bytes[i];
+  live_blocks = stats->total_live_blocks;
+  allocations = stats->total_allocations;
+
+  /* The ellipsoid is a rotated problem with both problem data and transformations */
+  problem = coco_suite_get_problem(suite, coco_suite_encode_problem_index(suite, 9, 2, 0));
+  assert(stats->live_bytes[COCO_MEMORY_PROBLEM] > live_bytes[COCO_MEMORY_PROBLEM]);
+  assert(stats->live_bytes[COCO_MEMORY_TRANSFORMATION] > live_bytes[COCO_MEMORY_TRANSFORMATION]);
+  assert(stats->peak_bytes[COCO_MEMORY_TRANSFORMATION] >= stats->live_bytes[COCO_MEMORY_TRANSFORMATION]);
+  assert(stats->live_bytes[COCO_MEMORY_SUITE] == live_bytes[COCO_MEMORY_SUITE]);
+
+  x = coco_allocate_vector(3);
+  assert(stats->live_bytes[COCO_MEMORY_OTHER] == live_bytes[COCO_MEMORY_OTHER] + 3 * sizeof(double));
+  coco_free_memory(x);
+  coco_free_memory(NULL);
+
+  /* Freeing the problem releases all of its blocks */
+  coco_problem_free(problem);
+  for (i = 0; i < COCO_MEMORY_NUMBER_OF_SUBSYSTEMS; i++)
+    assert(stats->live_bytes[i] == live_bytes[i]);
+  assert(stats->total_live_blocks == live_blocks);
+  assert(stats->total_allocations > allocations + 1);
+
+  coco_suite_free(suite);
+
+  /* The subsystem is per thread, so the problems constructed on the prefetching thread (if COCO was compiled
+   * with COCO_PREFETCH) do not change the attribution of the allocations of this thread */
+  suite = coco_suite("bbob", "instances: 1", "dimensions: 40 function_idx: 1-3 prefetch: 1");
+  while ((problem = coco_suite_get_next_problem(suite, NULL)) != NULL) {
+    live_bytes[COCO_MEMORY_OTHER] = stats->live_bytes[COCO_MEMORY_OTHER];
+    x = coco_allocate_vector(40);
+    assert(stats->live_bytes[COCO_MEMORY_OTHER] == live_bytes[COCO_MEMORY_OTHER] + 40 * sizeof(double));
+    coco_free_memory(x);
+  }
+  coco_suite_free(suite);
+
+  (void)state; /* unused */
+}
+
+static int test_all_coco_memory(void) {
+
+  const struct CMUnitTest tests[] = {
+  cmocka_unit_test(test_coco_memory)
+  };
+
+  return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,191 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include "cmocka.h"
+#include "coco.h"
+
+/**
+ * Returns 1 if the two timing summary files contain the same header and the same problems with the same
+ * numbers of evaluations in the same order and 0 otherwise (the measured times differ between runs).
+ */
+static int test_coco_merge_timing_files_equal(const char *path1, const char *path2) {
+
+  FILE *file1, *file2;
+  char line1[4096], line2[4096];
+  char *result1, *result2;
+  size_t length;
+  int result = 1;
+
+  file1 = fopen(path1, "r");
+  file2 = fopen(path2, "r");
+  assert_non_null(file1);
+  assert_non_null(file2);
+  do {
+    result1 = fgets(line1, sizeof(line1), file1);
+    result2 = fgets(line2, sizeof(line2), file2);
+    if ((result1 == NULL) || (result2 == NULL)) {
+      result = (result1 == result2);
+      break;
+    }
+    if (line1[0] == '%') {
+      result = (strcmp(line1, line2) == 0);
+    } else {
+      /* The problem id and the number of evaluations */
+      length = strcspn(line1, " ");
+      length += 1 + strcspn(line1 + length + 1, " ");
+      result = (strncmp(line1, line2, length) == 0) && (line2[length] == ' ');
+    }
+  } while (result);
+  fclose(file1);
+  fclose(file2);
+  return result;
+}
+
+/**
+ * Returns 1 if the two folders contain the same files and directories with the same content (see
+ * test_coco_merge_timing_files_equal() for the timing summary files) and 0 otherwise.
+ */
+static int test_coco_merge_folders_equal(const char *folder1, const char *folder2) {
+
+  char **names1, **names2, *path1, *path2;
+  size_t number_of_names1, number_of_names2, i;
+  FILE *file1, *file2;
+  int c1, c2, result;
+
+  names1 = coco_merge_list_directory(folder1, &number_of_names1);
+  names2 = coco_merge_list_directory(folder2, &number_of_names2);
+  result = (number_of_names1 == number_of_names2);
+  for (i = 0; result && (i < number_of_names1); i++) {
+    result = (strcmp(names1[i], names2[i]) == 0);
+    if (!result)
+      break;
+    path1 = coco_strdupf("%s%s%s", folder1, coco_path_separator, names1[i]);
+    path2 = coco_strdupf("%s%s%s", folder2, coco_path_separator, names2[i]);
+    if (coco_path_exists(path1)) {
+      result = coco_path_exists(path2) && test_coco_merge_folders_equal(path1, path2);
+    } else if (strcmp(names1[i], COCO_TIMING_FILE_NAME) == 0) {
+      result = test_coco_merge_timing_files_equal(path1, path2);
+    } else {
+      file1 = fopen(path1, "rb");
+      file2 = fopen(path2, "rb");
+      assert_non_null(file1);
+      assert_non_null(file2);
+      do {
+        c1 = fgetc(file1);
+        c2 = fgetc(file2);
+      } while ((c1 == c2) && (c1 != EOF));
+      fclose(file1);
+      fclose(file2);
+      result = (c1 == c2);
+    }
+    coco_free_memory(path1);
+    coco_free_memory(path2);
+  }
+
+  for (i = 0; i < number_of_names1; i++)
+    coco_free_memory(names1[i]);
+  for (i = 0; i < number_of_names2; i++)
+    coco_free_memory(names2[i]);
+  if (names1 != NULL)
+    coco_free_memory(names1);
+  if (names2 != NULL)
+    coco_free_memory(names2);
+  return result;
+}
+
+/**
+ * Runs random search on a small part of the suite with the given additional suite options using the
+ * observer of the same name (with timing). Returns the name of the used result folder.
+ */
+static char *test_coco_merge_run(const char *suite_name, const char *batch_options,
+    const char *result_folder) {
+
+  const size_t budget_multiplier = 20;
+  coco_suite_t *suite;
+  coco_observer_t *observer;
+  coco_problem_t *problem;
+  coco_random_state_t *rng;
+  char *suite_options, *observer_options, *output_folder;
+  double *x, y[2];
+  size_t dimension, i, j;
+
+  suite_options = coco_strdupf("dimensions: 2,3,5 function_idx: 1,2,8 %s", batch_options);
+  observer_options = coco_strdupf("result_folder: %s timing: 1", result_folder);
+  suite = coco_suite(suite_name, "instances: 1-2", suite_options);
+  observer = coco_observer(suite_name, observer_options);
+  output_folder = coco_strdup(observer->output_folder);
+
+  while ((problem = coco_suite_get_next_problem(suite, observer)) != NULL) {
+    rng = coco_random_new(12345);
+    dimension = coco_problem_get_dimension(problem);
+    x = coco_allocate_vector(dimension);
+    for (i = 0; i < budget_multiplier * dimension; i++) {
+      for (j = 0; j < dimension; j++) {
+        x[j] = 10.0 * coco_random_uniform(rng) - 5.0;
+      }
+      coco_evaluate_function(problem, x, y);
+    }
+    coco_free_memory(x);
+    coco_random_free(rng);
+  }
+
+  coco_observer_free(observer);
+  coco_suite_free(suite);
+  coco_free_memory(suite_options);
+  coco_free_memory(observer_options);
+  return output_folder;
+}
+
+/**
+ * Checks that the merged result folders of runs on three batches of the suite equal the result folder of a
+ * single run.
+ */
+static void test_coco_merge_check_batches(const char *suite_name) {
+
+  char *folder, *batch_folders[3], *merged_folder, *batch_options, *result_folder, *timing_path;
+  size_t batch;
+
+  folder = test_coco_merge_run(suite_name, "", "test_merge_all");
+  for (batch = 1; batch <= 3; batch++) {
+    batch_options = coco_strdupf("batch: %lu/3", (unsigned long) batch);
+    result_folder = coco_strdupf("test_merge_batch%lu", (unsigned long) batch);
+    batch_folders[batch - 1] = test_coco_merge_run(suite_name, batch_options, result_folder);
+    coco_free_memory(batch_options);
+    coco_free_memory(result_folder);
+  }
+  merged_folder = coco_strdupf("%s-merged", folder);
+  coco_merge_result_folders(merged_folder, 3, (const char **) batch_folders);
+  assert_true(test_coco_merge_folders_equal(folder, merged_folder));
+  timing_path = coco_strdupf("%s%s%s", merged_folder, coco_path_separator, COCO_TIMING_FILE_NAME);
+  assert_true(coco_file_exists(timing_path));
+  coco_free_memory(timing_path);
+
+  coco_remove_directory(folder);
+  coco_remove_directory(merged_folder);
+  coco_free_memory(folder);
+  coco_free_memory(merged_folder);
+  for (batch = 0; batch < 3; batch++) {
+    coco_remove_directory(batch_folders[batch]);
+    coco_free_memory(batch_folders[batch]);
+  }
+}
+
+/**
+ * Tests the function coco_merge_result_folders with the output of the bbob and bbob-biobj observers.
+ */
+static void test_coco_merge_result_folders(void **state) {
+
+  test_coco_merge_check_batches("bbob");
+  test_coco_merge_check_batches("bbob-biobj");
+
+  (void)state; /* unused */
+}
+
+static int test_all_coco_merge(void) {
+
+  const struct CMUnitTest tests[] = {
+  cmocka_unit_test(test_coco_merge_result_folders)
+  };
+
+  return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -66,10 +66,354 @@ static void test_coco_suite_encode_problem_index(void **state) {
   (void)state; /* unused */
 }
 
+/**
+ * Tests the function suite_biobj_get_best_value.
+ */
+static void test_suite_biobj_get_best_value(void **state) {
+
+  double best_value;
+
+  best_value = suite_biobj_get_best_value("hyp", "bbob-biobj_f01_i01_d02");
+  assert_true(best_value == 0.833332381880295);
+
+  best_value = suite_biobj_get_best_value("hyp", "bbob-biobj_f23_i05_d10");
+  assert_true((best_value > 0) && (best_value <= 1));
+
+  best_value = suite_biobj_get_best_value("hyp", "bbob-biobj_f55_i10_d40");
+  assert_true(best_value == 1);
+
+  (void)state; /* unused */
+}
+
+/**
+ * Checks that the metadata of all problems of the suite equals that of the constructed problems.
+ */
+static void test_coco_suite_check_problem_metadata(const char *suite_name,
+                                                   const char *suite_instance,
+                                                   const char *suite_options) {
+
+  coco_suite_t *suite, *metadata_suite;
+  coco_problem_t *problem;
+  const char *problem_id, *problem_name;
+  size_t dimension, number_of_objectives, index = 0, number_of_problems = 0;
+
+  suite = coco_suite(suite_name, suite_instance, suite_options);
+  metadata_suite = coco_suite(suite_name, suite_instance, suite_options);
+  while ((problem = coco_suite_get_next_problem(suite, NULL)) != NULL) {
+    while (!coco_suite_get_problem_metadata(metadata_suite, index, &problem_id, &problem_name, &dimension,
+        &number_of_objectives)) {
+      index++;
+      assert_true(index < coco_suite_get_number_of_problems(metadata_suite));
+    }
+    assert_true(index == coco_problem_get_suite_dep_index(problem));
+    assert_string_equal(problem_id, coco_problem_get_id(problem));
+    assert_string_equal(problem_name, coco_problem_get_name(problem));
+    assert_true(dimension == coco_problem_get_dimension(problem));
+    assert_true(number_of_objectives == coco_problem_get_number_of_objectives(problem));
+    index++;
+    number_of_problems++;
+  }
+  assert_true(number_of_problems > 0);
+  while (index < coco_suite_get_number_of_problems(metadata_suite)) {
+    assert_false(coco_suite_get_problem_metadata(metadata_suite, index++, NULL, NULL, NULL, NULL));
+  }
+  assert_false(coco_suite_get_problem_metadata(metadata_suite, index, NULL, NULL, NULL, NULL));
+  coco_suite_free(suite);
+  coco_suite_free(metadata_suite);
+}
+
+/**
+ * Tests the function coco_suite_get_problem_metadata.
+ */
+static void test_coco_suite_get_problem_metadata(void **state) {
+
+  test_coco_suite_check_problem_metadata("toy", "", "");
+  test_coco_suite_check_problem_metadata("bbob", "instances: 1-3", "dimensions: 2,5 function_idx: 1,7-9,24");
+  test_coco_suite_check_problem_metadata("bbob", "", "dimension_idx: 3 instance_idx: 2,15");
+  test_coco_suite_check_problem_metadata("bbob-biobj", "instances: 1-2", "dimensions: 2,3 function_idx: 1-5,55");
+  test_coco_suite_check_problem_metadata("bbob", "instances: 1-2", "dimensions: 2,10,20 batch: 2/3");
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests the "batch" suite option, i.e., that the batches partition the suite and keep all instances of a
+ * function in a dimension together.
+ */
+static void test_coco_suite_batch(void **state) {
+
+  const size_t number_of_batches = 3, number_of_instances = 3;
+  coco_suite_t *suite;
+  coco_problem_t *problem;
+  char *suite_options;
+  size_t *batches, number_of_problems, index, batch, i, previous_index = 0;
+  size_t problems_in_batch[3] = { 0, 0, 0 };
+
+  suite = coco_suite("bbob", "instances: 1-3", "dimensions: 2,3,5,10 function_idx: 1-5");
+  number_of_problems = coco_suite_get_number_of_problems(suite);
+  batches = (size_t *) coco_allocate_memory(number_of_problems * sizeof(size_t));
+  for (i = 0; i < number_of_problems; i++)
+    batches[i] = 0;
+  coco_suite_free(suite);
+
+  for (batch = 1; batch <= number_of_batches; batch++) {
+    suite_options = coco_strdupf("dimensions: 2,3,5,10 function_idx: 1-5 batch: %lu/%lu",
+        (unsigned long) batch, (unsigned long) number_of_batches);
+    suite = coco_suite("bbob", "instances: 1-3", suite_options);
+    while ((problem = coco_suite_get_next_problem(suite, NULL)) != NULL) {
+      index = coco_problem_get_suite_dep_index(problem);
+      assert_true(batches[index] == 0);
+      batches[index] = batch;
+      problems_in_batch[batch - 1]++;
+    }
+    coco_suite_free(suite);
+    coco_free_memory(suite_options);
+  }
+
+  /* Each problem is in one of the batches, which are not empty, with the other instances of its function in
+   * its dimension (which come one after the other in the suite) */
+  suite = coco_suite("bbob", "instances: 1-3", "dimensions: 2,3,5,10 function_idx: 1-5");
+  for (i = 0; (problem = coco_suite_get_next_problem(suite, NULL)) != NULL; i++) {
+    index = coco_problem_get_suite_dep_index(problem);
+    assert_true(batches[index] > 0);
+    if (i % number_of_instances != 0)
+      assert_true(batches[index] == batches[previous_index]);
+    previous_index = index;
+  }
+  assert_true(i == 60);
+  for (batch = 0; batch < number_of_batches; batch++)
+    assert_true(problems_in_batch[batch] > 0);
+  coco_suite_free(suite);
+  coco_free_memory(batches);
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests the "work_queue" suite option with two suites that take turns in getting the next problem and with
+ * a lease of a dead process that needs to be reclaimed.
+ */
+static void test_coco_suite_work_queue(void **state) {
+
+  const char *suite_options = "dimensions: 2,5,10 function_idx: 3-6 work_queue: test_work_queue";
+  coco_suite_t *suites[2];
+  coco_problem_t *problem;
+  int *is_taken;
+  size_t number_of_problems, number_of_taken_problems = 0, index, i;
+  size_t problems_of_suite[2] = { 0, 0 }, previous_index[2] = { 0, 0 };
+  FILE *file;
+
+  /* The suites take whole functions in dimensions (with two instances each), the most expensive ones first */
+  suites[0] = coco_suite("bbob", "instances: 1-2", suite_options);
+  suites[1] = coco_suite("bbob", "instances: 1-2", suite_options);
+  number_of_problems = coco_suite_get_number_of_problems(suites[0]);
+  is_taken = (int *) coco_allocate_memory(number_of_problems * sizeof(int));
+  for (index = 0; index < number_of_problems; index++)
+    is_taken[index] = 0;
+  for (i = 0; (problem = coco_suite_get_next_problem(suites[i], NULL)) != NULL; i = 1 - i) {
+    index = coco_problem_get_suite_dep_index(problem);
+    assert_true(index < number_of_problems);
+    assert_false(is_taken[index]);
+    is_taken[index] = 1;
+    assert_true(coco_problem_get_dimension(problem) == ((number_of_taken_problems < 8) ? 10 :
+        (number_of_taken_problems < 16) ? 5 : 2));
+    if (problems_of_suite[i] % 2 == 1)
+      assert_true(index == previous_index[i] + 1);
+    previous_index[i] = index;
+    problems_of_suite[i]++;
+    number_of_taken_problems++;
+  }
+  coco_free_memory(is_taken);
+  assert_null(coco_suite_get_next_problem(suites[1 - i], NULL));
+  assert_true(number_of_taken_problems == 24);
+  coco_suite_free(suites[0]);
+  coco_suite_free(suites[1]);
+  coco_remove_directory("test_work_queue");
+
+  /* A process that stopped in the middle of a function in a dimension leaves its lease until it expires */
+  suites[0] = coco_suite("bbob", "instances: 1-2", suite_options);
+  assert_non_null(coco_suite_get_next_problem(suites[0], NULL));
+  coco_suite_free(suites[0]);
+  suites[0] = coco_suite("bbob", "instances: 1-2", suite_options);
+  for (i = 0; coco_suite_get_next_problem(suites[0], NULL) != NULL; i++);
+  assert_true(i == 22);
+  coco_suite_free(suites[0]);
+
+  /* Let the lease expire */
+  file = fopen("test_work_queue/bbob_f003_d10.lease", "w");
+  assert_non_null(file);
+  fprintf(file, "dead\n0\ndead_output_folder\n");
+  fclose(file);
+  suites[0] = coco_suite("bbob", "instances: 1-2", suite_options);
+  problem = coco_suite_get_next_problem(suites[0], NULL);
+  assert_non_null(problem);
+  assert_string_equal(coco_problem_get_id(problem), "bbob_f003_i01_d10");
+  for (i = 1; coco_suite_get_next_problem(suites[0], NULL) != NULL; i++);
+  assert_true(i == 2);
+  coco_suite_free(suites[0]);
+  coco_remove_directory("test_work_queue");
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests that the heartbeat of the "work_queue" suite option is renewed during the evaluations and that a
+ * lease that has been reclaimed by another process is not overwritten.
+ */
+static void test_coco_suite_work_queue_heartbeat(void **state) {
+
+  /* With a timeout of 0 seconds, the heartbeat is renewed in every evaluation */
+  const char *suite_options = "dimensions: 2 function_idx: 3 work_queue: test_work_queue lease_timeout: 0";
+  const char *lease_path = "test_work_queue/bbob_f003_d02.lease";
+  coco_suite_t *suite;
+  coco_problem_t *problem;
+  char owner[COCO_PATH_MAX], output_folder[COCO_PATH_MAX];
+  unsigned long heartbeat;
+  double x[2] = { 0, 0 }, y;
+  FILE *file;
+
+  suite = coco_suite("bbob", "instances: 1-2", suite_options);
+  problem = coco_suite_get_next_problem(suite, NULL);
+  assert_non_null(problem);
+  assert_true(coco_work_queue_read_lease(lease_path, owner, &heartbeat, output_folder));
+
+  file = fopen(lease_path, "w");
+  assert_non_null(file);
+  fprintf(file, "%s\n0\n\n", owner);
+  fclose(file);
+  coco_evaluate_function(problem, x, &y);
+  assert_true(coco_work_queue_read_lease(lease_path, owner, &heartbeat, output_folder));
+  assert_true(heartbeat > 0);
+
+  /* The lease of another process is left as it is */
+  file = fopen(lease_path, "w");
+  assert_non_null(file);
+  fprintf(file, "other\n0\nother_output_folder\n");
+  fclose(file);
+  coco_evaluate_function(problem, x, &y);
+  assert_true(coco_work_queue_read_lease(lease_path, owner, &heartbeat, output_folder));
+  assert_string_equal(owner, "other");
+  assert_true(heartbeat == 0);
+
+  coco_suite_free(suite);
+  coco_remove_directory("test_work_queue");
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests that the "prefetch" suite option (which constructs the problems when they are asked for if COCO was
+ * not compiled with COCO_PREFETCH) does not change the problems of the suite or their order.
+ */
+static void test_coco_suite_prefetch(void **state) {
+
+  const char *suite_options = "dimensions: 2,5,10 function_idx: 1,21,22 instance_idx: 1-2";
+  coco_suite_t *suite, *prefetching_suite;
+  coco_problem_t *problem, *prefetched_problem, *other_problem;
+  char *prefetching_options;
+  double *x, y, prefetched_y;
+  size_t number_of_problems = 0;
+
+  prefetching_options = coco_strdupf("%s prefetch: 1", suite_options);
+  suite = coco_suite("bbob", "", suite_options);
+  prefetching_suite = coco_suite("bbob", "", prefetching_options);
+  while ((problem = coco_suite_get_next_problem(suite, NULL)) != NULL) {
+    prefetched_problem = coco_suite_get_next_problem(prefetching_suite, NULL);
+    assert_non_null(prefetched_problem);
+    assert_string_equal(coco_problem_get_id(problem), coco_problem_get_id(prefetched_problem));
+    x = coco_allocate_vector(coco_problem_get_dimension(problem));
+    coco_problem_get_initial_solution(problem, x);
+    coco_evaluate_function(problem, x, &y);
+    coco_evaluate_function(prefetched_problem, x, &prefetched_y);
+    assert_true(y == prefetched_y);
+    coco_free_memory(x);
+
+    /* Constructing another problem while the next one is prefetched */
+    if (number_of_problems++ == 3) {
+      other_problem = coco_suite_get_problem(prefetching_suite, 0);
+      assert_string_equal(coco_problem_get_id(other_problem), "bbob_f001_i01_d02");
+      coco_problem_free(other_problem);
+    }
+  }
+  assert_null(coco_suite_get_next_problem(prefetching_suite, NULL));
+  assert_true(number_of_problems == 18);
+  coco_suite_free(suite);
+  coco_suite_free(prefetching_suite);
+
+  /* Freeing the suite while the next problem is prefetched */
+  prefetching_suite = coco_suite("bbob", "", prefetching_options);
+  assert_non_null(coco_suite_get_next_problem(prefetching_suite, NULL));
+  coco_suite_free(prefetching_suite);
+  coco_free_memory(prefetching_options);
+
+  (void)state; /* unused */
+}
+
+/**
+ * Evaluates the problem in 100 points.
+ */
+static void test_coco_timing_experiment_optimizer(coco_problem_t *problem) {
+
+  double x[5] = { 0, 0, 0, 0, 0 }, y;
+  size_t i;
+
+  for (i = 0; i < 100; i++) {
+    x[0] = (double) i / 100.0;
+    coco_evaluate_function(problem, x, &y);
+  }
+}
+
+/**
+ * Tests the function coco_timing_experiment.
+ */
+static void test_coco_timing_experiment(void **state) {
+
+  coco_suite_t *suite;
+  FILE *file;
+  char line[1000], path[COCO_PATH_MAX] = { 0 };
+  unsigned long dimension, runs[2], evaluations[2];
+  double seconds[2], cpu_seconds[2];
+  size_t number_of_lines = 0;
+
+  assert_false(coco_file_exists("timing_experiment_bbob"));
+  suite = coco_suite("bbob", "instances: 1-5", "dimensions: 2,5 function_idx: 8");
+  coco_timing_experiment(suite, test_coco_timing_experiment_optimizer, 0.01);
+  coco_suite_free(suite);
+
+  coco_join_path(path, COCO_PATH_MAX, "timing_experiment_bbob", "timing_experiment.txt", NULL);
+  file = fopen(path, "r");
+  assert_non_null(file);
+  assert_non_null(fgets(line, sizeof(line), file));
+  assert_true(strstr(line, "functions = 8") != NULL);
+  while (fgets(line, sizeof(line), file) != NULL) {
+    if (line[0] == '%')
+      continue;
+    assert_true(sscanf(line, "%lu %lu %lu %lf %lf %lu %lu %lf %lf", &dimension, &runs[0], &evaluations[0],
+        &seconds[0], &cpu_seconds[0], &runs[1], &evaluations[1], &seconds[1], &cpu_seconds[1]) == 9);
+    assert_true(dimension == ((number_of_lines == 0) ? 2 : 5));
+    assert_true((runs[0] > 0) && (runs[1] > 0));
+    assert_true((evaluations[0] == 100 * runs[0]) && (evaluations[1] == 100 * runs[1]));
+    assert_true((seconds[0] > 0) && (seconds[1] > 0));
+    number_of_lines++;
+  }
+  fclose(file);
+  assert_true(number_of_lines == 2);
+  coco_remove_directory("timing_experiment_bbob");
+
+  (void)state; /* unused */
+}
+
 static int test_all_coco_suite(void) {
 
   const struct CMUnitTest tests[] = {
-      cmocka_unit_test(test_coco_suite_encode_problem_index)
+      cmocka_unit_test(test_coco_suite_encode_problem_index),
+      cmocka_unit_test(test_suite_biobj_get_best_value),
+      cmocka_unit_test(test_coco_suite_get_problem_metadata),
+      cmocka_unit_test(test_coco_suite_batch),
+      cmocka_unit_test(test_coco_suite_work_queue),
+      cmocka_unit_test(test_coco_suite_work_queue_heartbeat),
+      cmocka_unit_test(test_coco_suite_prefetch),
+      cmocka_unit_test(test_coco_timing_experiment)
   };
 
   return cmocka_run_group_tests(tests, NULL, NULL);
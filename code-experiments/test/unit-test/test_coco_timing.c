@@ -0,0 +1,142 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include "cmocka.h"
+#include "coco.h"
+
+/**
+ * Keeps the processor busy for at least the given number of seconds.
+ */
+static void test_coco_timing_wait(const double seconds) {
+  double start = coco_get_monotonic_time();
+  while (coco_get_monotonic_time() - start < seconds)
+    ;
+}
+
+/**
+ * Tests that the timing layers measure the evaluations and the optimizer and write the timing summary.
+ */
+static void test_coco_timing(void **state) {
+
+  coco_suite_t *suite;
+  coco_observer_t *observer;
+  coco_problem_t *problem, *plain_problem;
+  const coco_timing_t *timing;
+  char path[COCO_PATH_MAX] = { 0 }, line[1000], problem_id[100], *output_folder;
+  FILE *file;
+  double x[2] = { 1, 2 }, y, plain_y, seconds[COCO_TIMING_NUMBER_OF_CATEGORIES], wall, cpu;
+  unsigned long evaluations, histogram_sum, bin;
+  size_t number_of_problems = 0, i;
+  int offset, position;
+
+  suite = coco_suite("bbob", "instances: 1-2", "dimensions: 2 function_idx: 1");
+  observer = coco_observer("bbob", "result_folder: test_timing timing: 1");
+  output_folder = coco_strdup(observer->output_folder);
+  while ((problem = coco_suite_get_next_problem(suite, observer)) != NULL) {
+    timing = coco_problem_get_timing(problem);
+    assert(timing != NULL);
+    assert(timing->number_of_evaluations == 0);
+    assert(timing->seconds[COCO_TIMING_CONSTRUCTION] >= 0);
+
+    /* The timing layers do not change the result of the evaluation */
+    plain_problem = coco_suite_get_problem(suite, coco_problem_get_suite_dep_index(problem));
+    assert(coco_problem_get_timing(plain_problem) == NULL);
+    for (i = 0; i < 100; i++) {
+      coco_evaluate_function(problem, x, &y);
+      coco_evaluate_function(plain_problem, x, &plain_y);
+      assert(y == plain_y);
+      if (i == 49)
+        test_coco_timing_wait(0.02);
+    }
+    coco_problem_free(plain_problem);
+
+    timing = coco_problem_get_timing(problem);
+    assert(timing->number_of_evaluations == 100);
+    assert(timing->seconds[COCO_TIMING_EVALUATION] >= 0);
+    assert(timing->seconds[COCO_TIMING_LOGGING] >= 0);
+    assert(timing->seconds[COCO_TIMING_OPTIMIZER] >= 0.02);
+    assert(timing->wall_seconds >= timing->seconds[COCO_TIMING_CONSTRUCTION]
+        + timing->seconds[COCO_TIMING_EVALUATION] + timing->seconds[COCO_TIMING_LOGGING]
+        + timing->seconds[COCO_TIMING_OPTIMIZER] - 1e-6);
+    histogram_sum = 0;
+    for (i = 0; i < COCO_TIMING_NUMBER_OF_BINS; i++)
+      histogram_sum += (unsigned long) timing->latency_histogram[i];
+    assert(histogram_sum == 100);
+    number_of_problems++;
+  }
+  coco_suite_free(suite);
+  coco_observer_free(observer);
+
+  /* The summary contains a line for each problem */
+  coco_join_path(path, COCO_PATH_MAX, output_folder, "timing.txt", NULL);
+  file = fopen(path, "r");
+  assert(file != NULL);
+  i = 0;
+  while (fgets(line, sizeof(line), file) != NULL) {
+    if (line[0] == '%')
+      continue;
+    assert(sscanf(line, "%99s %lu %lf %lf %lf %lf %lf %lf%n", problem_id, &evaluations, &seconds[0],
+        &seconds[1], &seconds[2], &seconds[3], &wall, &cpu, &position) == 8);
+    assert(strcmp(problem_id, (i == 0) ? "bbob_f001_i01_d02" : "bbob_f001_i02_d02") == 0);
+    assert(evaluations == 100);
+    assert(seconds[3] >= 0.02);
+    assert(wall >= seconds[0] + seconds[1] + seconds[2] + seconds[3] - 1e-5);
+    histogram_sum = 0;
+    while (sscanf(line + position, " %lu%n", &bin, &offset) == 1) {
+      histogram_sum += bin;
+      position += offset;
+    }
+    assert(histogram_sum == 100);
+    i++;
+  }
+  fclose(file);
+  assert(i == number_of_problems);
+
+  coco_remove_directory(output_folder);
+  coco_free_memory(output_folder);
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests that the monotonic clock, and therefore the latency histogram, resolves times well below one
+ * microsecond (the resolution of gettimeofday()) on Linux.
+ */
+static void test_coco_timing_resolution(void **state) {
+
+  double previous, current, smallest_difference = 1;
+  size_t i;
+
+#if defined(__gnu_linux__)
+#if !defined(HAVE_CLOCK_GETTIME)
+  fail_msg("clock_gettime() is not available on Linux");
+#endif
+  previous = coco_get_monotonic_time();
+  for (i = 0; i < 1000; i++) {
+    current = coco_get_monotonic_time();
+    if ((current > previous) && (current - previous < smallest_difference))
+      smallest_difference = current - previous;
+    previous = current;
+  }
+  assert_true(smallest_difference < 1e-6);
+  /* Bin 9 of the histogram counts the latencies from 512 to 1024 nanoseconds */
+  assert_true(coco_timing_latency_bin(smallest_difference) < 9);
+#else
+  (void) previous;
+  (void) current;
+  (void) smallest_difference;
+  (void) i;
+#endif
+
+  (void)state; /* unused */
+}
+
+static int test_all_coco_timing(void) {
+
+  const struct CMUnitTest tests[] = {
+  cmocka_unit_test(test_coco_timing),
+  cmocka_unit_test(test_coco_timing_resolution)
+  };
+
+  return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,208 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include "cmocka.h"
+#include "coco.h"
+
+/**
+ * Returns 1 if the files with the given paths exist and have the same content and 0 otherwise.
+ */
+static int test_logger_bbob_files_equal(const char *path1, const char *path2) {
+
+  FILE *file1, *file2;
+  int c1, c2;
+
+  file1 = fopen(path1, "r");
+  file2 = fopen(path2, "r");
+  if ((file1 == NULL) || (file2 == NULL)) {
+    if (file1 != NULL)
+      fclose(file1);
+    if (file2 != NULL)
+      fclose(file2);
+    return 0;
+  }
+
+  do {
+    c1 = fgetc(file1);
+    c2 = fgetc(file2);
+  } while ((c1 == c2) && (c1 != EOF));
+
+  fclose(file1);
+  fclose(file2);
+  return (c1 == c2);
+}
+
+/**
+ * Runs random search on a small part of the bbob suite using the bbob observer with the given options.
+ * Returns the name of the used result folder.
+ */
+static char *test_logger_bbob_run(const char *result_folder, const char *options) {
+
+  const size_t budget_multiplier = 50;
+  coco_suite_t *suite;
+  coco_observer_t *observer;
+  coco_problem_t *problem;
+  coco_random_state_t *rng;
+  char *observer_options, *output_folder;
+  double *x, y;
+  size_t dimension, i, j;
+
+  observer_options = coco_strdupf("result_folder: %s %s", result_folder, options);
+  suite = coco_suite("bbob", "instances: 1-3", "dimensions: 2,40 function_idx: 1,8");
+  observer = coco_observer("bbob", observer_options);
+  output_folder = coco_strdup(observer->output_folder);
+
+  while ((problem = coco_suite_get_next_problem(suite, observer)) != NULL) {
+    rng = coco_random_new(12345);
+    dimension = coco_problem_get_dimension(problem);
+    x = coco_allocate_vector(dimension);
+    for (i = 0; i < budget_multiplier * dimension; i++) {
+      for (j = 0; j < dimension; j++) {
+        x[j] = (10.0 * coco_random_uniform(rng) - 5.0) / (double) (i + 1);
+      }
+      coco_evaluate_function(problem, x, &y);
+    }
+    coco_free_memory(x);
+    coco_random_free(rng);
+  }
+
+  coco_observer_free(observer);
+  coco_suite_free(suite);
+  coco_free_memory(observer_options);
+  return output_folder;
+}
+
+/**
+ * Checks that the data files in the result folders folder1 and folder2 of test_logger_bbob_run are equal. If
+ * is_binary is 1, the data files in folder2 are first converted from the binary format.
+ */
+static void test_logger_bbob_compare_results(const char *folder1, const char *folder2, const int is_binary) {
+
+  const size_t functions[] = { 1, 8 };
+  const size_t dimensions[] = { 2, 40 };
+  const char *extensions[] = { "dat", "tdat", "rdat" };
+  char data_folder[COCO_PATH_MAX], file_name[COCO_PATH_MAX], binary_file_name[COCO_PATH_MAX];
+  char path1[COCO_PATH_MAX], path2[COCO_PATH_MAX], path_binary[COCO_PATH_MAX];
+  size_t f, d, e;
+
+  for (f = 0; f < 2; f++) {
+    for (d = 0; d < 2; d++) {
+      for (e = 0; e < 3; e++) {
+        sprintf(file_name, "bbobexp_f%lu_DIM%lu_i1.%s", (unsigned long) functions[f],
+            (unsigned long) dimensions[d], extensions[e]);
+        strcpy(binary_file_name, file_name);
+        strcat(binary_file_name, ".bin");
+        sprintf(data_folder, "data_f%lu", (unsigned long) functions[f]);
+        path1[0] = path2[0] = path_binary[0] = '\0';
+        coco_join_path(path1, COCO_PATH_MAX, folder1, data_folder, file_name, NULL);
+        coco_join_path(path2, COCO_PATH_MAX, folder2, data_folder, file_name, NULL);
+        coco_join_path(path_binary, COCO_PATH_MAX, folder2, data_folder, binary_file_name, NULL);
+
+        if (is_binary)
+          coco_bbob_binary_to_text(path_binary, path2);
+        assert(test_logger_bbob_files_equal(path1, path2));
+      }
+    }
+  }
+}
+
+/**
+ * Tests that the binary format of the bbob logger converted with coco_bbob_binary_to_text gives exactly the
+ * same data files as the text format.
+ */
+static void test_logger_bbob_binary_format(void **state) {
+
+  char *folder_text, *folder_binary;
+
+  folder_text = test_logger_bbob_run("test_bbob_text", "format: text");
+  folder_binary = test_logger_bbob_run("test_bbob_binary", "format: binary");
+  test_logger_bbob_compare_results(folder_text, folder_binary, 1);
+
+  coco_remove_directory(folder_text);
+  coco_remove_directory(folder_binary);
+  coco_free_memory(folder_text);
+  coco_free_memory(folder_binary);
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests that the fields of the binary format are 8 little-endian bytes on every host.
+ */
+static void test_logger_bbob_binary_encoding(void **state) {
+
+  const unsigned char expected_size_t[8] = { 0x04, 0x03, 0x02, 0x01, 0, 0, 0, 0 };
+  const unsigned char expected_double[8] = { 0, 0, 0, 0, 0, 0, 0xF0, 0x3F }; /* 1.0 */
+  const int is_little_endian = logger_bbob_binary_is_little_endian();
+  unsigned char bytes[8];
+
+  logger_bbob_binary_put_size_t(bytes, 0x01020304);
+  assert_memory_equal(bytes, expected_size_t, 8);
+  assert_int_equal(logger_bbob_binary_get_size_t(bytes), 0x01020304);
+  assert_false(logger_bbob_binary_is_header_mark(bytes));
+
+  logger_bbob_binary_put_double(bytes, 1.0, is_little_endian);
+  assert_memory_equal(bytes, expected_double, 8);
+  assert_true(logger_bbob_binary_get_double(bytes, is_little_endian) == 1.0);
+
+  logger_bbob_binary_put_header_mark(bytes);
+  assert_true(logger_bbob_binary_is_header_mark(bytes));
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests that asynchronous logging (with a small buffer, so that the evaluations have to wait for the writer
+ * thread) gives exactly the same data files as synchronous logging. If COCO was not compiled with
+ * COCO_ASYNC_LOGGING, both runs log synchronously.
+ */
+static void test_logger_bbob_async_logging(void **state) {
+
+  char *folder_sync, *folder_async;
+
+  folder_sync = test_logger_bbob_run("test_bbob_sync", "");
+  folder_async = test_logger_bbob_run("test_bbob_async", "async_logging: 1 async_buffer_size: 16");
+  test_logger_bbob_compare_results(folder_sync, folder_async, 0);
+
+  coco_remove_directory(folder_sync);
+  coco_remove_directory(folder_async);
+  coco_free_memory(folder_sync);
+  coco_free_memory(folder_async);
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests that the flush policies do not change the output.
+ */
+static void test_logger_bbob_flush_policies(void **state) {
+
+  const char *policies[] = { "flush: on_target", "flush: on_close", "flush: interval_ms:1" };
+  char *folder_every, *folder_policy;
+  size_t i;
+
+  folder_every = test_logger_bbob_run("test_bbob_flush_every", "flush: every");
+  for (i = 0; i < 3; i++) {
+    folder_policy = test_logger_bbob_run("test_bbob_flush", policies[i]);
+    test_logger_bbob_compare_results(folder_every, folder_policy, 0);
+    coco_remove_directory(folder_policy);
+    coco_free_memory(folder_policy);
+  }
+
+  coco_remove_directory(folder_every);
+  coco_free_memory(folder_every);
+
+  (void)state; /* unused */
+}
+
+static int test_all_logger_bbob(void) {
+
+  const struct CMUnitTest tests[] = {
+      cmocka_unit_test(test_logger_bbob_binary_format),
+      cmocka_unit_test(test_logger_bbob_binary_encoding),
+      cmocka_unit_test(test_logger_bbob_async_logging),
+      cmocka_unit_test(test_logger_bbob_flush_policies)
+  };
+
+  return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,180 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include "cmocka.h"
+#include "coco.h"
+
+/**
+ * Returns 1 if the files with the given paths exist and have the same content and 0 otherwise.
+ */
+static int test_logger_biobj_files_equal(const char *path1, const char *path2) {
+
+  FILE *file1, *file2;
+  int c1, c2;
+
+  file1 = fopen(path1, "r");
+  file2 = fopen(path2, "r");
+  if ((file1 == NULL) || (file2 == NULL)) {
+    if (file1 != NULL)
+      fclose(file1);
+    if (file2 != NULL)
+      fclose(file2);
+    return 0;
+  }
+
+  do {
+    c1 = fgetc(file1);
+    c2 = fgetc(file2);
+  } while ((c1 == c2) && (c1 != EOF));
+
+  fclose(file1);
+  fclose(file2);
+  return (c1 == c2);
+}
+
+/**
+ * Runs random search with populations on a small part of the bbob-biobj suite. If use_population is 1, the
+ * populations are evaluated with coco_evaluate_population, otherwise one solution at a time. The given
+ * options are added to the observer options. Returns the name of the used result folder.
+ */
+static char *test_logger_biobj_run(const char *result_folder, const int use_population, const char *options) {
+
+  const size_t population_size = 25;
+  const size_t number_of_generations = 8;
+  coco_suite_t *suite;
+  coco_observer_t *observer;
+  coco_problem_t *problem;
+  coco_random_state_t *rng;
+  char *observer_options, *output_folder;
+  double *x, *y;
+  size_t dimension, generation, i, j;
+
+  observer_options = coco_strdupf("result_folder: %s log_nondominated: all %s", result_folder, options);
+  suite = coco_suite("bbob-biobj", "instances: 1-2", "dimensions: 2,5 function_idx: 1,4,55");
+  observer = coco_observer("bbob-biobj", observer_options);
+  output_folder = coco_strdup(observer->output_folder);
+
+  while ((problem = coco_suite_get_next_problem(suite, observer)) != NULL) {
+    rng = coco_random_new(12345);
+    dimension = coco_problem_get_dimension(problem);
+    x = coco_allocate_vector(population_size * dimension);
+    y = coco_allocate_vector(population_size * 2);
+
+    for (generation = 0; generation < number_of_generations; generation++) {
+      for (i = 0; i < population_size; i++) {
+        for (j = 0; j < dimension; j++) {
+          /* The population contracts around the origin and contains some duplicates */
+          if ((i > 0) && (i % 7 == 0))
+            x[i * dimension + j] = x[(i - 1) * dimension + j];
+          else
+            x[i * dimension + j] = (10.0 * coco_random_uniform(rng) - 5.0) / (double) (generation + 1);
+        }
+      }
+      if (use_population) {
+        coco_evaluate_population(problem, x, population_size, y);
+      } else {
+        for (i = 0; i < population_size; i++)
+          coco_evaluate_function(problem, &x[i * dimension], &y[2 * i]);
+      }
+    }
+
+    assert(coco_problem_get_evaluations(problem) == population_size * number_of_generations);
+    coco_free_memory(x);
+    coco_free_memory(y);
+    coco_random_free(rng);
+  }
+
+  coco_observer_free(observer);
+  coco_suite_free(suite);
+  coco_free_memory(observer_options);
+  return output_folder;
+}
+
+/**
+ * Checks that the archive and indicator files in the result folders folder_sequential and folder_population of
+ * test_logger_biobj_run are equal.
+ */
+static void test_logger_biobj_compare_results(const char *folder_sequential, const char *folder_population) {
+
+  const char *file_names[] = {
+      "archive/bbob-biobj_f01_d02_nondom_all.dat",
+      "archive/bbob-biobj_f04_d05_nondom_all.dat",
+      "archive/bbob-biobj_f55_d05_nondom_all.dat",
+      "bbob-biobj_f01_d02_hyp.dat",
+      "bbob-biobj_f04_d05_hyp.dat",
+      "bbob-biobj_f55_d05_hyp.dat"
+  };
+  const char *problem_types[] = { "1-separable_1-separable", "1-separable_2-moderate",
+      "5-weakly-structured_5-weakly-structured" };
+  char path1[COCO_PATH_MAX], path2[COCO_PATH_MAX], type_file[COCO_PATH_MAX];
+  size_t i;
+
+  for (i = 0; i < 6; i++) {
+    path1[0] = path2[0] = '\0';
+    if (i < 3) {
+      coco_join_path(path1, COCO_PATH_MAX, folder_sequential, file_names[i], NULL);
+      coco_join_path(path2, COCO_PATH_MAX, folder_population, file_names[i], NULL);
+    } else {
+      coco_join_path(path1, COCO_PATH_MAX, folder_sequential, problem_types[i - 3], file_names[i], NULL);
+      coco_join_path(path2, COCO_PATH_MAX, folder_population, problem_types[i - 3], file_names[i], NULL);
+    }
+    assert(test_logger_biobj_files_equal(path1, path2));
+  }
+
+  for (i = 0; i < 3; i++) {
+    path1[0] = path2[0] = '\0';
+    sprintf(type_file, "%s_hyp.info", problem_types[i]);
+    coco_join_path(path1, COCO_PATH_MAX, folder_sequential, type_file, NULL);
+    coco_join_path(path2, COCO_PATH_MAX, folder_population, type_file, NULL);
+    assert(test_logger_biobj_files_equal(path1, path2));
+  }
+}
+
+/**
+ * Tests that logger_biobj_evaluate_population produces exactly the same output as logger_biobj_evaluate.
+ */
+static void test_logger_biobj_evaluate_population(void **state) {
+
+  char *folder_sequential, *folder_population;
+
+  folder_sequential = test_logger_biobj_run("test_biobj_sequential", 0, "");
+  folder_population = test_logger_biobj_run("test_biobj_population", 1, "");
+  test_logger_biobj_compare_results(folder_sequential, folder_population);
+
+  coco_remove_directory(folder_sequential);
+  coco_remove_directory(folder_population);
+  coco_free_memory(folder_sequential);
+  coco_free_memory(folder_population);
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests that asynchronous logging of populations produces exactly the same output as synchronous logging of
+ * single solutions. If COCO was not compiled with COCO_ASYNC_LOGGING, both runs log synchronously.
+ */
+static void test_logger_biobj_async_logging(void **state) {
+
+  char *folder_sequential, *folder_async;
+
+  folder_sequential = test_logger_biobj_run("test_biobj_sequential", 0, "");
+  folder_async = test_logger_biobj_run("test_biobj_async", 1, "async_logging: 1 async_buffer_size: 10");
+  test_logger_biobj_compare_results(folder_sequential, folder_async);
+
+  coco_remove_directory(folder_sequential);
+  coco_remove_directory(folder_async);
+  coco_free_memory(folder_sequential);
+  coco_free_memory(folder_async);
+
+  (void)state; /* unused */
+}
+
+static int test_all_logger_biobj(void) {
+
+  const struct CMUnitTest tests[] = {
+      cmocka_unit_test(test_logger_biobj_evaluate_population),
+      cmocka_unit_test(test_logger_biobj_async_logging)
+  };
+
+  return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,285 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include "cmocka.h"
+#include "coco.h"
+
+/**
+ * Evaluates random solutions that get closer to the origin and returns the number of evaluations.
+ */
+static size_t test_logger_memory_evaluate(coco_problem_t *problem, const size_t budget, double *best_value) {
+
+  coco_random_state_t *rng;
+  size_t dimension, i, j;
+  double *x, y[2];
+
+  rng = coco_random_new(12345);
+  dimension = coco_problem_get_dimension(problem);
+  x = coco_allocate_vector(dimension);
+  for (i = 0; i < budget; i++) {
+    for (j = 0; j < dimension; j++) {
+      x[j] = (10.0 * coco_random_uniform(rng) - 5.0) / (double) (i + 1);
+    }
+    coco_evaluate_function(problem, x, y);
+    if ((best_value != NULL) && (y[0] < *best_value))
+      *best_value = y[0];
+  }
+  coco_free_memory(x);
+  coco_random_free(rng);
+  return budget;
+}
+
+/**
+ * Tests the results of the memory observer on single-objective problems.
+ */
+static void test_logger_memory_single_objective(void **state) {
+
+  coco_suite_t *suite;
+  coco_observer_t *observer;
+  coco_problem_t *problem;
+  const size_t *target_hits, *trajectory_evaluations;
+  const double *targets, *trajectory_values, *best_solution;
+  double best_f, optimal_value, *expected_best_values;
+  size_t number_of_targets, number_of_variables, trajectory_length, i, k;
+
+  suite = coco_suite("bbob", "instances: 1-2", "dimensions: 2,5 function_idx: 1,8");
+  observer = coco_observer("memory", "result_folder: test_memory trajectory: 3");
+  assert(!coco_file_exists("test_memory"));
+
+  expected_best_values = coco_allocate_vector(coco_suite_get_number_of_problems(suite));
+  i = 0;
+  while ((problem = coco_suite_get_next_problem(suite, observer)) != NULL) {
+    best_f = DBL_MAX;
+    optimal_value = *(coco_transformed_get_inner_problem(problem)->best_value);
+    test_logger_memory_evaluate(problem, 500 + i, &best_f);
+    expected_best_values[i++] = best_f - optimal_value;
+  }
+  coco_suite_free(suite);
+
+  assert(coco_observer_memory_get_number_of_results(observer) == i);
+  for (i = 0; i < coco_observer_memory_get_number_of_results(observer); i++) {
+    assert(coco_observer_memory_get_evaluations(observer, i) == 500 + i);
+    assert(coco_observer_memory_get_best_value(observer, i) == expected_best_values[i]);
+    best_solution = coco_observer_memory_get_best_solution(observer, i, &number_of_variables);
+    assert(number_of_variables == ((i < 4) ? 2 : 5));
+    assert(best_solution[0] != 0);
+
+    /* The bbob targets from 1e2 to 1e-8 with five targets per decade */
+    targets = coco_observer_memory_get_targets(observer, i, &number_of_targets);
+    target_hits = coco_observer_memory_get_target_hits(observer, i, NULL);
+    assert(number_of_targets == 51);
+    assert(fabs(targets[0] - 100) < 1e-12);
+    assert(fabs(targets[50] - 1e-8) < 1e-20);
+    for (k = 0; k < number_of_targets; k++) {
+      if (expected_best_values[i] <= targets[k]) {
+        assert(target_hits[k] > 0);
+        assert(target_hits[k] <= 500 + i);
+      } else {
+        assert(target_hits[k] == 0);
+      }
+      if ((k > 0) && (target_hits[k] > 0))
+        assert(target_hits[k] >= target_hits[k - 1]);
+    }
+
+    /* The last recorded improvement is the best value */
+    trajectory_length = coco_observer_memory_get_trajectory(observer, i, &trajectory_evaluations,
+        &trajectory_values);
+    assert((trajectory_length >= 1) && (trajectory_length <= 3));
+    assert(trajectory_evaluations[0] == 1);
+    for (k = 1; k < trajectory_length; k++) {
+      assert(trajectory_evaluations[k] > trajectory_evaluations[k - 1]);
+      assert(trajectory_values[k] < trajectory_values[k - 1]);
+    }
+    assert(trajectory_values[trajectory_length - 1] == expected_best_values[i]);
+  }
+  assert(strcmp(coco_observer_memory_get_problem_id(observer, 0), "bbob_f001_i01_d02") == 0);
+
+  coco_observer_memory_clear(observer);
+  assert(coco_observer_memory_get_number_of_results(observer) == 0);
+
+  coco_free_memory(expected_best_values);
+  coco_observer_free(observer);
+  assert(!coco_file_exists("test_memory"));
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests that the memory observer records the same target hits of bi-objective problems as the bbob-biobj
+ * observer (both are used within the multi observer, which can also be queried for the memory results).
+ */
+static void test_logger_memory_biobj(void **state) {
+
+  coco_suite_t *suite;
+  coco_observer_t *observer;
+  coco_problem_t *problem;
+  const size_t *target_hits;
+  const double *targets;
+  char path[COCO_PATH_MAX], line[1000];
+  FILE *file;
+  size_t number_of_targets, number_of_lines, i, k;
+  unsigned long evaluation;
+  double value, target;
+
+  suite = coco_suite("bbob-biobj", "instances: 1", "dimensions: 2,5 function_idx: 1");
+  observer = coco_observer("multi", "result_folder: test_memory_biobj observers: bbob-biobj,memory "
+      "log_nondominated: none");
+  while ((problem = coco_suite_get_next_problem(suite, observer)) != NULL) {
+    test_logger_memory_evaluate(problem, 1000, NULL);
+  }
+  coco_suite_free(suite);
+
+  assert(coco_observer_memory_get_number_of_results(observer) == 2);
+  for (i = 0; i < 2; i++) {
+    targets = coco_observer_memory_get_targets(observer, i, &number_of_targets);
+    target_hits = coco_observer_memory_get_target_hits(observer, i, NULL);
+    assert(number_of_targets == 100);
+    assert(target_hits[0] > 0);
+
+    /* The .dat file contains a line for each evaluation in which a target was hit (and some more) */
+    path[0] = '\0';
+    coco_join_path(path, COCO_PATH_MAX, observer->output_folder, "bbob-biobj", "1-separable_1-separable",
+        (i == 0) ? "bbob-biobj_f01_d02_hyp.dat" : "bbob-biobj_f01_d05_hyp.dat", NULL);
+    file = fopen(path, "r");
+    assert(file != NULL);
+    number_of_lines = 0;
+    while (fgets(line, sizeof(line), file) != NULL) {
+      if (sscanf(line, "%lu\t%lf\t%lf", &evaluation, &value, &target) != 3)
+        continue;
+      number_of_lines++;
+      for (k = 0; k < number_of_targets; k++) {
+        if (value <= targets[k])
+          assert((target_hits[k] > 0) && (target_hits[k] <= evaluation));
+        else
+          assert((target_hits[k] == 0) || (target_hits[k] > evaluation));
+      }
+    }
+    fclose(file);
+    assert(number_of_lines > 0);
+  }
+
+  path[0] = '\0';
+  coco_join_path(path, COCO_PATH_MAX, observer->output_folder, NULL);
+  coco_observer_free(observer);
+  coco_remove_directory(path);
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests that the summary of the memory observer aggregates the results of all instances.
+ */
+static void test_logger_memory_summary(void **state) {
+
+  coco_suite_t *suite;
+  coco_observer_t *observer;
+  coco_problem_t *problem;
+  const size_t *target_hits;
+  size_t number_of_targets, number_of_results, i, k, run, evaluations;
+  size_t ert_numerators[4][51], ert_denominators[4][51];
+  unsigned long function, dimension, objectives, runs, total_evaluations, value;
+  char path[COCO_PATH_MAX], line[2000], *output_folder;
+  FILE *file;
+  double ecdf, previous_ecdf;
+  int offset, position;
+
+  suite = coco_suite("bbob", "instances: 1-3", "dimensions: 2,5 function_idx: 1,8");
+  observer = coco_observer("memory", "result_folder: test_memory_summary summary: 1");
+  output_folder = coco_strdup(observer->output_folder);
+  i = 0;
+  while ((problem = coco_suite_get_next_problem(suite, observer)) != NULL) {
+    test_logger_memory_evaluate(problem, 100 * (i++ + 1), NULL);
+  }
+  coco_suite_free(suite);
+  assert(!coco_file_exists(output_folder));
+
+  /* Compute the expected ERT numerators and denominators (the results are ordered by dimension, function
+   * and instance) */
+  number_of_results = coco_observer_memory_get_number_of_results(observer);
+  assert(number_of_results == 12);
+  for (i = 0; i < 4; i++) {
+    for (k = 0; k < 51; k++)
+      ert_numerators[i][k] = ert_denominators[i][k] = 0;
+    for (run = 0; run < 3; run++) {
+      target_hits = coco_observer_memory_get_target_hits(observer, 3 * i + run, &number_of_targets);
+      evaluations = coco_observer_memory_get_evaluations(observer, 3 * i + run);
+      for (k = 0; k < number_of_targets; k++) {
+        ert_numerators[i][k] += (target_hits[k] > 0) ? target_hits[k] : evaluations;
+        ert_denominators[i][k] += (target_hits[k] > 0) ? 1 : 0;
+      }
+    }
+  }
+  coco_observer_free(observer);
+
+  path[0] = '\0';
+  coco_join_path(path, COCO_PATH_MAX, output_folder, "summary.txt", NULL);
+  file = fopen(path, "r");
+  assert(file != NULL);
+  i = 0;
+  while (fgets(line, sizeof(line), file) != NULL) {
+    if (line[0] == '%')
+      continue;
+    assert(sscanf(line, "function = %lu, dimension = %lu, objectives = %lu, runs = %lu, evaluations = %lu",
+        &function, &dimension, &objectives, &runs, &total_evaluations) == 5);
+    assert(function == ((i % 2 == 0) ? 1 : 8));
+    assert(dimension == ((i < 2) ? 2 : 5));
+    assert((objectives == 1) && (runs == 3));
+    assert(total_evaluations == 100 * (9 * i + 6));
+
+    assert(fgets(line, sizeof(line), file) != NULL);
+    assert(strncmp(line, "targets 1.0000e+02", 18) == 0);
+
+    assert(fgets(line, sizeof(line), file) != NULL);
+    assert(strncmp(line, "ert_numerator", 13) == 0);
+    position = 13;
+    for (k = 0; k < 51; k++) {
+      assert(sscanf(line + position, " %lu%n", &value, &offset) == 1);
+      assert(value == ert_numerators[i][k]);
+      position += offset;
+    }
+
+    assert(fgets(line, sizeof(line), file) != NULL);
+    assert(strncmp(line, "ert_denominator", 15) == 0);
+    position = 15;
+    for (k = 0; k < 51; k++) {
+      assert(sscanf(line + position, " %lu%n", &value, &offset) == 1);
+      assert(value == ert_denominators[i][k]);
+      position += offset;
+    }
+
+    /* The ECDF is nondecreasing and reaches at most the fraction of hit targets */
+    assert(fgets(line, sizeof(line), file) != NULL);
+    assert(strncmp(line, "ecdf", 4) == 0);
+    position = 4;
+    previous_ecdf = 0;
+    for (k = 0; sscanf(line + position, " %lf%n", &ecdf, &offset) == 1; k++) {
+      assert(ecdf >= previous_ecdf);
+      previous_ecdf = ecdf;
+      position += offset;
+    }
+    assert(k == 36);
+    evaluations = 0;
+    for (k = 0; k < 51; k++)
+      evaluations += ert_denominators[i][k];
+    assert(fabs(previous_ecdf - (double) evaluations / (3.0 * 51.0)) < 1e-4);
+    i++;
+  }
+  fclose(file);
+  assert(i == 4);
+
+  coco_remove_directory(output_folder);
+  coco_free_memory(output_folder);
+
+  (void)state; /* unused */
+}
+
+static int test_all_logger_memory(void) {
+
+  const struct CMUnitTest tests[] = {
+  cmocka_unit_test(test_logger_memory_single_objective),
+  cmocka_unit_test(test_logger_memory_biobj),
+  cmocka_unit_test(test_logger_memory_summary)
+  };
+
+  return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,96 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include "cmocka.h"
+#include "coco.h"
+
+/**
+ * Runs random search on a small part of the bbob suite observed by the given observer. Returns the name of
+ * the used result folder.
+ */
+static char *test_logger_multi_run(const char *observer_name, const char *result_folder, const char *options) {
+
+  const size_t budget_multiplier = 50;
+  coco_suite_t *suite;
+  coco_observer_t *observer;
+  coco_problem_t *problem, *original_problem;
+  coco_random_state_t *rng;
+  char *observer_options, *output_folder;
+  double *x, y;
+  size_t dimension, i, j;
+
+  observer_options = coco_strdupf("result_folder: %s %s", result_folder, options);
+  suite = coco_suite("bbob", "instances: 1-3", "dimensions: 2,40 function_idx: 1,8");
+  observer = coco_observer(observer_name, observer_options);
+  output_folder = coco_strdup(observer->output_folder);
+
+  while ((problem = coco_suite_get_next_problem(suite, observer)) != NULL) {
+    rng = coco_random_new(12345);
+    dimension = coco_problem_get_dimension(problem);
+    x = coco_allocate_vector(dimension);
+    for (i = 0; i < budget_multiplier * dimension; i++) {
+      for (j = 0; j < dimension; j++) {
+        x[j] = (10.0 * coco_random_uniform(rng) - 5.0) / (double) (i + 1);
+      }
+      coco_evaluate_function(problem, x, &y);
+    }
+
+    if (strcmp(observer_name, "multi") == 0) {
+      /* The multi logger adds a single layer, which wraps the original problem, and each evaluation reaches
+       * the original problem exactly once */
+      original_problem = coco_transformed_get_inner_problem(problem);
+      assert(strcmp(coco_problem_get_id(original_problem), coco_problem_get_id(problem)) == 0);
+      assert(original_problem->evaluate_function != logger_bbob_evaluate);
+      assert(original_problem->evaluate_function != logger_toy_evaluate);
+      assert(coco_problem_get_evaluations(original_problem) == budget_multiplier * dimension);
+    }
+
+    coco_free_memory(x);
+    coco_random_free(rng);
+  }
+
+  coco_observer_free(observer);
+  coco_suite_free(suite);
+  coco_free_memory(observer_options);
+  return output_folder;
+}
+
+/**
+ * Tests that the multi observer produces exactly the same output as the observers it consists of.
+ */
+static void test_logger_multi_output(void **state) {
+
+  char *folder_bbob, *folder_toy, *folder_multi;
+  char path1[COCO_PATH_MAX], path2[COCO_PATH_MAX];
+
+  folder_bbob = test_logger_multi_run("bbob", "test_multi_bbob", "");
+  folder_toy = test_logger_multi_run("toy", "test_multi_toy", "");
+  folder_multi = test_logger_multi_run("multi", "test_multi", "observers: bbob,toy");
+
+  path1[0] = '\0';
+  coco_join_path(path1, COCO_PATH_MAX, folder_multi, "bbob", NULL);
+  test_logger_bbob_compare_results(folder_bbob, path1, 0);
+
+  path1[0] = path2[0] = '\0';
+  coco_join_path(path1, COCO_PATH_MAX, folder_toy, "first_hitting_times.txt", NULL);
+  coco_join_path(path2, COCO_PATH_MAX, folder_multi, "toy", "first_hitting_times.txt", NULL);
+  assert(test_logger_bbob_files_equal(path1, path2));
+
+  coco_remove_directory(folder_bbob);
+  coco_remove_directory(folder_toy);
+  coco_remove_directory(folder_multi);
+  coco_free_memory(folder_bbob);
+  coco_free_memory(folder_toy);
+  coco_free_memory(folder_multi);
+
+  (void)state; /* unused */
+}
+
+static int test_all_logger_multi(void) {
+
+  const struct CMUnitTest tests[] = {
+      cmocka_unit_test(test_logger_multi_output)
+  };
+
+  return cmocka_run_group_tests(tests, NULL, NULL);
+}
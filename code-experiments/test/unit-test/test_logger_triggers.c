@@ -0,0 +1,97 @@
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include "cmocka.h"
+#include "coco.h"
+
+/**
+ * Tests the function logger_evaluation_triggers_always_log.
+ */
+static void test_logger_evaluation_triggers_always_log(void **state) {
+
+  size_t dimensions[6] = { 2, 3, 5, 10, 20, 40 };
+  size_t evals, i, dim;
+  int result;
+  logger_evaluation_triggers_t *triggers;
+
+  for (i = 0; i < 6; i++) {
+    dim = dimensions[i];
+    triggers = logger_evaluation_triggers_always_log(dim);
+    for (evals = 1; evals < 1500; evals++) {
+      result = logger_evaluation_triggers_is_hit(triggers, evals);
+      if ((evals == 1) || (evals == dim) || (evals == 2 * dim) || (evals == 5 * dim))
+        assert(result);
+      else if ((evals == 10 * dim) || (evals == 20 * dim) || (evals == 50 * dim))
+        assert(result);
+      else if ((evals == 100 * dim) || (evals == 200 * dim) || (evals == 500 * dim))
+        assert(result);
+      else
+        assert(!result);
+    }
+    logger_evaluation_triggers_free(triggers);
+  }
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests that logger_evaluation_triggers_bbob contains the evaluation numbers floor(10**(i/nbpts)) and
+ * dim * 10**i as well as the evaluations that are always logged.
+ */
+static void test_logger_evaluation_triggers_bbob(void **state) {
+
+  size_t dimensions[3] = { 2, 7, 40 };
+  size_t evals, i, k, dim;
+  int result, expected;
+  logger_evaluation_triggers_t *triggers;
+
+  for (i = 0; i < 3; i++) {
+    dim = dimensions[i];
+    triggers = logger_evaluation_triggers_bbob(dim, 20);
+    for (evals = 1; evals < 100000; evals++) {
+      expected = (evals == 1);
+      for (k = 0; k < 100; k++) {
+        if (evals == (size_t) floor(pow(10, (double) k / 20.0)))
+          expected = 1;
+      }
+      for (k = 0; k < 8; k++) {
+        if ((evals == dim * (size_t) pow(10, (double) k)) || (evals == 2 * dim * (size_t) pow(10, (double) k))
+            || (evals == 5 * dim * (size_t) pow(10, (double) k)))
+          expected = 1;
+      }
+      result = logger_evaluation_triggers_is_hit(triggers, evals);
+      assert(result == expected);
+    }
+    logger_evaluation_triggers_free(triggers);
+  }
+
+  (void)state; /* unused */
+}
+
+/**
+ * Tests that logger_f_triggers_get returns 10**(i/nbpts) both inside and outside the precomputed range.
+ */
+static void test_logger_f_triggers(void **state) {
+
+  logger_f_triggers_t *triggers;
+  int i;
+
+  triggers = logger_f_triggers(5);
+  for (i = -500; i <= 500; i++) {
+    assert(logger_f_triggers_get(triggers, i) == pow(10, i * 1.0 / 5.0));
+  }
+  logger_f_triggers_free(triggers);
+
+  (void)state; /* unused */
+}
+
+static int test_all_logger_triggers(void) {
+
+  const struct CMUnitTest tests[] = {
+      cmocka_unit_test(test_logger_evaluation_triggers_always_log),
+      cmocka_unit_test(test_logger_evaluation_triggers_bbob),
+      cmocka_unit_test(test_logger_f_triggers)
+  };
+
+  return cmocka_run_group_tests(tests, NULL, NULL);
+}
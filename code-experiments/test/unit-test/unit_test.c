@@ -1,22 +1,38 @@
+/* The amalgamation is included before any system header, so that its platform configuration (see
+ * coco_platform.h) takes effect */
+#include "coco.c"
 #include <stdarg.h>
 #include <stddef.h>
 #include <setjmp.h>
 #include "cmocka.h"
-#include "coco.c"
 #include "coco.h"
 #include <time.h>
 
-#include "test_coco_observer.c"
+#include "test_coco_memory.c"
+#include "test_coco_merge.c"
 #include "test_coco_suite.c"
+#include "test_coco_timing.c"
 #include "test_coco_utilities.c"
+#include "test_logger_bbob.c"
+#include "test_logger_biobj.c"
+#include "test_logger_memory.c"
+#include "test_logger_multi.c"
+#include "test_logger_triggers.c"
 #include "test_mo_generics.c"
 
 static int run_all_tests(void)
 {
   int result = test_all_coco_utilities();
   result += test_all_mo_generics();
-  result += test_all_coco_observer();
   result += test_all_coco_suite();
+  result += test_all_coco_timing();
+  result += test_all_coco_memory();
+  result += test_all_coco_merge();
+  result += test_all_logger_bbob();
+  result += test_all_logger_biobj();
+  result += test_all_logger_memory();
+  result += test_all_logger_multi();
+  result += test_all_logger_triggers();
 
   return result;
 }
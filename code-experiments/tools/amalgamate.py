@@ -34,6 +34,9 @@ class Amalgator:
         if filename in self.included_files:
             return
         self.included_files.append(filename)
+        if filename.endswith('.txt'):
+            self.process_table(filename)
+            return
         with open(filename) as fd:
             line_number = 1
             if not self.release:
@@ -53,6 +56,38 @@ class Amalgator:
                     self.destination_fd.write(line)
                 line_number += 1
 
+    def process_table(self, filename):
+        """Writes the table of best values stored in filename as a C array.
+
+        The file NAME.txt, where NAME is of the form PREFIX_best_values_INDICATOR, contains lines with a
+        problem id and its best value (lines starting with '%' are comments). It is turned into the array
+        NAME of PREFIX_best_value_t elements sorted by problem id, so that the values can be looked up with
+        bsearch() without any parsing at runtime. The including file must define PREFIX_best_value_t as a
+        struct with the fields 'const char *key' and 'double value'.
+        """
+        name = path.splitext(path.basename(filename))[0]
+        if '_best_values_' not in name:
+            raise ValueError("Cannot generate a table from %s" % filename)
+        type_name = name.split('_best_values_')[0] + '_best_value_t'
+        values = {}
+        with open(filename) as fd:
+            for line_number, line in enumerate(fd.readlines(), 1):
+                line = line.strip()
+                if not line or line.startswith('%'):
+                    continue
+                fields = line.split()
+                if len(fields) != 2:
+                    raise ValueError("%s:%i: expected a problem id and a value" % (filename, line_number))
+                if fields[0] in values:
+                    raise ValueError("%s:%i: duplicate problem id %s" % (filename, line_number, fields[0]))
+                float(fields[1])  # Make sure the value is a valid number
+                values[fields[0]] = fields[1]
+        self.destination_fd.write("/* Generated from %s, sorted by problem id */\n" % filename)
+        self.destination_fd.write("static const %s %s[] = {\n" % (type_name, name))
+        self.destination_fd.write(",\n".join('  { "%s", %s }' % (key, values[key])
+                                             for key in sorted(values)))
+        self.destination_fd.write("\n};\n")
+
 def amalgamate(source_files, destination_file, release=False):
     print("AML\t%s -> %s" % (str(source_files), destination_file))
     amalgator = Amalgator(destination_file, release)
@@ -53,6 +53,14 @@ def run_c():
     except subprocess.CalledProcessError:
         sys.exit(-1)
 
+def run_c_timing():
+    """ Builds and runs the timing experiment in C """
+    build_c()
+    try:
+        run('code-experiments/build/c', ['./timing_experiment'])
+    except subprocess.CalledProcessError:
+        sys.exit(-1)
+
 def test_c():
     """ Builds and runs unit tests, integration tests and an example experiment test in C """
     build_c()
@@ -73,6 +81,18 @@ def test_c_unit():
     build_c_unit_tests()
     run_c_unit_tests()
         
+def test_c_unit_threads():
+    """ Builds and runs unit tests in C with the features that run on threads
+        (asynchronous logging and prefetching) and the memory tracking, which
+        needs to be thread-safe for them, compiled in """
+    build_c()
+    os.environ['EXTRA_CCFLAGS'] = '-DCOCO_ASYNC_LOGGING -DCOCO_PREFETCH -DCOCO_MEMORY_TRACKING -pthread'
+    try:
+        build_c_unit_tests()
+    finally:
+        del os.environ['EXTRA_CCFLAGS']
+    run_c_unit_tests()
+
 def test_c_integration():
     """ Builds and runs integration tests in C """
     build_c()
@@ -177,6 +197,89 @@ def leak_check():
                     './test_biobj', 'leak_check']
     run('code-experiments/test/integration-test', valgrind_cmd)
     
+def bench_c(args):
+    """ Builds and runs the microbenchmarks in C and compares their results to
+        a baseline (if given in args together with an optional tolerance) """
+    build_c()
+    build_c_benchmark()
+    run_c_benchmark()
+    if len(args) > 0:
+        tolerance = float(args[1]) if len(args) > 1 else 0.25
+        if not compare_c_benchmark(args[0], 'code-experiments/test/benchmark/benchmark.json', tolerance):
+            sys.exit(-1)
+
+def build_c_benchmark():
+    """ Builds the microbenchmarks in C """
+    copy_file('code-experiments/build/c/coco.c', 'code-experiments/test/benchmark/coco.c')
+    copy_file('code-experiments/src/coco.h', 'code-experiments/test/benchmark/coco.h')
+    make("code-experiments/test/benchmark", "clean")
+    make("code-experiments/test/benchmark", "all")
+
+def run_c_benchmark():
+    """ Runs the microbenchmarks in C with the options given in the environment
+        variable COCO_BENCHMARK_OPTIONS """
+    try:
+        run('code-experiments/test/benchmark',
+            ['./benchmark', os.getenv('COCO_BENCHMARK_OPTIONS', '')])
+    except subprocess.CalledProcessError:
+        sys.exit(-1)
+
+def build_server():
+    """ Builds the evaluation server, its C client and the server benchmark """
+    build_c()
+    copy_file('code-experiments/build/c/coco.c', 'code-experiments/build/server/coco.c')
+    copy_file('code-experiments/src/coco.h', 'code-experiments/build/server/coco.h')
+    make("code-experiments/build/server", "clean")
+    make("code-experiments/build/server", "all")
+
+def bench_server():
+    """ Builds the evaluation server and compares the throughput of evaluations
+        through the server to the one in process """
+    build_server()
+    try:
+        run('code-experiments/build/server', ['./server_benchmark'])
+    except subprocess.CalledProcessError:
+        sys.exit(-1)
+
+def compare_c_benchmark(baseline_file, result_file, tolerance):
+    """ Compares the ns_per_call of the microbenchmark results to the ones of
+        the baseline and returns False if any of them is more than a factor
+        of (1 + tolerance) slower """
+    import json
+    with open(baseline_file) as f:
+        baseline = json.load(f)
+    with open(result_file) as f:
+        result = json.load(f)
+    for key in ['schema', 'schema_version']:
+        if baseline.get(key) != result.get(key):
+            print("ERROR: %s differs (baseline %s, result %s)" %
+                  (key, baseline.get(key), result.get(key)))
+            return False
+    baseline_times = dict((r['id'], r['ns_per_call']) for r in baseline['results'])
+    result_times = dict((r['id'], r['ns_per_call']) for r in result['results'])
+    regressions = []
+    improvements = []
+    for result_id in sorted(set(baseline_times) & set(result_times)):
+        ratio = result_times[result_id] / baseline_times[result_id]
+        if ratio > 1 + tolerance:
+            regressions.append((ratio, result_id))
+        elif ratio < 1 / (1 + tolerance):
+            improvements.append((ratio, result_id))
+    for result_id in sorted(set(baseline_times) - set(result_times)):
+        print("MISSING\t%s" % result_id)
+    for result_id in sorted(set(result_times) - set(baseline_times)):
+        print("NEW\t%s" % result_id)
+    for ratio, result_id in sorted(improvements):
+        print("FASTER\t%s: %.2f x baseline (%.1f ns instead of %.1f ns)" %
+              (result_id, ratio, result_times[result_id], baseline_times[result_id]))
+    for ratio, result_id in sorted(regressions, reverse=True):
+        print("SLOWER\t%s: %.2f x baseline (%.1f ns instead of %.1f ns)" %
+              (result_id, ratio, result_times[result_id], baseline_times[result_id]))
+    print("%d results compared, %d regressions and %d improvements beyond a tolerance of %g" %
+          (len(set(baseline_times) & set(result_times)), len(regressions),
+           len(improvements), tolerance))
+    return len(regressions) == 0
+
 ################################################################################
 ## Python 2
 def install_postprocessing():
@@ -475,6 +578,7 @@ def build_java():
                            'CocoJNI.o'])
     
     run('code-experiments/build/java', ['javac', 'Problem.java'])
+    run('code-experiments/build/java', ['javac', 'Optimizer.java'])
     run('code-experiments/build/java', ['javac', 'Benchmark.java'])
     run('code-experiments/build/java', ['javac', 'Observer.java'])
     run('code-experiments/build/java', ['javac', 'Suite.java'])
@@ -558,9 +662,12 @@ Available commands for users:
   build-python         - Build Python modules
   build-python2        - Build Python 2 modules
   build-python3        - Build Python 3 modules
+  build-server         - Build the evaluation server and its C client, which
+                         serve optimizers without COCO binding (POSIX only)
   install-postprocessing - Install postprocessing (user-locally)
 
   run-c                - Build and run example experiment in C
+  run-c-timing         - Build and run the timing experiment in C
   run-java             - Build and run example experiment in Java
   run-matlab           - Build and run example experiment in MATLAB
   run-matlab-sms       - Build and run SMS-EMOA on bbob-biobj suite in MATLAB
@@ -580,6 +687,8 @@ Available commands for developers:
   test-c               - Build and run unit tests, integration tests 
                          and an example experiment test in C 
   test-c-unit          - Build and run unit tests in C
+  test-c-unit-threads  - Build and run unit tests in C with COCO_ASYNC_LOGGING,
+                         COCO_PREFETCH and COCO_MEMORY_TRACKING (POSIX only)
   test-c-integration   - Build and run integration tests in C
   test-c-example       - Build and run an example experiment test in C 
   test-java            - Build and run a test in Java
@@ -588,6 +697,16 @@ Available commands for developers:
   test-python3         - Build and run minimal test of Python 3 module
   test-postprocessing  - Runs post-processing tests.
   leak-check           - Check for memory leaks in C
+  bench-c              - Build and run the microbenchmarks in C, which write
+                         their results to code-experiments/test/benchmark/
+                         benchmark.json (the benchmark options can be given
+                         in the environment variable COCO_BENCHMARK_OPTIONS)
+                         Takes an optional baseline (a previous results file)
+                         and tolerance (default 0.25) and fails if any result
+                         is more than a factor of (1 + tolerance) slower
+  bench-server         - Build the evaluation server (POSIX only) and compare
+                         the throughput of evaluations through the server to
+                         the one in process
 
 
 To build a release version which does not include debugging information in the 
@@ -609,8 +728,10 @@ def main(args):
     elif cmd == 'build-python': build_python()
     elif cmd == 'build-python2': build_python2()
     elif cmd == 'build-python3': build_python3()
+    elif cmd == 'build-server': build_server()
     elif cmd == 'install-postprocessing': install_postprocessing()
     elif cmd == 'run-c': run_c()
+    elif cmd == 'run-c-timing': run_c_timing()
     elif cmd == 'run-java': run_java()
     elif cmd == 'run-matlab': run_matlab()
     elif cmd == 'run-matlab-sms': run_matlab_sms()
@@ -619,6 +740,7 @@ def main(args):
         run_python(False) if len(args) > 1 and args[1] == 'no-tests' else run_python()
     elif cmd == 'test-c': test_c()
     elif cmd == 'test-c-unit': test_c_unit()
+    elif cmd == 'test-c-unit-threads': test_c_unit_threads()
     elif cmd == 'test-c-integration': test_c_integration()
     elif cmd == 'test-c-example': test_c_example()    
     elif cmd == 'test-java': test_java()
@@ -627,6 +749,8 @@ def main(args):
     elif cmd == 'test-python3': test_python3()
     elif cmd == 'test-postprocessing': test_postprocessing()
     elif cmd == 'leak-check': leak_check()
+    elif cmd == 'bench-c': bench_c(args[1:])
+    elif cmd == 'bench-server': bench_server()
     else: help()
 
 if __name__ == '__main__':